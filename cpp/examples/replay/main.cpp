@@ -0,0 +1,135 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <opendnp3/ConsoleLogger.h>
+#include <opendnp3/decoder/CaptureReplay.h>
+#include <opendnp3/logging/LogLevels.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace opendnp3;
+
+// visits every value so that the cost of decoding the objects is included in the measurement
+class CountingSOEHandler final : public ISOEHandler
+{
+public:
+    void BeginFragment(const ResponseInfo& info) override {}
+    void EndFragment(const ResponseInfo& info) override {}
+
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values) override
+    {
+        Count(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values) override
+    {
+        Count(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values) override
+    {
+        Count(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values) override
+    {
+        Count(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values) override
+    {
+        Count(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values) override
+    {
+        Count(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values) override
+    {
+        Count(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values) override
+    {
+        Count(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values) override
+    {
+        Count(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values) override
+    {
+        Count(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values) override
+    {
+        Count(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<DNPTime>& values) override
+    {
+        Count(values);
+    }
+
+    uint64_t numValues = 0;
+
+private:
+    template<class T> void Count(const ICollection<T>& values)
+    {
+        values.ForeachItem([this](const T&) { ++this->numValues; });
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: replay <capture file> [iterations]" << std::endl;
+        return -1;
+    }
+
+    const uint32_t iterations = (argc > 2) ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 1;
+
+    Logger logger(ConsoleLogger::Create(), ModuleId(), "replay", LogLevels(levels::NORMAL));
+    CountingSOEHandler handler;
+    CaptureReplay replay(handler, logger);
+
+    if (!replay.Load(argv[1]))
+    {
+        return -1;
+    }
+
+    const auto stats = replay.Run(iterations);
+    const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(stats.elapsed).count();
+    const auto seconds = static_cast<double>(micros) / 1000000.0;
+
+    std::cout << "records:      " << stats.numRecords << std::endl;
+    std::cout << "bytes:        " << stats.numBytes << std::endl;
+    std::cout << "link frames:  " << stats.numLinkFrames << std::endl;
+    std::cout << "fragments:    " << stats.numFragments << std::endl;
+    std::cout << "responses:    " << stats.numResponses << std::endl;
+    std::cout << "parse errors: " << stats.numParseErrors << std::endl;
+    std::cout << "values:       " << handler.numValues << std::endl;
+    std::cout << "elapsed (us): " << micros << std::endl;
+
+    if (seconds > 0)
+    {
+        std::cout << "frames/sec:   " << static_cast<uint64_t>(stats.numLinkFrames / seconds) << std::endl;
+        std::cout << "values/sec:   " << static_cast<uint64_t>(handler.numValues / seconds) << std::endl;
+    }
+
+    return 0;
+}
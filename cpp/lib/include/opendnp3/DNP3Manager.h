@@ -39,6 +39,7 @@
 
 #include <memory>
 #include <system_error>
+#include <utility>
 #include <vector>
 
 namespace opendnp3
@@ -74,6 +75,41 @@ public:
      */
     void Shutdown();
 
+    /**
+     * Limit how many TCP and TLS client connection attempts can be in progress at once across all channels
+     *
+     * Attempts beyond the limit are queued and started in order of ChannelRetry::connectPriority, so
+     * that a network outage doesn't cause every channel to reconnect at the same time. A TLS attempt holds
+     * its slot until the handshake completes. Server listeners accepting connections are not limited.
+     *
+     * @param maxInFlight Maximum number of connection attempts in progress, 0 (the default) means no limit
+     */
+    void SetMaxConnectsInFlight(uint32_t maxInFlight);
+
+    /**
+     * Limit how many full TLS handshakes can be in progress at once across all channels and listeners
+     *
+     * Full handshakes are CPU intensive and run on the same threads as established channels. Handshakes beyond the
+     * limit wait for a slot, so that a burst of new connections cannot starve existing ones. Clients resuming a
+     * cached session are not limited.
+     *
+     * @param maxInProgress Maximum number of full handshakes in progress, 0 (the default) means no limit
+     */
+    void SetMaxConcurrentHandshakes(uint32_t maxInProgress);
+
+    /**
+     * Reload the certificates, private keys and CA files of every TLS configuration in use from disk
+     *
+     * Channels and listeners that share a TLSConfig share a single loaded SSL context. After a reload, new
+     * connections use the updated files while established connections are unaffected. Cached client sessions are
+     * discarded so that every new connection is verified against the updated files. Use this to rotate
+     * certificates without recreating channels.
+     *
+     * @throw DNP3Error if the library was compiled without TLS support, or if any configuration failed to load, in
+     * which case that configuration keeps using the previously loaded files
+     */
+    void ReloadTLSConfigs();
+
     /**
      * Add a persistent TCP client channel. Automatically attempts to reconnect.
      *
@@ -165,6 +201,26 @@ public:
                                         SerialSettings settings,
                                         std::shared_ptr<IChannelListener> listener) const;
 
+    /**
+     * Add a pair of in-memory channels connected back-to-back
+     *
+     * Bytes written to one channel are read by the other through a fixed size ring buffer, without
+     * any sockets or per-message allocations. Useful for running many master/outstation pairs
+     * within a single process, e.g. for simulation and testing.
+     *
+     * @param id Alias that will be used for logging purposes. The channels are named "<id>-a" and "<id>-b"
+     * @param levels Bitfield that describes the logging level for both channels and associated sessions
+     * @param firstListener optional callback interface (can be nullptr) for info about the first channel
+     * @param secondListener optional callback interface (can be nullptr) for info about the second channel
+     * @throw DNP3Error if the manager was already shutdown
+     * @return pair of shared_ptr to the two channel interfaces
+     */
+    std::pair<std::shared_ptr<IChannel>, std::shared_ptr<IChannel>> AddLoopbackPair(
+        const std::string& id,
+        const opendnp3::LogLevels& levels,
+        std::shared_ptr<IChannelListener> firstListener,
+        std::shared_ptr<IChannelListener> secondListener) const;
+
     /**
      * Add a TLS client channel
      *
@@ -32,7 +32,9 @@ enum class Error : int
 {
     SHUTTING_DOWN,
     NO_TLS_SUPPORT,
-    UNABLE_TO_BIND_SERVER
+    UNABLE_TO_BIND_SERVER,
+    UNABLE_TO_LOAD_TLS_CONFIG,
+    UNABLE_TO_MAP_POINT_CACHE
 };
 
 struct ErrorSpec
@@ -47,6 +49,10 @@ struct ErrorSpec
             return "Not built with TLS support";
         case Error::UNABLE_TO_BIND_SERVER:
             return "Unable to bind server to the specified port";
+        case Error::UNABLE_TO_LOAD_TLS_CONFIG:
+            return "Unable to load the certificates or keys of a TLS configuration";
+        case Error::UNABLE_TO_MAP_POINT_CACHE:
+            return "Unable to map the file backing a point cache";
         default:
             return "unknown error";
         };
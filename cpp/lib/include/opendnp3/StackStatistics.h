@@ -20,6 +20,8 @@
 #ifndef OPENDNP3_STACKSTATISTICS_H
 #define OPENDNP3_STACKSTATISTICS_H
 
+#include "opendnp3/util/LatencyHistogram.h"
+
 #include <cstdint>
 
 namespace opendnp3
@@ -78,12 +80,38 @@ struct StackStatistics
         Tx tx;
     };
 
+    /**
+     * Latency of each processing stage. Only populated when latency tracing is
+     * enabled in the MasterParams or OutstationParams of the stack.
+     */
+    struct Latency
+    {
+        /// outstation: update applied to the database until the event is selected for a response
+        LatencyHistogram updateToSelected;
+
+        /// outstation: start of event selection until the response fragment is handed to the transport layer
+        LatencyHistogram selectedToQueued;
+
+        /// fragment handed to the transport layer until its first frame is written to the link layer
+        LatencyHistogram queuedToFirstFrame;
+
+        /// first segment of a fragment received until the fragment is reassembled
+        LatencyHistogram firstSegmentToFragment;
+
+        /// master: fragment reassembled until the application header is parsed
+        LatencyHistogram fragmentToParsed;
+
+        /// master: header parsed until the fragment is processed and measurements are dispatched to the ISOEHandler
+        LatencyHistogram parsedToDispatched;
+    };
+
     StackStatistics() = default;
 
     StackStatistics(const Link& link, const Transport& transport) : link(link), transport(transport) {}
 
     Link link;
     Transport transport;
+    Latency latency;
 };
 
 } // namespace opendnp3
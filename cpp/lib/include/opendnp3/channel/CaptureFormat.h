@@ -0,0 +1,44 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_CAPTUREFORMAT_H
+#define OPENDNP3_CAPTUREFORMAT_H
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+ * File format used when capturing the raw traffic of a channel
+ *
+ * Both formats store one record per socket read/write using LINKTYPE_USER0 (147). Configure Wireshark
+ * to decode DLT User 0 with the "dnp3.udp" dissector to inspect the frames.
+ */
+enum class CaptureFormat : uint8_t
+{
+    /// classic libpcap format, only received data is recorded since the format cannot express direction
+    PCAP,
+    /// pcapng format, records both directions and marks each packet as inbound or outbound
+    PCAPNG
+};
+
+} // namespace opendnp3
+
+#endif
@@ -23,6 +23,8 @@
 #include "opendnp3/channel/IOpenDelayStrategy.h"
 #include "opendnp3/util/TimeDuration.h"
 
+#include <cstdint>
+
 namespace opendnp3
 {
 
@@ -52,6 +54,8 @@ public:
     TimeDuration maxOpenRetry;
     /// reconnect delay (defaults to zero)
     TimeDuration reconnectDelay;
+    /// priority of the channel when the manager limits concurrent connection attempts, higher values connect first
+    uint8_t connectPriority = 0;
 
     TimeDuration NextDelay(const TimeDuration& current) const;
 
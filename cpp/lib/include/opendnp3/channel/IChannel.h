@@ -21,11 +21,13 @@
 #define OPENDNP3_ICHANNEL_H
 
 #include "opendnp3/IResource.h"
+#include "opendnp3/channel/CaptureFormat.h"
 #include "opendnp3/gen/ChannelState.h"
 #include "opendnp3/link/LinkStatistics.h"
 #include "opendnp3/logging/LogLevels.h"
 #include "opendnp3/master/IMaster.h"
 #include "opendnp3/master/IMasterApplication.h"
+#include "opendnp3/master/MasterSchedulerConfig.h"
 #include "opendnp3/master/ISOEHandler.h"
 #include "opendnp3/master/MasterStackConfig.h"
 #include "opendnp3/outstation/ICommandHandler.h"
@@ -92,8 +94,31 @@ public:
                                                        const OutstationStackConfig& config)
         = 0;
 
+    /**
+     * Change how the masters on this channel share it when running tasks
+     *
+     * @param config Configuration object that controls task concurrency across the channel
+     */
+    virtual void SetMasterSchedulerConfig(const MasterSchedulerConfig& config) = 0;
+
     virtual void AddStatisticsHandler(const StatisticsChangeHandler_t& statisticsChangeHandler) = 0;
     virtual void RemoveStatisticsHandler() = 0;
+
+    /**
+     * Record the raw bytes of every read and write on the channel to a capture file
+     *
+     * Starting a new capture replaces any capture already in progress.
+     *
+     * @param path Path of the file to create, an existing file is overwritten
+     * @param format File format of the capture
+     * @return true if the file was created and the capture started
+     */
+    virtual bool StartCapture(const std::string& path, CaptureFormat format) = 0;
+
+    /**
+     * Stop recording and close the capture file
+     */
+    virtual void StopCapture() = 0;
 };
 
 } // namespace opendnp3
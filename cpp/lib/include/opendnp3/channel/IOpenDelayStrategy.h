@@ -23,6 +23,10 @@
 #include "opendnp3/util/TimeDuration.h"
 #include "opendnp3/util/Uncopyable.h"
 
+#include <cstdint>
+#include <mutex>
+#include <random>
+
 namespace opendnp3
 {
 
@@ -54,6 +58,37 @@ public:
     TimeDuration GetNextDelay(const TimeDuration& current, const TimeDuration& max) const final;
 };
 
+/**
+ * Implements IOpenDelayStrategy using decorrelated jitter.
+ *
+ * Each delay is picked at random between a base value and 3x the previous delay, capped at the maximum. Channels
+ * that fail at the same time spread their retries out instead of reconnecting in lockstep.
+ */
+class DecorrelatedJitterStrategy final : public IOpenDelayStrategy, private Uncopyable
+{
+    static DecorrelatedJitterStrategy instance;
+
+public:
+    /**
+     * @param base lower bound of every delay
+     * @param seed seed of the random number generator
+     */
+    explicit DecorrelatedJitterStrategy(const TimeDuration& base = TimeDuration::Seconds(1),
+                                        uint32_t seed = std::random_device()());
+
+    /// Shared instance with a base of 1 second
+    static IOpenDelayStrategy& Instance();
+
+    TimeDuration GetNextDelay(const TimeDuration& current, const TimeDuration& max) const final;
+
+private:
+    const TimeDuration base;
+
+    // the strategy is shared between channels running on different threads
+    mutable std::mutex mutex;
+    mutable std::mt19937 generator;
+};
+
 } // namespace opendnp3
 
 #endif
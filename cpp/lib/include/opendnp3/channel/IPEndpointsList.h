@@ -43,6 +43,10 @@ public:
     ~IPEndpointsList() = default;
 
     const IPEndpoint& GetCurrentEndpoint() const;
+    const std::vector<IPEndpoint>& GetEndpoints() const;
+    size_t GetCurrentIndex() const;
+    // make the endpoint at index the current one, ignored if out of range
+    void SetCurrentIndex(size_t index);
     bool Next();
     void Reset();
 
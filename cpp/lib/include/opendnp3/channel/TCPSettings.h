@@ -15,13 +15,15 @@ namespace opendnp3
         bool ForceKeepAlive{ false }; // Force enable keep-alive packets send
         std::chrono::seconds KeepIdle{ 0 }; // Idle timeout in seconds before keep-alive packets send
         std::chrono::seconds KeepIntvl{ 0 }; // Keep-alive packets send interval in seconds
+        std::chrono::milliseconds ConnectionRaceDelay{ 0 }; // Stagger between parallel connects to each endpoint, 0 tries them one at a time
 
         friend bool operator==(const TCPSettings& lhs, const TCPSettings& rhs)
         {
             return lhs.Endpoints == rhs.Endpoints
                 && lhs.ForceKeepAlive == rhs.ForceKeepAlive
                 && lhs.KeepIdle == rhs.KeepIdle
-                && lhs.KeepIntvl == rhs.KeepIntvl;
+                && lhs.KeepIntvl == rhs.KeepIntvl
+                && lhs.ConnectionRaceDelay == rhs.ConnectionRaceDelay;
         }
 
         friend bool operator!=(const TCPSettings& lhs, const TCPSettings& rhs)
@@ -36,6 +38,7 @@ namespace opendnp3
                 << " ForceKeepAlive: " << obj.ForceKeepAlive
                 << " KeepIdle: " << obj.KeepIdle.count()
                 << " KeepIntvl: " << obj.KeepIntvl.count()
+                << " ConnectionRaceDelay: " << obj.ConnectionRaceDelay.count()
             ;
         }
     };
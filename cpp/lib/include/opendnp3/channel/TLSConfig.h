@@ -22,6 +22,9 @@
 #define OPENDNP3_TLS_CONFIG_H
 
 #include "opendnp3/channel/IPEndpointsList.h"
+#include "opendnp3/util/TimeDuration.h"
+
+#include <cstdint>
 #include <string>
 
 namespace opendnp3
@@ -97,6 +100,18 @@ struct TLSConfig
 
     IPEndpointsList hosts;
 
+    /// Allow abbreviated handshakes that resume a previous session via session tickets or session IDs (default
+    /// false). Clients look up sessions in a cache shared by all the channels of the manager, keyed by endpoint and
+    /// this configuration. The peer certificate is not re-verified when a session is resumed, so the cache is
+    /// cleared when the manager reloads its TLS configurations.
+    bool enableSessionResumption = false;
+
+    /// How long a session may be resumed after it was established
+    TimeDuration sessionLifetime = TimeDuration::Minutes(5);
+
+    /// Maximum number of sessions a server keeps for resumption by session ID
+    uint32_t maxCachedSessions = 1024;
+
     friend bool operator==(const TLSConfig& lhs, const TLSConfig& rhs)
     {
         return lhs.peerCertFilePath == rhs.peerCertFilePath
@@ -106,7 +121,10 @@ struct TLSConfig
             && lhs.allowTLSv11 == rhs.allowTLSv11
             && lhs.allowTLSv12 == rhs.allowTLSv12
             && lhs.allowTLSv13 == rhs.allowTLSv13
-            && lhs.cipherList == rhs.cipherList;
+            && lhs.cipherList == rhs.cipherList
+            && lhs.enableSessionResumption == rhs.enableSessionResumption
+            && lhs.sessionLifetime == rhs.sessionLifetime
+            && lhs.maxCachedSessions == rhs.maxCachedSessions;
     }
 
     friend bool operator!=(const TLSConfig& lhs, const TLSConfig& rhs)
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_CAPTUREREPLAY_H
+#define OPENDNP3_CAPTUREREPLAY_H
+
+#include "opendnp3/logging/Logger.h"
+#include "opendnp3/master/ISOEHandler.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace opendnp3
+{
+
+class CaptureReplayImpl;
+
+/// Counters produced by a replay run
+struct ReplayStatistics
+{
+    /// number of received records processed
+    uint64_t numRecords = 0;
+    /// number of received bytes processed
+    uint64_t numBytes = 0;
+    /// number of valid link frames parsed
+    uint64_t numLinkFrames = 0;
+    /// number of complete application fragments reassembled
+    uint64_t numFragments = 0;
+    /// number of response fragments delivered to the ISOEHandler
+    uint64_t numResponses = 0;
+    /// number of response fragments that failed to parse
+    uint64_t numParseErrors = 0;
+    /// wall clock time spent processing
+    std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::duration::zero();
+};
+
+/**
+ * Replays the received traffic of a pcap/pcapng capture through the master receive path
+ *
+ * Data flows through the same LinkLayerParser -> TransportRx -> MeasurementHandler pipeline
+ * that a master channel uses, but without an executor or timers, so the whole capture is
+ * processed as fast as possible. Useful for profiling parsing and ISOEHandler code offline.
+ */
+class CaptureReplay
+{
+public:
+    CaptureReplay(ISOEHandler& handler, const Logger& logger, uint32_t maxRxFragSize = 2048);
+    ~CaptureReplay();
+
+    /**
+     * Load a capture file produced by IChannel::StartCapture() or any pcap/pcapng file
+     * containing raw DNP3 link layer data
+     *
+     * @return true if the file was loaded successfully
+     */
+    bool Load(const std::string& path);
+
+    /**
+     * Process all of the received records in the loaded capture
+     *
+     * @param iterations number of times to replay the capture
+     * @return statistics accumulated over all iterations
+     */
+    ReplayStatistics Run(uint32_t iterations = 1);
+
+private:
+    CaptureReplayImpl* impl;
+};
+
+} // namespace opendnp3
+
+#endif
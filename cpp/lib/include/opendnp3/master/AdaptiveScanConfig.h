@@ -0,0 +1,63 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_ADAPTIVESCANCONFIG_H
+#define OPENDNP3_ADAPTIVESCANCONFIG_H
+
+#include "opendnp3/util/TimeDuration.h"
+
+namespace opendnp3
+{
+
+/**
+ * Bounds and factors for a periodic scan whose period adapts to how busy the outstation and the channel are
+ *
+ * After each successful scan the period is stretched if the scan returned no measurements, or if the response was
+ * slow or the scan had to wait for the channel. It is shortened if the scan returned measurements or the outstation
+ * still reports events in its IIN class bits. The period always stays within [minPeriod, maxPeriod].
+ */
+struct AdaptiveScanConfig
+{
+    /// Default constructor
+    AdaptiveScanConfig() {}
+
+    AdaptiveScanConfig(TimeDuration minPeriod, TimeDuration maxPeriod) : minPeriod(minPeriod), maxPeriod(maxPeriod) {}
+
+    /// Shortest period the scan runs at
+    TimeDuration minPeriod = TimeDuration::Seconds(1);
+
+    /// Longest period the scan stretches to
+    TimeDuration maxPeriod = TimeDuration::Minutes(1);
+
+    /// The period is multiplied by this factor when the scan is quiet or the channel is congested
+    double stretchFactor = 2.0;
+
+    /// The period is multiplied by this factor when the scan yields measurements or events are pending
+    double shrinkFactor = 0.5;
+
+    /// Responses taking at least this long indicate a congested channel, zero disables the check
+    TimeDuration slowResponse = TimeDuration::Zero();
+
+    /// Scans that waited at least this long for the channel indicate a congested channel, zero disables the check
+    TimeDuration congestedQueueWait = TimeDuration::Zero();
+};
+
+} // namespace opendnp3
+
+#endif
@@ -35,6 +35,7 @@
 #include "opendnp3/master/ISOEHandler.h"
 #include "opendnp3/master/RestartOperationResult.h"
 #include "opendnp3/master/TaskConfig.h"
+#include "opendnp3/master/TaskStatistics.h"
 #include "opendnp3/util/TimeDuration.h"
 
 #include <memory>
@@ -57,6 +58,13 @@ public:
      */
     virtual void SetLogFilters(const opendnp3::LogLevels& filters) = 0;
 
+    /**
+     * Synchronously read the per-task-type execution statistics of the master
+     *
+     * @return a snapshot of the statistics for every task type that has been started at least once
+     */
+    virtual MasterTaskStatistics GetTaskStatistics() = 0;
+
     /**
      * Add a recurring user-defined scan from a vector of headers
      * @ return A proxy class used to manipulate the scan
@@ -97,6 +97,9 @@ struct MasterParams
 
     /// if false, content will be appended to files
     bool shouldOverrideFiles = true;
+
+    /// If true, the time spent in each receive stage is recorded in StackStatistics::latency
+    bool traceLatency = false;
 };
 
 } // namespace opendnp3
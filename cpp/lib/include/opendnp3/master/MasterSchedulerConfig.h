@@ -0,0 +1,56 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_MASTERSCHEDULERCONFIG_H
+#define OPENDNP3_MASTERSCHEDULERCONFIG_H
+
+#include "opendnp3/util/TimeDuration.h"
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+Controls how the masters bound to a channel share it when running tasks
+*/
+struct MasterSchedulerConfig
+{
+    /// Default constructor
+    MasterSchedulerConfig() {}
+
+    /// If true, each master on a full-duplex channel (TCP, TLS, UDP) may have a task in flight at the same time as
+    /// the other masters on the channel. Serial channels always run a single task at a time across all masters.
+    bool concurrentTasksPerMaster = false;
+
+    /// Maximum number of tasks in flight across the channel when concurrentTasksPerMaster is enabled.
+    /// A value of 0 means one task per master without any channel-wide limit.
+    uint16_t maxConcurrentTasks = 0;
+
+    /// When a recurring poll (AddScan, AddClassScan, AddRangeScan, ...) of a master falls due, other recurring polls of
+    /// the same master that use the same ISOEHandler and fall due within this window are merged into the same READ
+    /// request, as long as the request fits in maxTxFragSize. The handler receives the combined response once.
+    /// Polls with different handlers are never merged, so a handler only sees the data it asked for.
+    /// Zero (the default) disables merging.
+    TimeDuration pollMergeWindow = TimeDuration::Zero();
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,178 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_POINTCACHE_H
+#define OPENDNP3_POINTCACHE_H
+
+#include "opendnp3/master/ISOEHandler.h"
+#include "opendnp3/master/PointCacheConfig.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace opendnp3
+{
+
+class MappedRegion;
+
+enum class PointCacheType : uint8_t
+{
+    Binary = 0,
+    DoubleBitBinary = 1,
+    Analog = 2,
+    Counter = 3,
+    FrozenCounter = 4,
+    BinaryOutputStatus = 5,
+    AnalogOutputStatus = 6
+};
+
+static const uint8_t NUM_POINT_CACHE_TYPES = 7;
+
+/**
+ * Copy of one cached point
+ */
+struct CachedPoint
+{
+    PointCacheType type = PointCacheType::Binary;
+    uint16_t index = 0;
+    /// value converted to double, binaries are 0/1 and double-bit binaries hold the DoubleBit enum value
+    double value = 0;
+    uint8_t flags = 0;
+    /// time of the last change in milliseconds since the epoch
+    uint64_t time = 0;
+    /// sequence number of the last change, 0 if the point was never received
+    uint64_t changeSequence = 0;
+};
+
+/**
+ * Layout of the region that holds the columns of a PointCache
+ *
+ * Each point type has four columns of 'count' entries located at byte offsets from the start of the region:
+ * change sequences (uint64_t), change times (uint64_t), values ('valueSize' bytes each) and flags (uint8_t).
+ * Values are stored as uint8_t for binaries and double-bit binaries, uint32_t for counters and double for analogs.
+ *
+ * Readers that access the columns directly, e.g. through the mapped file from another process, read 'writeCount'
+ * before and after copying the data and retry if it was odd or changed.
+ */
+struct PointCacheLayout
+{
+    static const uint32_t MAGIC = 0x43504E44; // "DNPC" in little endian
+    static const uint32_t VERSION = 1;
+
+    struct Table
+    {
+        uint32_t count;
+        uint32_t valueSize;
+        uint64_t changesOffset;
+        uint64_t timesOffset;
+        uint64_t valuesOffset;
+        uint64_t flagsOffset;
+    };
+
+    uint32_t magic;
+    uint32_t version;
+    /// incremented before and after every update, odd while an update is in progress
+    std::atomic<uint64_t> writeCount;
+    /// sequence number of the most recent change
+    uint64_t lastChange;
+    Table tables[NUM_POINT_CACHE_TYPES];
+};
+
+/**
+ * Keeps the latest value, flags and change time of every point of an outstation in per-type columns
+ *
+ * The cache is an ISOEHandler: pass it to AddMaster in place of the application handler, which it forwards every
+ * callback to. Only the point types in PointCacheType are cached, everything else is just forwarded.
+ *
+ * Each point records the sequence number of its last change. Incremental consumers keep the value returned by
+ * ForEachChange and pass it to the next call to only visit what changed in between.
+ */
+class PointCache final : public ISOEHandler
+{
+
+public:
+    /**
+     * Create a cache
+     *
+     * @param config number of points per type and optional file backing
+     * @param next optional handler that every callback is forwarded to
+     * @throw DNP3Error if the file could not be mapped
+     */
+    static std::shared_ptr<PointCache> Create(const PointCacheConfig& config,
+                                              std::shared_ptr<ISOEHandler> next = nullptr);
+
+    PointCache(const PointCacheConfig& config, std::shared_ptr<ISOEHandler> next);
+
+    ~PointCache();
+
+    /**
+     * Copy a single point
+     *
+     * @return false if the index is beyond the configured count of the type
+     */
+    bool Get(PointCacheType type, uint16_t index, CachedPoint& point) const;
+
+    /**
+     * Visit every point that changed after the given sequence number, in order of type and index
+     *
+     * @param since 0 to visit every point received so far, otherwise the value returned by a previous call
+     * @return the sequence number of the most recent change
+     */
+    uint64_t ForEachChange(uint64_t since, const std::function<void(const CachedPoint&)>& visitor) const;
+
+    /// Sequence number of the most recent change
+    uint64_t GetLastChange() const;
+
+    /// Direct access to the columns, see PointCacheLayout for how to read them consistently
+    const PointCacheLayout& GetLayout() const;
+
+    void BeginFragment(const ResponseInfo& info) override;
+    void EndFragment(const ResponseInfo& info) override;
+
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<DNPTime>& values) override;
+
+private:
+    template<class T> void Update(const ICollection<Indexed<T>>& values);
+
+    void Read(PointCacheType type, uint16_t index, CachedPoint& point) const;
+
+    PointCacheLayout& Layout() const;
+
+    const std::shared_ptr<ISOEHandler> next;
+    std::unique_ptr<MappedRegion> region;
+    mutable std::mutex mutex;
+};
+
+} // namespace opendnp3
+
+#endif
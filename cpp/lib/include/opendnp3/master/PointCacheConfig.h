@@ -0,0 +1,54 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_POINTCACHECONFIG_H
+#define OPENDNP3_POINTCACHECONFIG_H
+
+#include <cstdint>
+#include <string>
+
+namespace opendnp3
+{
+
+/**
+ * Number of points of each type held by a PointCache and where its columns are stored
+ *
+ * Values with an index at or beyond the configured count of their type are not cached.
+ */
+struct PointCacheConfig
+{
+    /// Default constructor
+    PointCacheConfig() {}
+
+    uint16_t numBinary = 0;
+    uint16_t numDoubleBinary = 0;
+    uint16_t numAnalog = 0;
+    uint16_t numCounter = 0;
+    uint16_t numFrozenCounter = 0;
+    uint16_t numBinaryOutputStatus = 0;
+    uint16_t numAnalogOutputStatus = 0;
+
+    /// If set, the columns are kept in a shared memory mapping of this file so that other processes can read them.
+    /// The file is created or truncated to size. If empty, the columns are kept in process memory.
+    std::string mappedFilePath;
+};
+
+} // namespace opendnp3
+
+#endif
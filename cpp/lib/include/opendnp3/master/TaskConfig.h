@@ -20,6 +20,7 @@
 #ifndef OPENDNP3_TASKCONFIG_H
 #define OPENDNP3_TASKCONFIG_H
 
+#include "opendnp3/master/AdaptiveScanConfig.h"
 #include "opendnp3/master/ITaskCallback.h"
 #include "opendnp3/master/TaskId.h"
 
@@ -68,6 +69,9 @@ public:
     std::shared_ptr<ITaskCallback> pCallback;
     bool canUseBackupChannel{ true };
     boost::optional<std::string> taskName;
+
+    /// If set, a periodic scan adapts its period within these bounds instead of running at a fixed period
+    boost::optional<AdaptiveScanConfig> adaptiveScan;
 };
 
 } // namespace opendnp3
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_TASKSTATISTICS_H
+#define OPENDNP3_TASKSTATISTICS_H
+
+#include "opendnp3/gen/MasterTaskType.h"
+#include "opendnp3/util/LatencyHistogram.h"
+
+#include <cstdint>
+#include <map>
+
+namespace opendnp3
+{
+
+/**
+ * Counters and latency distributions accumulated for every execution of one type of master task
+ */
+struct TaskStatistics
+{
+    /// number of times the task was started
+    uint64_t numStarted = 0;
+
+    /// number of executions that completed successfully
+    uint64_t numSucceeded = 0;
+
+    /// number of executions that completed with any failure
+    uint64_t numFailed = 0;
+
+    /// number of response timeouts that were retried rather than failing the task
+    uint64_t numRetries = 0;
+
+    /// number of response fragments processed by the task
+    uint64_t numResponses = 0;
+
+    /// number of APDU bytes received in response fragments, including the response header
+    uint64_t numBytesRx = 0;
+
+    /// number of measurement values parsed from responses
+    uint64_t numObjects = 0;
+
+    /// time from the task becoming runnable until it was started by the scheduler
+    LatencyHistogram queueWait;
+
+    /// time from the task starting until the first response fragment was processed
+    LatencyHistogram requestToFirstResponse;
+
+    /// time from the task starting until it completed
+    LatencyHistogram duration;
+};
+
+/**
+ * Task statistics of a master keyed by task type
+ */
+using MasterTaskStatistics = std::map<MasterTaskType, TaskStatistics>;
+
+} // namespace opendnp3
+
+#endif
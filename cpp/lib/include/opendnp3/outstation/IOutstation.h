@@ -22,8 +22,11 @@
 
 #include "opendnp3/IStack.h"
 #include "opendnp3/logging/LogLevels.h"
+#include "opendnp3/outstation/IUpdateHandler.h"
 #include "opendnp3/outstation/Updates.h"
 
+#include <functional>
+
 namespace opendnp3
 {
 
@@ -51,6 +54,28 @@ public:
      * Apply a set of measurement updates to the outstation
      */
     virtual void Apply(const Updates& updates) = 0;
+
+    /**
+     * Handler that any number of threads can write measurement updates into without allocating
+     *
+     * Updates are queued in a ring of OutstationParams::updateQueueSize entries and applied in one batch on the
+     * outstation's strand. The methods return false if the ring is full, while a batch passed to UpdateBatch is
+     * being applied with Apply, or for octet strings, which must be written with Apply instead. The handler is valid
+     * for the lifetime of the outstation.
+     */
+    virtual IUpdateHandler& GetUpdateChannel() = 0;
+
+    /**
+     * Apply a batch of updates in order, after every update already written to the update channel
+     *
+     * If the update channel has room for the whole batch, the writer fills it without allocating. Otherwise the
+     * writer fills an UpdateBuilder that is applied like Apply, and the update channel rejects writes until the
+     * batch has been applied. A batch is never split between the two.
+     *
+     * @param count the number of updates the writer makes, any more are rejected by the channel
+     * @param writer invoked once on the calling thread with the handler to write the batch into
+     */
+    virtual void UpdateBatch(size_t count, const std::function<void(IUpdateHandler&)>& writer) = 0;
 };
 
 } // namespace opendnp3
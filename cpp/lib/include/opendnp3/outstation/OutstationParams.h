@@ -23,6 +23,7 @@
 #include "opendnp3/app/AppConstants.h"
 #include "opendnp3/app/ClassField.h"
 #include "opendnp3/outstation/NumRetries.h"
+#include "opendnp3/outstation/StaticPacking.h"
 #include "opendnp3/outstation/StaticTypeBitfield.h"
 #include "opendnp3/util/TimeDuration.h"
 
@@ -85,6 +86,20 @@ struct OutstationParams
 
     /// if false, function code REMOVE_FILE not supported
     bool permitDeleteFiles = true;
+
+    /// If true, the time spent from database update to transmission is recorded in StackStatistics::latency
+    bool traceLatency = false;
+
+    /// Number of updates the channel returned by IOutstation::GetUpdateChannel can hold, rounded up to a power of two
+    uint32_t updateQueueSize = 1024;
+
+    /// If true, event headers use 1-byte count and index prefixes when every index in the header fits, and timed
+    /// binary/double-bit events reported in their default variation are sent as g2v3/g4v3 behind a g51 CTO.
+    /// Saves bytes on slow links, but every master in use must support these encodings.
+    bool compactEventEncoding = false;
+
+    /// How static data is laid out in responses, the default reproduces the historical start-stop ranges
+    StaticPacking staticPacking = StaticPacking::Ranges;
 };
 
 } // namespace opendnp3
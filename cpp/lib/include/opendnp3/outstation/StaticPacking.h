@@ -0,0 +1,45 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_STATICPACKING_H
+#define OPENDNP3_STATICPACKING_H
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+ * How the outstation lays out static data (class 0 and static reads) in response fragments
+ */
+enum class StaticPacking : uint8_t
+{
+    /// one start-stop header per contiguous run of indices with the same variation
+    Ranges,
+    /// per type, choose the mix of start-stop and index-prefixed (0x17/0x28) headers that uses the fewest bytes
+    Optimized,
+    /// like Optimized, but small gaps between indices that don't exist in the database may be bridged by a
+    /// start-stop header. The missing indices are reported as padding points carrying the RESTART flag, so only
+    /// use this with masters that ignore points they are not configured for
+    OptimizedWithPadding
+};
+
+} // namespace opendnp3
+
+#endif
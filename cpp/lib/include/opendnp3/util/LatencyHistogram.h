@@ -0,0 +1,75 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_LATENCYHISTOGRAM_H
+#define OPENDNP3_LATENCYHISTOGRAM_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+ *  Fixed-bucket histogram of latency samples with microsecond resolution
+ *
+ *  Bucket 0 counts samples below 1us and bucket N counts samples in [2^(N-1), 2^N) microseconds.
+ *  The last bucket also absorbs every sample above its lower bound.
+ */
+class LatencyHistogram
+{
+public:
+    static const uint8_t NUM_BUCKETS = 32;
+
+    void Record(std::chrono::steady_clock::duration latency);
+
+    /// Exclusive upper bound of a bucket in microseconds
+    static uint64_t UpperBoundMicros(uint8_t bucket);
+
+    /// Mean of all samples in microseconds, 0 if empty
+    uint64_t MeanMicros() const;
+
+    /**
+     *  Estimate a percentile from the bucket counts
+     *
+     *  @param percentile value in the range [0, 100]
+     *  @return upper bound in microseconds of the bucket containing the percentile, 0 if empty
+     */
+    uint64_t PercentileMicros(double percentile) const;
+
+    /// number of samples recorded
+    uint64_t count = 0;
+
+    /// sum of all samples in microseconds
+    uint64_t sumMicros = 0;
+
+    /// smallest sample in microseconds
+    uint64_t minMicros = 0;
+
+    /// largest sample in microseconds
+    uint64_t maxMicros = 0;
+
+    /// number of samples in each bucket
+    std::array<uint64_t, NUM_BUCKETS> buckets{};
+};
+
+} // namespace opendnp3
+
+#endif
@@ -41,6 +41,21 @@ void DNP3Manager::Shutdown()
     impl->Shutdown();
 }
 
+void DNP3Manager::SetMaxConnectsInFlight(uint32_t maxInFlight)
+{
+    impl->SetMaxConnectsInFlight(maxInFlight);
+}
+
+void DNP3Manager::SetMaxConcurrentHandshakes(uint32_t maxInProgress)
+{
+    impl->SetMaxConcurrentHandshakes(maxInProgress);
+}
+
+void DNP3Manager::ReloadTLSConfigs()
+{
+    impl->ReloadTLSConfigs();
+}
+
 std::shared_ptr<IChannel> DNP3Manager::AddTCPClient(const std::string& id,
                                                     const LogLevels& levels,
                                                     const ChannelRetry& retry,
@@ -92,6 +107,15 @@ std::shared_ptr<IChannel> DNP3Manager::AddSerial(const std::string& id,
     return this->impl->AddSerial(id, levels, retry, std::move(settings), std::move(listener));
 }
 
+std::pair<std::shared_ptr<IChannel>, std::shared_ptr<IChannel>> DNP3Manager::AddLoopbackPair(
+    const std::string& id,
+    const LogLevels& levels,
+    std::shared_ptr<IChannelListener> firstListener,
+    std::shared_ptr<IChannelListener> secondListener) const
+{
+    return this->impl->AddLoopbackPair(id, levels, std::move(firstListener), std::move(secondListener));
+}
+
 std::shared_ptr<IChannel> DNP3Manager::AddTLSClient(const std::string& id,
                                                     const LogLevels& levels,
                                                     const ChannelRetry& retry,
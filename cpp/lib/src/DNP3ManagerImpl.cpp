@@ -24,12 +24,15 @@
 
 #ifdef OPENDNP3_USE_TLS
 #include "channel/tls/MasterTLSServer.h"
+#include "channel/tls/SSLContextCache.h"
 #include "channel/tls/TLSClientIOHandler.h"
 #include "channel/tls/TLSServerIOHandler.h"
+#include "channel/tls/TLSSessionCache.h"
 #endif
 
 #include "channel/DNP3Channel.h"
 #include "channel/IOHandlersManager.h"
+#include "channel/LoopbackIOHandler.h"
 #include "channel/SharedChannelData.h"
 #include "channel/SerialIOHandler.h"
 #include "channel/TCPClientIOHandler.h"
@@ -43,6 +46,9 @@
 namespace opendnp3
 {
 
+// size of the ring buffer in each direction of a loopback pair
+const size_t LOOPBACK_BUFFER_SIZE = 4096;
+
 DNP3ManagerImpl::DNP3ManagerImpl(uint32_t concurrencyHint,
                                  std::shared_ptr<ILogHandler> handler,
                                  std::function<void(uint32_t)> onThreadStart,
@@ -50,8 +56,14 @@ DNP3ManagerImpl::DNP3ManagerImpl(uint32_t concurrencyHint,
     : logger(std::move(handler), ModuleId(), "manager", levels::ALL),
       io(std::make_shared<asio::io_context>()),
       threadpool(io, concurrencyHint, std::move(onThreadStart), std::move(onThreadExit)),
-      resources(ResourceManager::Create())
+      resources(ResourceManager::Create()),
+      admission(std::make_shared<ConnectionAdmission>()),
+      handshakes(std::make_shared<ConnectionAdmission>())
 {
+#ifdef OPENDNP3_USE_TLS
+    this->tlsContexts = std::make_shared<SSLContextCache>();
+    this->tlsSessions = std::make_shared<TLSSessionCache>();
+#endif
 }
 
 DNP3ManagerImpl::~DNP3ManagerImpl()
@@ -68,6 +80,33 @@ void DNP3ManagerImpl::Shutdown()
     }
 }
 
+void DNP3ManagerImpl::SetMaxConnectsInFlight(uint32_t maxInFlight)
+{
+    this->admission->SetMaxInFlight(maxInFlight);
+}
+
+void DNP3ManagerImpl::SetMaxConcurrentHandshakes(uint32_t maxInProgress)
+{
+    this->handshakes->SetMaxInFlight(maxInProgress);
+}
+
+void DNP3ManagerImpl::ReloadTLSConfigs()
+{
+#ifdef OPENDNP3_USE_TLS
+    const auto failures = this->tlsContexts->Reload();
+
+    // sessions were verified against the previous certificates and are not verified again when resumed
+    this->tlsSessions->Clear();
+
+    if (failures > 0)
+    {
+        throw DNP3Error(Error::UNABLE_TO_LOAD_TLS_CONFIG);
+    }
+#else
+    throw DNP3Error(Error::NO_TLS_SUPPORT);
+#endif
+}
+
 std::shared_ptr<IChannel> DNP3ManagerImpl::AddTCPClient(const std::string& id,
                                                         const LogLevels& levels,
                                                         const ChannelRetry& retry,
@@ -78,7 +117,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddTCPClient(const std::string& id,
     auto create = [&]() -> std::shared_ptr<IChannel> {
         const auto clogger = this->logger.detach(id, levels);
         const auto executor = exe4cpp::StrandExecutor::create(this->io);
-        const auto iohandlersManager = std::make_shared<IOHandlersManager>(clogger, listener, executor, retry, primary, boost::none, local);
+        const auto iohandlersManager = std::make_shared<IOHandlersManager>(clogger, listener, executor, retry, primary, boost::none, local, this->admission);
         return DNP3Channel::Create(clogger, executor, iohandlersManager, this->resources);
     };
 
@@ -105,7 +144,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddClientWithBackupChannel(
     auto create = [&]() -> std::shared_ptr<IChannel> {
         const auto clogger = this->logger.detach(id, levels);
         const auto executor = exe4cpp::StrandExecutor::create(this->io);
-        const auto iohandlersManager = std::make_shared<IOHandlersManager>(clogger, listener, executor, retry, primary, backup, local);
+        const auto iohandlersManager = std::make_shared<IOHandlersManager>(clogger, listener, executor, retry, primary, backup, local, this->admission);
         return DNP3Channel::Create(clogger, executor, iohandlersManager, this->resources);
     };
 
@@ -198,6 +237,43 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddSerial(const std::string& id,
     return channel;
 }
 
+std::pair<std::shared_ptr<IChannel>, std::shared_ptr<IChannel>> DNP3ManagerImpl::AddLoopbackPair(
+    const std::string& id,
+    const LogLevels& levels,
+    std::shared_ptr<IChannelListener> firstListener,
+    std::shared_ptr<IChannelListener> secondListener) const
+{
+    const auto connector = std::make_shared<LoopbackConnector>(LOOPBACK_BUFFER_SIZE);
+
+    auto create = [&](uint8_t end, const std::string& suffix, const std::shared_ptr<IChannelListener>& listener) {
+        return [&, end, suffix, listener]() -> std::shared_ptr<IChannel> {
+            auto clogger = this->logger.detach(id + suffix, levels);
+            auto executor = exe4cpp::StrandExecutor::create(this->io);
+            auto sessionManager = std::make_shared<SharedChannelData>(clogger);
+            auto iohandler = LoopbackIOHandler::Create(clogger, listener, executor, connector, end, sessionManager);
+            const auto iohandlersManager = std::make_shared<IOHandlersManager>(clogger, iohandler, sessionManager);
+            return DNP3Channel::Create(clogger, executor, iohandlersManager, this->resources);
+        };
+    };
+
+    auto first = this->resources->Bind<IChannel>(create(0, "-a", firstListener));
+
+    if (!first)
+    {
+        throw DNP3Error(Error::SHUTTING_DOWN);
+    }
+
+    auto second = this->resources->Bind<IChannel>(create(1, "-b", secondListener));
+
+    if (!second)
+    {
+        first->Shutdown();
+        throw DNP3Error(Error::SHUTTING_DOWN);
+    }
+
+    return std::make_pair(first, second);
+}
+
 std::shared_ptr<IChannel> DNP3ManagerImpl::AddTLSClient(const std::string& id,
                                                         const LogLevels& levels,
                                                         const ChannelRetry& retry,
@@ -212,7 +288,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddTLSClient(const std::string& id,
         auto clogger = this->logger.detach(id, levels);
         auto executor = exe4cpp::StrandExecutor::create(this->io);
         auto sessionManager = std::make_shared<SharedChannelData>(clogger);
-        auto iohandler = TLSClientIOHandler::Create(clogger, listener, executor, config, retry, IPEndpointsList{ hosts }, local, sessionManager);
+        auto iohandler = TLSClientIOHandler::Create(clogger, listener, executor, config, retry, IPEndpointsList{ hosts }, local, sessionManager, this->tlsContexts, this->tlsSessions, this->handshakes, this->admission);
         const auto iohandlersManager = std::make_shared<IOHandlersManager>(clogger, iohandler, sessionManager);
         return DNP3Channel::Create(clogger, executor, iohandlersManager, this->resources);
     };
@@ -244,7 +320,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddTLSServer(const std::string& id,
         auto clogger = this->logger.detach(id, levels);
         auto executor = exe4cpp::StrandExecutor::create(this->io);
         auto sessionManager = std::make_shared<SharedChannelData>(clogger);
-        auto iohandler = TLSServerIOHandler::Create(clogger, mode, listener, executor, endpoint, config, ec, sessionManager);
+        auto iohandler = TLSServerIOHandler::Create(clogger, mode, listener, executor, endpoint, config, ec, sessionManager, this->tlsContexts, this->handshakes);
         if (ec)
         {
             throw DNP3Error(Error::UNABLE_TO_BIND_SERVER, ec);
@@ -307,7 +383,7 @@ std::shared_ptr<IListener> DNP3ManagerImpl::CreateListener(std::string loggerid,
         std::error_code ec;
         auto server
             = MasterTLSServer::Create(this->logger.detach(loggerid, levels), exe4cpp::StrandExecutor::create(this->io),
-                                      endpoint, config, callbacks, this->resources, ec);
+                                      endpoint, config, callbacks, this->resources, ec, this->tlsContexts, this->handshakes);
         if (ec)
         {
             throw DNP3Error(Error::UNABLE_TO_BIND_SERVER, ec);
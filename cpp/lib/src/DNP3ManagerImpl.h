@@ -22,6 +22,7 @@
 #define OPENDNP3_DNP3MANAGERIMPL_H
 
 #include "ResourceManager.h"
+#include "channel/ConnectionAdmission.h"
 #include "opendnp3/channel/ChannelConnectionOptions.h"
 #include "opendnp3/channel/ChannelRetry.h"
 #include "opendnp3/channel/IChannel.h"
@@ -40,6 +41,9 @@
 namespace opendnp3
 {
 
+class SSLContextCache;
+class TLSSessionCache;
+
 class DNP3ManagerImpl : private Uncopyable
 {
 
@@ -53,6 +57,12 @@ public:
 
     void Shutdown();
 
+    void SetMaxConnectsInFlight(uint32_t maxInFlight);
+
+    void SetMaxConcurrentHandshakes(uint32_t maxInProgress);
+
+    void ReloadTLSConfigs();
+
     std::shared_ptr<IChannel> AddTCPClient(const std::string& id,
                                            const opendnp3::LogLevels& levels,
                                            const ChannelRetry& retry,
@@ -88,6 +98,12 @@ public:
                                         SerialSettings settings,
                                         std::shared_ptr<IChannelListener> listener) const;
 
+    std::pair<std::shared_ptr<IChannel>, std::shared_ptr<IChannel>> AddLoopbackPair(
+        const std::string& id,
+        const opendnp3::LogLevels& levels,
+        std::shared_ptr<IChannelListener> firstListener,
+        std::shared_ptr<IChannelListener> secondListener) const;
+
     std::shared_ptr<IChannel> AddTLSClient(const std::string& id,
                                            const opendnp3::LogLevels& levels,
                                            const ChannelRetry& retry,
@@ -119,6 +135,10 @@ private:
     const std::shared_ptr<asio::io_context> io;
     exe4cpp::ThreadPool threadpool;
     std::shared_ptr<ResourceManager> resources;
+    const std::shared_ptr<ConnectionAdmission> admission;
+    const std::shared_ptr<ConnectionAdmission> handshakes;
+    std::shared_ptr<SSLContextCache> tlsContexts;
+    std::shared_ptr<TLSSessionCache> tlsSessions;
 };
 
 } // namespace opendnp3
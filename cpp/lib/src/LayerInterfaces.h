@@ -56,6 +56,13 @@ public:
     // return false if the layer is down
     virtual bool OnReceive(const Message& message) = 0;
 
+    // Called by the lower layer to get storage where a message of the given length can be written before it is
+    // passed to OnReceive, empty if the data should stay in the lower layer's buffer
+    virtual ser4cpp::wseq_t GetReceiveBuffer(size_t /*length*/)
+    {
+        return ser4cpp::wseq_t::empty();
+    }
+
     // Called by the lower layer when it is ready to transmit more data
     virtual bool OnTxReady() = 0;
 };
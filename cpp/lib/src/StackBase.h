@@ -56,7 +56,16 @@ protected:
 
     StackStatistics CreateStatistics() const
     {
-        return StackStatistics(tstack.link->GetStatistics(), tstack.transport->GetStatistics());
+        StackStatistics statistics(tstack.link->GetStatistics(), tstack.transport->GetStatistics());
+        statistics.latency = this->latency;
+        return statistics;
+    }
+
+    // start recording transport latency, returns the histograms the application layer records into
+    StackStatistics::Latency& EnableLatencyTracing()
+    {
+        tstack.transport->SetLatencyTracing(this->latency);
+        return this->latency;
     }
 
     template<class T> void PerformShutdown(const std::shared_ptr<T>& self);
@@ -66,6 +75,7 @@ protected:
     const std::shared_ptr<IOHandlersManager> iohandlersManager;
     const std::shared_ptr<IResourceManager> manager;
     TransportStack tstack;
+    StackStatistics::Latency latency;
 };
 
 template<class T> void StackBase::PerformShutdown(const std::shared_ptr<T>& self)
@@ -0,0 +1,371 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BitfieldKernels.h"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPENDNP3_BITFIELD_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(OPENDNP3_BITFIELD_SSE2) && defined(__AVX2__)
+#define OPENDNP3_BITFIELD_AVX2
+#include <immintrin.h>
+#endif
+
+static_assert(sizeof(bool) == 1, "the kernels store bool values as bytes");
+
+namespace opendnp3
+{
+
+// ---------------- scalar ----------------
+
+bool ScalarBitfieldKernels::Available()
+{
+    return true;
+}
+
+void ScalarBitfieldKernels::UnpackBits(const uint8_t* input, size_t count, bool* output)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        output[i] = ((input[i / 8] >> (i % 8)) & 0x01) != 0;
+    }
+}
+
+void ScalarBitfieldKernels::PackBits(const bool* input, size_t count, uint8_t* output)
+{
+    for (size_t i = 0; i < count; i += 8)
+    {
+        uint8_t value = 0;
+        for (size_t bit = 0; (bit < 8) && (i + bit < count); ++bit)
+        {
+            if (input[i + bit])
+            {
+                value |= static_cast<uint8_t>(1 << bit);
+            }
+        }
+        output[i / 8] = value;
+    }
+}
+
+void ScalarBitfieldKernels::UnpackDoubleBits(const uint8_t* input, size_t count, uint8_t* output)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        output[i] = (input[i / 4] >> (2 * (i % 4))) & 0x03;
+    }
+}
+
+void ScalarBitfieldKernels::PackDoubleBits(const uint8_t* input, size_t count, uint8_t* output)
+{
+    for (size_t i = 0; i < count; i += 4)
+    {
+        uint8_t value = 0;
+        for (size_t pos = 0; (pos < 4) && (i + pos < count); ++pos)
+        {
+            value |= static_cast<uint8_t>((input[i + pos] & 0x03) << (2 * pos));
+        }
+        output[i / 4] = value;
+    }
+}
+
+// ---------------- SSE2 ----------------
+
+#ifdef OPENDNP3_BITFIELD_SSE2
+
+bool SSE2BitfieldKernels::Available()
+{
+    return true;
+}
+
+void SSE2BitfieldKernels::UnpackBits(const uint8_t* input, size_t count, bool* output)
+{
+    const auto mask = _mm_set_epi8(-128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1);
+    const auto ones = _mm_set1_epi8(1);
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        // each input byte repeated across the 8 output bytes it expands to
+        const auto bytes = _mm_unpacklo_epi64(_mm_set1_epi8(static_cast<char>(input[i / 8])),
+                                              _mm_set1_epi8(static_cast<char>(input[i / 8 + 1])));
+        const auto values = _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(bytes, mask), mask), ones);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), values);
+    }
+
+    ScalarBitfieldKernels::UnpackBits(input + i / 8, count - i, output + i);
+}
+
+void SSE2BitfieldKernels::PackBits(const bool* input, size_t count, uint8_t* output)
+{
+    const auto zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const auto bits = ~_mm_movemask_epi8(_mm_cmpeq_epi8(values, zero));
+        output[i / 8] = static_cast<uint8_t>(bits);
+        output[i / 8 + 1] = static_cast<uint8_t>(bits >> 8);
+    }
+
+    ScalarBitfieldKernels::PackBits(input + i, count - i, output + i / 8);
+}
+
+void SSE2BitfieldKernels::UnpackDoubleBits(const uint8_t* input, size_t count, uint8_t* output)
+{
+    // the low and high bit of each of the 4 values in a byte
+    const auto low_mask = _mm_set1_epi32(0x40100401);
+    const auto high_mask = _mm_set1_epi32(static_cast<int>(0x80200802));
+    const auto ones = _mm_set1_epi8(1);
+    const auto twos = _mm_set1_epi8(2);
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        int32_t word;
+        std::memcpy(&word, input + i / 4, sizeof(word));
+
+        // each input byte repeated across the 4 output bytes it expands to
+        auto bytes = _mm_cvtsi32_si128(word);
+        bytes = _mm_unpacklo_epi8(bytes, bytes);
+        bytes = _mm_unpacklo_epi16(bytes, bytes);
+
+        const auto low = _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(bytes, low_mask), low_mask), ones);
+        const auto high = _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(bytes, high_mask), high_mask), twos);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_or_si128(low, high));
+    }
+
+    ScalarBitfieldKernels::UnpackDoubleBits(input + i / 4, count - i, output + i);
+}
+
+void SSE2BitfieldKernels::PackDoubleBits(const uint8_t* input, size_t count, uint8_t* output)
+{
+    const auto value_mask = _mm_set1_epi8(0x03);
+    const auto pair_mask = _mm_set1_epi16(0x0F);
+    const auto byte_mask = _mm_set1_epi32(0xFF);
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        auto values = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)), value_mask);
+        // merge neighbouring values into pairs in each 16-bit lane, then pairs into bytes in each 32-bit lane
+        values = _mm_and_si128(_mm_or_si128(values, _mm_srli_epi16(values, 6)), pair_mask);
+        values = _mm_and_si128(_mm_or_si128(values, _mm_srli_epi32(values, 12)), byte_mask);
+        values = _mm_packs_epi32(values, values);
+        values = _mm_packus_epi16(values, values);
+
+        const auto word = _mm_cvtsi128_si32(values);
+        std::memcpy(output + i / 4, &word, sizeof(word));
+    }
+
+    ScalarBitfieldKernels::PackDoubleBits(input + i, count - i, output + i / 4);
+}
+
+#else
+
+bool SSE2BitfieldKernels::Available()
+{
+    return false;
+}
+
+void SSE2BitfieldKernels::UnpackBits(const uint8_t* input, size_t count, bool* output)
+{
+    ScalarBitfieldKernels::UnpackBits(input, count, output);
+}
+
+void SSE2BitfieldKernels::PackBits(const bool* input, size_t count, uint8_t* output)
+{
+    ScalarBitfieldKernels::PackBits(input, count, output);
+}
+
+void SSE2BitfieldKernels::UnpackDoubleBits(const uint8_t* input, size_t count, uint8_t* output)
+{
+    ScalarBitfieldKernels::UnpackDoubleBits(input, count, output);
+}
+
+void SSE2BitfieldKernels::PackDoubleBits(const uint8_t* input, size_t count, uint8_t* output)
+{
+    ScalarBitfieldKernels::PackDoubleBits(input, count, output);
+}
+
+#endif
+
+// ---------------- AVX2 ----------------
+
+#ifdef OPENDNP3_BITFIELD_AVX2
+
+bool AVX2BitfieldKernels::Available()
+{
+    return true;
+}
+
+void AVX2BitfieldKernels::UnpackBits(const uint8_t* input, size_t count, bool* output)
+{
+    // shuffles stay within 128-bit lanes, but every lane holds all 4 input bytes
+    const auto shuffle = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3,
+                                          3, 3, 3, 3, 3, 3);
+    const auto mask = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32,
+                                       64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const auto ones = _mm256_set1_epi8(1);
+
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        int32_t word;
+        std::memcpy(&word, input + i / 8, sizeof(word));
+
+        const auto bytes = _mm256_shuffle_epi8(_mm256_set1_epi32(word), shuffle);
+        const auto values = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_and_si256(bytes, mask), mask), ones);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), values);
+    }
+
+    SSE2BitfieldKernels::UnpackBits(input + i / 8, count - i, output + i);
+}
+
+void AVX2BitfieldKernels::PackBits(const bool* input, size_t count, uint8_t* output)
+{
+    const auto zero = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        const auto bits = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(values, zero)));
+        std::memcpy(output + i / 8, &bits, sizeof(bits));
+    }
+
+    SSE2BitfieldKernels::PackBits(input + i, count - i, output + i / 8);
+}
+
+void AVX2BitfieldKernels::UnpackDoubleBits(const uint8_t* input, size_t count, uint8_t* output)
+{
+    const auto shuffle = _mm256_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6,
+                                          6, 6, 7, 7, 7, 7);
+    const auto low_mask = _mm256_set1_epi32(0x40100401);
+    const auto high_mask = _mm256_set1_epi32(static_cast<int>(0x80200802));
+    const auto ones = _mm256_set1_epi8(1);
+    const auto twos = _mm256_set1_epi8(2);
+
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        int64_t word;
+        std::memcpy(&word, input + i / 4, sizeof(word));
+
+        const auto bytes = _mm256_shuffle_epi8(_mm256_set1_epi64x(word), shuffle);
+        const auto low = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_and_si256(bytes, low_mask), low_mask), ones);
+        const auto high = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_and_si256(bytes, high_mask), high_mask), twos);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_or_si256(low, high));
+    }
+
+    SSE2BitfieldKernels::UnpackDoubleBits(input + i / 4, count - i, output + i);
+}
+
+void AVX2BitfieldKernels::PackDoubleBits(const uint8_t* input, size_t count, uint8_t* output)
+{
+    const auto value_mask = _mm256_set1_epi8(0x03);
+    const auto pair_mask = _mm256_set1_epi16(0x0F);
+    const auto byte_mask = _mm256_set1_epi32(0xFF);
+
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        auto values = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i)), value_mask);
+        values = _mm256_and_si256(_mm256_or_si256(values, _mm256_srli_epi16(values, 6)), pair_mask);
+        values = _mm256_and_si256(_mm256_or_si256(values, _mm256_srli_epi32(values, 12)), byte_mask);
+        // the packs work per 128-bit lane, so each lane ends up with 4 of the 8 output bytes
+        values = _mm256_packs_epi32(values, values);
+        values = _mm256_packus_epi16(values, values);
+
+        const auto low = _mm_cvtsi128_si32(_mm256_castsi256_si128(values));
+        const auto high = _mm_cvtsi128_si32(_mm256_extracti128_si256(values, 1));
+        std::memcpy(output + i / 4, &low, sizeof(low));
+        std::memcpy(output + i / 4 + 4, &high, sizeof(high));
+    }
+
+    SSE2BitfieldKernels::PackDoubleBits(input + i, count - i, output + i / 4);
+}
+
+#else
+
+bool AVX2BitfieldKernels::Available()
+{
+    return false;
+}
+
+void AVX2BitfieldKernels::UnpackBits(const uint8_t* input, size_t count, bool* output)
+{
+    SSE2BitfieldKernels::UnpackBits(input, count, output);
+}
+
+void AVX2BitfieldKernels::PackBits(const bool* input, size_t count, uint8_t* output)
+{
+    SSE2BitfieldKernels::PackBits(input, count, output);
+}
+
+void AVX2BitfieldKernels::UnpackDoubleBits(const uint8_t* input, size_t count, uint8_t* output)
+{
+    SSE2BitfieldKernels::UnpackDoubleBits(input, count, output);
+}
+
+void AVX2BitfieldKernels::PackDoubleBits(const uint8_t* input, size_t count, uint8_t* output)
+{
+    SSE2BitfieldKernels::PackDoubleBits(input, count, output);
+}
+
+#endif
+
+// ---------------- dispatch ----------------
+
+const char* BitfieldKernels::Name()
+{
+#if defined(OPENDNP3_BITFIELD_AVX2)
+    return "AVX2";
+#elif defined(OPENDNP3_BITFIELD_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+void BitfieldKernels::UnpackBits(const uint8_t* input, size_t count, bool* output)
+{
+    AVX2BitfieldKernels::UnpackBits(input, count, output);
+}
+
+void BitfieldKernels::PackBits(const bool* input, size_t count, uint8_t* output)
+{
+    AVX2BitfieldKernels::PackBits(input, count, output);
+}
+
+void BitfieldKernels::UnpackDoubleBits(const uint8_t* input, size_t count, uint8_t* output)
+{
+    AVX2BitfieldKernels::UnpackDoubleBits(input, count, output);
+}
+
+void BitfieldKernels::PackDoubleBits(const uint8_t* input, size_t count, uint8_t* output)
+{
+    AVX2BitfieldKernels::PackDoubleBits(input, count, output);
+}
+
+} // namespace opendnp3
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_BITFIELDKERNELS_H
+#define OPENDNP3_BITFIELDKERNELS_H
+
+#include "opendnp3/util/StaticOnly.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+ * Converts between packed bitfields and one byte per value. Single bits are unpacked to bool,
+ * double bits to their 2-bit values (0-3). Bits are packed LSB first and the unused bits of the
+ * last byte are always written as zero.
+ *
+ * Every kernel has the same interface. The SSE2/AVX2 kernels fall back to the scalar one when
+ * they weren't compiled in, see Available().
+ */
+class ScalarBitfieldKernels : private StaticOnly
+{
+public:
+    static bool Available();
+
+    static void UnpackBits(const uint8_t* input, size_t count, bool* output);
+    static void PackBits(const bool* input, size_t count, uint8_t* output);
+
+    static void UnpackDoubleBits(const uint8_t* input, size_t count, uint8_t* output);
+    static void PackDoubleBits(const uint8_t* input, size_t count, uint8_t* output);
+};
+
+class SSE2BitfieldKernels : private StaticOnly
+{
+public:
+    static bool Available();
+
+    static void UnpackBits(const uint8_t* input, size_t count, bool* output);
+    static void PackBits(const bool* input, size_t count, uint8_t* output);
+
+    static void UnpackDoubleBits(const uint8_t* input, size_t count, uint8_t* output);
+    static void PackDoubleBits(const uint8_t* input, size_t count, uint8_t* output);
+};
+
+// only compiled in when the library is built with DNP3_AVX2
+class AVX2BitfieldKernels : private StaticOnly
+{
+public:
+    static bool Available();
+
+    static void UnpackBits(const uint8_t* input, size_t count, bool* output);
+    static void PackBits(const bool* input, size_t count, uint8_t* output);
+
+    static void UnpackDoubleBits(const uint8_t* input, size_t count, uint8_t* output);
+    static void PackDoubleBits(const uint8_t* input, size_t count, uint8_t* output);
+};
+
+// the fastest kernel compiled into the library
+class BitfieldKernels : private StaticOnly
+{
+public:
+    static const char* Name();
+
+    static void UnpackBits(const uint8_t* input, size_t count, bool* output);
+    static void PackBits(const bool* input, size_t count, uint8_t* output);
+
+    static void UnpackDoubleBits(const uint8_t* input, size_t count, uint8_t* output);
+    static void PackDoubleBits(const uint8_t* input, size_t count, uint8_t* output);
+};
+
+} // namespace opendnp3
+
+#endif
@@ -20,6 +20,8 @@
 #ifndef OPENDNP3_BITFIELDRANGEWRITEITERATOR_H
 #define OPENDNP3_BITFIELDRANGEWRITEITERATOR_H
 
+#include "app/BitfieldKernels.h"
+
 #include <ser4cpp/serialization/LittleEndian.h>
 
 namespace opendnp3
@@ -55,7 +57,7 @@ public:
     {
         if (isValid && count > 0)
         {
-            typename IndexType::type_t stop = start + count - 1;
+            const auto stop = static_cast<typename IndexType::type_t>(start + count - 1);
             IndexType::write_to(range, stop);
 
             auto num = count / 8;
@@ -95,6 +97,43 @@ public:
         }
     }
 
+    /**
+     * @return the number of values that still fit in the buffer and the index range
+     */
+    uint32_t Remaining() const
+    {
+        if (!isValid)
+        {
+            return 0;
+        }
+
+        const auto num_in_buffer = static_cast<uint32_t>(maxCount - count);
+        const auto num_in_range = static_cast<uint32_t>(IndexType::max_value) + 1 - count;
+        return (num_in_buffer < num_in_range) ? num_in_buffer : num_in_range;
+    }
+
+    /**
+     * writes all of the values, or none of them if they don't all fit
+     */
+    bool WriteArray(const bool* values, uint32_t num)
+    {
+        if (num > this->Remaining())
+        {
+            return false;
+        }
+
+        // finish any partially written byte, then pack whole bytes at once
+        uint32_t i = 0;
+        for (; (i < num) && ((count % 8) != 0); ++i)
+        {
+            this->Write(values[i]);
+        }
+
+        BitfieldKernels::PackBits(values + i, num - i, static_cast<uint8_t*>(*pPosition) + (count / 8));
+        count += (num - i);
+        return true;
+    }
+
     bool IsValid() const
     {
         return isValid;
@@ -102,7 +141,7 @@ public:
 
 private:
     typename IndexType::type_t start;
-    typename IndexType::type_t count;
+    uint32_t count;
 
     size_t maxCount;
 
@@ -33,8 +33,10 @@ public:
     DNP3Serializer(GroupVariationID id,
                    size_t size,
                    typename Serializer<T>::read_func_t read_func,
-                   typename Serializer<T>::write_func_t write_func)
-        : Serializer<T>(size, read_func, write_func), id(id)
+                   typename Serializer<T>::write_func_t write_func,
+                   typename Serializer<T>::read_array_func_t read_array_func = nullptr,
+                   typename Serializer<T>::write_array_func_t write_array_func = nullptr)
+        : Serializer<T>(size, read_func, write_func, read_array_func, write_array_func), id(id)
     {
     }
 
@@ -21,6 +21,7 @@
 #define OPENDNP3_GROUPVARIATIONRECORD_H
 
 #include "app/Range.h"
+#include "gen/GroupVariationTable.h"
 
 #include "opendnp3/gen/GroupVariation.h"
 #include "opendnp3/gen/QualifierCode.h"
@@ -32,13 +33,6 @@
 namespace opendnp3
 {
 
-enum class GroupVariationType : int
-{
-    STATIC,
-    EVENT,
-    OTHER
-};
-
 struct EnumAndType
 {
     EnumAndType(GroupVariation enumeration_, GroupVariationType type_) : enumeration(enumeration_), type(type_) {}
@@ -51,13 +45,26 @@ class GroupVariationRecord
 {
 
 public:
-    static EnumAndType GetEnumAndType(uint8_t group, uint8_t variation);
+    // group/variation resolution is a pair of table loads, so it's kept inline for the header parsers
+
+    static EnumAndType GetEnumAndType(uint8_t group, uint8_t variation)
+    {
+        const auto info = GroupVariationTable::Lookup(group, variation);
+        return EnumAndType(info.enumeration, info.type);
+    }
 
     static uint16_t GetGroupVar(uint8_t group, uint8_t variation);
 
-    static GroupVariationRecord GetRecord(uint8_t group, uint8_t variation);
+    static GroupVariationRecord GetRecord(uint8_t group, uint8_t variation)
+    {
+        const auto info = GroupVariationTable::Lookup(group, variation);
+        return GroupVariationRecord(group, variation, info.enumeration, info.type);
+    }
 
-    static GroupVariationType GetType(uint8_t group, uint8_t variation);
+    static GroupVariationType GetType(uint8_t group, uint8_t variation)
+    {
+        return GroupVariationTable::Lookup(group, variation).type;
+    }
 
     GroupVariationRecord(uint8_t group_, uint8_t variation_, GroupVariation enumeration_, GroupVariationType type_);
 
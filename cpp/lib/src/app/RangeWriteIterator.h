@@ -76,6 +76,41 @@ public:
         }
     }
 
+    /**
+     * @return the number of values that still fit in the buffer and the index range
+     */
+    uint32_t Remaining() const
+    {
+        if (!isValid)
+        {
+            return 0;
+        }
+
+        const auto num_in_buffer = static_cast<uint32_t>(pPosition->length() / serializer.get_size());
+        const auto num_in_range = static_cast<uint32_t>(IndexType::max_value) + 1 - count;
+        return (num_in_buffer < num_in_range) ? num_in_buffer : num_in_range;
+    }
+
+    /**
+     * writes all of the values in a single pass, or none of them if they don't all fit
+     */
+    bool WriteArray(const WriteType* values, uint32_t num)
+    {
+        if (num == 0)
+        {
+            return true;
+        }
+
+        if (num > this->Remaining())
+        {
+            return false;
+        }
+
+        serializer.write_array(values, num, *pPosition);
+        count += num;
+        return true;
+    }
+
     bool IsValid() const
     {
         return isValid;
@@ -30,11 +30,21 @@ template<class T> class Serializer
 public:
     using read_func_t = bool (*)(ser4cpp::rseq_t& buffer, T& output);
     using write_func_t = bool (*)(const T& value, ser4cpp::wseq_t& buffer);
+    using read_array_func_t = bool (*)(ser4cpp::rseq_t& buffer, T* output, size_t count);
+    using write_array_func_t = bool (*)(const T* values, size_t count, ser4cpp::wseq_t& buffer);
 
     Serializer() = default;
 
-    Serializer(size_t size, read_func_t read_func, write_func_t write_func)
-        : size(size), read_func(read_func), write_func(write_func)
+    Serializer(size_t size,
+               read_func_t read_func,
+               write_func_t write_func,
+               read_array_func_t read_array_func = nullptr,
+               write_array_func_t write_array_func = nullptr)
+        : size(size),
+          read_func(read_func),
+          write_func(write_func),
+          read_array_func(read_array_func),
+          write_array_func(write_array_func)
     {
     }
 
@@ -62,10 +72,58 @@ public:
         return (*write_func)(value, buffer);
     }
 
+    /**
+     * reads count values and advances the read buffer, nothing is read if the buffer is too short
+     */
+    bool read_array(ser4cpp::rseq_t& buffer, T* output, size_t count) const
+    {
+        if (read_array_func)
+        {
+            return (*read_array_func)(buffer, output, count);
+        }
+
+        if (buffer.length() < count * size)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            (*read_func)(buffer, output[i]);
+        }
+
+        return true;
+    }
+
+    /**
+     * writes count values and advances the write buffer, nothing is written if the buffer is too short
+     */
+    bool write_array(const T* values, size_t count, ser4cpp::wseq_t& buffer) const
+    {
+        if (write_array_func)
+        {
+            return (*write_array_func)(values, count, buffer);
+        }
+
+        if (buffer.length() < count * size)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            (*write_func)(values[i], buffer);
+        }
+
+        return true;
+    }
+
 private:
     size_t size = 0;
     read_func_t read_func = nullptr;
     write_func_t write_func = nullptr;
+    read_array_func_t read_array_func = nullptr;
+    write_array_func_t write_array_func = nullptr;
 };
 } // namespace opendnp3
 
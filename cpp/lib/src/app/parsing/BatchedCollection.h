@@ -0,0 +1,170 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_BATCHEDCOLLECTION_H
+#define OPENDNP3_BATCHEDCOLLECTION_H
+
+#include "app/BitfieldKernels.h"
+
+#include "opendnp3/app/Indexed.h"
+#include "opendnp3/gen/DoubleBit.h"
+#include "opendnp3/app/parsing/ICollection.h"
+
+#include <ser4cpp/container/SequenceTypes.h>
+
+#include <array>
+
+namespace opendnp3
+{
+
+/**
+ * A collection over a contiguous range of fixed-size objects that converts the values
+ * in small batches using the descriptor's ReadArray(..) instead of one at a time
+ */
+template<class Descriptor> class BatchedCollection : public ICollection<Indexed<typename Descriptor::Target>>
+{
+    using target_t = typename Descriptor::Target;
+
+    static const size_t BATCH_SIZE = 32;
+
+public:
+    BatchedCollection(const ser4cpp::rseq_t& buffer, uint16_t start, size_t count)
+        : buffer(buffer), start(start), COUNT(count)
+    {
+    }
+
+    virtual size_t Count() const override final
+    {
+        return COUNT;
+    }
+
+    virtual void Foreach(IVisitor<Indexed<target_t>>& visitor) const final
+    {
+        ser4cpp::rseq_t copy(buffer);
+        std::array<target_t, BATCH_SIZE> values;
+
+        size_t pos = 0;
+        while (pos < COUNT)
+        {
+            const auto num = (COUNT - pos) < BATCH_SIZE ? (COUNT - pos) : BATCH_SIZE;
+
+            Descriptor::ReadArray(copy, values.data(), num);
+
+            for (size_t i = 0; i < num; ++i)
+            {
+                visitor.OnValue(WithIndex(values[i], static_cast<uint16_t>(start + pos + i)));
+            }
+
+            pos += num;
+        }
+    }
+
+private:
+    ser4cpp::rseq_t buffer;
+    const uint16_t start;
+    const size_t COUNT;
+};
+
+/**
+ * A collection over a packed range of single bits, unpacked in blocks by the bitfield kernels
+ */
+template<class Type> class BitfieldCollection : public ICollection<Indexed<Type>>
+{
+    static const size_t BATCH_SIZE = 256;
+
+public:
+    BitfieldCollection(const ser4cpp::rseq_t& buffer, uint16_t start, size_t count)
+        : buffer(buffer), start(start), COUNT(count)
+    {
+    }
+
+    virtual size_t Count() const override final
+    {
+        return COUNT;
+    }
+
+    virtual void Foreach(IVisitor<Indexed<Type>>& visitor) const final
+    {
+        std::array<bool, BATCH_SIZE> values;
+
+        // batches are a multiple of 8 bits so every one starts on a byte boundary
+        for (size_t pos = 0; pos < COUNT; pos += BATCH_SIZE)
+        {
+            const auto num = (COUNT - pos) < BATCH_SIZE ? (COUNT - pos) : BATCH_SIZE;
+
+            BitfieldKernels::UnpackBits(static_cast<const uint8_t*>(buffer) + pos / 8, num, values.data());
+
+            for (size_t i = 0; i < num; ++i)
+            {
+                visitor.OnValue(WithIndex(Type(values[i]), static_cast<uint16_t>(start + pos + i)));
+            }
+        }
+    }
+
+private:
+    ser4cpp::rseq_t buffer;
+    const uint16_t start;
+    const size_t COUNT;
+};
+
+/**
+ * A collection over a packed range of double bits, unpacked in blocks by the bitfield kernels
+ */
+template<class Type> class DoubleBitfieldCollection : public ICollection<Indexed<Type>>
+{
+    static const size_t BATCH_SIZE = 256;
+
+public:
+    DoubleBitfieldCollection(const ser4cpp::rseq_t& buffer, uint16_t start, size_t count)
+        : buffer(buffer), start(start), COUNT(count)
+    {
+    }
+
+    virtual size_t Count() const override final
+    {
+        return COUNT;
+    }
+
+    virtual void Foreach(IVisitor<Indexed<Type>>& visitor) const final
+    {
+        std::array<uint8_t, BATCH_SIZE> values;
+
+        for (size_t pos = 0; pos < COUNT; pos += BATCH_SIZE)
+        {
+            const auto num = (COUNT - pos) < BATCH_SIZE ? (COUNT - pos) : BATCH_SIZE;
+
+            BitfieldKernels::UnpackDoubleBits(static_cast<const uint8_t*>(buffer) + pos / 4, num, values.data());
+
+            for (size_t i = 0; i < num; ++i)
+            {
+                visitor.OnValue(
+                    WithIndex(Type(DoubleBitSpec::from_type(values[i])), static_cast<uint16_t>(start + pos + i)));
+            }
+        }
+    }
+
+private:
+    ser4cpp::rseq_t buffer;
+    const uint16_t start;
+    const size_t COUNT;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -20,14 +20,21 @@
 #include "CountIndexParser.h"
 
 #include "app/parsing/BufferedCollection.h"
+#include "gen/objects/Group1.h"
+#include "gen/objects/Group10.h"
 #include "gen/objects/Group11.h"
 #include "gen/objects/Group12.h"
 #include "gen/objects/Group13.h"
 #include "gen/objects/Group2.h"
+#include "gen/objects/Group20.h"
+#include "gen/objects/Group21.h"
 #include "gen/objects/Group22.h"
 #include "gen/objects/Group23.h"
+#include "gen/objects/Group3.h"
+#include "gen/objects/Group30.h"
 #include "gen/objects/Group32.h"
 #include "gen/objects/Group4.h"
+#include "gen/objects/Group40.h"
 #include "gen/objects/Group41.h"
 #include "gen/objects/Group42.h"
 #include "gen/objects/Group43.h"
@@ -97,6 +104,9 @@ ParseResult CountIndexParser::ParseCountOfObjects(ser4cpp::rseq_t& buffer,
 {
     switch (record.enumeration)
     {
+    case (GroupVariation::Group1Var2):
+        return CountIndexParser::From<Group1Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
+
     case (GroupVariation::Group2Var1):
         return CountIndexParser::From<Group2Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
     case (GroupVariation::Group2Var2):
@@ -104,6 +114,9 @@ ParseResult CountIndexParser::ParseCountOfObjects(ser4cpp::rseq_t& buffer,
     case (GroupVariation::Group2Var3):
         return CountIndexParser::From<Group2Var3>(count, numparser).Process(record, buffer, pHandler, pLogger);
 
+    case (GroupVariation::Group3Var2):
+        return CountIndexParser::From<Group3Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
+
     case (GroupVariation::Group4Var1):
         return CountIndexParser::From<Group4Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
     case (GroupVariation::Group4Var2):
@@ -111,6 +124,9 @@ ParseResult CountIndexParser::ParseCountOfObjects(ser4cpp::rseq_t& buffer,
     case (GroupVariation::Group4Var3):
         return CountIndexParser::From<Group4Var3>(count, numparser).Process(record, buffer, pHandler, pLogger);
 
+    case (GroupVariation::Group10Var2):
+        return CountIndexParser::From<Group10Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
+
     case (GroupVariation::Group11Var1):
         return CountIndexParser::From<Group11Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
     case (GroupVariation::Group11Var2):
@@ -124,6 +140,28 @@ ParseResult CountIndexParser::ParseCountOfObjects(ser4cpp::rseq_t& buffer,
     case (GroupVariation::Group13Var2):
         return CountIndexParser::From<Group13Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
 
+    case (GroupVariation::Group20Var1):
+        return CountIndexParser::From<Group20Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group20Var2):
+        return CountIndexParser::From<Group20Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group20Var5):
+        return CountIndexParser::From<Group20Var5>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group20Var6):
+        return CountIndexParser::From<Group20Var6>(count, numparser).Process(record, buffer, pHandler, pLogger);
+
+    case (GroupVariation::Group21Var1):
+        return CountIndexParser::From<Group21Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group21Var2):
+        return CountIndexParser::From<Group21Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group21Var5):
+        return CountIndexParser::From<Group21Var5>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group21Var6):
+        return CountIndexParser::From<Group21Var6>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group21Var9):
+        return CountIndexParser::From<Group21Var9>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group21Var10):
+        return CountIndexParser::From<Group21Var10>(count, numparser).Process(record, buffer, pHandler, pLogger);
+
     case (GroupVariation::Group22Var1):
         return CountIndexParser::From<Group22Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
     case (GroupVariation::Group22Var2):
@@ -142,6 +180,19 @@ ParseResult CountIndexParser::ParseCountOfObjects(ser4cpp::rseq_t& buffer,
     case (GroupVariation::Group23Var6):
         return CountIndexParser::From<Group23Var6>(count, numparser).Process(record, buffer, pHandler, pLogger);
 
+    case (GroupVariation::Group30Var1):
+        return CountIndexParser::From<Group30Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group30Var2):
+        return CountIndexParser::From<Group30Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group30Var3):
+        return CountIndexParser::From<Group30Var3>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group30Var4):
+        return CountIndexParser::From<Group30Var4>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group30Var5):
+        return CountIndexParser::From<Group30Var5>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group30Var6):
+        return CountIndexParser::From<Group30Var6>(count, numparser).Process(record, buffer, pHandler, pLogger);
+
     case (GroupVariation::Group32Var1):
         return CountIndexParser::From<Group32Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
     case (GroupVariation::Group32Var2):
@@ -159,6 +210,15 @@ ParseResult CountIndexParser::ParseCountOfObjects(ser4cpp::rseq_t& buffer,
     case (GroupVariation::Group32Var8):
         return CountIndexParser::From<Group32Var8>(count, numparser).Process(record, buffer, pHandler, pLogger);
 
+    case (GroupVariation::Group40Var1):
+        return CountIndexParser::From<Group40Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group40Var2):
+        return CountIndexParser::From<Group40Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group40Var3):
+        return CountIndexParser::From<Group40Var3>(count, numparser).Process(record, buffer, pHandler, pLogger);
+    case (GroupVariation::Group40Var4):
+        return CountIndexParser::From<Group40Var4>(count, numparser).Process(record, buffer, pHandler, pLogger);
+
     case (GroupVariation::Group41Var1):
         return CountIndexParser::From<Group41Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
     case (GroupVariation::Group41Var2):
@@ -21,6 +21,7 @@
 #define OPENDNP3_RANGEPARSER_H
 
 #include "app/Range.h"
+#include "app/parsing/BatchedCollection.h"
 #include "app/parsing/BitReader.h"
 #include "app/parsing/BufferedCollection.h"
 #include "app/parsing/IAPDUHandler.h"
@@ -130,15 +131,7 @@ void RangeParser::InvokeRangeOf(const HeaderRecord& record,
                                 const ser4cpp::rseq_t& buffer,
                                 IAPDUHandler& handler)
 {
-    const auto COUNT = range.Count();
-
-    auto read = [range](ser4cpp::rseq_t& buffer, uint32_t pos) {
-        typename Descriptor::Target target;
-        Descriptor::ReadTarget(buffer, target);
-        return WithIndex(target, range.start + pos);
-    };
-
-    auto collection = CreateBufferedCollection<Indexed<typename Descriptor::Target>>(buffer, COUNT, read);
+    BatchedCollection<Descriptor> collection(buffer, range.start, range.Count());
 
     handler.OnHeader(RangeHeader(record, range), collection);
 }
@@ -174,14 +167,7 @@ void RangeParser::InvokeRangeBitfieldType(const HeaderRecord& record,
                                           const ser4cpp::rseq_t& buffer,
                                           IAPDUHandler& handler)
 {
-    const auto COUNT = range.Count();
-
-    auto read = [range](ser4cpp::rseq_t& buffer, uint32_t pos) -> Indexed<Type> {
-        Type value(GetBit(buffer, pos));
-        return WithIndex(value, range.start + pos);
-    };
-
-    auto collection = CreateBufferedCollection<Indexed<Type>>(buffer, COUNT, read);
+    BitfieldCollection<Type> collection(buffer, range.start, range.Count());
 
     handler.OnHeader(RangeHeader(record, range), collection);
 }
@@ -198,14 +184,7 @@ void RangeParser::InvokeRangeDoubleBitfieldType(const HeaderRecord& record,
                                                 const ser4cpp::rseq_t& buffer,
                                                 IAPDUHandler& handler)
 {
-    const auto COUNT = range.Count();
-
-    auto read = [range](ser4cpp::rseq_t& buffer, size_t pos) -> Indexed<Type> {
-        Type value(GetDoubleBit(buffer, pos));
-        return WithIndex(value, static_cast<uint16_t>(range.start + pos));
-    };
-
-    auto collection = CreateBufferedCollection<Indexed<Type>>(buffer, COUNT, read);
+    DoubleBitfieldCollection<Type> collection(buffer, range.start, range.Count());
 
     handler.OnHeader(RangeHeader(record, range), collection);
 }
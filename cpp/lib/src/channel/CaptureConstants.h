@@ -0,0 +1,62 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_CAPTURECONSTANTS_H
+#define OPENDNP3_CAPTURECONSTANTS_H
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/// Direction of a captured record relative to the local stack
+enum class CaptureDirection : uint8_t
+{
+    Rx,
+    Tx
+};
+
+// libpcap file header
+const uint32_t PCAP_MAGIC_MICROS = 0xA1B2C3D4;
+const uint32_t PCAP_MAGIC_NANOS = 0xA1B23C4D;
+const uint16_t PCAP_VERSION_MAJOR = 2;
+const uint16_t PCAP_VERSION_MINOR = 4;
+const uint8_t PCAP_FILE_HEADER_SIZE = 24;
+const uint8_t PCAP_RECORD_HEADER_SIZE = 16;
+
+// pcapng block types and options
+const uint32_t PCAPNG_SECTION_HEADER_BLOCK = 0x0A0D0D0A;
+const uint32_t PCAPNG_INTERFACE_DESCRIPTION_BLOCK = 0x00000001;
+const uint32_t PCAPNG_SIMPLE_PACKET_BLOCK = 0x00000003;
+const uint32_t PCAPNG_ENHANCED_PACKET_BLOCK = 0x00000006;
+const uint32_t PCAPNG_BYTE_ORDER_MAGIC = 0x1A2B3C4D;
+const uint16_t PCAPNG_OPTION_END = 0;
+const uint16_t PCAPNG_OPTION_IF_TSRESOL = 9;
+const uint16_t PCAPNG_OPTION_EPB_FLAGS = 2;
+const uint32_t PCAPNG_EPB_FLAGS_INBOUND = 0x01;
+const uint32_t PCAPNG_EPB_FLAGS_OUTBOUND = 0x02;
+const uint32_t PCAPNG_EPB_FLAGS_DIRECTION_MASK = 0x03;
+
+// common to both formats
+const uint16_t CAPTURE_LINKTYPE_USER0 = 147;
+const uint32_t CAPTURE_SNAPLEN = 65535;
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,306 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/CaptureReader.h"
+
+#include "logging/LogMacros.h"
+
+#include "opendnp3/logging/LogLevels.h"
+
+#include <ser4cpp/serialization/LittleEndian.h>
+
+#include <fstream>
+#include <iterator>
+
+namespace opendnp3
+{
+
+namespace
+{
+    uint16_t Swap16(uint16_t value)
+    {
+        return static_cast<uint16_t>((value >> 8) | (value << 8));
+    }
+
+    uint32_t Swap32(uint32_t value)
+    {
+        return ((value & 0xFF000000) >> 24) | ((value & 0x00FF0000) >> 8) | ((value & 0x0000FF00) << 8)
+            | ((value & 0x000000FF) << 24);
+    }
+
+    uint16_t Read16(const uint8_t* data, bool swap)
+    {
+        const auto value = ser4cpp::UInt16::read(data);
+        return swap ? Swap16(value) : value;
+    }
+
+    uint32_t Read32(const uint8_t* data, bool swap)
+    {
+        const auto value = ser4cpp::UInt32::read(data);
+        return swap ? Swap32(value) : value;
+    }
+
+    // convert a timestamp expressed in 'unitsPerSecond' to microseconds
+    uint64_t ToMicros(uint64_t timestamp, uint64_t unitsPerSecond)
+    {
+        const uint64_t MICROS_PER_SECOND = 1000000;
+        if (unitsPerSecond >= MICROS_PER_SECOND)
+        {
+            return timestamp / (unitsPerSecond / MICROS_PER_SECOND);
+        }
+        return timestamp * (MICROS_PER_SECOND / unitsPerSecond);
+    }
+
+    // decode the pcapng if_tsresol option value
+    uint64_t UnitsPerSecond(uint8_t tsresol)
+    {
+        const uint8_t exponent = tsresol & 0x7F;
+        const bool base2 = (tsresol & 0x80) != 0;
+        if (exponent > (base2 ? 63 : 19))
+        {
+            return 1000000;
+        }
+
+        uint64_t units = 1;
+        for (uint8_t i = 0; i < exponent; ++i)
+        {
+            units *= base2 ? 2 : 10;
+        }
+        return units;
+    }
+} // namespace
+
+CaptureReader::CaptureReader(const Logger& logger) : logger(logger) {}
+
+bool CaptureReader::Load(const std::string& path)
+{
+    this->contents.clear();
+    this->records.clear();
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        FORMAT_LOG_BLOCK(this->logger, flags::ERR, "Unable to open capture file: %s", path.c_str());
+        return false;
+    }
+
+    this->contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    const ser4cpp::rseq_t input(this->contents.data(), static_cast<uint32_t>(this->contents.size()));
+
+    if (input.length() < 4)
+    {
+        SIMPLE_LOG_BLOCK(this->logger, flags::ERR, "Capture file is too short");
+        return false;
+    }
+
+    const auto magic = Read32(input, false);
+
+    if (magic == PCAPNG_SECTION_HEADER_BLOCK)
+    {
+        return this->ParsePcapng(input);
+    }
+
+    if (magic == PCAP_MAGIC_MICROS || magic == PCAP_MAGIC_NANOS || Swap32(magic) == PCAP_MAGIC_MICROS
+        || Swap32(magic) == PCAP_MAGIC_NANOS)
+    {
+        return this->ParsePcap(input);
+    }
+
+    FORMAT_LOG_BLOCK(this->logger, flags::ERR, "Unknown capture file magic: 0x%08X", magic);
+    return false;
+}
+
+bool CaptureReader::ParsePcap(ser4cpp::rseq_t input)
+{
+    if (input.length() < PCAP_FILE_HEADER_SIZE)
+    {
+        SIMPLE_LOG_BLOCK(this->logger, flags::ERR, "Truncated pcap file header");
+        return false;
+    }
+
+    const auto raw = Read32(input, false);
+    const bool swap = (raw != PCAP_MAGIC_MICROS) && (raw != PCAP_MAGIC_NANOS);
+    const auto magic = swap ? Swap32(raw) : raw;
+    const uint64_t unitsPerSecond = (magic == PCAP_MAGIC_NANOS) ? 1000000000 : 1000000;
+
+    input.advance(PCAP_FILE_HEADER_SIZE);
+
+    while (input.is_not_empty())
+    {
+        if (input.length() < PCAP_RECORD_HEADER_SIZE)
+        {
+            SIMPLE_LOG_BLOCK(this->logger, flags::WARN, "Ignoring truncated pcap record header");
+            break;
+        }
+
+        const uint64_t seconds = Read32(input, swap);
+        const uint64_t fraction = Read32(input + 4, swap);
+        const auto captured = Read32(input + 8, swap);
+        input.advance(PCAP_RECORD_HEADER_SIZE);
+
+        if (input.length() < captured)
+        {
+            SIMPLE_LOG_BLOCK(this->logger, flags::WARN, "Ignoring truncated pcap record");
+            break;
+        }
+
+        const auto micros = seconds * 1000000 + ToMicros(fraction, unitsPerSecond);
+        this->records.emplace_back(CaptureDirection::Rx, micros, input.take(captured));
+        input.advance(captured);
+    }
+
+    return true;
+}
+
+bool CaptureReader::ParsePcapng(ser4cpp::rseq_t input)
+{
+    bool swap = false;
+    std::vector<uint64_t> interfaces;
+
+    while (input.is_not_empty())
+    {
+        if (input.length() < 12)
+        {
+            SIMPLE_LOG_BLOCK(this->logger, flags::WARN, "Ignoring truncated pcapng block");
+            break;
+        }
+
+        const auto type = Read32(input, false);
+
+        if (type == PCAPNG_SECTION_HEADER_BLOCK)
+        {
+            // the byte order magic defines the endianness of the whole section
+            const auto bom = Read32(input + 8, false);
+            if (bom == PCAPNG_BYTE_ORDER_MAGIC)
+            {
+                swap = false;
+            }
+            else if (Swap32(bom) == PCAPNG_BYTE_ORDER_MAGIC)
+            {
+                swap = true;
+            }
+            else
+            {
+                FORMAT_LOG_BLOCK(this->logger, flags::ERR, "Bad pcapng byte order magic: 0x%08X", bom);
+                return false;
+            }
+            interfaces.clear();
+        }
+
+        const auto length = Read32(input + 4, swap);
+        if (length < 12 || (length % 4) != 0 || length > input.length())
+        {
+            FORMAT_LOG_BLOCK(this->logger, flags::WARN, "Ignoring pcapng block with bad length: %u", length);
+            break;
+        }
+
+        const auto body = input.skip(8).take(length - 12);
+
+        switch (Read32(input, swap))
+        {
+        case (PCAPNG_INTERFACE_DESCRIPTION_BLOCK):
+        {
+            uint64_t unitsPerSecond = 1000000;
+            if (body.length() >= 8)
+            {
+                auto options = body.skip(8);
+                while (options.length() >= 4)
+                {
+                    const auto code = Read16(options, swap);
+                    const auto optLength = Read16(options + 2, swap);
+                    options.advance(4);
+                    if (code == PCAPNG_OPTION_END || optLength > options.length())
+                    {
+                        break;
+                    }
+                    if (code == PCAPNG_OPTION_IF_TSRESOL && optLength == 1)
+                    {
+                        unitsPerSecond = UnitsPerSecond(options[0]);
+                    }
+                    options.advance((optLength + 3) & ~3);
+                }
+            }
+            interfaces.push_back(unitsPerSecond);
+            break;
+        }
+        case (PCAPNG_ENHANCED_PACKET_BLOCK):
+        {
+            if (body.length() < 20)
+            {
+                break;
+            }
+
+            const auto id = Read32(body, swap);
+            const uint64_t timestamp = (static_cast<uint64_t>(Read32(body + 4, swap)) << 32) | Read32(body + 8, swap);
+            const auto captured = Read32(body + 12, swap);
+            const auto padded = (captured + 3) & ~3u;
+
+            if (body.length() < (20 + padded))
+            {
+                SIMPLE_LOG_BLOCK(this->logger, flags::WARN, "Ignoring truncated pcapng packet");
+                break;
+            }
+
+            auto direction = CaptureDirection::Rx;
+            auto options = body.skip(20 + padded);
+            while (options.length() >= 4)
+            {
+                const auto code = Read16(options, swap);
+                const auto optLength = Read16(options + 2, swap);
+                options.advance(4);
+                if (code == PCAPNG_OPTION_END || optLength > options.length())
+                {
+                    break;
+                }
+                if (code == PCAPNG_OPTION_EPB_FLAGS && optLength == 4)
+                {
+                    const auto flags = Read32(options, swap) & PCAPNG_EPB_FLAGS_DIRECTION_MASK;
+                    direction = (flags == PCAPNG_EPB_FLAGS_OUTBOUND) ? CaptureDirection::Tx : CaptureDirection::Rx;
+                }
+                options.advance((optLength + 3) & ~3);
+            }
+
+            const uint64_t unitsPerSecond = (id < interfaces.size()) ? interfaces[id] : 1000000;
+            this->records.emplace_back(direction, ToMicros(timestamp, unitsPerSecond), body.skip(20).take(captured));
+            break;
+        }
+        case (PCAPNG_SIMPLE_PACKET_BLOCK):
+        {
+            if (body.length() < 4)
+            {
+                break;
+            }
+
+            const auto original = Read32(body, swap);
+            const auto data = body.skip(4);
+            this->records.emplace_back(CaptureDirection::Rx, 0, data.take(original));
+            break;
+        }
+        default:
+            break;
+        }
+
+        input.advance(length);
+    }
+
+    return true;
+}
+
+} // namespace opendnp3
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_CAPTUREREADER_H
+#define OPENDNP3_CAPTUREREADER_H
+
+#include "channel/CaptureConstants.h"
+
+#include "opendnp3/logging/Logger.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <ser4cpp/container/SequenceTypes.h>
+
+#include <string>
+#include <vector>
+
+namespace opendnp3
+{
+
+/// A single socket read/write recorded in a capture file
+struct CaptureRecord
+{
+    CaptureRecord(CaptureDirection direction, uint64_t micros, const ser4cpp::rseq_t& data)
+        : direction(direction), micros(micros), data(data)
+    {
+    }
+
+    CaptureDirection direction;
+    // microseconds since the epoch
+    uint64_t micros;
+    // points into the memory owned by the CaptureReader
+    ser4cpp::rseq_t data;
+};
+
+/**
+ * Loads a pcap or pcapng file into memory and indexes the packet records
+ *
+ * Both byte orders are accepted. pcap files carry no direction so every record is reported as Rx.
+ */
+class CaptureReader final : private Uncopyable
+{
+public:
+    explicit CaptureReader(const Logger& logger);
+
+    bool Load(const std::string& path);
+
+    const std::vector<CaptureRecord>& Records() const
+    {
+        return records;
+    }
+
+private:
+    bool ParsePcap(ser4cpp::rseq_t input);
+    bool ParsePcapng(ser4cpp::rseq_t input);
+
+    Logger logger;
+    std::vector<uint8_t> contents;
+    std::vector<CaptureRecord> records;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,249 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/CaptureWriter.h"
+
+#include "logging/LogMacros.h"
+
+#include "opendnp3/logging/LogLevels.h"
+
+#include <ser4cpp/container/StaticBuffer.h>
+#include <ser4cpp/serialization/LittleEndian.h>
+#include <ser4cpp/util/Comparisons.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+namespace opendnp3
+{
+
+std::shared_ptr<CaptureWriter> CaptureWriter::Create(const Logger& logger,
+                                                     const std::string& path,
+                                                     CaptureFormat format,
+                                                     std::error_code& ec)
+{
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        ec = std::error_code(errno, std::generic_category());
+        return nullptr;
+    }
+
+    auto writer = std::make_shared<CaptureWriter>(logger, file, format);
+    if (!writer->WriteFileHeader())
+    {
+        ec = std::make_error_code(std::errc::io_error);
+        return nullptr;
+    }
+
+    return writer;
+}
+
+CaptureWriter::CaptureWriter(const Logger& logger, FILE* file, CaptureFormat format)
+    : logger(logger), file(file), format(format), thread([this]() { this->Run(); })
+{
+}
+
+CaptureWriter::~CaptureWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->shutdown = true;
+    }
+    this->condition.notify_one();
+    this->thread.join();
+
+    std::fclose(this->file);
+}
+
+void CaptureWriter::Write(CaptureDirection direction, const ser4cpp::rseq_t& data)
+{
+    if (this->failed || (this->format == CaptureFormat::PCAP && direction != CaptureDirection::Rx))
+    {
+        return;
+    }
+
+    const auto micros = NowMicros();
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        if (this->format == CaptureFormat::PCAPNG)
+        {
+            this->EncodePcapngRecord(direction, micros, data);
+        }
+        else
+        {
+            this->EncodePcapRecord(micros, data);
+        }
+    }
+
+    this->condition.notify_one();
+}
+
+void CaptureWriter::Run()
+{
+    std::vector<uint8_t> batch;
+
+    while (true)
+    {
+        size_t dropped = 0;
+
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->condition.wait(lock, [this]() { return this->shutdown || !this->pending.empty(); });
+
+            if (this->pending.empty())
+            {
+                return;
+            }
+
+            batch.swap(this->pending);
+            std::swap(dropped, this->numDropped);
+        }
+
+        if (dropped > 0)
+        {
+            FORMAT_LOG_BLOCK(this->logger, flags::WARN, "Capture writer fell behind, dropped %zu record(s)", dropped);
+        }
+
+        const bool success = (std::fwrite(batch.data(), 1, batch.size(), this->file) == batch.size())
+            && (std::fflush(this->file) == 0);
+
+        batch.clear();
+
+        if (!success)
+        {
+            FORMAT_LOG_BLOCK(this->logger, flags::ERR, "Capture disabled, unable to write capture file: %s",
+                             std::strerror(errno));
+
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->failed = true;
+            this->pending.clear();
+            return;
+        }
+    }
+}
+
+bool CaptureWriter::WriteFileHeader()
+{
+    ser4cpp::StaticBuffer<48> buffer;
+    auto dest = buffer.as_wseq();
+
+    if (this->format == CaptureFormat::PCAPNG)
+    {
+        const uint32_t SHB_LENGTH = 28;
+        const uint32_t IDB_LENGTH = 20;
+        const uint16_t reserved = 0;
+
+        // section header block, section length is unspecified (-1)
+        ser4cpp::LittleEndian::write(dest, PCAPNG_SECTION_HEADER_BLOCK, SHB_LENGTH, PCAPNG_BYTE_ORDER_MAGIC,
+                                     static_cast<uint16_t>(1), static_cast<uint16_t>(0), static_cast<uint32_t>(0xFFFFFFFF),
+                                     static_cast<uint32_t>(0xFFFFFFFF), SHB_LENGTH);
+
+        // single interface with the default microsecond resolution
+        ser4cpp::LittleEndian::write(dest, PCAPNG_INTERFACE_DESCRIPTION_BLOCK, IDB_LENGTH, CAPTURE_LINKTYPE_USER0,
+                                     reserved, CAPTURE_SNAPLEN, IDB_LENGTH);
+    }
+    else
+    {
+        const int32_t thiszone = 0;
+        const uint32_t sigfigs = 0;
+        ser4cpp::LittleEndian::write(dest, PCAP_MAGIC_MICROS, PCAP_VERSION_MAJOR, PCAP_VERSION_MINOR, thiszone, sigfigs,
+                                     CAPTURE_SNAPLEN, static_cast<uint32_t>(CAPTURE_LINKTYPE_USER0));
+    }
+
+    // written synchronously before any record so Create() can report an unusable file
+    std::lock_guard<std::mutex> lock(this->mutex);
+    const auto num = buffer.length() - dest.length();
+    return (std::fwrite(buffer.data(), 1, num, this->file) == num) && (std::fflush(this->file) == 0);
+}
+
+void CaptureWriter::EncodePcapRecord(uint64_t micros, const ser4cpp::rseq_t& data)
+{
+    const auto length = static_cast<uint32_t>(data.length());
+    const auto captured = ser4cpp::min<uint32_t>(length, CAPTURE_SNAPLEN);
+
+    if (this->pending.size() + PCAP_RECORD_HEADER_SIZE + captured > MAX_PENDING_BYTES)
+    {
+        ++this->numDropped;
+        return;
+    }
+
+    ser4cpp::StaticBuffer<PCAP_RECORD_HEADER_SIZE> header;
+    auto dest = header.as_wseq();
+    ser4cpp::LittleEndian::write(dest, static_cast<uint32_t>(micros / 1000000), static_cast<uint32_t>(micros % 1000000),
+                                 captured, length);
+
+    this->Append(header.data(), header.length());
+    this->Append(static_cast<const uint8_t*>(data), captured);
+}
+
+void CaptureWriter::EncodePcapngRecord(CaptureDirection direction, uint64_t micros, const ser4cpp::rseq_t& data)
+{
+    const auto length = static_cast<uint32_t>(data.length());
+    const auto captured = ser4cpp::min<uint32_t>(length, CAPTURE_SNAPLEN);
+    const uint32_t padding = (4 - (captured % 4)) % 4;
+
+    // header (28) + data + padding + epb_flags option (8) + end of options (4) + trailing length (4)
+    const uint32_t total = 44 + captured + padding;
+
+    if (this->pending.size() + total > MAX_PENDING_BYTES)
+    {
+        ++this->numDropped;
+        return;
+    }
+
+    const uint32_t interfaceId = 0;
+    const uint32_t flags
+        = (direction == CaptureDirection::Rx) ? PCAPNG_EPB_FLAGS_INBOUND : PCAPNG_EPB_FLAGS_OUTBOUND;
+
+    ser4cpp::StaticBuffer<28> header;
+    auto hdest = header.as_wseq();
+    ser4cpp::LittleEndian::write(hdest, PCAPNG_ENHANCED_PACKET_BLOCK, total, interfaceId,
+                                 static_cast<uint32_t>(micros >> 32), static_cast<uint32_t>(micros & 0xFFFFFFFF), captured,
+                                 length);
+
+    const uint8_t zeros[4] = {0, 0, 0, 0};
+
+    ser4cpp::StaticBuffer<16> trailer;
+    auto tdest = trailer.as_wseq();
+    ser4cpp::LittleEndian::write(tdest, PCAPNG_OPTION_EPB_FLAGS, static_cast<uint16_t>(4), flags, PCAPNG_OPTION_END,
+                                 static_cast<uint16_t>(0), total);
+
+    this->Append(header.data(), header.length());
+    this->Append(static_cast<const uint8_t*>(data), captured);
+    this->Append(zeros, padding);
+    this->Append(trailer.data(), trailer.length());
+}
+
+void CaptureWriter::Append(const uint8_t* data, size_t length)
+{
+    this->pending.insert(this->pending.end(), data, data + length);
+}
+
+uint64_t CaptureWriter::NowMicros()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count());
+}
+
+} // namespace opendnp3
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_CAPTUREWRITER_H
+#define OPENDNP3_CAPTUREWRITER_H
+
+#include "channel/CaptureConstants.h"
+
+#include "opendnp3/channel/CaptureFormat.h"
+#include "opendnp3/logging/Logger.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <ser4cpp/container/SequenceTypes.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * Records the raw bytes of every channel read/write completion to a pcap or pcapng file
+ *
+ * Writes are serialized internally so a single writer can be shared between the primary
+ * and backup IOHandler of a channel. Records are only encoded into memory by Write(); a
+ * dedicated thread performs the file I/O so the channel strand never blocks on the disk.
+ * The first failed write is logged and permanently disables the writer.
+ */
+class CaptureWriter final : private Uncopyable
+{
+public:
+    static std::shared_ptr<CaptureWriter> Create(const Logger& logger,
+                                                 const std::string& path,
+                                                 CaptureFormat format,
+                                                 std::error_code& ec);
+
+    CaptureWriter(const Logger& logger, FILE* file, CaptureFormat format);
+
+    // flushes any buffered records before closing the file
+    ~CaptureWriter();
+
+    void Write(CaptureDirection direction, const ser4cpp::rseq_t& data);
+
+    bool IsFailed() const
+    {
+        return this->failed;
+    }
+
+    // records are dropped rather than buffered beyond this many bytes
+    static const size_t MAX_PENDING_BYTES = 1 << 20;
+
+private:
+    bool WriteFileHeader();
+    void EncodePcapRecord(uint64_t micros, const ser4cpp::rseq_t& data);
+    void EncodePcapngRecord(CaptureDirection direction, uint64_t micros, const ser4cpp::rseq_t& data);
+    void Append(const uint8_t* data, size_t length);
+
+    void Run();
+
+    static uint64_t NowMicros();
+
+    Logger logger;
+    FILE* const file;
+    const CaptureFormat format;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<uint8_t> pending;
+    size_t numDropped = 0;
+    bool shutdown = false;
+    std::atomic<bool> failed{false};
+
+    std::thread thread;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/ConnectionAdmission.h"
+
+#include <algorithm>
+
+namespace opendnp3
+{
+
+ConnectionAdmission::ConnectionAdmission(uint32_t maxInFlight) : maxInFlight(maxInFlight) {}
+
+void ConnectionAdmission::SetMaxInFlight(uint32_t maxInFlight)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    this->maxInFlight = maxInFlight;
+    this->AdmitQueued();
+}
+
+ConnectionAdmission::ticket_t ConnectionAdmission::Request(const std::shared_ptr<exe4cpp::IExecutor>& executor,
+                                                           uint8_t priority,
+                                                           const std::function<void()>& onAdmitted)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    const auto ticket = this->nextTicket++;
+    this->queue.emplace(Key{priority, ticket}, Pending{executor, onAdmitted});
+    this->AdmitQueued();
+
+    return ticket;
+}
+
+void ConnectionAdmission::Release(ticket_t ticket)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    if (this->inFlight.erase(ticket) > 0)
+    {
+        this->AdmitQueued();
+        return;
+    }
+
+    const auto pending = std::find_if(this->queue.begin(), this->queue.end(),
+                                      [ticket](const std::pair<const Key, Pending>& entry) {
+                                          return entry.first.ticket == ticket;
+                                      });
+
+    if (pending != this->queue.end())
+    {
+        this->queue.erase(pending);
+    }
+}
+
+uint32_t ConnectionAdmission::NumInFlight() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    return static_cast<uint32_t>(this->inFlight.size());
+}
+
+size_t ConnectionAdmission::NumQueued() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    return this->queue.size();
+}
+
+bool ConnectionAdmission::HasFreeSlot() const
+{
+    return (this->maxInFlight == 0) || (this->inFlight.size() < this->maxInFlight);
+}
+
+void ConnectionAdmission::AdmitQueued()
+{
+    while (!this->queue.empty() && this->HasFreeSlot())
+    {
+        const auto next = this->queue.begin();
+        this->inFlight.insert(next->first.ticket);
+        next->second.executor->post(next->second.onAdmitted);
+        this->queue.erase(next);
+    }
+}
+
+} // namespace opendnp3
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_CONNECTIONADMISSION_H
+#define OPENDNP3_CONNECTIONADMISSION_H
+
+#include "opendnp3/util/Uncopyable.h"
+
+#include <exe4cpp/IExecutor.h>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+
+namespace opendnp3
+{
+
+/**
+ * Limits how many connection attempts are in flight at once across all of the channels of a manager
+ *
+ * Channels queue a request before connecting and release it when the attempt completes. Queued requests are
+ * admitted by descending priority, then in the order they were made.
+ */
+class ConnectionAdmission final : private Uncopyable
+{
+public:
+    using ticket_t = uint64_t;
+
+    /**
+     * @param maxInFlight maximum number of admitted requests, 0 for no limit
+     */
+    explicit ConnectionAdmission(uint32_t maxInFlight = 0);
+
+    void SetMaxInFlight(uint32_t maxInFlight);
+
+    /**
+     * Queue a request for a connection slot
+     *
+     * @param executor executor the callback is posted to, never invoked synchronously
+     * @param priority higher values are admitted first
+     * @param onAdmitted invoked once the slot is granted
+     * @return ticket identifying the request
+     */
+    ticket_t Request(const std::shared_ptr<exe4cpp::IExecutor>& executor,
+                     uint8_t priority,
+                     const std::function<void()>& onAdmitted);
+
+    /**
+     * Withdraw a queued request or free the slot of an admitted one
+     */
+    void Release(ticket_t ticket);
+
+    uint32_t NumInFlight() const;
+
+    size_t NumQueued() const;
+
+private:
+    struct Key
+    {
+        uint8_t priority;
+        ticket_t ticket;
+
+        bool operator<(const Key& other) const
+        {
+            return (priority == other.priority) ? (ticket < other.ticket) : (priority > other.priority);
+        }
+    };
+
+    struct Pending
+    {
+        std::shared_ptr<exe4cpp::IExecutor> executor;
+        std::function<void()> onAdmitted;
+    };
+
+    bool HasFreeSlot() const;
+
+    void AdmitQueued();
+
+    mutable std::mutex mutex;
+    uint32_t maxInFlight;
+    ticket_t nextTicket = 1;
+    std::map<Key, Pending> queue;
+    std::set<ticket_t> inFlight;
+};
+
+} // namespace opendnp3
+
+#endif
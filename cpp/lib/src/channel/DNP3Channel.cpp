@@ -49,6 +49,14 @@ DNP3Channel::DNP3Channel(const Logger& logger,
             masterScheduler->ChannelChanging(pause);
         }
     });
+
+    const auto primaryFullDuplex = this->iohandlersManager->IsFullDuplex(false);
+    const auto backupFullDuplex = this->iohandlersManager->IsFullDuplex(true);
+    this->scheduler->SetFullDuplex(primaryFullDuplex);
+    this->iohandlersManager->ChannelReservationChanged.connect(
+        [masterScheduler = this->scheduler, primaryFullDuplex, backupFullDuplex](const bool isBackup) {
+            masterScheduler->SetFullDuplex(isBackup ? backupFullDuplex : primaryFullDuplex);
+        });
 }
 
 DNP3Channel::~DNP3Channel()
@@ -130,6 +138,17 @@ std::shared_ptr<IOutstation> DNP3Channel::AddOutstation(const std::string& id,
     return this->AddStack(config.link, stack);
 }
 
+void DNP3Channel::SetMasterSchedulerConfig(const MasterSchedulerConfig& config)
+{
+    auto set = [self = this->shared_from_this(), config]() {
+        if (self->scheduler)
+        {
+            self->scheduler->Configure(config);
+        }
+    };
+    this->executor->post(set);
+}
+
 void DNP3Channel::AddStatisticsHandler(const StatisticsChangeHandler_t& statisticsChangeHandler)
 {
     this->iohandlersManager->AddStatisticsHandler(statisticsChangeHandler);
@@ -140,6 +159,26 @@ void DNP3Channel::RemoveStatisticsHandler()
     this->iohandlersManager->RemoveStatisticsHandler();
 }
 
+bool DNP3Channel::StartCapture(const std::string& path, CaptureFormat format)
+{
+    std::error_code ec;
+    auto writer = CaptureWriter::Create(this->logger, path, format, ec);
+    if (!writer)
+    {
+        FORMAT_LOG_BLOCK(this->logger, flags::ERR, "Unable to start capture to %s: %s", path.c_str(),
+                         ec.message().c_str());
+        return false;
+    }
+
+    this->iohandlersManager->SetCapture(writer);
+    return true;
+}
+
+void DNP3Channel::StopCapture()
+{
+    this->iohandlersManager->SetCapture(nullptr);
+}
+
 template<class T> std::shared_ptr<T> DNP3Channel::AddStack(const LinkConfig& link, const std::shared_ptr<T>& stack)
 {
 
@@ -70,6 +70,11 @@ public:
 
     void AddStatisticsHandler(const StatisticsChangeHandler_t& statisticsChangeHandler) override;
     void RemoveStatisticsHandler() override;
+
+    void SetMasterSchedulerConfig(const MasterSchedulerConfig& config) override;
+
+    bool StartCapture(const std::string& path, CaptureFormat format) override;
+    void StopCapture() override;
 private:
     void ShutdownImpl();
 
@@ -86,6 +86,8 @@ void IOHandler::OnReadComplete(const std::error_code& ec, size_t num)
     {
         this->statistics.numBytesRx += num;
 
+        this->Capture(CaptureDirection::Rx, this->parser.WriteBuff().readonly().take(num));
+
         this->parser.OnRead(num, *this);
         this->BeginRead();
     }
@@ -107,6 +109,8 @@ void IOHandler::OnWriteComplete(const std::error_code& ec, size_t num)
 
         if (!_sessionsManager->TxQueue().empty())
         {
+            this->Capture(CaptureDirection::Tx, _sessionsManager->TxQueue().front().TxData.take(num));
+
             const auto session = _sessionsManager->TxQueue().front().Session;
             _sessionsManager->TxQueue().pop_front();
             session->OnTxReady();
@@ -116,12 +120,14 @@ void IOHandler::OnWriteComplete(const std::error_code& ec, size_t num)
     }
 }
 
-bool IOHandler::BeginTransmit(const std::shared_ptr<ILinkSession>& session, const ser4cpp::rseq_t& data)
+bool IOHandler::BeginTransmit(const std::shared_ptr<ILinkSession>& session,
+                              const ser4cpp::rseq_t& data,
+                              uint32_t numFrames)
 {
     std::lock_guard<std::mutex> lock{ _mtx };
     if (this->channel)
     {
-        _sessionsManager->TxQueue().emplace_back(data, session);
+        _sessionsManager->TxQueue().emplace_back(data, session, numFrames);
         return this->CheckForSend();
     }
     SIMPLE_LOG_BLOCK(logger, flags::ERR, "Router received transmit request while offline")
@@ -224,6 +230,11 @@ bool IOHandler::OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& u
     return false;
 }
 
+ser4cpp::wseq_t IOHandler::GetUserDataBuffer(const LinkHeaderFields& header, size_t length)
+{
+    return _sessionsManager->GetUserDataBuffer(header, length);
+}
+
 void IOHandler::BeginRead()
 {
     if (this->channel)
@@ -239,8 +250,10 @@ bool IOHandler::CheckForSend()
         return false;
     }
 
-    ++this->statistics.numLinkFrameTx;
-    return this->channel->BeginWrite(_sessionsManager->TxQueue().front().TxData);
+    // a single write can carry every frame of a fragment
+    const auto& tx = _sessionsManager->TxQueue().front();
+    this->statistics.numLinkFrameTx += tx.NumFrames;
+    return this->channel->BeginWrite(tx.TxData);
 }
 
 void IOHandler::AddStatisticsHandler(const StatisticsChangeHandler_t& statisticsChangeHandler)
@@ -257,6 +270,26 @@ void IOHandler::RemoveStatisticsHandler()
     this->parser.AddStatisticsHandler(nullptr);
 }
 
+void IOHandler::SetCapture(const std::shared_ptr<CaptureWriter>& writer)
+{
+    std::lock_guard<std::mutex> lock{ _mtx };
+    _capture = writer;
+}
+
+void IOHandler::Capture(CaptureDirection direction, const ser4cpp::rseq_t& data) const
+{
+    std::shared_ptr<CaptureWriter> writer;
+    {
+        std::lock_guard<std::mutex> lock{ _mtx };
+        writer = _capture;
+    }
+
+    if (writer)
+    {
+        writer->Write(direction, data);
+    }
+}
+
 void IOHandler::Reset(bool onFail, bool doNotNotify)
 {
     if (this->channel)
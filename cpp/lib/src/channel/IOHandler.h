@@ -21,6 +21,7 @@
 #define OPENDNP3_IOHANDLER_H
 
 #include "ISharedChannelData.h"
+#include "channel/CaptureWriter.h"
 #include "channel/IAsyncChannel.h"
 #include "link/LinkLayerParser.h"
 
@@ -61,7 +62,9 @@ public:
 
     /// --- implement ILinkTx ---
 
-    bool BeginTransmit(const std::shared_ptr<ILinkSession>& session, const ser4cpp::rseq_t& data);
+    bool BeginTransmit(const std::shared_ptr<ILinkSession>& session,
+                       const ser4cpp::rseq_t& data,
+                       uint32_t numFrames);
 
     // Begin sending messages to the context
     bool Prepare(NewChannelOpenedCallback_t channelOpenedCallback = nullptr);
@@ -75,6 +78,15 @@ public:
     void AddStatisticsHandler(const StatisticsChangeHandler_t& statisticsChangeHandler);
     void RemoveStatisticsHandler();
 
+    // Record all subsequent read/write completions to the writer, nullptr stops the capture
+    void SetCapture(const std::shared_ptr<CaptureWriter>& writer);
+
+    // true if requests and responses can be in flight in both directions at the same time
+    virtual bool IsFullDuplex() const
+    {
+        return true;
+    }
+
 protected:
     // ------ Implement IChannelCallbacks -----
 
@@ -99,6 +111,12 @@ protected:
     // Called by the super class when a new channel is available
     void OnNewChannel(const std::shared_ptr<IAsyncChannel>& newChannel);
 
+    // Called by super classes whose channels never corrupt or drop bytes, i.e. TCP and TLS
+    void SetReliableTransport()
+    {
+        this->parser.SetReliableTransport(true);
+    }
+
     const bool close_existing;
     Logger logger;
     const std::shared_ptr<IChannelListener> listener;
@@ -114,10 +132,12 @@ private:
 
     // called by the parser when a complete frame is read
     bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) final;
+    ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length) final;
 
     void Reset(bool onFail = true, bool doNotNotify = false);
     void BeginRead();
     bool CheckForSend();
+    void Capture(CaptureDirection direction, const ser4cpp::rseq_t& data) const;
 
     LinkLayerParser parser;
 
@@ -126,6 +146,8 @@ private:
 
     std::shared_ptr<ISharedChannelData> _sessionsManager;
 
+    std::shared_ptr<CaptureWriter> _capture;
+
     mutable std::mutex _mtx;
 
     bool _isPrimary{ true };
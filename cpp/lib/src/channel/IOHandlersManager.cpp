@@ -17,7 +17,8 @@ namespace opendnp3
         const ChannelRetry& retry,
         ChannelConnectionOptions primarySettings,
         boost::optional<ChannelConnectionOptions> backupSettings,
-        const std::string& adapter
+        const std::string& adapter,
+        const std::shared_ptr<ConnectionAdmission>& admission
     )
         : _logger(logger)
         , _primarySettings(std::move(primarySettings))
@@ -60,7 +61,8 @@ namespace opendnp3
                 adapter,
                 _sessionsManager,
                 true,
-                callback
+                callback,
+                admission
             );
         }
         else if (_primarySettings.UseSerial())
@@ -111,7 +113,8 @@ namespace opendnp3
                 adapter,
                 _sessionsManager,
                 false,
-                callback
+                callback,
+                admission
             );
         }
         else if (_backupSettings->UseSerial())
@@ -343,6 +346,16 @@ namespace opendnp3
         }
     }
 
+    void IOHandlersManager::SetCapture(const std::shared_ptr<CaptureWriter>& writer) const
+    {
+        std::lock_guard<std::mutex> lock{ _mtx };
+        _primaryChannel->SetCapture(writer);
+        if (_backupChannel)
+        {
+            _backupChannel->SetCapture(writer);
+        }
+    }
+
     void IOHandlersManager::Reset()
     {
         std::lock_guard<std::mutex> lock{ _mtx };
@@ -371,4 +384,11 @@ namespace opendnp3
         return _backupChannelUsed;
     }
 
+    bool IOHandlersManager::IsFullDuplex(bool isBackup) const
+    {
+        // the handlers are fixed at construction, no lock required
+        const auto& handler = isBackup ? _backupChannel : _primaryChannel;
+        return handler && handler->IsFullDuplex();
+    }
+
 } // namespace opendnp3
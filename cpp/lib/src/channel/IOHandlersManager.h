@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ConnectionAdmission.h"
 #include "IOHandler.h"
 #include "IoSessionDescriptor.h"
 #include "opendnp3/channel/ChannelRetry.h"
@@ -26,7 +27,8 @@ namespace opendnp3
             const ChannelRetry& retry,
             ChannelConnectionOptions primarySettings,
             boost::optional<ChannelConnectionOptions> backupSettings = {},
-            const std::string& adapter = {}
+            const std::string& adapter = {},
+            const std::shared_ptr<ConnectionAdmission>& admission = nullptr
         );
 
         IOHandlersManager(
@@ -53,6 +55,8 @@ namespace opendnp3
         void AddStatisticsHandler(const StatisticsChangeHandler_t& statisticsChangeHandler) const;
         void RemoveStatisticsHandler() const;
 
+        void SetCapture(const std::shared_ptr<CaptureWriter>& writer) const;
+
         void Reset();
         void Shutdown();
 
@@ -60,6 +64,8 @@ namespace opendnp3
 
         bool IsBackupChannelUsed() const;
 
+        bool IsFullDuplex(bool isBackup) const;
+
         using ChannelReservationChangedHandler_t = void(bool isBackup);
         using ChannelReservationChangedSignal_t = boost::signals2::signal<ChannelReservationChangedHandler_t>;
         ChannelReservationChangedSignal_t ChannelReservationChanged;
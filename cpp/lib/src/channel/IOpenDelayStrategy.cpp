@@ -19,6 +19,8 @@
  */
 #include "opendnp3/channel/IOpenDelayStrategy.h"
 
+#include <algorithm>
+
 namespace opendnp3
 {
 
@@ -35,4 +37,32 @@ TimeDuration ExponentialBackoffStrategy::GetNextDelay(const TimeDuration& curren
     return (doubled > max) ? max : doubled;
 }
 
+DecorrelatedJitterStrategy DecorrelatedJitterStrategy::instance;
+
+DecorrelatedJitterStrategy::DecorrelatedJitterStrategy(const TimeDuration& base, uint32_t seed)
+    : base(base), generator(seed)
+{
+}
+
+IOpenDelayStrategy& DecorrelatedJitterStrategy::Instance()
+{
+    return instance;
+}
+
+TimeDuration DecorrelatedJitterStrategy::GetNextDelay(const TimeDuration& current, const TimeDuration& max) const
+{
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+
+    const auto maxMs = duration_cast<milliseconds>(max.value).count();
+    const auto lower = std::min(duration_cast<milliseconds>(this->base.value).count(), maxMs);
+    const auto currentMs = duration_cast<milliseconds>(current.value).count();
+    const auto upper = (currentMs > maxMs / 3) ? maxMs : std::max(currentMs * 3, lower);
+
+    std::uniform_int_distribution<int64_t> distribution(lower, upper);
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return TimeDuration::Milliseconds(distribution(this->generator));
+}
+
 } // namespace opendnp3
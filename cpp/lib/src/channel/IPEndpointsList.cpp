@@ -68,6 +68,24 @@ const IPEndpoint& IPEndpointsList::GetCurrentEndpoint() const
     return *this->currentEndpoint;
 }
 
+const std::vector<IPEndpoint>& IPEndpointsList::GetEndpoints() const
+{
+    return this->endpoints;
+}
+
+size_t IPEndpointsList::GetCurrentIndex() const
+{
+    return static_cast<size_t>(this->currentEndpoint - this->endpoints.begin());
+}
+
+void IPEndpointsList::SetCurrentIndex(size_t index)
+{
+    if (index < this->endpoints.size())
+    {
+        this->currentEndpoint = this->endpoints.begin() + index;
+    }
+}
+
 bool IPEndpointsList::Next()
 {
     auto result = true;
@@ -31,6 +31,9 @@ namespace opendnp3
 
         virtual bool SendToSession(const Addresses& addresses, const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) = 0;
 
+        // storage in the one session that will accept the frame, empty if there isn't exactly one
+        virtual ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length) = 0;
+
         virtual void LowerLayerUp(LinkStateChangeSource source) = 0;
 
         virtual bool IsAnySessionEnabled() const = 0;
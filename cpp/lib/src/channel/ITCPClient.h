@@ -0,0 +1,52 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_ITCPCLIENT_H
+#define OPENDNP3_ITCPCLIENT_H
+
+#include "opendnp3/channel/IPEndpoint.h"
+
+#include <exe4cpp/asio/StrandExecutor.h>
+
+#include <functional>
+
+namespace opendnp3
+{
+
+/**
+ * Makes outbound TCP connections on behalf of TCPClientIOHandler
+ */
+class ITCPClient
+{
+
+public:
+    typedef std::function<void(
+        const std::shared_ptr<exe4cpp::StrandExecutor>& executor, asio::ip::tcp::socket, const std::error_code& ec)>
+        connect_callback_t;
+
+    virtual ~ITCPClient() = default;
+
+    virtual bool Cancel() = 0;
+
+    virtual bool BeginConnect(const IPEndpoint& remote, const connect_callback_t& callback) = 0;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -24,6 +24,11 @@ namespace opendnp3
         return this->_session->OnFrame(header, userdata);
     }
 
+    ser4cpp::wseq_t IoSessionDescriptor::GetUserDataBuffer(const LinkHeaderFields& header, size_t length) const
+    {
+        return this->_session->GetUserDataBuffer(header, length);
+    }
+
     bool IoSessionDescriptor::LowerLayerUp(LinkStateChangeSource source)
     {
         if (!_online)
@@ -20,6 +20,8 @@ namespace opendnp3
 
         bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) const;
 
+        ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length) const;
+
         bool LowerLayerUp(LinkStateChangeSource source);
 
         bool LowerLayerDown(LinkStateChangeSource source);
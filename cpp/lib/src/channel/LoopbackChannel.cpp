@@ -0,0 +1,55 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/LoopbackChannel.h"
+
+#include <utility>
+
+namespace opendnp3
+{
+
+LoopbackChannel::LoopbackChannel(const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                                 std::shared_ptr<LoopbackPipe> rx,
+                                 std::shared_ptr<LoopbackPipe> tx)
+    : IAsyncChannel(executor), rx(std::move(rx)), tx(std::move(tx))
+{
+}
+
+void LoopbackChannel::BeginReadImpl(ser4cpp::wseq_t dest)
+{
+    this->rx->Read(this->Self(), dest);
+}
+
+void LoopbackChannel::BeginWriteImpl(const ser4cpp::rseq_t& buffer)
+{
+    this->tx->Write(this->Self(), buffer);
+}
+
+void LoopbackChannel::ShutdownImpl()
+{
+    this->rx->Close();
+    this->tx->Close();
+}
+
+std::shared_ptr<LoopbackChannel> LoopbackChannel::Self()
+{
+    return std::static_pointer_cast<LoopbackChannel>(this->shared_from_this());
+}
+
+} // namespace opendnp3
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_LOOPBACKCHANNEL_H
+#define OPENDNP3_LOOPBACKCHANNEL_H
+
+#include "channel/IAsyncChannel.h"
+#include "channel/LoopbackPipe.h"
+
+namespace opendnp3
+{
+
+/**
+ * In-memory channel that reads from one pipe and writes to another
+ */
+class LoopbackChannel final : public IAsyncChannel
+{
+
+public:
+    static std::shared_ptr<LoopbackChannel> Create(const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                                                   std::shared_ptr<LoopbackPipe> rx,
+                                                   std::shared_ptr<LoopbackPipe> tx)
+    {
+        return std::make_shared<LoopbackChannel>(executor, std::move(rx), std::move(tx));
+    }
+
+    LoopbackChannel(const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                    std::shared_ptr<LoopbackPipe> rx,
+                    std::shared_ptr<LoopbackPipe> tx);
+
+    // invoked by the pipes on this channel's executor
+    void CompleteRead(const std::error_code& ec, size_t num)
+    {
+        this->OnReadCallback(ec, num);
+    }
+
+    void CompleteWrite(const std::error_code& ec, size_t num)
+    {
+        this->OnWriteCallback(ec, num);
+    }
+
+protected:
+    void BeginReadImpl(ser4cpp::wseq_t dest) final;
+    void BeginWriteImpl(const ser4cpp::rseq_t& buffer) final;
+    void ShutdownImpl() final;
+
+private:
+    std::shared_ptr<LoopbackChannel> Self();
+
+    const std::shared_ptr<LoopbackPipe> rx;
+    const std::shared_ptr<LoopbackPipe> tx;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/LoopbackConnector.h"
+
+#include "channel/LoopbackChannel.h"
+#include "channel/LoopbackIOHandler.h"
+
+namespace opendnp3
+{
+
+LoopbackConnector::LoopbackConnector(size_t bufferSize) : bufferSize(bufferSize) {}
+
+void LoopbackConnector::Listen(uint8_t end, const std::shared_ptr<LoopbackIOHandler>& handler)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    this->listening[end] = handler;
+
+    const auto& first = this->listening[0];
+    const auto& second = this->listening[1];
+
+    if (first && second)
+    {
+        const auto firstToSecond = std::make_shared<LoopbackPipe>(this->bufferSize);
+        const auto secondToFirst = std::make_shared<LoopbackPipe>(this->bufferSize);
+
+        first->OnConnected(LoopbackChannel::Create(first->executor, secondToFirst, firstToSecond));
+        second->OnConnected(LoopbackChannel::Create(second->executor, firstToSecond, secondToFirst));
+
+        this->listening[0].reset();
+        this->listening[1].reset();
+    }
+}
+
+void LoopbackConnector::Cancel(uint8_t end)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    this->listening[end].reset();
+}
+
+} // namespace opendnp3
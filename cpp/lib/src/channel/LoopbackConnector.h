@@ -0,0 +1,61 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_LOOPBACKCONNECTOR_H
+#define OPENDNP3_LOOPBACKCONNECTOR_H
+
+#include "opendnp3/util/Uncopyable.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace opendnp3
+{
+
+class LoopbackIOHandler;
+
+/**
+ * Rendezvous point for the two ends of a loopback pair
+ *
+ * Each end registers when it wants a channel. As soon as both ends are registered a fresh pair
+ * of pipes is created and each end is handed a channel connected to the other.
+ */
+class LoopbackConnector final : private Uncopyable
+{
+public:
+    static const uint8_t NUM_ENDS = 2;
+
+    explicit LoopbackConnector(size_t bufferSize);
+
+    void Listen(uint8_t end, const std::shared_ptr<LoopbackIOHandler>& handler);
+
+    void Cancel(uint8_t end);
+
+private:
+    const size_t bufferSize;
+
+    std::mutex mutex;
+    std::array<std::shared_ptr<LoopbackIOHandler>, NUM_ENDS> listening;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/LoopbackIOHandler.h"
+
+#include "logging/LogMacros.h"
+
+#include "opendnp3/logging/LogLevels.h"
+
+#include <utility>
+
+namespace opendnp3
+{
+
+LoopbackIOHandler::LoopbackIOHandler(const Logger& logger,
+                                     const std::shared_ptr<IChannelListener>& listener,
+                                     const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                                     const std::shared_ptr<LoopbackConnector>& connector,
+                                     uint8_t end,
+                                     std::shared_ptr<ISharedChannelData> sessionsManager)
+    : IOHandler(logger, false, listener, std::move(sessionsManager), true),
+      executor(executor),
+      connector(connector),
+      end(end)
+{
+}
+
+void LoopbackIOHandler::OnConnected(const std::shared_ptr<IAsyncChannel>& channel)
+{
+    auto callback = [this, channel, self = shared_from_this()]() {
+        if (!this->accepting.exchange(false))
+        {
+            // accepting was suspended while the connection was being handed over
+            channel->Shutdown();
+            return;
+        }
+
+        SIMPLE_LOG_BLOCK(this->logger, flags::INFO, "Loopback connected");
+        this->OnNewChannel(channel);
+    };
+
+    this->executor->post(callback);
+}
+
+void LoopbackIOHandler::ShutdownImpl()
+{
+    this->SuspendChannelAccept();
+}
+
+void LoopbackIOHandler::BeginChannelAccept()
+{
+    this->accepting = true;
+    this->connector->Listen(this->end, std::static_pointer_cast<LoopbackIOHandler>(shared_from_this()));
+}
+
+void LoopbackIOHandler::SuspendChannelAccept()
+{
+    this->accepting = false;
+    this->connector->Cancel(this->end);
+}
+
+void LoopbackIOHandler::OnChannelShutdown()
+{
+    // the other end closed, wait for it to listen again
+    this->BeginChannelAccept();
+}
+
+} // namespace opendnp3
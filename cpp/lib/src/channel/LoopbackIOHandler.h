@@ -0,0 +1,79 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_LOOPBACKIOHANDLER_H
+#define OPENDNP3_LOOPBACKIOHANDLER_H
+
+#include "channel/IOHandler.h"
+#include "channel/LoopbackConnector.h"
+
+#include <atomic>
+
+namespace opendnp3
+{
+
+/**
+ * IOHandler for one end of an in-memory loopback pair
+ *
+ * The channel opens when both ends have an enabled session. When the other end closes, this end
+ * immediately waits for it to come back.
+ */
+class LoopbackIOHandler final : public IOHandler
+{
+
+public:
+    static std::shared_ptr<LoopbackIOHandler> Create(const Logger& logger,
+                                                     const std::shared_ptr<IChannelListener>& listener,
+                                                     const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                                                     const std::shared_ptr<LoopbackConnector>& connector,
+                                                     uint8_t end,
+                                                     std::shared_ptr<ISharedChannelData> sessionsManager)
+    {
+        return std::make_shared<LoopbackIOHandler>(logger, listener, executor, connector, end,
+                                                   std::move(sessionsManager));
+    }
+
+    LoopbackIOHandler(const Logger& logger,
+                      const std::shared_ptr<IChannelListener>& listener,
+                      const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                      const std::shared_ptr<LoopbackConnector>& connector,
+                      uint8_t end,
+                      std::shared_ptr<ISharedChannelData> sessionsManager);
+
+    // called by the connector from any thread when both ends are listening
+    void OnConnected(const std::shared_ptr<IAsyncChannel>& channel);
+
+    const std::shared_ptr<exe4cpp::StrandExecutor> executor;
+
+protected:
+    void ShutdownImpl() override;
+    void BeginChannelAccept() override;
+    void SuspendChannelAccept() override;
+    void OnChannelShutdown() override;
+
+private:
+    const std::shared_ptr<LoopbackConnector> connector;
+    const uint8_t end;
+
+    std::atomic_bool accepting{ false };
+};
+
+} // namespace opendnp3
+
+#endif
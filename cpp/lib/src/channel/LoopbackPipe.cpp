@@ -0,0 +1,151 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/LoopbackPipe.h"
+
+#include "channel/LoopbackChannel.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace opendnp3
+{
+
+LoopbackPipe::LoopbackPipe(size_t capacity) : ring(capacity) {}
+
+void LoopbackPipe::Read(const std::shared_ptr<LoopbackChannel>& reader, const ser4cpp::wseq_t& dest)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    this->reader = reader;
+    this->readDest = dest;
+
+    this->TransferToReader();
+
+    // draining the ring may have made room for the rest of a pending write
+    this->TransferFromWriter();
+}
+
+void LoopbackPipe::Write(const std::shared_ptr<LoopbackChannel>& writer, const ser4cpp::rseq_t& data)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    if (this->closed)
+    {
+        PostWrite(writer, asio::error::broken_pipe, 0);
+        return;
+    }
+
+    this->writer = writer;
+    this->writeData = data;
+    this->numWritten = 0;
+
+    this->TransferFromWriter();
+    this->TransferToReader();
+}
+
+void LoopbackPipe::Close()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    this->closed = true;
+
+    if (this->writer)
+    {
+        PostWrite(this->writer, asio::error::broken_pipe, this->numWritten);
+        this->writer.reset();
+    }
+
+    this->TransferToReader();
+}
+
+void LoopbackPipe::TransferFromWriter()
+{
+    if (!this->writer)
+    {
+        return;
+    }
+
+    const auto num = this->Push(this->writeData);
+    this->writeData.advance(num);
+    this->numWritten += num;
+
+    if (this->writeData.is_empty())
+    {
+        PostWrite(this->writer, std::error_code(), this->numWritten);
+        this->writer.reset();
+    }
+}
+
+void LoopbackPipe::TransferToReader()
+{
+    if (!this->reader)
+    {
+        return;
+    }
+
+    if (this->count > 0)
+    {
+        PostRead(this->reader, std::error_code(), this->Pop(this->readDest));
+        this->reader.reset();
+    }
+    else if (this->closed)
+    {
+        PostRead(this->reader, asio::error::eof, 0);
+        this->reader.reset();
+    }
+}
+
+size_t LoopbackPipe::Push(const ser4cpp::rseq_t& data)
+{
+    const auto num = std::min(data.length(), this->ring.size() - this->count);
+    const auto tail = (this->head + this->count) % this->ring.size();
+    const auto first = std::min(num, this->ring.size() - tail);
+
+    memcpy(this->ring.data() + tail, data, first);
+    memcpy(this->ring.data(), data.skip(first), num - first);
+
+    this->count += num;
+    return num;
+}
+
+size_t LoopbackPipe::Pop(ser4cpp::wseq_t dest)
+{
+    const auto num = std::min(dest.length(), this->count);
+    const auto first = std::min(num, this->ring.size() - this->head);
+
+    memcpy(dest, this->ring.data() + this->head, first);
+    memcpy(dest.skip(first), this->ring.data(), num - first);
+
+    this->head = (this->head + num) % this->ring.size();
+    this->count -= num;
+    return num;
+}
+
+void LoopbackPipe::PostRead(const std::shared_ptr<LoopbackChannel>& channel, const std::error_code& ec, size_t num)
+{
+    channel->executor->post([channel, ec, num]() { channel->CompleteRead(ec, num); });
+}
+
+void LoopbackPipe::PostWrite(const std::shared_ptr<LoopbackChannel>& channel, const std::error_code& ec, size_t num)
+{
+    channel->executor->post([channel, ec, num]() { channel->CompleteWrite(ec, num); });
+}
+
+} // namespace opendnp3
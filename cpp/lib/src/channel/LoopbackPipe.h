@@ -0,0 +1,84 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_LOOPBACKPIPE_H
+#define OPENDNP3_LOOPBACKPIPE_H
+
+#include "opendnp3/util/Uncopyable.h"
+
+#include <ser4cpp/container/SequenceTypes.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <vector>
+
+namespace opendnp3
+{
+
+class LoopbackChannel;
+
+/**
+ * One direction of an in-memory loopback connection
+ *
+ * Bytes are copied from a pending write into a fixed-size ring buffer and from there into a pending read.
+ * A write completes once all of its bytes are in the ring, a read completes as soon as any bytes are available.
+ * Completions are always posted to the executor of the channel that started the operation.
+ */
+class LoopbackPipe final : private Uncopyable
+{
+public:
+    explicit LoopbackPipe(size_t capacity);
+
+    void Read(const std::shared_ptr<LoopbackChannel>& reader, const ser4cpp::wseq_t& dest);
+
+    void Write(const std::shared_ptr<LoopbackChannel>& writer, const ser4cpp::rseq_t& data);
+
+    // fail any pending write, the reader receives the remaining bytes followed by end of file
+    void Close();
+
+private:
+    void TransferFromWriter();
+    void TransferToReader();
+
+    size_t Push(const ser4cpp::rseq_t& data);
+    size_t Pop(ser4cpp::wseq_t dest);
+
+    static void PostRead(const std::shared_ptr<LoopbackChannel>& channel, const std::error_code& ec, size_t num);
+    static void PostWrite(const std::shared_ptr<LoopbackChannel>& channel, const std::error_code& ec, size_t num);
+
+    std::mutex mutex;
+    bool closed = false;
+
+    std::vector<uint8_t> ring;
+    size_t head = 0;
+    size_t count = 0;
+
+    std::shared_ptr<LoopbackChannel> reader;
+    ser4cpp::wseq_t readDest;
+
+    std::shared_ptr<LoopbackChannel> writer;
+    ser4cpp::rseq_t writeData;
+    size_t numWritten = 0;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -66,6 +66,11 @@ public:
                     bool isPrimary,
                     ConnectionFailureCallback_t connectionFailureCallback = []{});
 
+    bool IsFullDuplex() const override
+    {
+        return false;
+    }
+
 protected:
     void ShutdownImpl() override;
     void BeginChannelAccept() override;
@@ -110,6 +110,31 @@ namespace opendnp3
         return accepted;
     }
 
+    ser4cpp::wseq_t SharedChannelData::GetUserDataBuffer(const LinkHeaderFields& header, size_t length)
+    {
+        auto buffer = ser4cpp::wseq_t::empty();
+
+        for (auto& session : _sessions)
+        {
+            if (session.Enabled())
+            {
+                const auto candidate = session.GetUserDataBuffer(header, length);
+                if (candidate.is_not_empty())
+                {
+                    if (buffer.is_not_empty())
+                    {
+                        // more than one session will see the frame, so it has to stay in the parser
+                        return ser4cpp::wseq_t::empty();
+                    }
+
+                    buffer = candidate;
+                }
+            }
+        }
+
+        return buffer;
+    }
+
     void SharedChannelData::LowerLayerUp(LinkStateChangeSource source)
     {
         for (auto& session : _sessions)
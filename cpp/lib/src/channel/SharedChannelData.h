@@ -28,6 +28,8 @@ namespace opendnp3
             const ser4cpp::rseq_t& userdata
         ) override;
 
+        ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length) override;
+
         void LowerLayerUp(LinkStateChangeSource source) override;
 
         bool IsAnySessionEnabled() const override;
@@ -5,10 +5,12 @@ namespace opendnp3
 
     SharedTransmission::SharedTransmission(
         const ser4cpp::rseq_t& txdata,
-        std::shared_ptr<ILinkSession> session
+        std::shared_ptr<ILinkSession> session,
+        uint32_t numFrames
     )
         : TxData(txdata)
         , Session(std::move(session))
+        , NumFrames(numFrames)
     {}
 
 } // namespace opendnp3
@@ -10,12 +10,13 @@ namespace opendnp3
 
     struct SharedTransmission
     {
-        SharedTransmission(const ser4cpp::rseq_t& txdata, std::shared_ptr<ILinkSession> session);
+        SharedTransmission(const ser4cpp::rseq_t& txdata, std::shared_ptr<ILinkSession> session, uint32_t numFrames);
 
         SharedTransmission() = default;
 
         ser4cpp::rseq_t TxData;
         std::shared_ptr<ILinkSession> Session;
+        uint32_t NumFrames = 1;
     };
 
 } // namespace opendnp3
@@ -20,6 +20,7 @@
 #ifndef OPENDNP3_TCPCLIENT_H
 #define OPENDNP3_TCPCLIENT_H
 
+#include "channel/ITCPClient.h"
 #include "channel/LoggingConnectionCondition.h"
 
 #include "opendnp3/channel/IPEndpoint.h"
@@ -30,14 +31,10 @@
 namespace opendnp3
 {
 
-class TCPClient final : public std::enable_shared_from_this<TCPClient>, private Uncopyable
+class TCPClient final : public ITCPClient, public std::enable_shared_from_this<TCPClient>, private Uncopyable
 {
 
 public:
-    typedef std::function<void(
-        const std::shared_ptr<exe4cpp::StrandExecutor>& executor, asio::ip::tcp::socket, const std::error_code& ec)>
-        connect_callback_t;
-
     static std::shared_ptr<TCPClient> Create(const Logger& logger,
                                              const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
                                              const std::string& adapter)
@@ -47,9 +44,9 @@ public:
 
     TCPClient(const Logger& logger, const std::shared_ptr<exe4cpp::StrandExecutor>& executor, std::string adapter);
 
-    bool Cancel();
+    bool Cancel() override;
 
-    bool BeginConnect(const IPEndpoint& remote, const connect_callback_t& callback);
+    bool BeginConnect(const IPEndpoint& remote, const connect_callback_t& callback) override;
 
 private:
     void HandleResolveResult(const connect_callback_t& callback,
@@ -35,13 +35,18 @@ TCPClientIOHandler::TCPClientIOHandler(const Logger& logger,
                                        std::string adapter,
                                        std::shared_ptr<ISharedChannelData> sessionsManager,
                                        bool isPrimary,
-                                       ConnectionFailureCallback_t connectionFailureCallback)
+                                       ConnectionFailureCallback_t connectionFailureCallback,
+                                       std::shared_ptr<ConnectionAdmission> admission,
+                                       client_factory_t clientFactory)
     : IOHandler(logger, false, listener, std::move(sessionsManager), isPrimary, std::move(connectionFailureCallback)),
       executor(std::move(executor)),
       retry(retry),
       settings(settings),
-      adapter(std::move(adapter))
+      adapter(std::move(adapter)),
+      admission(std::move(admission)),
+      clientFactory(std::move(clientFactory))
 {
+    this->SetReliableTransport();
 }
 
 void TCPClientIOHandler::ShutdownImpl()
@@ -51,11 +56,17 @@ void TCPClientIOHandler::ShutdownImpl()
 
 void TCPClientIOHandler::BeginChannelAccept()
 {
+    if (this->ShouldRace())
+    {
+        this->StartRace(this->retry.minOpenRetry);
+        return;
+    }
+
     if (this->client)
     {
         this->client->Cancel();
     }
-    this->client = TCPClient::Create(logger, executor, adapter);
+    this->client = this->CreateClient();
     this->StartConnect(this->retry.minOpenRetry);
 }
 
@@ -69,7 +80,7 @@ void TCPClientIOHandler::OnChannelShutdown()
     if (this->retry.InfiniteTries())
     {
         this->retrytimer = this->executor->start(this->retry.reconnectDelay.value, [this, self = shared_from_this()]() {
-            if (!client)
+            if (!this->IsActive())
             {
                 return;
             }
@@ -92,6 +103,8 @@ bool TCPClientIOHandler::StartConnect(const TimeDuration& delay)
 
     auto cb = [=, self = shared_from_this()](const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
                                              asio::ip::tcp::socket socket, const std::error_code& ec) -> void {
+        this->ReleaseAdmission();
+
         if (ec)
         {
             FORMAT_LOG_BLOCK(this->logger, flags::WARN, "Error Connecting: %s", ec.message().c_str())
@@ -125,29 +138,222 @@ bool TCPClientIOHandler::StartConnect(const TimeDuration& delay)
 
             if (client)
             {
-                std::error_code keepAliveOptionsEc;
-                ConfigureTCPKeepAliveOptions(settings, socket, keepAliveOptionsEc);
-                if (keepAliveOptionsEc)
-                {
-                    FORMAT_LOG_BLOCK(this->logger, flags::WARN, "Error Configuring Keep-alive Options: %s",
-                                     keepAliveOptionsEc.message().c_str())
-                }
-                this->OnNewChannel(TCPSocketChannel::Create(executor, std::move(socket)));
+                this->OnConnected(executor, std::move(socket));
             }
         }
     };
 
-    FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Connecting to: %s, port %u",
-                     this->settings.Endpoints.GetCurrentEndpoint().address.c_str(),
-                     this->settings.Endpoints.GetCurrentEndpoint().port);
+    auto connect = [this, cb]() {
+        if (!this->client)
+        {
+            return;
+        }
+
+        FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Connecting to: %s, port %u",
+                         this->settings.Endpoints.GetCurrentEndpoint().address.c_str(),
+                         this->settings.Endpoints.GetCurrentEndpoint().port);
+
+        this->client->BeginConnect(this->settings.Endpoints.GetCurrentEndpoint(), cb);
+    };
+
+    this->Admit(connect);
+
+    return true;
+}
+
+bool TCPClientIOHandler::StartRace(const TimeDuration& delay)
+{
+    this->CancelRace();
+
+    for (size_t i = 0; i < this->settings.Endpoints.GetEndpoints().size(); ++i)
+    {
+        this->raceClients.push_back(this->CreateClient());
+    }
 
-    this->client->BeginConnect(this->settings.Endpoints.GetCurrentEndpoint(), cb);
+    this->raceStart = this->settings.Endpoints.GetCurrentIndex();
+
+    const auto race = this->raceId;
+    this->Admit([this, race, delay]() { this->StartNextRaceAttempt(race, delay); });
 
     return true;
 }
 
+void TCPClientIOHandler::StartNextRaceAttempt(uint32_t race, const TimeDuration& delay)
+{
+    this->raceTimer.cancel();
+
+    if (race != this->raceId || this->nextRaceAttempt >= this->raceClients.size())
+    {
+        return;
+    }
+
+    const auto index = this->nextRaceAttempt++;
+    const auto position = (this->raceStart + index) % this->raceClients.size();
+    const auto endpoint = this->settings.Endpoints.GetEndpoints()[position];
+
+    auto cb = [=, self = shared_from_this()](const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                                             asio::ip::tcp::socket socket, const std::error_code& ec) -> void {
+        if (race != this->raceId)
+        {
+            return;
+        }
+
+        if (ec)
+        {
+            FORMAT_LOG_BLOCK(this->logger, flags::WARN, "Error Connecting to: %s, port %u: %s",
+                             endpoint.address.c_str(), endpoint.port, ec.message().c_str())
+
+            ++this->statistics.numOpenFail;
+
+            if (++this->numRaceFailures == this->raceClients.size())
+            {
+                this->OnRaceFailed(delay);
+            }
+            else
+            {
+                // don't wait for the stagger delay, start the next attempt right away
+                this->StartNextRaceAttempt(race, delay);
+            }
+            return;
+        }
+
+        FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Connected to: %s, port %u", endpoint.address.c_str(),
+                         endpoint.port);
+
+        // the first connection wins, cancel the attempts still in progress and race it first next time
+        this->settings.Endpoints.SetCurrentIndex(position);
+        this->numFailedRaces = 0;
+        this->ReleaseAdmission();
+        ++this->raceId;
+        this->raceTimer.cancel();
+        for (const auto& client : this->raceClients)
+        {
+            client->Cancel();
+        }
+
+        this->OnConnected(executor, std::move(socket));
+    };
+
+    FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Connecting to: %s, port %u", endpoint.address.c_str(),
+                     endpoint.port);
+
+    this->raceClients[index]->BeginConnect(endpoint, cb);
+
+    if (this->nextRaceAttempt < this->raceClients.size())
+    {
+        this->raceTimer = this->executor->start(this->settings.ConnectionRaceDelay,
+                                                [this, self = shared_from_this(), race, delay]() {
+                                                    this->StartNextRaceAttempt(race, delay);
+                                                });
+    }
+}
+
+void TCPClientIOHandler::OnRaceFailed(const TimeDuration& delay)
+{
+    this->ReleaseAdmission();
+
+    const auto newDelay = this->retry.NextDelay(delay);
+
+    auto retry_cb = [self = shared_from_this(), newDelay, this]() {
+        if (this->retry.InfiniteTries())
+        {
+            this->StartRace(newDelay);
+        }
+        else if (++this->numFailedRaces < this->settings.Endpoints.GetEndpoints().size())
+        {
+            // with finite tries, every endpoint gets to go first in one race before giving up
+            this->settings.Endpoints.Next();
+            this->StartRace(newDelay);
+        }
+        else
+        {
+            this->numFailedRaces = 0;
+
+            if (_connectionFailureCallback)
+            {
+                _openingChannel.exchange(false);
+                _connectionFailureCallback();
+            }
+        }
+    };
+
+    this->retrytimer = this->executor->start(delay.value, retry_cb);
+}
+
+void TCPClientIOHandler::CancelRace()
+{
+    ++this->raceId;
+    this->raceTimer.cancel();
+
+    for (const auto& client : this->raceClients)
+    {
+        client->Cancel();
+    }
+
+    this->raceClients.clear();
+    this->nextRaceAttempt = 0;
+    this->numRaceFailures = 0;
+}
+
+bool TCPClientIOHandler::ShouldRace() const
+{
+    return this->settings.ConnectionRaceDelay.count() > 0 && this->settings.Endpoints.GetEndpoints().size() > 1;
+}
+
+bool TCPClientIOHandler::IsActive() const
+{
+    return this->client || !this->raceClients.empty();
+}
+
+void TCPClientIOHandler::OnConnected(const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                                     asio::ip::tcp::socket socket)
+{
+    std::error_code keepAliveOptionsEc;
+    ConfigureTCPKeepAliveOptions(settings, socket, keepAliveOptionsEc);
+    if (keepAliveOptionsEc)
+    {
+        FORMAT_LOG_BLOCK(this->logger, flags::WARN, "Error Configuring Keep-alive Options: %s",
+                         keepAliveOptionsEc.message().c_str())
+    }
+    this->OnNewChannel(TCPSocketChannel::Create(executor, std::move(socket)));
+}
+
+void TCPClientIOHandler::Admit(const std::function<void()>& connect)
+{
+    this->ReleaseAdmission();
+
+    if (!this->admission)
+    {
+        connect();
+        return;
+    }
+
+    auto onAdmitted = [this, self = shared_from_this(), connect, generation = this->admissionGeneration]() {
+        // ignore admissions for attempts that were abandoned while queued
+        if (generation == this->admissionGeneration)
+        {
+            connect();
+        }
+    };
+
+    this->admissionTicket = this->admission->Request(this->executor, this->retry.connectPriority, onAdmitted);
+}
+
+void TCPClientIOHandler::ReleaseAdmission()
+{
+    if (this->admission && this->admissionTicket != 0)
+    {
+        this->admission->Release(this->admissionTicket);
+        this->admissionTicket = 0;
+        ++this->admissionGeneration;
+    }
+}
+
 void TCPClientIOHandler::ResetState()
 {
+    this->ReleaseAdmission();
+    this->CancelRace();
+
     if (this->client)
     {
         this->client->Cancel();
@@ -155,8 +361,19 @@ void TCPClientIOHandler::ResetState()
     }
 
     this->settings.Endpoints.Reset();
+    this->numFailedRaces = 0;
 
     retrytimer.cancel();
 }
 
+std::shared_ptr<ITCPClient> TCPClientIOHandler::CreateClient() const
+{
+    if (this->clientFactory)
+    {
+        return this->clientFactory();
+    }
+
+    return TCPClient::Create(logger, executor, adapter);
+}
+
 } // namespace opendnp3
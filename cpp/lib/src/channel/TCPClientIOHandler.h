@@ -20,6 +20,7 @@
 #ifndef OPENDNP3_TCPCLIENTIOHANDLER_H
 #define OPENDNP3_TCPCLIENTIOHANDLER_H
 
+#include "channel/ConnectionAdmission.h"
 #include "channel/IOHandler.h"
 #include "channel/TCPClient.h"
 
@@ -28,6 +29,8 @@
 
 #include <exe4cpp/Timer.h>
 
+#include <vector>
+
 namespace opendnp3
 {
 
@@ -35,6 +38,9 @@ class TCPClientIOHandler final : public IOHandler
 {
 
 public:
+    // creates the client used for a connection attempt, TCPClient unless overridden by tests
+    using client_factory_t = std::function<std::shared_ptr<ITCPClient>()>;
+
     static std::shared_ptr<TCPClientIOHandler> Create(const Logger& logger,
                                                       const std::shared_ptr<IChannelListener>& listener,
                                                       const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
@@ -43,7 +49,9 @@ public:
                                                       const std::string& adapter,
                                                       std::shared_ptr<ISharedChannelData> sessionsManager,
                                                       bool isPrimary,
-                                                      ConnectionFailureCallback_t connectionFailureCallback = []{})
+                                                      ConnectionFailureCallback_t connectionFailureCallback = []{},
+                                                      std::shared_ptr<ConnectionAdmission> admission = nullptr,
+                                                      client_factory_t clientFactory = nullptr)
     {
         return std::make_shared<TCPClientIOHandler>(
             logger,
@@ -54,7 +62,9 @@ public:
             adapter,
             std::move(sessionsManager),
             isPrimary,
-            std::move(connectionFailureCallback)
+            std::move(connectionFailureCallback),
+            std::move(admission),
+            std::move(clientFactory)
         );
     }
 
@@ -66,7 +76,9 @@ public:
                        std::string adapter,
                        std::shared_ptr<ISharedChannelData> sessionsManager,
                        bool isPrimary,
-                       ConnectionFailureCallback_t connectionFailureCallback);
+                       ConnectionFailureCallback_t connectionFailureCallback,
+                       std::shared_ptr<ConnectionAdmission> admission = nullptr,
+                       client_factory_t clientFactory = nullptr);
 
 protected:
     void ShutdownImpl() override;
@@ -77,18 +89,59 @@ protected:
 private:
     bool StartConnect(const TimeDuration& delay);
 
+    // connect to all endpoints in parallel, staggered by settings.ConnectionRaceDelay, starting with the
+    // current endpoint which is the winner of the last race
+    bool StartRace(const TimeDuration& delay);
+
+    void StartNextRaceAttempt(uint32_t race, const TimeDuration& delay);
+
+    void OnRaceFailed(const TimeDuration& delay);
+
+    void CancelRace();
+
+    bool ShouldRace() const;
+
+    bool IsActive() const;
+
+    void OnConnected(const std::shared_ptr<exe4cpp::StrandExecutor>& executor, asio::ip::tcp::socket socket);
+
+    // run the connection attempt once the manager admits it
+    void Admit(const std::function<void()>& connect);
+
+    // called when the admitted attempt completes
+    void ReleaseAdmission();
+
     void ResetState();
 
+    std::shared_ptr<ITCPClient> CreateClient() const;
+
     const std::shared_ptr<exe4cpp::StrandExecutor> executor;
     const ChannelRetry retry;
     TCPSettings settings;
     const std::string adapter;
+    const std::shared_ptr<ConnectionAdmission> admission;
+    const client_factory_t clientFactory;
+    ConnectionAdmission::ticket_t admissionTicket = 0;
+    uint32_t admissionGeneration = 0;
 
     // current value of the client
-    std::shared_ptr<TCPClient> client;
+    std::shared_ptr<ITCPClient> client;
 
     // connection retry timer
     exe4cpp::Timer retrytimer;
+
+    // one client per endpoint while racing, empty if not racing
+    std::vector<std::shared_ptr<ITCPClient>> raceClients;
+    // starts the next attempt if the current one hasn't completed within the stagger delay
+    exe4cpp::Timer raceTimer;
+    // identifies the current race so that stale callbacks are ignored
+    uint32_t raceId = 0;
+    // index of the endpoint the current race starts with
+    size_t raceStart = 0;
+    size_t nextRaceAttempt = 0;
+    size_t numRaceFailures = 0;
+    // consecutive races in which every attempt failed
+    size_t numFailedRaces = 0;
 };
 
 } // namespace opendnp3
@@ -50,6 +50,7 @@ TCPServerIOHandler::TCPServerIOHandler(const Logger& logger,
       settings(std::move(settings)),
       server(std::make_shared<Server>(this->logger, this->executor, settings.Endpoints.GetCurrentEndpoint(), ec))
 {
+    this->SetReliableTransport();
 }
 
 void TCPServerIOHandler::ShutdownImpl()
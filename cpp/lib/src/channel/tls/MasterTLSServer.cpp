@@ -37,8 +37,12 @@ MasterTLSServer::MasterTLSServer(const Logger& logger,
                                  const TLSConfig& config,
                                  std::shared_ptr<IListenCallbacks> callbacks,
                                  std::shared_ptr<ResourceManager> manager,
-                                 std::error_code& ec)
-    : TLSServer(logger, executor, endpoint, config, ec), callbacks(std::move(callbacks)), manager(std::move(manager))
+                                 std::error_code& ec,
+                                 std::shared_ptr<SSLContextCache> contexts,
+                                 std::shared_ptr<ConnectionAdmission> handshakes)
+    : TLSServer(logger, executor, endpoint, config, ec, std::move(contexts), std::move(handshakes)),
+      callbacks(std::move(callbacks)),
+      manager(std::move(manager))
 {
 }
 
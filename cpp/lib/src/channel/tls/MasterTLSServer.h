@@ -41,7 +41,9 @@ public:
                     const TLSConfig& tlsConfig,
                     std::shared_ptr<IListenCallbacks> callbacks,
                     std::shared_ptr<ResourceManager> manager,
-                    std::error_code& ec);
+                    std::error_code& ec,
+                    std::shared_ptr<SSLContextCache> contexts = nullptr,
+                    std::shared_ptr<ConnectionAdmission> handshakes = nullptr);
 
     static std::shared_ptr<MasterTLSServer> Create(const Logger& logger,
                                                    const std::shared_ptr<exe4cpp::StrandExecutor> executor,
@@ -49,9 +51,12 @@ public:
                                                    const TLSConfig& tlsConfig,
                                                    const std::shared_ptr<IListenCallbacks> callbacks,
                                                    const std::shared_ptr<ResourceManager>& manager,
-                                                   std::error_code& ec)
+                                                   std::error_code& ec,
+                                                   const std::shared_ptr<SSLContextCache>& contexts = nullptr,
+                                                   const std::shared_ptr<ConnectionAdmission>& handshakes = nullptr)
     {
-        auto ret = std::make_shared<MasterTLSServer>(logger, executor, endpoint, tlsConfig, callbacks, manager, ec);
+        auto ret = std::make_shared<MasterTLSServer>(logger, executor, endpoint, tlsConfig, callbacks, manager, ec,
+                                                     contexts, handshakes);
 
         if (ec)
             return nullptr;
@@ -20,6 +20,7 @@
 
 #include "channel/tls/SSLContext.h"
 
+#include "channel/tls/TLSSessionCache.h"
 #include "logging/LogMacros.h"
 
 #include "opendnp3/logging/LogLevels.h"
@@ -39,11 +40,18 @@ int SSLContext::GetVerifyMode(bool server)
 
 std::error_code SSLContext::ApplyConfig(const TLSConfig& config, bool server, std::error_code& ec)
 {
-    // turn off session caching completely
-    SSL_CTX_set_session_cache_mode(value.native_handle(), SSL_SESS_CACHE_OFF);
+    auto OPTIONS = asio::ssl::context::default_workarounds | asio::ssl::context::no_sslv2 | asio::ssl::context::no_sslv3;
 
-    auto OPTIONS = asio::ssl::context::default_workarounds | asio::ssl::context::no_sslv2 | asio::ssl::context::no_sslv3
-        | SSL_OP_NO_TICKET;
+    if (config.enableSessionResumption)
+    {
+        this->ConfigureResumption(config, server);
+    }
+    else
+    {
+        // turn off session caching completely
+        SSL_CTX_set_session_cache_mode(value.native_handle(), SSL_SESS_CACHE_OFF);
+        OPTIONS |= SSL_OP_NO_TICKET;
+    }
 
     if (!config.allowTLSv10)
     {
@@ -115,4 +123,29 @@ std::error_code SSLContext::ApplyConfig(const TLSConfig& config, bool server, st
 
     return ec;
 }
+
+void SSLContext::ConfigureResumption(const TLSConfig& config, bool server)
+{
+    const auto lifetime = std::chrono::duration_cast<std::chrono::seconds>(config.sessionLifetime.value).count();
+    SSL_CTX_set_timeout(value.native_handle(), static_cast<long>(lifetime));
+
+    if (server)
+    {
+        // sessions are only resumed by peers that present a certificate to this same context
+        static const unsigned char SESSION_ID_CONTEXT[] = "opendnp3";
+
+        SSL_CTX_set_session_cache_mode(value.native_handle(), SSL_SESS_CACHE_SERVER);
+        SSL_CTX_sess_set_cache_size(value.native_handle(), static_cast<long>(config.maxCachedSessions));
+        SSL_CTX_set_session_id_context(value.native_handle(), SESSION_ID_CONTEXT, sizeof(SESSION_ID_CONTEXT) - 1);
+    }
+    else
+    {
+        // client sessions are stored in the TLSSessionCache shared by the manager, not in the context
+        SSL_CTX_set_session_cache_mode(value.native_handle(),
+                                       SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+        TLSSessionCache::Enable(value.native_handle());
+    }
+
+    SIMPLE_LOG_BLOCK(logger, flags::DBG, "TLS session resumption enabled");
+}
 } // namespace opendnp3
@@ -45,6 +45,8 @@ private:
     static int GetVerifyMode(bool server);
 
     std::error_code ApplyConfig(const TLSConfig& config, bool server, std::error_code& ec);
+
+    void ConfigureResumption(const TLSConfig& config, bool server);
 };
 
 } // namespace opendnp3
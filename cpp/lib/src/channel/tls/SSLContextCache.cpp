@@ -0,0 +1,125 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/tls/SSLContextCache.h"
+
+#include "logging/LogMacros.h"
+
+#include "opendnp3/logging/LogLevels.h"
+
+#include <algorithm>
+
+namespace opendnp3
+{
+
+std::shared_ptr<SSLContext> SSLContextCache::Get(const Logger& logger,
+                                                 bool server,
+                                                 const TLSConfig& config,
+                                                 std::error_code& ec)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    for (const auto& entry : this->entries)
+    {
+        if (entry.server == server && entry.config == config)
+        {
+            return entry.context;
+        }
+    }
+
+    this->EvictUnused();
+
+    // loading under the lock ensures that concurrent requests for the same configuration only load it once
+    auto context = Load(logger, server, config, ec);
+    if (context)
+    {
+        this->entries.emplace_back(logger, server, config, context);
+    }
+
+    return context;
+}
+
+std::shared_ptr<SSLContext> SSLContextCache::Acquire(const std::shared_ptr<SSLContextCache>& cache,
+                                                     const Logger& logger,
+                                                     bool server,
+                                                     const TLSConfig& config,
+                                                     std::error_code& ec)
+{
+    return cache ? cache->Get(logger, server, config, ec) : Load(logger, server, config, ec);
+}
+
+size_t SSLContextCache::Reload()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    // don't reload configurations nobody uses anymore, their files may be long gone
+    this->EvictUnused();
+
+    size_t failures = 0;
+
+    for (auto& entry : this->entries)
+    {
+        std::error_code ec;
+        auto context = Load(entry.logger, entry.server, entry.config, ec);
+        if (context)
+        {
+            entry.replaced.push_back(entry.context);
+            entry.context = context;
+        }
+        else
+        {
+            FORMAT_LOG_BLOCK(entry.logger, flags::ERR, "Unable to reload TLS configuration, keeping the previous one: %s",
+                             ec.message().c_str());
+            ++failures;
+        }
+    }
+
+    return failures;
+}
+
+size_t SSLContextCache::Size() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->entries.size();
+}
+
+bool SSLContextCache::Entry::InUse()
+{
+    this->replaced.erase(std::remove_if(this->replaced.begin(), this->replaced.end(),
+                                        [](const std::weak_ptr<SSLContext>& context) { return context.expired(); }),
+                         this->replaced.end());
+
+    return this->context.use_count() > 1 || !this->replaced.empty();
+}
+
+void SSLContextCache::EvictUnused()
+{
+    this->entries.remove_if([](Entry& entry) { return !entry.InUse(); });
+}
+
+std::shared_ptr<SSLContext> SSLContextCache::Load(const Logger& logger,
+                                                  bool server,
+                                                  const TLSConfig& config,
+                                                  std::error_code& ec)
+{
+    auto context = std::make_shared<SSLContext>(logger, server, config, ec);
+    return ec ? nullptr : context;
+}
+
+} // namespace opendnp3
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_SSLCONTEXTCACHE_H
+#define OPENDNP3_SSLCONTEXTCACHE_H
+
+#include "channel/tls/SSLContext.h"
+
+#include "opendnp3/channel/TLSConfig.h"
+#include "opendnp3/logging/Logger.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * Shares fully configured SSL contexts between the TLS channels and listeners of a manager
+ *
+ * Contexts are keyed by role and TLSConfig contents, so the certificates, private key and CA file of a configuration
+ * are read and parsed once no matter how many channels use it. A context is never modified once it is handed out.
+ * Reload() builds replacement contexts from disk, which are picked up by subsequent connections while existing
+ * connections keep the context they were established with. A configuration is evicted once no channel or connection
+ * holds any of its contexts, so that channels that come and go don't accumulate entries or get reloaded forever.
+ */
+class SSLContextCache final : private Uncopyable
+{
+public:
+    /**
+     * Retrieve the shared context for a configuration, loading it on first use
+     *
+     * @return the context, or nullptr with ec set if the configuration could not be loaded
+     */
+    std::shared_ptr<SSLContext> Get(const Logger& logger, bool server, const TLSConfig& config, std::error_code& ec);
+
+    /**
+     * Retrieve a context from a cache if there is one, otherwise create a context that isn't shared
+     */
+    static std::shared_ptr<SSLContext> Acquire(const std::shared_ptr<SSLContextCache>& cache,
+                                               const Logger& logger,
+                                               bool server,
+                                               const TLSConfig& config,
+                                               std::error_code& ec);
+
+    /**
+     * Reload every cached configuration from disk
+     *
+     * A configuration that fails to load keeps its previous context
+     *
+     * @return the number of configurations that failed to load
+     */
+    size_t Reload();
+
+    size_t Size() const;
+
+private:
+    struct Entry
+    {
+        Entry(const Logger& logger, bool server, TLSConfig config, std::shared_ptr<SSLContext> context)
+            : logger(logger), server(server), config(std::move(config)), context(std::move(context))
+        {
+        }
+
+        // true if anything other than the cache holds the current or a replaced context
+        bool InUse();
+
+        Logger logger;
+        bool server;
+        TLSConfig config;
+        std::shared_ptr<SSLContext> context;
+        // contexts replaced by Reload() that may still be held by established connections
+        std::vector<std::weak_ptr<SSLContext>> replaced;
+    };
+
+    // must be called with the mutex held
+    void EvictUnused();
+
+    static std::shared_ptr<SSLContext> Load(const Logger& logger,
+                                            bool server,
+                                            const TLSConfig& config,
+                                            std::error_code& ec);
+
+    mutable std::mutex mutex;
+    std::list<Entry> entries;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -21,6 +21,7 @@
 #include "channel/tls/TLSClient.h"
 
 #include "channel/SocketHelpers.h"
+#include "logging/LogMacros.h"
 
 #include "opendnp3/logging/LogLevels.h"
 
@@ -33,12 +34,19 @@ TLSClient::TLSClient(const Logger& logger,
                      const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
                      std::string adapter,
                      const TLSConfig& config,
-                     std::error_code& ec)
+                     std::error_code& ec,
+                     const std::shared_ptr<SSLContextCache>& contexts,
+                     std::shared_ptr<TLSSessionCache> sessions,
+                     std::shared_ptr<ConnectionAdmission> handshakes)
     : logger(logger),
       condition(logger),
       executor(executor),
       adapter(std::move(adapter)),
-      ctx(logger, false, config, ec),
+      contexts(contexts),
+      ctx(SSLContextCache::Acquire(contexts, logger, false, config, ec)),
+      config(config),
+      sessions(std::move(sessions)),
+      handshakes(std::move(handshakes)),
       resolver(*executor->get_context())
 {
 }
@@ -61,8 +69,19 @@ bool TLSClient::BeginConnect(const IPEndpoint& remote, const connect_callback_t&
     if (canceled)
         return false;
 
+    // pick up a context reloaded since the last attempt
+    if (this->contexts)
+    {
+        std::error_code ec;
+        auto latest = this->contexts->Get(this->logger, false, this->config, ec);
+        if (latest)
+        {
+            this->ctx = latest;
+        }
+    }
+
     auto stream
-        = std::make_shared<asio::ssl::stream<asio::ip::tcp::socket>>(*this->executor->get_context(), this->ctx.value);
+        = std::make_shared<asio::ssl::stream<asio::ip::tcp::socket>>(*this->executor->get_context(), this->ctx->value);
 
     auto verify = [self = shared_from_this()](bool preverified, asio::ssl::verify_context& ctx) -> bool {
         self->LogVerifyCallback(preverified, ctx);
@@ -85,6 +104,16 @@ bool TLSClient::BeginConnect(const IPEndpoint& remote, const connect_callback_t&
         return true;
     }
 
+    if (this->config.enableSessionResumption && this->sessions)
+    {
+        this->sessionKey = TLSSessionCache::GetKey(remote, this->config);
+        if (this->sessions->Attach(stream->native_handle(), this->sessionKey))
+        {
+            FORMAT_LOG_BLOCK(this->logger, flags::DBG, "Offering cached TLS session to: %s, port %u",
+                             remote.address.c_str(), remote.port);
+        }
+    }
+
     SocketHelpers::BindToLocalAddress<asio::ip::tcp>(this->adapter, 0, stream->lowest_layer(), ec);
 
     if (ec)
@@ -183,17 +212,57 @@ void TLSClient::HandleConnectResult(const connect_callback_t& callback,
             callback(this->executor, stream, ec);
         }
     }
+    else if (!this->handshakes || SSL_get_session(stream->native_handle()))
+    {
+        // abbreviated handshakes are cheap and don't count against the limit
+        this->BeginHandshake(callback, stream, 0);
+    }
     else
     {
-        auto cb = [self = shared_from_this(), callback, stream](const std::error_code& ec) {
-            if (!self->canceled)
+        auto ticket = std::make_shared<ConnectionAdmission::ticket_t>(0);
+        auto admitted = [self = shared_from_this(), callback, stream, ticket]() {
+            if (self->canceled)
             {
-                callback(self->executor, stream, ec);
+                self->handshakes->Release(*ticket);
+                return;
             }
+
+            self->BeginHandshake(callback, stream, *ticket);
         };
 
-        stream->async_handshake(asio::ssl::stream_base::client, executor->wrap(cb));
+        *ticket = this->handshakes->Request(this->executor, 0, admitted);
     }
 }
 
+void TLSClient::BeginHandshake(const connect_callback_t& callback,
+                               const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream,
+                               ConnectionAdmission::ticket_t ticket)
+{
+    auto cb = [self = shared_from_this(), callback, stream, ticket](const std::error_code& ec) {
+        if (ticket)
+        {
+            self->handshakes->Release(ticket);
+        }
+
+        if (self->config.enableSessionResumption && self->sessions)
+        {
+            if (ec)
+            {
+                self->sessions->Remove(self->sessionKey);
+            }
+            else if (SSL_session_reused(stream->native_handle()))
+            {
+                SIMPLE_LOG_BLOCK(self->logger, flags::DBG, "Resumed TLS session");
+            }
+        }
+
+        if (!self->canceled)
+        {
+            callback(self->executor, stream, ec);
+        }
+    };
+
+    stream->async_handshake(asio::ssl::stream_base::client, executor->wrap(cb));
+}
+
 } // namespace opendnp3
@@ -20,8 +20,10 @@
 #ifndef OPENDNP3_TLSCLIENT_H
 #define OPENDNP3_TLSCLIENT_H
 
+#include "channel/ConnectionAdmission.h"
 #include "channel/LoggingConnectionCondition.h"
-#include "channel/tls/SSLContext.h"
+#include "channel/tls/SSLContextCache.h"
+#include "channel/tls/TLSSessionCache.h"
 
 #include "opendnp3/channel/IPEndpoint.h"
 #include "opendnp3/channel/TLSConfig.h"
@@ -46,9 +48,12 @@ public:
                                              const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
                                              const std::string& adapter,
                                              const TLSConfig& config,
-                                             std::error_code& ec)
+                                             std::error_code& ec,
+                                             const std::shared_ptr<SSLContextCache>& contexts = nullptr,
+                                             const std::shared_ptr<TLSSessionCache>& sessions = nullptr,
+                                             const std::shared_ptr<ConnectionAdmission>& handshakes = nullptr)
     {
-        auto ret = std::make_shared<TLSClient>(logger, executor, adapter, config, ec);
+        auto ret = std::make_shared<TLSClient>(logger, executor, adapter, config, ec, contexts, sessions, handshakes);
         return ec ? nullptr : ret;
     }
 
@@ -56,7 +61,10 @@ public:
               const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
               std::string adapter,
               const TLSConfig& config,
-              std::error_code& ec);
+              std::error_code& ec,
+              const std::shared_ptr<SSLContextCache>& contexts = nullptr,
+              std::shared_ptr<TLSSessionCache> sessions = nullptr,
+              std::shared_ptr<ConnectionAdmission> handshakes = nullptr);
 
     bool Cancel();
 
@@ -74,13 +82,22 @@ private:
                              const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream,
                              const std::error_code& ec);
 
+    void BeginHandshake(const connect_callback_t& callback,
+                        const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream,
+                        ConnectionAdmission::ticket_t ticket);
+
     bool canceled = false;
 
     Logger logger;
     LoggingConnectionCondition condition;
     const std::shared_ptr<exe4cpp::StrandExecutor> executor;
     const std::string adapter;
-    SSLContext ctx;
+    const std::shared_ptr<SSLContextCache> contexts;
+    std::shared_ptr<SSLContext> ctx;
+    const TLSConfig config;
+    const std::shared_ptr<TLSSessionCache> sessions;
+    const std::shared_ptr<ConnectionAdmission> handshakes;
+    std::string sessionKey;
     asio::ip::tcp::endpoint localEndpoint;
     asio::ip::tcp::resolver resolver;
 };
@@ -36,14 +36,23 @@ TLSClientIOHandler::TLSClientIOHandler(const Logger& logger,
                                        const ChannelRetry& retry,
                                        const IPEndpointsList& remotes,
                                        std::string adapter,
-                                       std::shared_ptr<ILinkSessionsManager> sessionsManager)
-    : IOHandler(logger, false, listener, std::move(sessionManager), true),
+                                       std::shared_ptr<ISharedChannelData> sessionsManager,
+                                       std::shared_ptr<SSLContextCache> contexts,
+                                       std::shared_ptr<TLSSessionCache> sessions,
+                                       std::shared_ptr<ConnectionAdmission> handshakes,
+                                       std::shared_ptr<ConnectionAdmission> admission)
+    : IOHandler(logger, false, listener, std::move(sessionsManager), true),
       executor(executor),
       config(std::move(config)),
       retry(retry),
       remotes(remotes),
-      adapter(std::move(adapter))
+      adapter(std::move(adapter)),
+      contexts(std::move(contexts)),
+      sessions(std::move(sessions)),
+      handshakes(std::move(handshakes)),
+      admission(std::move(admission))
 {
+    this->SetReliableTransport();
 }
 
 void TLSClientIOHandler::ShutdownImpl()
@@ -55,7 +64,7 @@ void TLSClientIOHandler::BeginChannelAccept()
 {
     std::error_code ec;
 
-    this->client = TLSClient::Create(logger, executor, adapter, config, ec);
+    this->client = TLSClient::Create(logger, executor, adapter, config, ec, contexts, sessions, handshakes);
 
     if (ec)
     {
@@ -92,6 +101,8 @@ void TLSClientIOHandler::StartConnect(const TimeDuration& delay)
     auto cb = [=, self = shared_from_this()](const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
                                              const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream,
                                              const std::error_code& ec) -> void {
+        this->ReleaseAdmission();
+
         if (ec)
         {
             FORMAT_LOG_BLOCK(this->logger, flags::WARN, "Error Connecting: %s", ec.message().c_str());
@@ -117,14 +128,56 @@ void TLSClientIOHandler::StartConnect(const TimeDuration& delay)
         }
     };
 
-    FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Connecting to: %s, port %u",
-                     this->remotes.GetCurrentEndpoint().address.c_str(), this->remotes.GetCurrentEndpoint().port);
+    auto connect = [this, cb]() {
+        if (!this->client)
+        {
+            return;
+        }
+
+        FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Connecting to: %s, port %u",
+                         this->remotes.GetCurrentEndpoint().address.c_str(), this->remotes.GetCurrentEndpoint().port);
+
+        this->client->BeginConnect(this->remotes.GetCurrentEndpoint(), cb);
+    };
 
-    this->client->BeginConnect(this->remotes.GetCurrentEndpoint(), cb);
+    this->Admit(connect);
+}
+
+void TLSClientIOHandler::Admit(const std::function<void()>& connect)
+{
+    this->ReleaseAdmission();
+
+    if (!this->admission)
+    {
+        connect();
+        return;
+    }
+
+    auto onAdmitted = [this, self = shared_from_this(), connect, generation = this->admissionGeneration]() {
+        // ignore admissions for attempts that were abandoned while queued
+        if (generation == this->admissionGeneration)
+        {
+            connect();
+        }
+    };
+
+    this->admissionTicket = this->admission->Request(this->executor, this->retry.connectPriority, onAdmitted);
+}
+
+void TLSClientIOHandler::ReleaseAdmission()
+{
+    if (this->admission && this->admissionTicket != 0)
+    {
+        this->admission->Release(this->admissionTicket);
+        this->admissionTicket = 0;
+        ++this->admissionGeneration;
+    }
 }
 
 void TLSClientIOHandler::ResetState()
 {
+    this->ReleaseAdmission();
+
     if (this->client)
     {
         this->client->Cancel();
@@ -45,9 +45,13 @@ public:
                                                       const ChannelRetry& retry,
                                                       const IPEndpointsList& remotes,
                                                       const std::string& adapter,
-                                                      std::shared_ptr<ILinkSessionsManager> sessionsManager)
+                                                      std::shared_ptr<ISharedChannelData> sessionsManager,
+                                                      const std::shared_ptr<SSLContextCache>& contexts = nullptr,
+                                                      const std::shared_ptr<TLSSessionCache>& sessions = nullptr,
+                                                      const std::shared_ptr<ConnectionAdmission>& handshakes = nullptr,
+                                                      const std::shared_ptr<ConnectionAdmission>& admission = nullptr)
     {
-        return std::make_shared<TLSClientIOHandler>(logger, listener, executor, config, retry, remotes, adapter, std::move(sessionManager));
+        return std::make_shared<TLSClientIOHandler>(logger, listener, executor, config, retry, remotes, adapter, std::move(sessionsManager), contexts, sessions, handshakes, admission);
     }
 
     TLSClientIOHandler(const Logger& logger,
@@ -57,7 +61,11 @@ public:
                        const ChannelRetry& retry,
                        const IPEndpointsList& remotes,
                        std::string adapter,
-                       std::shared_ptr<ILinkSessionsManager> sessionsManager);
+                       std::shared_ptr<ISharedChannelData> sessionsManager,
+                       std::shared_ptr<SSLContextCache> contexts = nullptr,
+                       std::shared_ptr<TLSSessionCache> sessions = nullptr,
+                       std::shared_ptr<ConnectionAdmission> handshakes = nullptr,
+                       std::shared_ptr<ConnectionAdmission> admission = nullptr);
 
 protected:
     virtual void ShutdownImpl() override;
@@ -68,6 +76,12 @@ protected:
 private:
     void StartConnect(const TimeDuration& delay);
 
+    // run the connection attempt once the manager admits it
+    void Admit(const std::function<void()>& connect);
+
+    // called when the admitted attempt completes
+    void ReleaseAdmission();
+
     void ResetState();
 
     const std::shared_ptr<exe4cpp::StrandExecutor> executor;
@@ -75,6 +89,12 @@ private:
     const ChannelRetry retry;
     IPEndpointsList remotes;
     const std::string adapter;
+    const std::shared_ptr<SSLContextCache> contexts;
+    const std::shared_ptr<TLSSessionCache> sessions;
+    const std::shared_ptr<ConnectionAdmission> handshakes;
+    const std::shared_ptr<ConnectionAdmission> admission;
+    ConnectionAdmission::ticket_t admissionTicket = 0;
+    uint32_t admissionGeneration = 0;
 
     // current value of the client
     std::shared_ptr<TLSClient> client;
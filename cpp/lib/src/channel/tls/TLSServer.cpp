@@ -33,10 +33,15 @@ TLSServer::TLSServer(const Logger& logger,
                      const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
                      const IPEndpoint& endpoint,
                      const TLSConfig& config,
-                     std::error_code& ec)
+                     std::error_code& ec,
+                     std::shared_ptr<SSLContextCache> contexts,
+                     std::shared_ptr<ConnectionAdmission> handshakes)
     : logger(logger),
       executor(executor),
-      ctx(logger, true, config, ec),
+      contexts(std::move(contexts)),
+      config(config),
+      ctx(SSLContextCache::Acquire(this->contexts, logger, true, config, ec)),
+      handshakes(std::move(handshakes)),
       endpoint(asio::ip::tcp::v4(), endpoint.port),
       acceptor(*executor->get_context())
 {
@@ -98,9 +103,20 @@ void TLSServer::StartAccept()
     // this ensures that the TCPListener is never deleted during an active callback
     auto self(shared_from_this());
 
+    // pick up a context reloaded since the last accept
+    if (this->contexts)
+    {
+        auto latest = this->contexts->Get(this->logger, true, this->config, ec);
+        if (latest)
+        {
+            this->ctx = latest;
+        }
+        ec.clear();
+    }
+
     // this could be a unique_ptr once move semantics are supported in lambdas
     auto stream
-        = std::make_shared<asio::ssl::stream<asio::ip::tcp::socket>>(*this->executor->get_context(), self->ctx.value);
+        = std::make_shared<asio::ssl::stream<asio::ip::tcp::socket>>(*this->executor->get_context(), self->ctx->value);
 
     auto verify = [this, ID](bool preverified, asio::ssl::verify_context& ctx) {
         return this->VerifyCallback(ID, preverified, ctx);
@@ -149,21 +165,57 @@ void TLSServer::StartAccept()
             return;
         }
 
-        auto handshake_cb = [stream, ID, self](const std::error_code& ec) {
-            if (ec)
+        if (!self->handshakes)
+        {
+            self->BeginHandshake(ID, stream, 0);
+            return;
+        }
+
+        // whether the peer resumes a session is only known once the handshake is underway, so every handshake
+        // waits for a slot
+        auto ticket = std::make_shared<ConnectionAdmission::ticket_t>(0);
+        auto admitted = [self, stream, ID, ticket]() {
+            if (self->isShutdown)
             {
-                FORMAT_LOG_BLOCK(self->logger, flags::INFO, "TLS handshake failed: %s", ec.message().c_str());
+                self->handshakes->Release(*ticket);
                 return;
             }
 
-            self->AcceptStream(ID, self->executor, stream);
+            self->BeginHandshake(ID, stream, *ticket);
         };
 
-        // Begin the TLS handshake
-        stream->async_handshake(asio::ssl::stream_base::server, self->executor->wrap(handshake_cb));
+        *ticket = self->handshakes->Request(self->executor, 0, admitted);
     };
 
     this->acceptor.async_accept(stream->lowest_layer(), this->executor->wrap(accept_cb));
 }
 
+void TLSServer::BeginHandshake(uint64_t sessionid,
+                               const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream,
+                               ConnectionAdmission::ticket_t ticket)
+{
+    auto handshake_cb = [stream, sessionid, ticket, self = shared_from_this()](const std::error_code& ec) {
+        if (ticket)
+        {
+            self->handshakes->Release(ticket);
+        }
+
+        if (ec)
+        {
+            FORMAT_LOG_BLOCK(self->logger, flags::INFO, "TLS handshake failed: %s", ec.message().c_str());
+            return;
+        }
+
+        if (SSL_session_reused(stream->native_handle()))
+        {
+            SIMPLE_LOG_BLOCK(self->logger, flags::DBG, "Resumed TLS session");
+        }
+
+        self->AcceptStream(sessionid, self->executor, stream);
+    };
+
+    // Begin the TLS handshake
+    stream->async_handshake(asio::ssl::stream_base::server, this->executor->wrap(handshake_cb));
+}
+
 } // namespace opendnp3
@@ -20,7 +20,8 @@
 #ifndef OPENDNP3_TLSSERVER_H
 #define OPENDNP3_TLSSERVER_H
 
-#include "channel/tls/SSLContext.h"
+#include "channel/ConnectionAdmission.h"
+#include "channel/tls/SSLContextCache.h"
 
 #include "opendnp3/channel/IListener.h"
 #include "opendnp3/channel/IPEndpoint.h"
@@ -45,7 +46,9 @@ public:
               const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
               const IPEndpoint& endpoint,
               const TLSConfig& config,
-              std::error_code& ec);
+              std::error_code& ec,
+              std::shared_ptr<SSLContextCache> contexts = nullptr,
+              std::shared_ptr<ConnectionAdmission> handshakes = nullptr);
 
     /// Stop listening for connections, permanently shutting down the listener
     void Shutdown() override;
@@ -70,7 +73,14 @@ private:
     std::error_code ConfigureContext(const TLSConfig& config, std::error_code& ec);
     std::error_code ConfigureListener(const std::string& adapter, std::error_code& ec);
 
-    SSLContext ctx;
+    void BeginHandshake(uint64_t sessionid,
+                        const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream,
+                        ConnectionAdmission::ticket_t ticket);
+
+    const std::shared_ptr<SSLContextCache> contexts;
+    const TLSConfig config;
+    std::shared_ptr<SSLContext> ctx;
+    const std::shared_ptr<ConnectionAdmission> handshakes;
     asio::ip::tcp::endpoint endpoint;
     asio::ip::tcp::acceptor acceptor;
 
@@ -44,13 +44,19 @@ TLSServerIOHandler::TLSServerIOHandler(const Logger& logger,
                                        IPEndpoint endpoint,
                                        TLSConfig config,
                                        std::error_code& ec,
-                                       std::shared_ptr<ILinkSessionsManager> sessionsManager)
-    : IOHandler(logger, mode == ServerAcceptMode::CloseExisting, listener, std::move(sessionManager), true),
+                                       std::shared_ptr<ISharedChannelData> sessionsManager,
+                                       std::shared_ptr<SSLContextCache> contexts,
+                                       std::shared_ptr<ConnectionAdmission> handshakes)
+    : IOHandler(logger, mode == ServerAcceptMode::CloseExisting, listener, std::move(sessionsManager), true),
       executor(std::move(executor)),
       endpoint(std::move(endpoint)),
       config(std::move(config)),
-      server(std::make_shared<Server>(this->logger, this->executor, this->endpoint, this->config, ec))
+      contexts(std::move(contexts)),
+      handshakes(std::move(handshakes)),
+      server(std::make_shared<Server>(
+          this->logger, this->executor, this->endpoint, this->config, ec, this->contexts, this->handshakes))
 {
+    this->SetReliableTransport();
 }
 
 void TLSServerIOHandler::ShutdownImpl()
@@ -75,7 +81,8 @@ void TLSServerIOHandler::BeginChannelAccept()
     else
     {
         std::error_code ec;
-        this->server = std::make_shared<Server>(this->logger, this->executor, this->endpoint, this->config, ec);
+        this->server = std::make_shared<Server>(this->logger, this->executor, this->endpoint, this->config, ec,
+                                                this->contexts, this->handshakes);
 
         if (ec)
         {
@@ -44,8 +44,10 @@ class TLSServerIOHandler final : public IOHandler
                const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
                const IPEndpoint& endpoint,
                const TLSConfig& config,
-               std::error_code& ec)
-            : TLSServer(logger, executor, endpoint, config, ec)
+               std::error_code& ec,
+               std::shared_ptr<SSLContextCache> contexts,
+               std::shared_ptr<ConnectionAdmission> handshakes)
+            : TLSServer(logger, executor, endpoint, config, ec, std::move(contexts), std::move(handshakes))
         {
         }
 
@@ -81,9 +83,11 @@ public:
                                                       const IPEndpoint& endpoint,
                                                       const TLSConfig& config,
                                                       std::error_code& ec,
-                                                      std::shared_ptr<ILinkSessionsManager> sessionsManager)
+                                                      std::shared_ptr<ISharedChannelData> sessionsManager,
+                                                      const std::shared_ptr<SSLContextCache>& contexts = nullptr,
+                                                      const std::shared_ptr<ConnectionAdmission>& handshakes = nullptr)
     {
-        return std::make_shared<TLSServerIOHandler>(logger, mode, listener, executor, endpoint, config, ec, std::move(sessionManager));
+        return std::make_shared<TLSServerIOHandler>(logger, mode, listener, executor, endpoint, config, ec, std::move(sessionsManager), contexts, handshakes);
     }
 
     TLSServerIOHandler(const Logger& logger,
@@ -93,7 +97,9 @@ public:
                        IPEndpoint endpoint,
                        TLSConfig config,
                        std::error_code& ec,
-                       std::shared_ptr<ILinkSessionsManager> sessionsManager);
+                       std::shared_ptr<ISharedChannelData> sessionsManager,
+                       std::shared_ptr<SSLContextCache> contexts = nullptr,
+                       std::shared_ptr<ConnectionAdmission> handshakes = nullptr);
 
 protected:
     virtual void ShutdownImpl() override;
@@ -105,6 +111,8 @@ private:
     const std::shared_ptr<exe4cpp::StrandExecutor> executor;
     const IPEndpoint endpoint;
     const TLSConfig config;
+    const std::shared_ptr<SSLContextCache> contexts;
+    const std::shared_ptr<ConnectionAdmission> handshakes;
     std::shared_ptr<Server> server;
 };
 
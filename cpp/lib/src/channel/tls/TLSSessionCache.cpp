@@ -0,0 +1,167 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/tls/TLSSessionCache.h"
+
+#include <sstream>
+
+namespace opendnp3
+{
+
+TLSSessionCache::TLSSessionCache(size_t maxEntries) : maxEntries(maxEntries) {}
+
+TLSSessionCache::~TLSSessionCache()
+{
+    for (auto& entry : this->sessions)
+    {
+        SSL_SESSION_free(entry.second.session);
+    }
+}
+
+std::string TLSSessionCache::GetKey(const IPEndpoint& remote, const TLSConfig& config)
+{
+    // fields are separated by NUL, which cannot appear in a host name, path or cipher list
+    std::ostringstream oss;
+    oss << remote.address << '\0' << remote.port << '\0' << config.peerCertFilePath << '\0'
+        << config.localCertFilePath << '\0' << config.privateKeyFilePath << '\0' << config.allowTLSv10
+        << config.allowTLSv11 << config.allowTLSv12 << config.allowTLSv13 << '\0' << config.cipherList;
+    return oss.str();
+}
+
+void TLSSessionCache::Enable(SSL_CTX* ctx)
+{
+    SSL_CTX_sess_set_new_cb(ctx, &TLSSessionCache::OnNewSession);
+}
+
+bool TLSSessionCache::Attach(SSL* ssl, const std::string& key)
+{
+    const auto index = GetBindingIndex();
+    delete static_cast<Binding*>(SSL_get_ex_data(ssl, index));
+    SSL_set_ex_data(ssl, index, new Binding{this->shared_from_this(), key});
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    const auto iter = this->sessions.find(key);
+    if (iter == this->sessions.end())
+    {
+        return false;
+    }
+
+    return SSL_set_session(ssl, iter->second.session) == 1;
+}
+
+void TLSSessionCache::Remove(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    const auto iter = this->sessions.find(key);
+    if (iter != this->sessions.end())
+    {
+        SSL_SESSION_free(iter->second.session);
+        this->sessions.erase(iter);
+    }
+}
+
+void TLSSessionCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    for (auto& entry : this->sessions)
+    {
+        SSL_SESSION_free(entry.second.session);
+    }
+    this->sessions.clear();
+}
+
+size_t TLSSessionCache::Size() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->sessions.size();
+}
+
+int TLSSessionCache::GetBindingIndex()
+{
+    static const int index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, &TLSSessionCache::FreeBinding);
+    return index;
+}
+
+int TLSSessionCache::OnNewSession(SSL* ssl, SSL_SESSION* session)
+{
+    const auto binding = static_cast<Binding*>(SSL_get_ex_data(ssl, GetBindingIndex()));
+    if (!binding)
+    {
+        return 0;
+    }
+
+    const auto cache = binding->cache.lock();
+    if (!cache || !SSL_SESSION_is_resumable(session))
+    {
+        return 0;
+    }
+
+    // returning 1 hands our reference to the session over to the cache
+    cache->Store(binding->key, session);
+    return 1;
+}
+
+void TLSSessionCache::FreeBinding(
+    void* /*parent*/, void* ptr, CRYPTO_EX_DATA* /*ad*/, int /*idx*/, long /*argl*/, void* /*argp*/)
+{
+    delete static_cast<Binding*>(ptr);
+}
+
+void TLSSessionCache::Store(const std::string& key, SSL_SESSION* session)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    const auto iter = this->sessions.find(key);
+    if (iter != this->sessions.end())
+    {
+        SSL_SESSION_free(iter->second.session);
+        iter->second = Entry{session, ++this->nextStamp};
+        return;
+    }
+
+    if (this->maxEntries > 0 && this->sessions.size() >= this->maxEntries)
+    {
+        this->EvictOldest();
+    }
+
+    this->sessions[key] = Entry{session, ++this->nextStamp};
+}
+
+void TLSSessionCache::EvictOldest()
+{
+    auto oldest = this->sessions.begin();
+    for (auto iter = this->sessions.begin(); iter != this->sessions.end(); ++iter)
+    {
+        if (iter->second.stamp < oldest->second.stamp)
+        {
+            oldest = iter;
+        }
+    }
+
+    if (oldest != this->sessions.end())
+    {
+        SSL_SESSION_free(oldest->second.session);
+        this->sessions.erase(oldest);
+    }
+}
+
+} // namespace opendnp3
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_TLSSESSIONCACHE_H
+#define OPENDNP3_TLSSESSIONCACHE_H
+
+#include "opendnp3/channel/IPEndpoint.h"
+#include "opendnp3/channel/TLSConfig.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <openssl/ssl.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace opendnp3
+{
+
+/**
+ * Client side cache of resumable TLS sessions shared by all the channels of a manager
+ *
+ * Sessions are keyed by remote endpoint and the full TLS configuration, so a session is only offered to the peer that
+ * issued it, with the identity and trust settings it was verified with. Resuming skips peer verification, so two
+ * channels to the same endpoint that trust different certificates must never share a session. Sessions are captured
+ * through the new session callback of the SSL_CTX, which also picks up TLS 1.3 tickets that arrive after the
+ * handshake completes.
+ */
+class TLSSessionCache final : public std::enable_shared_from_this<TLSSessionCache>, private Uncopyable
+{
+public:
+    /**
+     * @param maxEntries maximum number of cached sessions, the oldest is evicted first
+     */
+    explicit TLSSessionCache(size_t maxEntries = 1024);
+
+    ~TLSSessionCache();
+
+    static std::string GetKey(const IPEndpoint& remote, const TLSConfig& config);
+
+    /**
+     * Install the new session callback on a client context. The context must have client session caching enabled.
+     */
+    static void Enable(SSL_CTX* ctx);
+
+    /**
+     * Bind a connection to a cache entry so new sessions are stored under the key, and offer the cached session if
+     * there is one
+     *
+     * @return true if a session was offered for resumption
+     */
+    bool Attach(SSL* ssl, const std::string& key);
+
+    /**
+     * Discard the session stored under a key, e.g. after a failed handshake
+     */
+    void Remove(const std::string& key);
+
+    /**
+     * Discard every session, e.g. after the trusted certificates were reloaded
+     */
+    void Clear();
+
+    size_t Size() const;
+
+private:
+    struct Entry
+    {
+        SSL_SESSION* session;
+        uint64_t stamp;
+    };
+
+    struct Binding
+    {
+        std::weak_ptr<TLSSessionCache> cache;
+        std::string key;
+    };
+
+    static int GetBindingIndex();
+
+    static int OnNewSession(SSL* ssl, SSL_SESSION* session);
+
+    static void FreeBinding(void* parent, void* ptr, CRYPTO_EX_DATA* ad, int idx, long argl, void* argp);
+
+    // takes ownership of the session reference
+    void Store(const std::string& key, SSL_SESSION* session);
+
+    void EvictOldest();
+
+    const size_t maxEntries;
+
+    mutable std::mutex mutex;
+    uint64_t nextStamp = 0;
+    std::map<std::string, Entry> sessions;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "opendnp3/decoder/CaptureReplay.h"
+
+#include "decoder/CaptureReplayImpl.h"
+
+namespace opendnp3
+{
+
+CaptureReplay::CaptureReplay(ISOEHandler& handler, const Logger& logger, uint32_t maxRxFragSize)
+    : impl(new CaptureReplayImpl(handler, logger, maxRxFragSize))
+{
+}
+
+bool CaptureReplay::Load(const std::string& path)
+{
+    return impl->Load(path);
+}
+
+ReplayStatistics CaptureReplay::Run(uint32_t iterations)
+{
+    return impl->Run(iterations);
+}
+
+CaptureReplay::~CaptureReplay()
+{
+    delete impl;
+}
+
+} // namespace opendnp3
@@ -0,0 +1,164 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "decoder/CaptureReplayImpl.h"
+
+#include "app/parsing/APDUHeaderParser.h"
+#include "master/MeasurementHandler.h"
+
+namespace opendnp3
+{
+
+CaptureReplayImpl::CaptureReplayImpl(ISOEHandler& handler, const Logger& logger, uint32_t maxRxFragSize)
+    : handler(&handler), logger(logger), maxRxFragSize(maxRxFragSize), reader(logger), link(logger)
+{
+}
+
+bool CaptureReplayImpl::Load(const std::string& path)
+{
+    return this->reader.Load(path);
+}
+
+ReplayStatistics CaptureReplayImpl::Run(uint32_t iterations)
+{
+    this->statistics = ReplayStatistics();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        this->Reset();
+
+        for (const auto& record : this->reader.Records())
+        {
+            if (record.direction == CaptureDirection::Rx)
+            {
+                ++this->statistics.numRecords;
+                this->statistics.numBytes += record.data.length();
+                this->ProcessLPDU(record.data);
+            }
+        }
+    }
+
+    this->statistics.elapsed = std::chrono::steady_clock::now() - start;
+
+    return this->statistics;
+}
+
+void CaptureReplayImpl::Reset()
+{
+    this->link.Reset();
+    for (auto& transport : this->transports)
+    {
+        transport.second->Reset();
+    }
+}
+
+void CaptureReplayImpl::ProcessLPDU(const ser4cpp::rseq_t& data)
+{
+    ser4cpp::rseq_t remaining(data);
+
+    while (remaining.is_not_empty())
+    {
+        auto dest = this->link.WriteBuff();
+
+        const auto NUM = (remaining.length() > dest.length()) ? dest.length() : remaining.length();
+
+        dest.copy_from(remaining.take(NUM));
+        this->link.OnRead(NUM, *this);
+
+        remaining.advance(NUM);
+    }
+}
+
+void CaptureReplayImpl::ProcessAPDU(const ser4cpp::rseq_t& data)
+{
+    ++this->statistics.numFragments;
+
+    if (!IsResponse(data))
+    {
+        return;
+    }
+
+    const auto result = APDUHeaderParser::ParseResponse(data, &this->logger);
+    if (!result.success)
+    {
+        ++this->statistics.numParseErrors;
+        return;
+    }
+
+    ++this->statistics.numResponses;
+
+    if (MeasurementHandler::ProcessMeasurements(result.header.as_response_info(), result.objects, this->logger,
+                                                this->handler)
+        != ParseResult::OK)
+    {
+        ++this->statistics.numParseErrors;
+    }
+}
+
+TransportRx& CaptureReplayImpl::GetTransport(const Addresses& addresses)
+{
+    const uint32_t key = (static_cast<uint32_t>(addresses.source) << 16) | addresses.destination;
+
+    auto iter = this->transports.find(key);
+    if (iter == this->transports.end())
+    {
+        iter = this->transports
+                   .emplace(key, std::unique_ptr<TransportRx>(new TransportRx(this->logger, this->maxRxFragSize)))
+                   .first;
+    }
+
+    return *iter->second;
+}
+
+bool CaptureReplayImpl::IsResponse(const ser4cpp::rseq_t& data)
+{
+    if (data.length() < 2)
+    {
+        return false;
+    }
+
+    switch (FunctionCodeSpec::from_type(data[1]))
+    {
+    case (FunctionCode::RESPONSE):
+    case (FunctionCode::UNSOLICITED_RESPONSE):
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool CaptureReplayImpl::OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata)
+{
+    ++this->statistics.numLinkFrames;
+
+    if (header.func == LinkFunction::PRI_CONFIRMED_USER_DATA || header.func == LinkFunction::PRI_UNCONFIRMED_USER_DATA)
+    {
+        const auto result = this->GetTransport(header.addresses).ProcessReceive(Message(header.addresses, userdata));
+        if (result.payload.is_not_empty())
+        {
+            this->ProcessAPDU(result.payload);
+        }
+    }
+
+    return true;
+}
+
+} // namespace opendnp3
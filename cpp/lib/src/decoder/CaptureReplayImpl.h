@@ -0,0 +1,72 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_CAPTUREREPLAYIMPL_H
+#define OPENDNP3_CAPTUREREPLAYIMPL_H
+
+#include "channel/CaptureReader.h"
+#include "link/IFrameSink.h"
+#include "link/LinkLayerParser.h"
+#include "transport/TransportRx.h"
+
+#include "opendnp3/decoder/CaptureReplay.h"
+#include "opendnp3/logging/Logger.h"
+
+#include <map>
+#include <memory>
+
+namespace opendnp3
+{
+
+// feeds captured data through the master receive path
+class CaptureReplayImpl final : private IFrameSink
+{
+public:
+    CaptureReplayImpl(ISOEHandler& handler, const Logger& logger, uint32_t maxRxFragSize);
+
+    bool Load(const std::string& path);
+
+    ReplayStatistics Run(uint32_t iterations);
+
+private:
+    void Reset();
+
+    void ProcessLPDU(const ser4cpp::rseq_t& data);
+    void ProcessAPDU(const ser4cpp::rseq_t& data);
+
+    TransportRx& GetTransport(const Addresses& addresses);
+
+    static bool IsResponse(const ser4cpp::rseq_t& data);
+
+    /// --- Implement IFrameSink ---
+    virtual bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) override;
+
+    ISOEHandler* handler;
+    Logger logger;
+    const uint32_t maxRxFragSize;
+    CaptureReader reader;
+    LinkLayerParser link;
+    // one reassembly buffer per source/destination pair
+    std::map<uint32_t, std::unique_ptr<TransportRx>> transports;
+    ReplayStatistics statistics;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,432 @@
+//
+//  _   _         ______    _ _ _   _             _ _ _
+// | \ | |       |  ____|  | (_) | (_)           | | | |
+// |  \| | ___   | |__   __| |_| |_ _ _ __   __ _| | | |
+// | . ` |/ _ \  |  __| / _` | | __| | '_ \ / _` | | | |
+// | |\  | (_) | | |___| (_| | | |_| | | | | (_| |_|_|_|
+// |_| \_|\___/  |______\__,_|_|\__|_|_| |_|\__, (_|_|_)
+//                                           __/ |
+//                                          |___/
+// 
+// This file is auto-generated. Do not edit manually
+// 
+// Copyright 2013-2022 Step Function I/O, LLC
+// 
+// Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+// LLC (https://stepfunc.io) under one or more contributor license agreements.
+// See the NOTICE file distributed with this work for additional information
+// regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+// this file to you under the Apache License, Version 2.0 (the "License"); you
+// may not use this file except in compliance with the License. You may obtain
+// a copy of the License at:
+// 
+//   http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "gen/GroupVariationTable.h"
+
+namespace opendnp3 {
+
+const GroupInfo GroupVariationTable::groups[256] =
+{
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g0
+  {0, 3, GroupVariationType::STATIC, GroupVariation::UNKNOWN}, // g1
+  {3, 4, GroupVariationType::EVENT, GroupVariation::UNKNOWN}, // g2
+  {7, 3, GroupVariationType::STATIC, GroupVariation::UNKNOWN}, // g3
+  {10, 4, GroupVariationType::EVENT, GroupVariation::UNKNOWN}, // g4
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g5
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g6
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g7
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g8
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g9
+  {14, 3, GroupVariationType::STATIC, GroupVariation::UNKNOWN}, // g10
+  {17, 3, GroupVariationType::EVENT, GroupVariation::UNKNOWN}, // g11
+  {20, 2, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g12
+  {22, 3, GroupVariationType::EVENT, GroupVariation::UNKNOWN}, // g13
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g14
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g15
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g16
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g17
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g18
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g19
+  {25, 7, GroupVariationType::STATIC, GroupVariation::UNKNOWN}, // g20
+  {32, 11, GroupVariationType::STATIC, GroupVariation::UNKNOWN}, // g21
+  {43, 7, GroupVariationType::EVENT, GroupVariation::UNKNOWN}, // g22
+  {50, 7, GroupVariationType::EVENT, GroupVariation::UNKNOWN}, // g23
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g24
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g25
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g26
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g27
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g28
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g29
+  {57, 7, GroupVariationType::STATIC, GroupVariation::UNKNOWN}, // g30
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g31
+  {64, 9, GroupVariationType::EVENT, GroupVariation::UNKNOWN}, // g32
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g33
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g34
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g35
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g36
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g37
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g38
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g39
+  {73, 5, GroupVariationType::STATIC, GroupVariation::UNKNOWN}, // g40
+  {78, 5, GroupVariationType::EVENT, GroupVariation::UNKNOWN}, // g41
+  {83, 9, GroupVariationType::EVENT, GroupVariation::UNKNOWN}, // g42
+  {92, 9, GroupVariationType::EVENT, GroupVariation::UNKNOWN}, // g43
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g44
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g45
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g46
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g47
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g48
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g49
+  {101, 5, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g50
+  {106, 3, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g51
+  {109, 3, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g52
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g53
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g54
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g55
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g56
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g57
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g58
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g59
+  {112, 5, GroupVariationType::EVENT, GroupVariation::UNKNOWN}, // g60
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g61
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g62
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g63
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g64
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g65
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g66
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g67
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g68
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g69
+  {117, 9, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g70
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g71
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g72
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g73
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g74
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g75
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g76
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g77
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g78
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g79
+  {126, 2, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g80
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g81
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g82
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g83
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g84
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g85
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g86
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g87
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g88
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g89
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g90
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g91
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g92
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g93
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g94
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g95
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g96
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g97
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g98
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g99
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g100
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g101
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g102
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g103
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g104
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g105
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g106
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g107
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g108
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g109
+  {128, 1, GroupVariationType::STATIC, GroupVariation::Group110Var0}, // g110
+  {129, 1, GroupVariationType::EVENT, GroupVariation::Group111Var0}, // g111
+  {130, 1, GroupVariationType::OTHER, GroupVariation::Group112Var0}, // g112
+  {131, 1, GroupVariationType::OTHER, GroupVariation::Group113Var0}, // g113
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g114
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g115
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g116
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g117
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g118
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g119
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g120
+  {0, 0, GroupVariationType::STATIC, GroupVariation::UNKNOWN}, // g121
+  {0, 0, GroupVariationType::EVENT, GroupVariation::UNKNOWN}, // g122
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g123
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g124
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g125
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g126
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g127
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g128
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g129
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g130
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g131
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g132
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g133
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g134
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g135
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g136
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g137
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g138
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g139
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g140
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g141
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g142
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g143
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g144
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g145
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g146
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g147
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g148
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g149
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g150
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g151
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g152
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g153
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g154
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g155
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g156
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g157
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g158
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g159
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g160
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g161
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g162
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g163
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g164
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g165
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g166
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g167
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g168
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g169
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g170
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g171
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g172
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g173
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g174
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g175
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g176
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g177
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g178
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g179
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g180
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g181
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g182
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g183
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g184
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g185
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g186
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g187
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g188
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g189
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g190
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g191
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g192
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g193
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g194
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g195
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g196
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g197
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g198
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g199
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g200
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g201
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g202
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g203
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g204
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g205
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g206
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g207
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g208
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g209
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g210
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g211
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g212
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g213
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g214
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g215
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g216
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g217
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g218
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g219
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g220
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g221
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g222
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g223
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g224
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g225
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g226
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g227
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g228
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g229
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g230
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g231
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g232
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g233
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g234
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g235
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g236
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g237
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g238
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g239
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g240
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g241
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g242
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g243
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g244
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g245
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g246
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g247
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g248
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g249
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g250
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g251
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g252
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g253
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN}, // g254
+  {0, 0, GroupVariationType::OTHER, GroupVariation::UNKNOWN} // g255
+};
+
+const GroupVariationInfo GroupVariationTable::variations[132] =
+{
+  {GroupVariation::Group1Var0, GroupVariationType::STATIC, 0}, // g1v0
+  {GroupVariation::Group1Var1, GroupVariationType::STATIC, 0}, // g1v1
+  {GroupVariation::Group1Var2, GroupVariationType::STATIC, 1}, // g1v2
+  {GroupVariation::Group2Var0, GroupVariationType::EVENT, 0}, // g2v0
+  {GroupVariation::Group2Var1, GroupVariationType::EVENT, 1}, // g2v1
+  {GroupVariation::Group2Var2, GroupVariationType::EVENT, 7}, // g2v2
+  {GroupVariation::Group2Var3, GroupVariationType::EVENT, 3}, // g2v3
+  {GroupVariation::Group3Var0, GroupVariationType::STATIC, 0}, // g3v0
+  {GroupVariation::Group3Var1, GroupVariationType::STATIC, 0}, // g3v1
+  {GroupVariation::Group3Var2, GroupVariationType::STATIC, 1}, // g3v2
+  {GroupVariation::Group4Var0, GroupVariationType::EVENT, 0}, // g4v0
+  {GroupVariation::Group4Var1, GroupVariationType::EVENT, 1}, // g4v1
+  {GroupVariation::Group4Var2, GroupVariationType::EVENT, 7}, // g4v2
+  {GroupVariation::Group4Var3, GroupVariationType::EVENT, 3}, // g4v3
+  {GroupVariation::Group10Var0, GroupVariationType::STATIC, 0}, // g10v0
+  {GroupVariation::Group10Var1, GroupVariationType::STATIC, 0}, // g10v1
+  {GroupVariation::Group10Var2, GroupVariationType::STATIC, 1}, // g10v2
+  {GroupVariation::Group11Var0, GroupVariationType::EVENT, 0}, // g11v0
+  {GroupVariation::Group11Var1, GroupVariationType::EVENT, 1}, // g11v1
+  {GroupVariation::Group11Var2, GroupVariationType::EVENT, 7}, // g11v2
+  {GroupVariation::Group12Var0, GroupVariationType::OTHER, 0}, // g12v0
+  {GroupVariation::Group12Var1, GroupVariationType::OTHER, 11}, // g12v1
+  {GroupVariation::UNKNOWN, GroupVariationType::EVENT, 0}, // g13v0 - undefined
+  {GroupVariation::Group13Var1, GroupVariationType::EVENT, 1}, // g13v1
+  {GroupVariation::Group13Var2, GroupVariationType::EVENT, 7}, // g13v2
+  {GroupVariation::Group20Var0, GroupVariationType::STATIC, 0}, // g20v0
+  {GroupVariation::Group20Var1, GroupVariationType::STATIC, 5}, // g20v1
+  {GroupVariation::Group20Var2, GroupVariationType::STATIC, 3}, // g20v2
+  {GroupVariation::UNKNOWN, GroupVariationType::STATIC, 0}, // g20v3 - undefined
+  {GroupVariation::UNKNOWN, GroupVariationType::STATIC, 0}, // g20v4 - undefined
+  {GroupVariation::Group20Var5, GroupVariationType::STATIC, 4}, // g20v5
+  {GroupVariation::Group20Var6, GroupVariationType::STATIC, 2}, // g20v6
+  {GroupVariation::Group21Var0, GroupVariationType::STATIC, 0}, // g21v0
+  {GroupVariation::Group21Var1, GroupVariationType::STATIC, 5}, // g21v1
+  {GroupVariation::Group21Var2, GroupVariationType::STATIC, 3}, // g21v2
+  {GroupVariation::UNKNOWN, GroupVariationType::STATIC, 0}, // g21v3 - undefined
+  {GroupVariation::UNKNOWN, GroupVariationType::STATIC, 0}, // g21v4 - undefined
+  {GroupVariation::Group21Var5, GroupVariationType::STATIC, 11}, // g21v5
+  {GroupVariation::Group21Var6, GroupVariationType::STATIC, 9}, // g21v6
+  {GroupVariation::UNKNOWN, GroupVariationType::STATIC, 0}, // g21v7 - undefined
+  {GroupVariation::UNKNOWN, GroupVariationType::STATIC, 0}, // g21v8 - undefined
+  {GroupVariation::Group21Var9, GroupVariationType::STATIC, 4}, // g21v9
+  {GroupVariation::Group21Var10, GroupVariationType::STATIC, 2}, // g21v10
+  {GroupVariation::Group22Var0, GroupVariationType::EVENT, 0}, // g22v0
+  {GroupVariation::Group22Var1, GroupVariationType::EVENT, 5}, // g22v1
+  {GroupVariation::Group22Var2, GroupVariationType::EVENT, 3}, // g22v2
+  {GroupVariation::UNKNOWN, GroupVariationType::EVENT, 0}, // g22v3 - undefined
+  {GroupVariation::UNKNOWN, GroupVariationType::EVENT, 0}, // g22v4 - undefined
+  {GroupVariation::Group22Var5, GroupVariationType::EVENT, 11}, // g22v5
+  {GroupVariation::Group22Var6, GroupVariationType::EVENT, 9}, // g22v6
+  {GroupVariation::Group23Var0, GroupVariationType::EVENT, 0}, // g23v0
+  {GroupVariation::Group23Var1, GroupVariationType::EVENT, 5}, // g23v1
+  {GroupVariation::Group23Var2, GroupVariationType::EVENT, 3}, // g23v2
+  {GroupVariation::UNKNOWN, GroupVariationType::EVENT, 0}, // g23v3 - undefined
+  {GroupVariation::UNKNOWN, GroupVariationType::EVENT, 0}, // g23v4 - undefined
+  {GroupVariation::Group23Var5, GroupVariationType::EVENT, 11}, // g23v5
+  {GroupVariation::Group23Var6, GroupVariationType::EVENT, 9}, // g23v6
+  {GroupVariation::Group30Var0, GroupVariationType::STATIC, 0}, // g30v0
+  {GroupVariation::Group30Var1, GroupVariationType::STATIC, 5}, // g30v1
+  {GroupVariation::Group30Var2, GroupVariationType::STATIC, 3}, // g30v2
+  {GroupVariation::Group30Var3, GroupVariationType::STATIC, 4}, // g30v3
+  {GroupVariation::Group30Var4, GroupVariationType::STATIC, 2}, // g30v4
+  {GroupVariation::Group30Var5, GroupVariationType::STATIC, 5}, // g30v5
+  {GroupVariation::Group30Var6, GroupVariationType::STATIC, 9}, // g30v6
+  {GroupVariation::Group32Var0, GroupVariationType::EVENT, 0}, // g32v0
+  {GroupVariation::Group32Var1, GroupVariationType::EVENT, 5}, // g32v1
+  {GroupVariation::Group32Var2, GroupVariationType::EVENT, 3}, // g32v2
+  {GroupVariation::Group32Var3, GroupVariationType::EVENT, 11}, // g32v3
+  {GroupVariation::Group32Var4, GroupVariationType::EVENT, 9}, // g32v4
+  {GroupVariation::Group32Var5, GroupVariationType::EVENT, 5}, // g32v5
+  {GroupVariation::Group32Var6, GroupVariationType::EVENT, 9}, // g32v6
+  {GroupVariation::Group32Var7, GroupVariationType::EVENT, 11}, // g32v7
+  {GroupVariation::Group32Var8, GroupVariationType::EVENT, 15}, // g32v8
+  {GroupVariation::Group40Var0, GroupVariationType::STATIC, 0}, // g40v0
+  {GroupVariation::Group40Var1, GroupVariationType::STATIC, 5}, // g40v1
+  {GroupVariation::Group40Var2, GroupVariationType::STATIC, 3}, // g40v2
+  {GroupVariation::Group40Var3, GroupVariationType::STATIC, 5}, // g40v3
+  {GroupVariation::Group40Var4, GroupVariationType::STATIC, 9}, // g40v4
+  {GroupVariation::Group41Var0, GroupVariationType::EVENT, 0}, // g41v0
+  {GroupVariation::Group41Var1, GroupVariationType::EVENT, 5}, // g41v1
+  {GroupVariation::Group41Var2, GroupVariationType::EVENT, 3}, // g41v2
+  {GroupVariation::Group41Var3, GroupVariationType::EVENT, 5}, // g41v3
+  {GroupVariation::Group41Var4, GroupVariationType::EVENT, 9}, // g41v4
+  {GroupVariation::Group42Var0, GroupVariationType::EVENT, 0}, // g42v0
+  {GroupVariation::Group42Var1, GroupVariationType::EVENT, 5}, // g42v1
+  {GroupVariation::Group42Var2, GroupVariationType::EVENT, 3}, // g42v2
+  {GroupVariation::Group42Var3, GroupVariationType::EVENT, 11}, // g42v3
+  {GroupVariation::Group42Var4, GroupVariationType::EVENT, 9}, // g42v4
+  {GroupVariation::Group42Var5, GroupVariationType::EVENT, 5}, // g42v5
+  {GroupVariation::Group42Var6, GroupVariationType::EVENT, 9}, // g42v6
+  {GroupVariation::Group42Var7, GroupVariationType::EVENT, 11}, // g42v7
+  {GroupVariation::Group42Var8, GroupVariationType::EVENT, 15}, // g42v8
+  {GroupVariation::UNKNOWN, GroupVariationType::EVENT, 0}, // g43v0 - undefined
+  {GroupVariation::Group43Var1, GroupVariationType::EVENT, 5}, // g43v1
+  {GroupVariation::Group43Var2, GroupVariationType::EVENT, 3}, // g43v2
+  {GroupVariation::Group43Var3, GroupVariationType::EVENT, 11}, // g43v3
+  {GroupVariation::Group43Var4, GroupVariationType::EVENT, 9}, // g43v4
+  {GroupVariation::Group43Var5, GroupVariationType::EVENT, 5}, // g43v5
+  {GroupVariation::Group43Var6, GroupVariationType::EVENT, 9}, // g43v6
+  {GroupVariation::Group43Var7, GroupVariationType::EVENT, 11}, // g43v7
+  {GroupVariation::Group43Var8, GroupVariationType::EVENT, 15}, // g43v8
+  {GroupVariation::UNKNOWN, GroupVariationType::OTHER, 0}, // g50v0 - undefined
+  {GroupVariation::Group50Var1, GroupVariationType::OTHER, 6}, // g50v1
+  {GroupVariation::UNKNOWN, GroupVariationType::OTHER, 0}, // g50v2 - undefined
+  {GroupVariation::Group50Var3, GroupVariationType::OTHER, 6}, // g50v3
+  {GroupVariation::Group50Var4, GroupVariationType::STATIC, 11}, // g50v4
+  {GroupVariation::UNKNOWN, GroupVariationType::OTHER, 0}, // g51v0 - undefined
+  {GroupVariation::Group51Var1, GroupVariationType::OTHER, 6}, // g51v1
+  {GroupVariation::Group51Var2, GroupVariationType::OTHER, 6}, // g51v2
+  {GroupVariation::UNKNOWN, GroupVariationType::OTHER, 0}, // g52v0 - undefined
+  {GroupVariation::Group52Var1, GroupVariationType::OTHER, 2}, // g52v1
+  {GroupVariation::Group52Var2, GroupVariationType::OTHER, 2}, // g52v2
+  {GroupVariation::UNKNOWN, GroupVariationType::EVENT, 0}, // g60v0 - undefined
+  {GroupVariation::Group60Var1, GroupVariationType::STATIC, 0}, // g60v1
+  {GroupVariation::Group60Var2, GroupVariationType::EVENT, 0}, // g60v2
+  {GroupVariation::Group60Var3, GroupVariationType::EVENT, 0}, // g60v3
+  {GroupVariation::Group60Var4, GroupVariationType::EVENT, 0}, // g60v4
+  {GroupVariation::UNKNOWN, GroupVariationType::OTHER, 0}, // g70v0 - undefined
+  {GroupVariation::Group70Var1, GroupVariationType::OTHER, 0}, // g70v1
+  {GroupVariation::Group70Var2, GroupVariationType::OTHER, 0}, // g70v2
+  {GroupVariation::Group70Var3, GroupVariationType::OTHER, 26}, // g70v3
+  {GroupVariation::Group70Var4, GroupVariationType::OTHER, 13}, // g70v4
+  {GroupVariation::Group70Var5, GroupVariationType::OTHER, 8}, // g70v5
+  {GroupVariation::Group70Var6, GroupVariationType::OTHER, 9}, // g70v6
+  {GroupVariation::Group70Var7, GroupVariationType::OTHER, 20}, // g70v7
+  {GroupVariation::Group70Var8, GroupVariationType::OTHER, 0}, // g70v8
+  {GroupVariation::UNKNOWN, GroupVariationType::OTHER, 0}, // g80v0 - undefined
+  {GroupVariation::Group80Var1, GroupVariationType::OTHER, 0}, // g80v1
+  {GroupVariation::Group110Var0, GroupVariationType::STATIC, 0}, // g110v0
+  {GroupVariation::Group111Var0, GroupVariationType::EVENT, 0}, // g111v0
+  {GroupVariation::Group112Var0, GroupVariationType::OTHER, 0}, // g112v0
+  {GroupVariation::Group113Var0, GroupVariationType::OTHER, 0} // g113v0
+};
+
+}
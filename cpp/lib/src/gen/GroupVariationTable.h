@@ -0,0 +1,81 @@
+//
+//  _   _         ______    _ _ _   _             _ _ _
+// | \ | |       |  ____|  | (_) | (_)           | | | |
+// |  \| | ___   | |__   __| |_| |_ _ _ __   __ _| | | |
+// | . ` |/ _ \  |  __| / _` | | __| | '_ \ / _` | | | |
+// | |\  | (_) | | |___| (_| | | |_| | | | | (_| |_|_|_|
+// |_| \_|\___/  |______\__,_|_|\__|_|_| |_|\__, (_|_|_)
+//                                           __/ |
+//                                          |___/
+// 
+// This file is auto-generated. Do not edit manually
+// 
+// Copyright 2013-2022 Step Function I/O, LLC
+// 
+// Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+// LLC (https://stepfunc.io) under one or more contributor license agreements.
+// See the NOTICE file distributed with this work for additional information
+// regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+// this file to you under the Apache License, Version 2.0 (the "License"); you
+// may not use this file except in compliance with the License. You may obtain
+// a copy of the License at:
+// 
+//   http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef OPENDNP3_GROUPVARIATIONTABLE_H
+#define OPENDNP3_GROUPVARIATIONTABLE_H
+
+#include "opendnp3/gen/GroupVariation.h"
+
+#include <cstdint>
+
+namespace opendnp3 {
+
+enum class GroupVariationType : int
+{
+  STATIC,
+  EVENT,
+  OTHER
+};
+
+struct GroupVariationInfo
+{
+  GroupVariation enumeration;
+  GroupVariationType type;
+  // number of bytes per object for fixed size types, 0 otherwise
+  uint8_t size;
+};
+
+struct GroupInfo
+{
+  // offset of variation 0 in the variation table
+  uint16_t offset;
+  // number of consecutive variations starting at 0 in the variation table
+  uint8_t count;
+  // type and enumeration of variations beyond count
+  GroupVariationType type;
+  GroupVariation fallback;
+};
+
+struct GroupVariationTable
+{
+  static GroupVariationInfo Lookup(uint8_t group, uint8_t variation)
+  {
+    const auto& g = groups[group];
+    return (variation < g.count) ? variations[g.offset + variation] : GroupVariationInfo{g.fallback, g.type, 0};
+  }
+
+  static const GroupInfo groups[256];
+  static const GroupVariationInfo variations[132];
+};
+
+}
+
+#endif
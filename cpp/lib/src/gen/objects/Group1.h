@@ -70,7 +70,9 @@ struct Group1Var2
   typedef BinarySpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Binary&);
   static bool WriteTarget(const Binary&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Binary*, size_t);
+  static bool WriteArray(const Binary*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticBinaryVariation svariation = StaticBinaryVariation::Group1Var2;
 };
 
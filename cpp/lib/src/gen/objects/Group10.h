@@ -69,7 +69,9 @@ struct Group10Var2
   typedef BinaryOutputStatusSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, BinaryOutputStatus&);
   static bool WriteTarget(const BinaryOutputStatus&, ser4cpp::wseq_t&);
-  static DNP3Serializer<BinaryOutputStatus> Inst() { return DNP3Serializer<BinaryOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, BinaryOutputStatus*, size_t);
+  static bool WriteArray(const BinaryOutputStatus*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<BinaryOutputStatus> Inst() { return DNP3Serializer<BinaryOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticBinaryOutputStatusVariation svariation = StaticBinaryOutputStatusVariation::Group10Var2;
 };
 
@@ -74,6 +74,43 @@ bool Group11Var1::WriteTarget(const BinaryOutputStatus& value, ser4cpp::wseq_t&
   return Group11Var1::Write(ConvertGroup11Var1::Apply(value), buff);
 }
 
+bool Group11Var1::ReadArray(rseq_t& buff, BinaryOutputStatus* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 1)
+  {
+    output[i] = BinaryOutputStatusFactory::From(UInt8::read(data));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group11Var1::WriteArray(const BinaryOutputStatus* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 1)
+  {
+    const auto gv = ConvertGroup11Var1::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group11Var2 -------
 
 Group11Var2::Group11Var2() : flags(0), time(0)
@@ -108,5 +145,43 @@ bool Group11Var2::WriteTarget(const BinaryOutputStatus& value, ser4cpp::wseq_t&
   return Group11Var2::Write(ConvertGroup11Var2::Apply(value), buff);
 }
 
+bool Group11Var2::ReadArray(rseq_t& buff, BinaryOutputStatus* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 7)
+  {
+    output[i] = BinaryOutputStatusFactory::From(UInt8::read(data), DNPTime(UInt48::read(data + 1).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group11Var2::WriteArray(const BinaryOutputStatus* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 7)
+  {
+    const auto gv = ConvertGroup11Var2::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    UInt48::write(data + 1, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
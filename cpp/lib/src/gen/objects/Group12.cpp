@@ -74,5 +74,46 @@ bool Group12Var1::WriteTarget(const ControlRelayOutputBlock& value, ser4cpp::wse
   return Group12Var1::Write(ConvertGroup12Var1::Apply(value), buff);
 }
 
+bool Group12Var1::ReadArray(rseq_t& buff, ControlRelayOutputBlock* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    output[i] = ControlRelayOutputBlockFactory::From(UInt8::read(data), UInt8::read(data + 1), UInt32::read(data + 2), UInt32::read(data + 6), UInt8::read(data + 10));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group12Var1::WriteArray(const ControlRelayOutputBlock* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    const auto gv = ConvertGroup12Var1::Apply(values[i]);
+    UInt8::write(data, gv.code);
+    UInt8::write(data + 1, gv.count);
+    UInt32::write(data + 2, gv.onTime);
+    UInt32::write(data + 6, gv.offTime);
+    UInt8::write(data + 10, gv.status);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
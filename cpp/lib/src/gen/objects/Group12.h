@@ -66,7 +66,9 @@ struct Group12Var1
   typedef ControlRelayOutputBlock Target;
   static bool ReadTarget(ser4cpp::rseq_t&, ControlRelayOutputBlock&);
   static bool WriteTarget(const ControlRelayOutputBlock&, ser4cpp::wseq_t&);
-  static DNP3Serializer<ControlRelayOutputBlock> Inst() { return DNP3Serializer<ControlRelayOutputBlock>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, ControlRelayOutputBlock*, size_t);
+  static bool WriteArray(const ControlRelayOutputBlock*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<ControlRelayOutputBlock> Inst() { return DNP3Serializer<ControlRelayOutputBlock>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 
@@ -74,6 +74,43 @@ bool Group13Var1::WriteTarget(const BinaryCommandEvent& value, ser4cpp::wseq_t&
   return Group13Var1::Write(ConvertGroup13Var1::Apply(value), buff);
 }
 
+bool Group13Var1::ReadArray(rseq_t& buff, BinaryCommandEvent* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 1)
+  {
+    output[i] = BinaryCommandEventFactory::From(UInt8::read(data));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group13Var1::WriteArray(const BinaryCommandEvent* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 1)
+  {
+    const auto gv = ConvertGroup13Var1::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group13Var2 -------
 
 Group13Var2::Group13Var2() : flags(0), time(0)
@@ -108,5 +145,43 @@ bool Group13Var2::WriteTarget(const BinaryCommandEvent& value, ser4cpp::wseq_t&
   return Group13Var2::Write(ConvertGroup13Var2::Apply(value), buff);
 }
 
+bool Group13Var2::ReadArray(rseq_t& buff, BinaryCommandEvent* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 7)
+  {
+    output[i] = BinaryCommandEventFactory::From(UInt8::read(data), DNPTime(UInt48::read(data + 1).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group13Var2::WriteArray(const BinaryCommandEvent* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 7)
+  {
+    const auto gv = ConvertGroup13Var2::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    UInt48::write(data + 1, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
@@ -56,7 +56,9 @@ struct Group13Var1
   typedef BinaryCommandEvent Target;
   static bool ReadTarget(ser4cpp::rseq_t&, BinaryCommandEvent&);
   static bool WriteTarget(const BinaryCommandEvent&, ser4cpp::wseq_t&);
-  static DNP3Serializer<BinaryCommandEvent> Inst() { return DNP3Serializer<BinaryCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, BinaryCommandEvent*, size_t);
+  static bool WriteArray(const BinaryCommandEvent*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<BinaryCommandEvent> Inst() { return DNP3Serializer<BinaryCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Binary Command Event - With Time
@@ -76,7 +78,9 @@ struct Group13Var2
   typedef BinaryCommandEvent Target;
   static bool ReadTarget(ser4cpp::rseq_t&, BinaryCommandEvent&);
   static bool WriteTarget(const BinaryCommandEvent&, ser4cpp::wseq_t&);
-  static DNP3Serializer<BinaryCommandEvent> Inst() { return DNP3Serializer<BinaryCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, BinaryCommandEvent*, size_t);
+  static bool WriteArray(const BinaryCommandEvent*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<BinaryCommandEvent> Inst() { return DNP3Serializer<BinaryCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 
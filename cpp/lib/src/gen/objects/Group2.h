@@ -63,7 +63,9 @@ struct Group2Var1
   typedef BinarySpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Binary&);
   static bool WriteTarget(const Binary&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Binary*, size_t);
+  static bool WriteArray(const Binary*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Binary Input Event - With Absolute Time
@@ -84,7 +86,9 @@ struct Group2Var2
   typedef BinarySpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Binary&);
   static bool WriteTarget(const Binary&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Binary*, size_t);
+  static bool WriteArray(const Binary*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Binary Input Event - With Relative Time
@@ -105,7 +109,9 @@ struct Group2Var3
   typedef BinarySpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Binary&);
   static bool WriteTarget(const Binary&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Binary*, size_t);
+  static bool WriteArray(const Binary*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 
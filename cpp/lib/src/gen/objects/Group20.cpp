@@ -74,6 +74,44 @@ bool Group20Var1::WriteTarget(const Counter& value, ser4cpp::wseq_t& buff)
   return Group20Var1::Write(ConvertGroup20Var1::Apply(value), buff);
 }
 
+bool Group20Var1::ReadArray(rseq_t& buff, Counter* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = CounterFactory::From(UInt8::read(data), UInt32::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group20Var1::WriteArray(const Counter* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup20Var1::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    UInt32::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group20Var2 -------
 
 Group20Var2::Group20Var2() : flags(0), value(0)
@@ -108,6 +146,44 @@ bool Group20Var2::WriteTarget(const Counter& value, ser4cpp::wseq_t& buff)
   return Group20Var2::Write(ConvertGroup20Var2::Apply(value), buff);
 }
 
+bool Group20Var2::ReadArray(rseq_t& buff, Counter* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    output[i] = CounterFactory::From(UInt8::read(data), UInt16::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group20Var2::WriteArray(const Counter* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    const auto gv = ConvertGroup20Var2::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    UInt16::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group20Var5 -------
 
 Group20Var5::Group20Var5() : value(0)
@@ -142,6 +218,43 @@ bool Group20Var5::WriteTarget(const Counter& value, ser4cpp::wseq_t& buff)
   return Group20Var5::Write(ConvertGroup20Var5::Apply(value), buff);
 }
 
+bool Group20Var5::ReadArray(rseq_t& buff, Counter* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 4)
+  {
+    output[i] = CounterFactory::From(UInt32::read(data));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group20Var5::WriteArray(const Counter* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 4)
+  {
+    const auto gv = ConvertGroup20Var5::Apply(values[i]);
+    UInt32::write(data, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group20Var6 -------
 
 Group20Var6::Group20Var6() : value(0)
@@ -176,5 +289,42 @@ bool Group20Var6::WriteTarget(const Counter& value, ser4cpp::wseq_t& buff)
   return Group20Var6::Write(ConvertGroup20Var6::Apply(value), buff);
 }
 
+bool Group20Var6::ReadArray(rseq_t& buff, Counter* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 2)
+  {
+    output[i] = CounterFactory::From(UInt16::read(data));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group20Var6::WriteArray(const Counter* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 2)
+  {
+    const auto gv = ConvertGroup20Var6::Apply(values[i]);
+    UInt16::write(data, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
@@ -65,7 +65,9 @@ struct Group20Var1
   typedef CounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Counter&);
   static bool WriteTarget(const Counter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Counter*, size_t);
+  static bool WriteArray(const Counter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticCounterVariation svariation = StaticCounterVariation::Group20Var1;
 };
 
@@ -88,7 +90,9 @@ struct Group20Var2
   typedef CounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Counter&);
   static bool WriteTarget(const Counter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Counter*, size_t);
+  static bool WriteArray(const Counter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticCounterVariation svariation = StaticCounterVariation::Group20Var2;
 };
 
@@ -110,7 +114,9 @@ struct Group20Var5
   typedef CounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Counter&);
   static bool WriteTarget(const Counter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Counter*, size_t);
+  static bool WriteArray(const Counter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticCounterVariation svariation = StaticCounterVariation::Group20Var5;
 };
 
@@ -132,7 +138,9 @@ struct Group20Var6
   typedef CounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Counter&);
   static bool WriteTarget(const Counter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Counter*, size_t);
+  static bool WriteArray(const Counter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticCounterVariation svariation = StaticCounterVariation::Group20Var6;
 };
 
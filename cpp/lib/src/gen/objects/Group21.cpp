@@ -74,6 +74,44 @@ bool Group21Var1::WriteTarget(const FrozenCounter& value, ser4cpp::wseq_t& buff)
   return Group21Var1::Write(ConvertGroup21Var1::Apply(value), buff);
 }
 
+bool Group21Var1::ReadArray(rseq_t& buff, FrozenCounter* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = FrozenCounterFactory::From(UInt8::read(data), UInt32::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group21Var1::WriteArray(const FrozenCounter* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup21Var1::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    UInt32::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group21Var2 -------
 
 Group21Var2::Group21Var2() : flags(0), value(0)
@@ -108,6 +146,44 @@ bool Group21Var2::WriteTarget(const FrozenCounter& value, ser4cpp::wseq_t& buff)
   return Group21Var2::Write(ConvertGroup21Var2::Apply(value), buff);
 }
 
+bool Group21Var2::ReadArray(rseq_t& buff, FrozenCounter* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    output[i] = FrozenCounterFactory::From(UInt8::read(data), UInt16::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group21Var2::WriteArray(const FrozenCounter* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    const auto gv = ConvertGroup21Var2::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    UInt16::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group21Var5 -------
 
 Group21Var5::Group21Var5() : flags(0), value(0), time(0)
@@ -142,6 +218,45 @@ bool Group21Var5::WriteTarget(const FrozenCounter& value, ser4cpp::wseq_t& buff)
   return Group21Var5::Write(ConvertGroup21Var5::Apply(value), buff);
 }
 
+bool Group21Var5::ReadArray(rseq_t& buff, FrozenCounter* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    output[i] = FrozenCounterFactory::From(UInt8::read(data), UInt32::read(data + 1), DNPTime(UInt48::read(data + 5).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group21Var5::WriteArray(const FrozenCounter* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    const auto gv = ConvertGroup21Var5::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    UInt32::write(data + 1, gv.value);
+    UInt48::write(data + 5, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group21Var6 -------
 
 Group21Var6::Group21Var6() : flags(0), value(0), time(0)
@@ -176,6 +291,45 @@ bool Group21Var6::WriteTarget(const FrozenCounter& value, ser4cpp::wseq_t& buff)
   return Group21Var6::Write(ConvertGroup21Var6::Apply(value), buff);
 }
 
+bool Group21Var6::ReadArray(rseq_t& buff, FrozenCounter* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    output[i] = FrozenCounterFactory::From(UInt8::read(data), UInt16::read(data + 1), DNPTime(UInt48::read(data + 3).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group21Var6::WriteArray(const FrozenCounter* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    const auto gv = ConvertGroup21Var6::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    UInt16::write(data + 1, gv.value);
+    UInt48::write(data + 3, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group21Var9 -------
 
 Group21Var9::Group21Var9() : value(0)
@@ -210,6 +364,43 @@ bool Group21Var9::WriteTarget(const FrozenCounter& value, ser4cpp::wseq_t& buff)
   return Group21Var9::Write(ConvertGroup21Var9::Apply(value), buff);
 }
 
+bool Group21Var9::ReadArray(rseq_t& buff, FrozenCounter* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 4)
+  {
+    output[i] = FrozenCounterFactory::From(UInt32::read(data));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group21Var9::WriteArray(const FrozenCounter* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 4)
+  {
+    const auto gv = ConvertGroup21Var9::Apply(values[i]);
+    UInt32::write(data, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group21Var10 -------
 
 Group21Var10::Group21Var10() : value(0)
@@ -244,5 +435,42 @@ bool Group21Var10::WriteTarget(const FrozenCounter& value, ser4cpp::wseq_t& buff
   return Group21Var10::Write(ConvertGroup21Var10::Apply(value), buff);
 }
 
+bool Group21Var10::ReadArray(rseq_t& buff, FrozenCounter* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 2)
+  {
+    output[i] = FrozenCounterFactory::From(UInt16::read(data));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group21Var10::WriteArray(const FrozenCounter* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 2)
+  {
+    const auto gv = ConvertGroup21Var10::Apply(values[i]);
+    UInt16::write(data, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
@@ -65,7 +65,9 @@ struct Group21Var1
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, FrozenCounter*, size_t);
+  static bool WriteArray(const FrozenCounter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticFrozenCounterVariation svariation = StaticFrozenCounterVariation::Group21Var1;
 };
 
@@ -88,7 +90,9 @@ struct Group21Var2
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, FrozenCounter*, size_t);
+  static bool WriteArray(const FrozenCounter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticFrozenCounterVariation svariation = StaticFrozenCounterVariation::Group21Var2;
 };
 
@@ -112,7 +116,9 @@ struct Group21Var5
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, FrozenCounter*, size_t);
+  static bool WriteArray(const FrozenCounter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticFrozenCounterVariation svariation = StaticFrozenCounterVariation::Group21Var5;
 };
 
@@ -136,7 +142,9 @@ struct Group21Var6
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, FrozenCounter*, size_t);
+  static bool WriteArray(const FrozenCounter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticFrozenCounterVariation svariation = StaticFrozenCounterVariation::Group21Var6;
 };
 
@@ -158,7 +166,9 @@ struct Group21Var9
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, FrozenCounter*, size_t);
+  static bool WriteArray(const FrozenCounter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticFrozenCounterVariation svariation = StaticFrozenCounterVariation::Group21Var9;
 };
 
@@ -180,7 +190,9 @@ struct Group21Var10
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, FrozenCounter*, size_t);
+  static bool WriteArray(const FrozenCounter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticFrozenCounterVariation svariation = StaticFrozenCounterVariation::Group21Var10;
 };
 
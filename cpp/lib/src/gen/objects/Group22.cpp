@@ -74,6 +74,44 @@ bool Group22Var1::WriteTarget(const Counter& value, ser4cpp::wseq_t& buff)
   return Group22Var1::Write(ConvertGroup22Var1::Apply(value), buff);
 }
 
+bool Group22Var1::ReadArray(rseq_t& buff, Counter* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = CounterFactory::From(UInt8::read(data), UInt32::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group22Var1::WriteArray(const Counter* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup22Var1::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    UInt32::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group22Var2 -------
 
 Group22Var2::Group22Var2() : flags(0), value(0)
@@ -108,6 +146,44 @@ bool Group22Var2::WriteTarget(const Counter& value, ser4cpp::wseq_t& buff)
   return Group22Var2::Write(ConvertGroup22Var2::Apply(value), buff);
 }
 
+bool Group22Var2::ReadArray(rseq_t& buff, Counter* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    output[i] = CounterFactory::From(UInt8::read(data), UInt16::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group22Var2::WriteArray(const Counter* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    const auto gv = ConvertGroup22Var2::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    UInt16::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group22Var5 -------
 
 Group22Var5::Group22Var5() : flags(0), value(0), time(0)
@@ -142,6 +218,45 @@ bool Group22Var5::WriteTarget(const Counter& value, ser4cpp::wseq_t& buff)
   return Group22Var5::Write(ConvertGroup22Var5::Apply(value), buff);
 }
 
+bool Group22Var5::ReadArray(rseq_t& buff, Counter* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    output[i] = CounterFactory::From(UInt8::read(data), UInt32::read(data + 1), DNPTime(UInt48::read(data + 5).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group22Var5::WriteArray(const Counter* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    const auto gv = ConvertGroup22Var5::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    UInt32::write(data + 1, gv.value);
+    UInt48::write(data + 5, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group22Var6 -------
 
 Group22Var6::Group22Var6() : flags(0), value(0), time(0)
@@ -176,5 +291,44 @@ bool Group22Var6::WriteTarget(const Counter& value, ser4cpp::wseq_t& buff)
   return Group22Var6::Write(ConvertGroup22Var6::Apply(value), buff);
 }
 
+bool Group22Var6::ReadArray(rseq_t& buff, Counter* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    output[i] = CounterFactory::From(UInt8::read(data), UInt16::read(data + 1), DNPTime(UInt48::read(data + 3).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group22Var6::WriteArray(const Counter* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    const auto gv = ConvertGroup22Var6::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    UInt16::write(data + 1, gv.value);
+    UInt48::write(data + 3, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
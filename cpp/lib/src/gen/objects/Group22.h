@@ -65,7 +65,9 @@ struct Group22Var1
   typedef CounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Counter&);
   static bool WriteTarget(const Counter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Counter*, size_t);
+  static bool WriteArray(const Counter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Counter Event - 16-bit With Flag
@@ -87,7 +89,9 @@ struct Group22Var2
   typedef CounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Counter&);
   static bool WriteTarget(const Counter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Counter*, size_t);
+  static bool WriteArray(const Counter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Counter Event - 32-bit With Flag and Time
@@ -110,7 +114,9 @@ struct Group22Var5
   typedef CounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Counter&);
   static bool WriteTarget(const Counter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Counter*, size_t);
+  static bool WriteArray(const Counter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Counter Event - 16-bit With Flag and Time
@@ -133,7 +139,9 @@ struct Group22Var6
   typedef CounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Counter&);
   static bool WriteTarget(const Counter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Counter*, size_t);
+  static bool WriteArray(const Counter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 
@@ -65,7 +65,9 @@ struct Group23Var1
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, FrozenCounter*, size_t);
+  static bool WriteArray(const FrozenCounter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Frozen Counter Event - 16-bit With Flag
@@ -87,7 +89,9 @@ struct Group23Var2
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, FrozenCounter*, size_t);
+  static bool WriteArray(const FrozenCounter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Frozen Counter Event - 32-bit With Flag and Time
@@ -110,7 +114,9 @@ struct Group23Var5
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, FrozenCounter*, size_t);
+  static bool WriteArray(const FrozenCounter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Frozen Counter Event - 16-bit With Flag and Time
@@ -133,7 +139,9 @@ struct Group23Var6
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, ser4cpp::wseq_t&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, FrozenCounter*, size_t);
+  static bool WriteArray(const FrozenCounter*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 
@@ -74,5 +74,42 @@ bool Group3Var2::WriteTarget(const DoubleBitBinary& value, ser4cpp::wseq_t& buff
   return Group3Var2::Write(ConvertGroup3Var2::Apply(value), buff);
 }
 
+bool Group3Var2::ReadArray(rseq_t& buff, DoubleBitBinary* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 1)
+  {
+    output[i] = DoubleBitBinaryFactory::From(UInt8::read(data));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group3Var2::WriteArray(const DoubleBitBinary* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 1)
+  {
+    const auto gv = ConvertGroup3Var2::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
@@ -69,7 +69,9 @@ struct Group3Var2
   typedef DoubleBitBinarySpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, DoubleBitBinary&);
   static bool WriteTarget(const DoubleBitBinary&, ser4cpp::wseq_t&);
-  static DNP3Serializer<DoubleBitBinary> Inst() { return DNP3Serializer<DoubleBitBinary>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, DoubleBitBinary*, size_t);
+  static bool WriteArray(const DoubleBitBinary*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<DoubleBitBinary> Inst() { return DNP3Serializer<DoubleBitBinary>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticDoubleBinaryVariation svariation = StaticDoubleBinaryVariation::Group3Var2;
 };
 
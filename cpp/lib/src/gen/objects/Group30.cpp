@@ -74,6 +74,44 @@ bool Group30Var1::WriteTarget(const Analog& value, ser4cpp::wseq_t& buff)
   return Group30Var1::Write(ConvertGroup30Var1::Apply(value), buff);
 }
 
+bool Group30Var1::ReadArray(rseq_t& buff, Analog* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = AnalogFactory::From(UInt8::read(data), Int32::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group30Var1::WriteArray(const Analog* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup30Var1::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    Int32::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group30Var2 -------
 
 Group30Var2::Group30Var2() : flags(0), value(0)
@@ -108,6 +146,44 @@ bool Group30Var2::WriteTarget(const Analog& value, ser4cpp::wseq_t& buff)
   return Group30Var2::Write(ConvertGroup30Var2::Apply(value), buff);
 }
 
+bool Group30Var2::ReadArray(rseq_t& buff, Analog* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    output[i] = AnalogFactory::From(UInt8::read(data), Int16::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group30Var2::WriteArray(const Analog* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    const auto gv = ConvertGroup30Var2::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    Int16::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group30Var3 -------
 
 Group30Var3::Group30Var3() : value(0)
@@ -142,6 +218,43 @@ bool Group30Var3::WriteTarget(const Analog& value, ser4cpp::wseq_t& buff)
   return Group30Var3::Write(ConvertGroup30Var3::Apply(value), buff);
 }
 
+bool Group30Var3::ReadArray(rseq_t& buff, Analog* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 4)
+  {
+    output[i] = AnalogFactory::From(Int32::read(data));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group30Var3::WriteArray(const Analog* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 4)
+  {
+    const auto gv = ConvertGroup30Var3::Apply(values[i]);
+    Int32::write(data, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group30Var4 -------
 
 Group30Var4::Group30Var4() : value(0)
@@ -176,6 +289,43 @@ bool Group30Var4::WriteTarget(const Analog& value, ser4cpp::wseq_t& buff)
   return Group30Var4::Write(ConvertGroup30Var4::Apply(value), buff);
 }
 
+bool Group30Var4::ReadArray(rseq_t& buff, Analog* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 2)
+  {
+    output[i] = AnalogFactory::From(Int16::read(data));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group30Var4::WriteArray(const Analog* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 2)
+  {
+    const auto gv = ConvertGroup30Var4::Apply(values[i]);
+    Int16::write(data, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group30Var5 -------
 
 Group30Var5::Group30Var5() : flags(0), value(0.0)
@@ -210,6 +360,44 @@ bool Group30Var5::WriteTarget(const Analog& value, ser4cpp::wseq_t& buff)
   return Group30Var5::Write(ConvertGroup30Var5::Apply(value), buff);
 }
 
+bool Group30Var5::ReadArray(rseq_t& buff, Analog* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = AnalogFactory::From(UInt8::read(data), SingleFloat::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group30Var5::WriteArray(const Analog* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup30Var5::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    SingleFloat::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group30Var6 -------
 
 Group30Var6::Group30Var6() : flags(0), value(0.0)
@@ -244,5 +432,43 @@ bool Group30Var6::WriteTarget(const Analog& value, ser4cpp::wseq_t& buff)
   return Group30Var6::Write(ConvertGroup30Var6::Apply(value), buff);
 }
 
+bool Group30Var6::ReadArray(rseq_t& buff, Analog* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    output[i] = AnalogFactory::From(UInt8::read(data), DoubleFloat::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group30Var6::WriteArray(const Analog* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    const auto gv = ConvertGroup30Var6::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    DoubleFloat::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
@@ -65,7 +65,9 @@ struct Group30Var1
   typedef AnalogSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Analog&);
   static bool WriteTarget(const Analog&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Analog*, size_t);
+  static bool WriteArray(const Analog*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticAnalogVariation svariation = StaticAnalogVariation::Group30Var1;
 };
 
@@ -88,7 +90,9 @@ struct Group30Var2
   typedef AnalogSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Analog&);
   static bool WriteTarget(const Analog&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Analog*, size_t);
+  static bool WriteArray(const Analog*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticAnalogVariation svariation = StaticAnalogVariation::Group30Var2;
 };
 
@@ -110,7 +114,9 @@ struct Group30Var3
   typedef AnalogSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Analog&);
   static bool WriteTarget(const Analog&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Analog*, size_t);
+  static bool WriteArray(const Analog*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticAnalogVariation svariation = StaticAnalogVariation::Group30Var3;
 };
 
@@ -132,7 +138,9 @@ struct Group30Var4
   typedef AnalogSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Analog&);
   static bool WriteTarget(const Analog&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Analog*, size_t);
+  static bool WriteArray(const Analog*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticAnalogVariation svariation = StaticAnalogVariation::Group30Var4;
 };
 
@@ -155,7 +163,9 @@ struct Group30Var5
   typedef AnalogSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Analog&);
   static bool WriteTarget(const Analog&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Analog*, size_t);
+  static bool WriteArray(const Analog*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticAnalogVariation svariation = StaticAnalogVariation::Group30Var5;
 };
 
@@ -178,7 +188,9 @@ struct Group30Var6
   typedef AnalogSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Analog&);
   static bool WriteTarget(const Analog&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Analog*, size_t);
+  static bool WriteArray(const Analog*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticAnalogVariation svariation = StaticAnalogVariation::Group30Var6;
 };
 
@@ -74,6 +74,44 @@ bool Group32Var1::WriteTarget(const Analog& value, ser4cpp::wseq_t& buff)
   return Group32Var1::Write(ConvertGroup32Var1::Apply(value), buff);
 }
 
+bool Group32Var1::ReadArray(rseq_t& buff, Analog* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = AnalogFactory::From(UInt8::read(data), Int32::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group32Var1::WriteArray(const Analog* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup32Var1::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    Int32::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group32Var2 -------
 
 Group32Var2::Group32Var2() : flags(0), value(0)
@@ -108,6 +146,44 @@ bool Group32Var2::WriteTarget(const Analog& value, ser4cpp::wseq_t& buff)
   return Group32Var2::Write(ConvertGroup32Var2::Apply(value), buff);
 }
 
+bool Group32Var2::ReadArray(rseq_t& buff, Analog* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    output[i] = AnalogFactory::From(UInt8::read(data), Int16::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group32Var2::WriteArray(const Analog* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    const auto gv = ConvertGroup32Var2::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    Int16::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group32Var3 -------
 
 Group32Var3::Group32Var3() : flags(0), value(0), time(0)
@@ -142,6 +218,45 @@ bool Group32Var3::WriteTarget(const Analog& value, ser4cpp::wseq_t& buff)
   return Group32Var3::Write(ConvertGroup32Var3::Apply(value), buff);
 }
 
+bool Group32Var3::ReadArray(rseq_t& buff, Analog* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    output[i] = AnalogFactory::From(UInt8::read(data), Int32::read(data + 1), DNPTime(UInt48::read(data + 5).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group32Var3::WriteArray(const Analog* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    const auto gv = ConvertGroup32Var3::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    Int32::write(data + 1, gv.value);
+    UInt48::write(data + 5, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group32Var4 -------
 
 Group32Var4::Group32Var4() : flags(0), value(0), time(0)
@@ -176,6 +291,45 @@ bool Group32Var4::WriteTarget(const Analog& value, ser4cpp::wseq_t& buff)
   return Group32Var4::Write(ConvertGroup32Var4::Apply(value), buff);
 }
 
+bool Group32Var4::ReadArray(rseq_t& buff, Analog* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    output[i] = AnalogFactory::From(UInt8::read(data), Int16::read(data + 1), DNPTime(UInt48::read(data + 3).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group32Var4::WriteArray(const Analog* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    const auto gv = ConvertGroup32Var4::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    Int16::write(data + 1, gv.value);
+    UInt48::write(data + 3, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group32Var5 -------
 
 Group32Var5::Group32Var5() : flags(0), value(0.0)
@@ -210,6 +364,44 @@ bool Group32Var5::WriteTarget(const Analog& value, ser4cpp::wseq_t& buff)
   return Group32Var5::Write(ConvertGroup32Var5::Apply(value), buff);
 }
 
+bool Group32Var5::ReadArray(rseq_t& buff, Analog* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = AnalogFactory::From(UInt8::read(data), SingleFloat::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group32Var5::WriteArray(const Analog* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup32Var5::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    SingleFloat::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group32Var6 -------
 
 Group32Var6::Group32Var6() : flags(0), value(0.0)
@@ -244,6 +436,44 @@ bool Group32Var6::WriteTarget(const Analog& value, ser4cpp::wseq_t& buff)
   return Group32Var6::Write(ConvertGroup32Var6::Apply(value), buff);
 }
 
+bool Group32Var6::ReadArray(rseq_t& buff, Analog* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    output[i] = AnalogFactory::From(UInt8::read(data), DoubleFloat::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group32Var6::WriteArray(const Analog* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    const auto gv = ConvertGroup32Var6::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    DoubleFloat::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group32Var7 -------
 
 Group32Var7::Group32Var7() : flags(0), value(0.0), time(0)
@@ -278,6 +508,45 @@ bool Group32Var7::WriteTarget(const Analog& value, ser4cpp::wseq_t& buff)
   return Group32Var7::Write(ConvertGroup32Var7::Apply(value), buff);
 }
 
+bool Group32Var7::ReadArray(rseq_t& buff, Analog* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    output[i] = AnalogFactory::From(UInt8::read(data), SingleFloat::read(data + 1), DNPTime(UInt48::read(data + 5).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group32Var7::WriteArray(const Analog* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    const auto gv = ConvertGroup32Var7::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    SingleFloat::write(data + 1, gv.value);
+    UInt48::write(data + 5, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group32Var8 -------
 
 Group32Var8::Group32Var8() : flags(0), value(0.0), time(0)
@@ -312,5 +581,44 @@ bool Group32Var8::WriteTarget(const Analog& value, ser4cpp::wseq_t& buff)
   return Group32Var8::Write(ConvertGroup32Var8::Apply(value), buff);
 }
 
+bool Group32Var8::ReadArray(rseq_t& buff, Analog* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 15)
+  {
+    output[i] = AnalogFactory::From(UInt8::read(data), DoubleFloat::read(data + 1), DNPTime(UInt48::read(data + 9).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group32Var8::WriteArray(const Analog* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 15)
+  {
+    const auto gv = ConvertGroup32Var8::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    DoubleFloat::write(data + 1, gv.value);
+    UInt48::write(data + 9, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
@@ -65,7 +65,9 @@ struct Group32Var1
   typedef AnalogSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Analog&);
   static bool WriteTarget(const Analog&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Analog*, size_t);
+  static bool WriteArray(const Analog*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Input Event - 16-bit With Flag
@@ -87,7 +89,9 @@ struct Group32Var2
   typedef AnalogSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Analog&);
   static bool WriteTarget(const Analog&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Analog*, size_t);
+  static bool WriteArray(const Analog*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Input Event - 32-bit With Flag and Time
@@ -110,7 +114,9 @@ struct Group32Var3
   typedef AnalogSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Analog&);
   static bool WriteTarget(const Analog&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Analog*, size_t);
+  static bool WriteArray(const Analog*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Input Event - 16-bit With Flag and Time
@@ -133,7 +139,9 @@ struct Group32Var4
   typedef AnalogSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Analog&);
   static bool WriteTarget(const Analog&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Analog*, size_t);
+  static bool WriteArray(const Analog*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Input Event - Single-precision With Flag
@@ -155,7 +163,9 @@ struct Group32Var5
   typedef AnalogSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Analog&);
   static bool WriteTarget(const Analog&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Analog*, size_t);
+  static bool WriteArray(const Analog*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Input Event - Double-precision With Flag
@@ -177,7 +187,9 @@ struct Group32Var6
   typedef AnalogSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Analog&);
   static bool WriteTarget(const Analog&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Analog*, size_t);
+  static bool WriteArray(const Analog*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Input Event - Single-precision With Flag and Time
@@ -200,7 +212,9 @@ struct Group32Var7
   typedef AnalogSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Analog&);
   static bool WriteTarget(const Analog&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Analog*, size_t);
+  static bool WriteArray(const Analog*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Input Event - Double-precision With Flag and Time
@@ -223,7 +237,9 @@ struct Group32Var8
   typedef AnalogSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, Analog&);
   static bool WriteTarget(const Analog&, ser4cpp::wseq_t&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, Analog*, size_t);
+  static bool WriteArray(const Analog*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 
@@ -74,6 +74,43 @@ bool Group4Var1::WriteTarget(const DoubleBitBinary& value, ser4cpp::wseq_t& buff
   return Group4Var1::Write(ConvertGroup4Var1::Apply(value), buff);
 }
 
+bool Group4Var1::ReadArray(rseq_t& buff, DoubleBitBinary* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 1)
+  {
+    output[i] = DoubleBitBinaryFactory::From(UInt8::read(data));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group4Var1::WriteArray(const DoubleBitBinary* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 1)
+  {
+    const auto gv = ConvertGroup4Var1::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group4Var2 -------
 
 Group4Var2::Group4Var2() : flags(0), time(0)
@@ -108,6 +145,44 @@ bool Group4Var2::WriteTarget(const DoubleBitBinary& value, ser4cpp::wseq_t& buff
   return Group4Var2::Write(ConvertGroup4Var2::Apply(value), buff);
 }
 
+bool Group4Var2::ReadArray(rseq_t& buff, DoubleBitBinary* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 7)
+  {
+    output[i] = DoubleBitBinaryFactory::From(UInt8::read(data), DNPTime(UInt48::read(data + 1).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group4Var2::WriteArray(const DoubleBitBinary* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 7)
+  {
+    const auto gv = ConvertGroup4Var2::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    UInt48::write(data + 1, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group4Var3 -------
 
 Group4Var3::Group4Var3() : flags(0), time(0)
@@ -142,5 +217,43 @@ bool Group4Var3::WriteTarget(const DoubleBitBinary& value, ser4cpp::wseq_t& buff
   return Group4Var3::Write(ConvertGroup4Var3::Apply(value), buff);
 }
 
+bool Group4Var3::ReadArray(rseq_t& buff, DoubleBitBinary* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    output[i] = DoubleBitBinaryFactory::From(UInt8::read(data), UInt16::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group4Var3::WriteArray(const DoubleBitBinary* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    const auto gv = ConvertGroup4Var3::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    UInt16::write(data + 1, gv.time);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
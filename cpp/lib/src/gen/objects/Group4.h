@@ -63,7 +63,9 @@ struct Group4Var1
   typedef DoubleBitBinarySpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, DoubleBitBinary&);
   static bool WriteTarget(const DoubleBitBinary&, ser4cpp::wseq_t&);
-  static DNP3Serializer<DoubleBitBinary> Inst() { return DNP3Serializer<DoubleBitBinary>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, DoubleBitBinary*, size_t);
+  static bool WriteArray(const DoubleBitBinary*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<DoubleBitBinary> Inst() { return DNP3Serializer<DoubleBitBinary>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Double-bit Binary Input Event - With Absolute Time
@@ -84,7 +86,9 @@ struct Group4Var2
   typedef DoubleBitBinarySpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, DoubleBitBinary&);
   static bool WriteTarget(const DoubleBitBinary&, ser4cpp::wseq_t&);
-  static DNP3Serializer<DoubleBitBinary> Inst() { return DNP3Serializer<DoubleBitBinary>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, DoubleBitBinary*, size_t);
+  static bool WriteArray(const DoubleBitBinary*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<DoubleBitBinary> Inst() { return DNP3Serializer<DoubleBitBinary>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Double-bit Binary Input Event - With Relative Time
@@ -105,7 +109,9 @@ struct Group4Var3
   typedef DoubleBitBinarySpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, DoubleBitBinary&);
   static bool WriteTarget(const DoubleBitBinary&, ser4cpp::wseq_t&);
-  static DNP3Serializer<DoubleBitBinary> Inst() { return DNP3Serializer<DoubleBitBinary>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, DoubleBitBinary*, size_t);
+  static bool WriteArray(const DoubleBitBinary*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<DoubleBitBinary> Inst() { return DNP3Serializer<DoubleBitBinary>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 
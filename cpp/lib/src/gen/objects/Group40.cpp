@@ -74,6 +74,44 @@ bool Group40Var1::WriteTarget(const AnalogOutputStatus& value, ser4cpp::wseq_t&
   return Group40Var1::Write(ConvertGroup40Var1::Apply(value), buff);
 }
 
+bool Group40Var1::ReadArray(rseq_t& buff, AnalogOutputStatus* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = AnalogOutputStatusFactory::From(UInt8::read(data), Int32::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group40Var1::WriteArray(const AnalogOutputStatus* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup40Var1::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    Int32::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group40Var2 -------
 
 Group40Var2::Group40Var2() : flags(0), value(0)
@@ -108,6 +146,44 @@ bool Group40Var2::WriteTarget(const AnalogOutputStatus& value, ser4cpp::wseq_t&
   return Group40Var2::Write(ConvertGroup40Var2::Apply(value), buff);
 }
 
+bool Group40Var2::ReadArray(rseq_t& buff, AnalogOutputStatus* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    output[i] = AnalogOutputStatusFactory::From(UInt8::read(data), Int16::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group40Var2::WriteArray(const AnalogOutputStatus* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    const auto gv = ConvertGroup40Var2::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    Int16::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group40Var3 -------
 
 Group40Var3::Group40Var3() : flags(0), value(0.0)
@@ -142,6 +218,44 @@ bool Group40Var3::WriteTarget(const AnalogOutputStatus& value, ser4cpp::wseq_t&
   return Group40Var3::Write(ConvertGroup40Var3::Apply(value), buff);
 }
 
+bool Group40Var3::ReadArray(rseq_t& buff, AnalogOutputStatus* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = AnalogOutputStatusFactory::From(UInt8::read(data), SingleFloat::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group40Var3::WriteArray(const AnalogOutputStatus* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup40Var3::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    SingleFloat::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group40Var4 -------
 
 Group40Var4::Group40Var4() : flags(0), value(0.0)
@@ -176,5 +290,43 @@ bool Group40Var4::WriteTarget(const AnalogOutputStatus& value, ser4cpp::wseq_t&
   return Group40Var4::Write(ConvertGroup40Var4::Apply(value), buff);
 }
 
+bool Group40Var4::ReadArray(rseq_t& buff, AnalogOutputStatus* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    output[i] = AnalogOutputStatusFactory::From(UInt8::read(data), DoubleFloat::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group40Var4::WriteArray(const AnalogOutputStatus* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    const auto gv = ConvertGroup40Var4::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    DoubleFloat::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
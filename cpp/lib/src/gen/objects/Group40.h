@@ -65,7 +65,9 @@ struct Group40Var1
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputStatus*, size_t);
+  static bool WriteArray(const AnalogOutputStatus*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticAnalogOutputStatusVariation svariation = StaticAnalogOutputStatusVariation::Group40Var1;
 };
 
@@ -88,7 +90,9 @@ struct Group40Var2
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputStatus*, size_t);
+  static bool WriteArray(const AnalogOutputStatus*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticAnalogOutputStatusVariation svariation = StaticAnalogOutputStatusVariation::Group40Var2;
 };
 
@@ -111,7 +115,9 @@ struct Group40Var3
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputStatus*, size_t);
+  static bool WriteArray(const AnalogOutputStatus*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticAnalogOutputStatusVariation svariation = StaticAnalogOutputStatusVariation::Group40Var3;
 };
 
@@ -134,7 +140,9 @@ struct Group40Var4
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputStatus*, size_t);
+  static bool WriteArray(const AnalogOutputStatus*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticAnalogOutputStatusVariation svariation = StaticAnalogOutputStatusVariation::Group40Var4;
 };
 
@@ -74,6 +74,44 @@ bool Group41Var1::WriteTarget(const AnalogOutputInt32& value, ser4cpp::wseq_t& b
   return Group41Var1::Write(ConvertGroup41Var1::Apply(value), buff);
 }
 
+bool Group41Var1::ReadArray(rseq_t& buff, AnalogOutputInt32* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = AnalogOutputInt32Factory::From(Int32::read(data), UInt8::read(data + 4));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group41Var1::WriteArray(const AnalogOutputInt32* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup41Var1::Apply(values[i]);
+    Int32::write(data, gv.value);
+    UInt8::write(data + 4, gv.status);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group41Var2 -------
 
 Group41Var2::Group41Var2() : value(0), status(0)
@@ -108,6 +146,44 @@ bool Group41Var2::WriteTarget(const AnalogOutputInt16& value, ser4cpp::wseq_t& b
   return Group41Var2::Write(ConvertGroup41Var2::Apply(value), buff);
 }
 
+bool Group41Var2::ReadArray(rseq_t& buff, AnalogOutputInt16* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    output[i] = AnalogOutputInt16Factory::From(Int16::read(data), UInt8::read(data + 2));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group41Var2::WriteArray(const AnalogOutputInt16* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    const auto gv = ConvertGroup41Var2::Apply(values[i]);
+    Int16::write(data, gv.value);
+    UInt8::write(data + 2, gv.status);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group41Var3 -------
 
 Group41Var3::Group41Var3() : value(0.0), status(0)
@@ -142,6 +218,44 @@ bool Group41Var3::WriteTarget(const AnalogOutputFloat32& value, ser4cpp::wseq_t&
   return Group41Var3::Write(ConvertGroup41Var3::Apply(value), buff);
 }
 
+bool Group41Var3::ReadArray(rseq_t& buff, AnalogOutputFloat32* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = AnalogOutputFloat32Factory::From(SingleFloat::read(data), UInt8::read(data + 4));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group41Var3::WriteArray(const AnalogOutputFloat32* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup41Var3::Apply(values[i]);
+    SingleFloat::write(data, gv.value);
+    UInt8::write(data + 4, gv.status);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group41Var4 -------
 
 Group41Var4::Group41Var4() : value(0.0), status(0)
@@ -176,5 +290,43 @@ bool Group41Var4::WriteTarget(const AnalogOutputDouble64& value, ser4cpp::wseq_t
   return Group41Var4::Write(ConvertGroup41Var4::Apply(value), buff);
 }
 
+bool Group41Var4::ReadArray(rseq_t& buff, AnalogOutputDouble64* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    output[i] = AnalogOutputDouble64Factory::From(DoubleFloat::read(data), UInt8::read(data + 8));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group41Var4::WriteArray(const AnalogOutputDouble64* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    const auto gv = ConvertGroup41Var4::Apply(values[i]);
+    DoubleFloat::write(data, gv.value);
+    UInt8::write(data + 8, gv.status);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
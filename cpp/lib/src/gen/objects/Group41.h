@@ -64,7 +64,9 @@ struct Group41Var1
   typedef AnalogOutputInt32 Target;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputInt32&);
   static bool WriteTarget(const AnalogOutputInt32&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputInt32> Inst() { return DNP3Serializer<AnalogOutputInt32>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputInt32*, size_t);
+  static bool WriteArray(const AnalogOutputInt32*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputInt32> Inst() { return DNP3Serializer<AnalogOutputInt32>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Output - 16-bit With Flag
@@ -85,7 +87,9 @@ struct Group41Var2
   typedef AnalogOutputInt16 Target;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputInt16&);
   static bool WriteTarget(const AnalogOutputInt16&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputInt16> Inst() { return DNP3Serializer<AnalogOutputInt16>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputInt16*, size_t);
+  static bool WriteArray(const AnalogOutputInt16*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputInt16> Inst() { return DNP3Serializer<AnalogOutputInt16>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Output - Single-precision
@@ -106,7 +110,9 @@ struct Group41Var3
   typedef AnalogOutputFloat32 Target;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputFloat32&);
   static bool WriteTarget(const AnalogOutputFloat32&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputFloat32> Inst() { return DNP3Serializer<AnalogOutputFloat32>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputFloat32*, size_t);
+  static bool WriteArray(const AnalogOutputFloat32*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputFloat32> Inst() { return DNP3Serializer<AnalogOutputFloat32>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Output - Double-precision
@@ -127,7 +133,9 @@ struct Group41Var4
   typedef AnalogOutputDouble64 Target;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputDouble64&);
   static bool WriteTarget(const AnalogOutputDouble64&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputDouble64> Inst() { return DNP3Serializer<AnalogOutputDouble64>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputDouble64*, size_t);
+  static bool WriteArray(const AnalogOutputDouble64*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputDouble64> Inst() { return DNP3Serializer<AnalogOutputDouble64>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 
@@ -74,6 +74,44 @@ bool Group42Var1::WriteTarget(const AnalogOutputStatus& value, ser4cpp::wseq_t&
   return Group42Var1::Write(ConvertGroup42Var1::Apply(value), buff);
 }
 
+bool Group42Var1::ReadArray(rseq_t& buff, AnalogOutputStatus* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = AnalogOutputStatusFactory::From(UInt8::read(data), Int32::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group42Var1::WriteArray(const AnalogOutputStatus* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup42Var1::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    Int32::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group42Var2 -------
 
 Group42Var2::Group42Var2() : flags(0), value(0)
@@ -108,6 +146,44 @@ bool Group42Var2::WriteTarget(const AnalogOutputStatus& value, ser4cpp::wseq_t&
   return Group42Var2::Write(ConvertGroup42Var2::Apply(value), buff);
 }
 
+bool Group42Var2::ReadArray(rseq_t& buff, AnalogOutputStatus* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    output[i] = AnalogOutputStatusFactory::From(UInt8::read(data), Int16::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group42Var2::WriteArray(const AnalogOutputStatus* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    const auto gv = ConvertGroup42Var2::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    Int16::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group42Var3 -------
 
 Group42Var3::Group42Var3() : flags(0), value(0), time(0)
@@ -142,6 +218,45 @@ bool Group42Var3::WriteTarget(const AnalogOutputStatus& value, ser4cpp::wseq_t&
   return Group42Var3::Write(ConvertGroup42Var3::Apply(value), buff);
 }
 
+bool Group42Var3::ReadArray(rseq_t& buff, AnalogOutputStatus* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    output[i] = AnalogOutputStatusFactory::From(UInt8::read(data), Int32::read(data + 1), DNPTime(UInt48::read(data + 5).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group42Var3::WriteArray(const AnalogOutputStatus* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    const auto gv = ConvertGroup42Var3::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    Int32::write(data + 1, gv.value);
+    UInt48::write(data + 5, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group42Var4 -------
 
 Group42Var4::Group42Var4() : flags(0), value(0), time(0)
@@ -176,6 +291,45 @@ bool Group42Var4::WriteTarget(const AnalogOutputStatus& value, ser4cpp::wseq_t&
   return Group42Var4::Write(ConvertGroup42Var4::Apply(value), buff);
 }
 
+bool Group42Var4::ReadArray(rseq_t& buff, AnalogOutputStatus* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    output[i] = AnalogOutputStatusFactory::From(UInt8::read(data), Int16::read(data + 1), DNPTime(UInt48::read(data + 3).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group42Var4::WriteArray(const AnalogOutputStatus* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    const auto gv = ConvertGroup42Var4::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    Int16::write(data + 1, gv.value);
+    UInt48::write(data + 3, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group42Var5 -------
 
 Group42Var5::Group42Var5() : flags(0), value(0.0)
@@ -210,6 +364,44 @@ bool Group42Var5::WriteTarget(const AnalogOutputStatus& value, ser4cpp::wseq_t&
   return Group42Var5::Write(ConvertGroup42Var5::Apply(value), buff);
 }
 
+bool Group42Var5::ReadArray(rseq_t& buff, AnalogOutputStatus* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = AnalogOutputStatusFactory::From(UInt8::read(data), SingleFloat::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group42Var5::WriteArray(const AnalogOutputStatus* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup42Var5::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    SingleFloat::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group42Var6 -------
 
 Group42Var6::Group42Var6() : flags(0), value(0.0)
@@ -244,6 +436,44 @@ bool Group42Var6::WriteTarget(const AnalogOutputStatus& value, ser4cpp::wseq_t&
   return Group42Var6::Write(ConvertGroup42Var6::Apply(value), buff);
 }
 
+bool Group42Var6::ReadArray(rseq_t& buff, AnalogOutputStatus* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    output[i] = AnalogOutputStatusFactory::From(UInt8::read(data), DoubleFloat::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group42Var6::WriteArray(const AnalogOutputStatus* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    const auto gv = ConvertGroup42Var6::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    DoubleFloat::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group42Var7 -------
 
 Group42Var7::Group42Var7() : flags(0), value(0.0), time(0)
@@ -278,6 +508,45 @@ bool Group42Var7::WriteTarget(const AnalogOutputStatus& value, ser4cpp::wseq_t&
   return Group42Var7::Write(ConvertGroup42Var7::Apply(value), buff);
 }
 
+bool Group42Var7::ReadArray(rseq_t& buff, AnalogOutputStatus* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    output[i] = AnalogOutputStatusFactory::From(UInt8::read(data), SingleFloat::read(data + 1), DNPTime(UInt48::read(data + 5).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group42Var7::WriteArray(const AnalogOutputStatus* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    const auto gv = ConvertGroup42Var7::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    SingleFloat::write(data + 1, gv.value);
+    UInt48::write(data + 5, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group42Var8 -------
 
 Group42Var8::Group42Var8() : flags(0), value(0.0), time(0)
@@ -312,5 +581,44 @@ bool Group42Var8::WriteTarget(const AnalogOutputStatus& value, ser4cpp::wseq_t&
   return Group42Var8::Write(ConvertGroup42Var8::Apply(value), buff);
 }
 
+bool Group42Var8::ReadArray(rseq_t& buff, AnalogOutputStatus* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 15)
+  {
+    output[i] = AnalogOutputStatusFactory::From(UInt8::read(data), DoubleFloat::read(data + 1), DNPTime(UInt48::read(data + 9).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group42Var8::WriteArray(const AnalogOutputStatus* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 15)
+  {
+    const auto gv = ConvertGroup42Var8::Apply(values[i]);
+    UInt8::write(data, gv.flags);
+    DoubleFloat::write(data + 1, gv.value);
+    UInt48::write(data + 9, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
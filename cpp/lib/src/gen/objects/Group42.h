@@ -65,7 +65,9 @@ struct Group42Var1
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputStatus*, size_t);
+  static bool WriteArray(const AnalogOutputStatus*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Output Event - 16-bit With Flag
@@ -87,7 +89,9 @@ struct Group42Var2
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputStatus*, size_t);
+  static bool WriteArray(const AnalogOutputStatus*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Output Event - 32-bit With Flag and Time
@@ -110,7 +114,9 @@ struct Group42Var3
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputStatus*, size_t);
+  static bool WriteArray(const AnalogOutputStatus*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Output Event - 16-bit With Flag and Time
@@ -133,7 +139,9 @@ struct Group42Var4
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputStatus*, size_t);
+  static bool WriteArray(const AnalogOutputStatus*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Output Event - Single-precision With Flag
@@ -155,7 +163,9 @@ struct Group42Var5
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputStatus*, size_t);
+  static bool WriteArray(const AnalogOutputStatus*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Output Event - Double-precision With Flag
@@ -177,7 +187,9 @@ struct Group42Var6
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputStatus*, size_t);
+  static bool WriteArray(const AnalogOutputStatus*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Output Event - Single-precision With Flag and Time
@@ -200,7 +212,9 @@ struct Group42Var7
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputStatus*, size_t);
+  static bool WriteArray(const AnalogOutputStatus*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Output Event - Double-precision With Flag and Time
@@ -223,7 +237,9 @@ struct Group42Var8
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogOutputStatus*, size_t);
+  static bool WriteArray(const AnalogOutputStatus*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 
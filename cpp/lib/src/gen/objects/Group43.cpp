@@ -74,6 +74,44 @@ bool Group43Var1::WriteTarget(const AnalogCommandEvent& value, ser4cpp::wseq_t&
   return Group43Var1::Write(ConvertGroup43Var1::Apply(value), buff);
 }
 
+bool Group43Var1::ReadArray(rseq_t& buff, AnalogCommandEvent* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = AnalogCommandEventFactory::From(UInt8::read(data), Int32::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group43Var1::WriteArray(const AnalogCommandEvent* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup43Var1::Apply(values[i]);
+    UInt8::write(data, gv.status);
+    Int32::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group43Var2 -------
 
 Group43Var2::Group43Var2() : status(0), value(0)
@@ -108,6 +146,44 @@ bool Group43Var2::WriteTarget(const AnalogCommandEvent& value, ser4cpp::wseq_t&
   return Group43Var2::Write(ConvertGroup43Var2::Apply(value), buff);
 }
 
+bool Group43Var2::ReadArray(rseq_t& buff, AnalogCommandEvent* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    output[i] = AnalogCommandEventFactory::From(UInt8::read(data), Int16::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group43Var2::WriteArray(const AnalogCommandEvent* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 3)
+  {
+    const auto gv = ConvertGroup43Var2::Apply(values[i]);
+    UInt8::write(data, gv.status);
+    Int16::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group43Var3 -------
 
 Group43Var3::Group43Var3() : status(0), value(0), time(0)
@@ -142,6 +218,45 @@ bool Group43Var3::WriteTarget(const AnalogCommandEvent& value, ser4cpp::wseq_t&
   return Group43Var3::Write(ConvertGroup43Var3::Apply(value), buff);
 }
 
+bool Group43Var3::ReadArray(rseq_t& buff, AnalogCommandEvent* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    output[i] = AnalogCommandEventFactory::From(UInt8::read(data), Int32::read(data + 1), DNPTime(UInt48::read(data + 5).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group43Var3::WriteArray(const AnalogCommandEvent* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    const auto gv = ConvertGroup43Var3::Apply(values[i]);
+    UInt8::write(data, gv.status);
+    Int32::write(data + 1, gv.value);
+    UInt48::write(data + 5, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group43Var4 -------
 
 Group43Var4::Group43Var4() : status(0), value(0), time(0)
@@ -176,6 +291,45 @@ bool Group43Var4::WriteTarget(const AnalogCommandEvent& value, ser4cpp::wseq_t&
   return Group43Var4::Write(ConvertGroup43Var4::Apply(value), buff);
 }
 
+bool Group43Var4::ReadArray(rseq_t& buff, AnalogCommandEvent* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    output[i] = AnalogCommandEventFactory::From(UInt8::read(data), Int16::read(data + 1), DNPTime(UInt48::read(data + 3).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group43Var4::WriteArray(const AnalogCommandEvent* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    const auto gv = ConvertGroup43Var4::Apply(values[i]);
+    UInt8::write(data, gv.status);
+    Int16::write(data + 1, gv.value);
+    UInt48::write(data + 3, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group43Var5 -------
 
 Group43Var5::Group43Var5() : status(0), value(0.0)
@@ -210,6 +364,44 @@ bool Group43Var5::WriteTarget(const AnalogCommandEvent& value, ser4cpp::wseq_t&
   return Group43Var5::Write(ConvertGroup43Var5::Apply(value), buff);
 }
 
+bool Group43Var5::ReadArray(rseq_t& buff, AnalogCommandEvent* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    output[i] = AnalogCommandEventFactory::From(UInt8::read(data), SingleFloat::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group43Var5::WriteArray(const AnalogCommandEvent* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 5)
+  {
+    const auto gv = ConvertGroup43Var5::Apply(values[i]);
+    UInt8::write(data, gv.status);
+    SingleFloat::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group43Var6 -------
 
 Group43Var6::Group43Var6() : status(0), value(0.0)
@@ -244,6 +436,44 @@ bool Group43Var6::WriteTarget(const AnalogCommandEvent& value, ser4cpp::wseq_t&
   return Group43Var6::Write(ConvertGroup43Var6::Apply(value), buff);
 }
 
+bool Group43Var6::ReadArray(rseq_t& buff, AnalogCommandEvent* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    output[i] = AnalogCommandEventFactory::From(UInt8::read(data), DoubleFloat::read(data + 1));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group43Var6::WriteArray(const AnalogCommandEvent* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 9)
+  {
+    const auto gv = ConvertGroup43Var6::Apply(values[i]);
+    UInt8::write(data, gv.status);
+    DoubleFloat::write(data + 1, gv.value);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group43Var7 -------
 
 Group43Var7::Group43Var7() : status(0), value(0.0), time(0)
@@ -278,6 +508,45 @@ bool Group43Var7::WriteTarget(const AnalogCommandEvent& value, ser4cpp::wseq_t&
   return Group43Var7::Write(ConvertGroup43Var7::Apply(value), buff);
 }
 
+bool Group43Var7::ReadArray(rseq_t& buff, AnalogCommandEvent* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    output[i] = AnalogCommandEventFactory::From(UInt8::read(data), SingleFloat::read(data + 1), DNPTime(UInt48::read(data + 5).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group43Var7::WriteArray(const AnalogCommandEvent* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    const auto gv = ConvertGroup43Var7::Apply(values[i]);
+    UInt8::write(data, gv.status);
+    SingleFloat::write(data + 1, gv.value);
+    UInt48::write(data + 5, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 // ------- Group43Var8 -------
 
 Group43Var8::Group43Var8() : status(0), value(0.0), time(0)
@@ -312,5 +581,44 @@ bool Group43Var8::WriteTarget(const AnalogCommandEvent& value, ser4cpp::wseq_t&
   return Group43Var8::Write(ConvertGroup43Var8::Apply(value), buff);
 }
 
+bool Group43Var8::ReadArray(rseq_t& buff, AnalogCommandEvent* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 15)
+  {
+    output[i] = AnalogCommandEventFactory::From(UInt8::read(data), DoubleFloat::read(data + 1), DNPTime(UInt48::read(data + 9).Get()));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group43Var8::WriteArray(const AnalogCommandEvent* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 15)
+  {
+    const auto gv = ConvertGroup43Var8::Apply(values[i]);
+    UInt8::write(data, gv.status);
+    DoubleFloat::write(data + 1, gv.value);
+    UInt48::write(data + 9, UInt48Type(gv.time.value));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
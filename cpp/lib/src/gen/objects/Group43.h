@@ -58,7 +58,9 @@ struct Group43Var1
   typedef AnalogCommandEvent Target;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogCommandEvent&);
   static bool WriteTarget(const AnalogCommandEvent&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogCommandEvent*, size_t);
+  static bool WriteArray(const AnalogCommandEvent*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Command Event - 16-bit
@@ -79,7 +81,9 @@ struct Group43Var2
   typedef AnalogCommandEvent Target;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogCommandEvent&);
   static bool WriteTarget(const AnalogCommandEvent&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogCommandEvent*, size_t);
+  static bool WriteArray(const AnalogCommandEvent*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Command Event - 32-bit With Time
@@ -101,7 +105,9 @@ struct Group43Var3
   typedef AnalogCommandEvent Target;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogCommandEvent&);
   static bool WriteTarget(const AnalogCommandEvent&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogCommandEvent*, size_t);
+  static bool WriteArray(const AnalogCommandEvent*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Command Event - 16-bit With Time
@@ -123,7 +129,9 @@ struct Group43Var4
   typedef AnalogCommandEvent Target;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogCommandEvent&);
   static bool WriteTarget(const AnalogCommandEvent&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogCommandEvent*, size_t);
+  static bool WriteArray(const AnalogCommandEvent*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Command Event - Single-precision
@@ -144,7 +152,9 @@ struct Group43Var5
   typedef AnalogCommandEvent Target;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogCommandEvent&);
   static bool WriteTarget(const AnalogCommandEvent&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogCommandEvent*, size_t);
+  static bool WriteArray(const AnalogCommandEvent*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Command Event - Double-precision
@@ -165,7 +175,9 @@ struct Group43Var6
   typedef AnalogCommandEvent Target;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogCommandEvent&);
   static bool WriteTarget(const AnalogCommandEvent&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogCommandEvent*, size_t);
+  static bool WriteArray(const AnalogCommandEvent*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Command Event - Single-precision With Time
@@ -187,7 +199,9 @@ struct Group43Var7
   typedef AnalogCommandEvent Target;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogCommandEvent&);
   static bool WriteTarget(const AnalogCommandEvent&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogCommandEvent*, size_t);
+  static bool WriteArray(const AnalogCommandEvent*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 // Analog Command Event - Double-precision With Time
@@ -209,7 +223,9 @@ struct Group43Var8
   typedef AnalogCommandEvent Target;
   static bool ReadTarget(ser4cpp::rseq_t&, AnalogCommandEvent&);
   static bool WriteTarget(const AnalogCommandEvent&, ser4cpp::wseq_t&);
-  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, AnalogCommandEvent*, size_t);
+  static bool WriteArray(const AnalogCommandEvent*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<AnalogCommandEvent> Inst() { return DNP3Serializer<AnalogCommandEvent>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
 };
 
 
@@ -104,5 +104,44 @@ bool Group50Var4::WriteTarget(const TimeAndInterval& value, ser4cpp::wseq_t& buf
   return Group50Var4::Write(ConvertGroup50Var4::Apply(value), buff);
 }
 
+bool Group50Var4::ReadArray(rseq_t& buff, TimeAndInterval* output, size_t count)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  const uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    output[i] = TimeAndIntervalFactory::From(DNPTime(UInt48::read(data).Get()), UInt32::read(data + 6), UInt8::read(data + 10));
+  }
+
+  buff.advance(size);
+  return true;
+}
+
+bool Group50Var4::WriteArray(const TimeAndInterval* values, size_t count, ser4cpp::wseq_t& buff)
+{
+  const auto size = count * Size();
+  if(buff.length() < size)
+  {
+    return false;
+  }
+
+  uint8_t* data = buff;
+  for(size_t i = 0; i < count; ++i, data += 11)
+  {
+    const auto gv = ConvertGroup50Var4::Apply(values[i]);
+    UInt48::write(data, UInt48Type(gv.time.value));
+    UInt32::write(data + 6, gv.interval);
+    UInt8::write(data + 10, gv.units);
+  }
+
+  buff.advance(size);
+  return true;
+}
+
 
 }
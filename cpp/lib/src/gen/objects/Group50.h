@@ -87,7 +87,9 @@ struct Group50Var4
   typedef TimeAndIntervalSpec Spec;
   static bool ReadTarget(ser4cpp::rseq_t&, TimeAndInterval&);
   static bool WriteTarget(const TimeAndInterval&, ser4cpp::wseq_t&);
-  static DNP3Serializer<TimeAndInterval> Inst() { return DNP3Serializer<TimeAndInterval>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool ReadArray(ser4cpp::rseq_t&, TimeAndInterval*, size_t);
+  static bool WriteArray(const TimeAndInterval*, size_t, ser4cpp::wseq_t&);
+  static DNP3Serializer<TimeAndInterval> Inst() { return DNP3Serializer<TimeAndInterval>(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }
   static const StaticTimeAndIntervalVariation svariation = StaticTimeAndIntervalVariation::Group50Var4;
 };
 
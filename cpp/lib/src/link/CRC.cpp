@@ -45,6 +45,22 @@ uint16_t CRC::crcTable[256]
        0x9600, 0xA05E, 0x6E26, 0x5878, 0x029A, 0x34C4, 0xB75E, 0x8100, 0xDBE2, 0xEDBC, 0x91AF, 0xA7F1, 0xFD13, 0xCB4D,
        0x48D7, 0x7E89, 0x246B, 0x1235};
 
+CRC::SliceTables::SliceTables()
+{
+    // values[n][i] is the table entry for byte i followed by n + 1 zero bytes
+    for (size_t i = 0; i < 256; ++i)
+    {
+        uint16_t crc = crcTable[i];
+        for (auto& table : values)
+        {
+            crc = crcTable[crc & 0xFF] ^ (crc >> 8);
+            table[i] = crc;
+        }
+    }
+}
+
+const CRC::SliceTables CRC::sliceTables;
+
 uint16_t CRC::CalcCrc(const uint8_t* input, size_t length)
 {
     uint16_t CRC = 0;
@@ -71,6 +87,30 @@ void CRC::AddCrc(uint8_t* input, size_t length)
     ser4cpp::UInt16::write_to(buffer, crc);
 }
 
+void CRC::CopyWithCrc(uint8_t* dest, size_t prefix, const uint8_t* src, size_t length)
+{
+    uint16_t CRC = 0;
+
+    for (size_t i = 0; i < prefix; ++i)
+    {
+        uint8_t index = (CRC ^ dest[i]) & 0xFF;
+        CRC = crcTable[index] ^ (CRC >> 8);
+    }
+
+    dest += prefix;
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        const auto value = src[i];
+        dest[i] = value;
+        uint8_t index = (CRC ^ value) & 0xFF;
+        CRC = crcTable[index] ^ (CRC >> 8);
+    }
+
+    ser4cpp::wseq_t buffer(dest + length, 2);
+    ser4cpp::UInt16::write_to(buffer, static_cast<uint16_t>(~CRC));
+}
+
 bool CRC::IsCorrectCRC(const uint8_t* input, size_t length)
 {
 // This definition is automatically set when compiling for OSS-Fuzz.
@@ -85,4 +125,54 @@ bool CRC::IsCorrectCRC(const uint8_t* input, size_t length)
 #endif
 }
 
+bool CRC::AreCorrectCRCs(const uint8_t* input, size_t count, size_t blockSize)
+{
+#ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+    return true;
+#else
+    const size_t stride = blockSize + 2;
+
+    for (; count >= 2; count -= 2)
+    {
+        const uint8_t* first = input;
+        const uint8_t* second = input + stride;
+
+        uint16_t crc1 = 0;
+        uint16_t crc2 = 0;
+
+        // slicing by 4 shortens the dependency chain of each block, and the two chains are independent
+        size_t i = 0;
+        for (; i + 4 <= blockSize; i += 4)
+        {
+            crc1 = SliceBy4(crc1, first + i);
+            crc2 = SliceBy4(crc2, second + i);
+        }
+
+        for (; i < blockSize; ++i)
+        {
+            crc1 = crcTable[(crc1 ^ first[i]) & 0xFF] ^ (crc1 >> 8);
+            crc2 = crcTable[(crc2 ^ second[i]) & 0xFF] ^ (crc2 >> 8);
+        }
+
+        const uint16_t expected1 = first[blockSize] | (first[blockSize + 1] << 8);
+        const uint16_t expected2 = second[blockSize] | (second[blockSize + 1] << 8);
+
+        if ((static_cast<uint16_t>(~crc1) != expected1) || (static_cast<uint16_t>(~crc2) != expected2))
+        {
+            return false;
+        }
+
+        input += 2 * stride;
+    }
+
+    return (count == 0) || IsCorrectCRC(input, blockSize);
+#endif
+}
+
+uint16_t CRC::SliceBy4(uint16_t crc, const uint8_t* input)
+{
+    const uint16_t value = crc ^ (input[0] | (input[1] << 8));
+    return sliceTables[2][value & 0xFF] ^ sliceTables[1][value >> 8] ^ sliceTables[0][input[2]] ^ crcTable[input[3]];
+}
+
 } // namespace opendnp3
@@ -36,10 +36,46 @@ public:
 
     static void AddCrc(uint8_t* input, size_t length);
 
+    /**
+     * Copies data and appends a CRC in a single pass
+     *
+     * @param dest destination that already holds 'prefix' bytes covered by the CRC
+     * @param prefix number of bytes already at the start of dest
+     * @param src data copied after the prefix
+     * @param length number of bytes to copy
+     */
+    static void CopyWithCrc(uint8_t* dest, size_t prefix, const uint8_t* src, size_t length);
+
     static bool IsCorrectCRC(const uint8_t* input, size_t length);
 
+    /**
+     * Checks the CRCs of consecutive blocks that each hold 'blockSize' bytes followed by their CRC. The blocks
+     * are verified two at a time so that the table lookups of one block overlap those of the other.
+     *
+     * @param input start of the first block
+     * @param count number of blocks
+     * @param blockSize number of bytes covered by each CRC
+     */
+    static bool AreCorrectCRCs(const uint8_t* input, size_t count, size_t blockSize);
+
 private:
+    static uint16_t SliceBy4(uint16_t crc, const uint8_t* input);
+
+    // crcTable extended to process several bytes per lookup round
+    struct SliceTables
+    {
+        SliceTables();
+
+        const uint16_t* operator[](size_t index) const
+        {
+            return values[index];
+        }
+
+        uint16_t values[3][256];
+    };
+
     static uint16_t crcTable[256]; // Precomputed CRC lookup table
+    static const SliceTables sliceTables;
 };
 
 } // namespace opendnp3
@@ -36,6 +36,13 @@ public:
     virtual ~IFrameSink() {}
 
     virtual bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) = 0;
+
+    // Called by the parser before a frame's body is validated to get storage where the user data should be
+    // written. If empty, the user data is written into the parser's own buffer before being passed to OnFrame.
+    virtual ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& /*header*/, size_t /*length*/)
+    {
+        return ser4cpp::wseq_t::empty();
+    }
 };
 
 } // namespace opendnp3
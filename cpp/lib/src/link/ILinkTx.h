@@ -36,9 +36,11 @@ public:
     virtual ~ILinkTx() {}
 
     /**
-     * Begin transmission of a frame. Callback happens OFF the call stack (via executor)
+     * Begin transmission of one or more frames. Callback happens OFF the call stack (via executor)
+     *
+     * @param numFrames number of link frames contained in the buffer
      */
-    virtual bool BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& context) = 0;
+    virtual bool BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& context, uint32_t numFrames) = 0;
 };
 
 } // namespace opendnp3
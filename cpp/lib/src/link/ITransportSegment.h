@@ -21,6 +21,7 @@
 #define OPENDNP3_ITRANSPORTSEGMENT_H
 
 #include "opendnp3/link/Addresses.h"
+#include "opendnp3/logging/Logger.h"
 
 #include <ser4cpp/container/SequenceTypes.h>
 
@@ -42,6 +43,24 @@ public:
 
     // move to the next segment, true if more segments available
     virtual bool Advance() = 0;
+
+    // size of the buffer needed by EncodeFrames, 0 if the segments can only be read one at a time
+    virtual size_t GetFramesSize() const
+    {
+        return 0;
+    }
+
+    // encode all remaining segments as unconfirmed user data frames in a single pass, consuming them
+    virtual ser4cpp::rseq_t EncodeFrames(ser4cpp::wseq_t& /*buffer*/, bool /*isMaster*/, Logger* /*logger*/)
+    {
+        return ser4cpp::rseq_t::empty();
+    }
+
+    // number of frames written by the last call to EncodeFrames
+    virtual uint32_t GetNumEncodedFrames() const
+    {
+        return 0;
+    }
 };
 
 } // namespace opendnp3
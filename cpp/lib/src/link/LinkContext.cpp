@@ -137,8 +137,8 @@ bool LinkContext::OnTxReady()
     this->txMode = LinkTransmitMode::Idle;
 
     // before we dispatch the transmit result, give any pending transmissions access first
-    this->TryPendingTx(this->pendingSecTx, false);
-    this->TryPendingTx(this->pendingPriTx, true);
+    this->TryPendingTx(this->pendingSecTx, false, 1);
+    this->TryPendingTx(this->pendingPriTx, true, this->pendingPriTxFrames);
 
     // now dispatch the completion event to the correct state handler
     if (isPrimary)
@@ -162,16 +162,36 @@ ser4cpp::rseq_t LinkContext::FormatPrimaryBufferWithUnconfirmed(const Addresses&
     return output;
 }
 
-bool LinkContext::QueueTransmit(const ser4cpp::rseq_t& buffer, bool primary)
+ser4cpp::rseq_t LinkContext::FormatFragmentBufferWithUnconfirmed(ITransportSegment& segments)
+{
+    const auto size = segments.GetFramesSize();
+    if (size == 0)
+    {
+        return ser4cpp::rseq_t::empty();
+    }
+
+    if (this->fragmentTxBuffer.size() < size)
+    {
+        this->fragmentTxBuffer.resize(size);
+    }
+
+    ser4cpp::wseq_t buffer(this->fragmentTxBuffer.data(), size);
+    auto output = segments.EncodeFrames(buffer, config.IsMaster, &logger);
+    FORMAT_HEX_BLOCK(logger, flags::LINK_TX_HEX, output, 10, 18);
+    return output;
+}
+
+bool LinkContext::QueueTransmit(const ser4cpp::rseq_t& buffer, bool primary, uint32_t numFrames)
 {
     if (txMode == LinkTransmitMode::Idle)
     {
         txMode = primary ? LinkTransmitMode::Primary : LinkTransmitMode::Secondary;
-        return linktx->BeginTransmit(buffer, *pSession);
+        return linktx->BeginTransmit(buffer, *pSession, numFrames);
     }
     if (primary)
     {
         pendingPriTx.set(buffer);
+        pendingPriTxFrames = numFrames;
     }
     else
     {
@@ -383,11 +403,24 @@ bool LinkContext::OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t&
     return true;
 }
 
-bool LinkContext::TryPendingTx(ser4cpp::Settable<ser4cpp::rseq_t>& pending, bool primary)
+ser4cpp::wseq_t LinkContext::GetUserDataBuffer(const LinkHeaderFields& header, size_t length) const
+{
+    const bool isUserData
+        = (header.func == LinkFunction::PRI_CONFIRMED_USER_DATA || header.func == LinkFunction::PRI_UNCONFIRMED_USER_DATA);
+
+    // only frames that OnFrame would route to this layer can be written into the upper layer
+    const bool accepted = isOnline && isUserData && (header.isFromMaster != config.IsMaster)
+        && (header.addresses.destination == config.LocalAddr) && !header.addresses.IsBroadcast()
+        && (header.addresses.source == config.RemoteAddr || config.respondToAnySource);
+
+    return accepted ? upper->GetReceiveBuffer(length) : ser4cpp::wseq_t::empty();
+}
+
+bool LinkContext::TryPendingTx(ser4cpp::Settable<ser4cpp::rseq_t>& pending, bool primary, uint32_t numFrames)
 {
     if (this->txMode == LinkTransmitMode::Idle && pending.is_set())
     {
-        const auto res = this->linktx->BeginTransmit(pending.get(), *pSession);
+        const auto res = this->linktx->BeginTransmit(pending.get(), *pSession, numFrames);
         pending.clear();
         this->txMode = primary ? LinkTransmitMode::Primary : LinkTransmitMode::Secondary;
         return res;
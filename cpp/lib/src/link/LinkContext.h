@@ -38,6 +38,7 @@
 #include <exe4cpp/IExecutor.h>
 
 #include <memory>
+#include <vector>
 
 namespace opendnp3
 {
@@ -90,12 +91,15 @@ public:
     // --- helpers for formatting user data messages ---
     ser4cpp::rseq_t FormatPrimaryBufferWithUnconfirmed(const Addresses& addr, const ser4cpp::rseq_t& tpdu);
 
+    // encodes every remaining segment into the fragment buffer, empty if the segments don't support it
+    ser4cpp::rseq_t FormatFragmentBufferWithUnconfirmed(ITransportSegment& segments);
+
     // --- Helpers for queueing frames ---
     bool QueueAck(uint16_t destination);
     bool QueueLinkStatus(uint16_t destination);
     bool QueueRequestLinkStatus(uint16_t destination);
 
-    bool QueueTransmit(const ser4cpp::rseq_t& buffer, bool primary);
+    bool QueueTransmit(const ser4cpp::rseq_t& buffer, bool primary, uint32_t numFrames = 1);
 
     // --- public members ----
 
@@ -110,13 +114,18 @@ public:
     void FailKeepAlive(bool timeout);
     void CompleteKeepAlive();
     bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata);
-    bool TryPendingTx(ser4cpp::Settable<ser4cpp::rseq_t>& pending, bool primary);
+    ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length) const;
+    bool TryPendingTx(ser4cpp::Settable<ser4cpp::rseq_t>& pending, bool primary, uint32_t numFrames);
 
     // buffers used for primary and secondary requests
     ser4cpp::StaticBuffer<LPDU_MAX_FRAME_SIZE> priTxBuffer;
+    // holds all the frames of a fragment, grows to the largest fragment sent
+    std::vector<uint8_t> fragmentTxBuffer;
     ser4cpp::StaticBuffer<LPDU_HEADER_SIZE> secTxBuffer;
 
     ser4cpp::Settable<ser4cpp::rseq_t> pendingPriTx;
+    // number of frames in pendingPriTx, secondary transmissions are always a single frame
+    uint32_t pendingPriTxFrames = 1;
     ser4cpp::Settable<ser4cpp::rseq_t> pendingSecTx;
 
     Logger logger;
@@ -68,6 +68,18 @@ bool LinkFrame::ValidateBodyCRC(const uint8_t* pBody, size_t length)
     return true;
 }
 
+bool LinkFrame::ValidateFrameCRC(const uint8_t* apFrame, size_t aLength)
+{
+    const size_t numFullBlocks = aLength / LPDU_DATA_BLOCK_SIZE;
+    const size_t partialSize = aLength % LPDU_DATA_BLOCK_SIZE;
+
+    const uint8_t* pBody = apFrame + LPDU_HEADER_SIZE;
+    const uint8_t* pPartial = pBody + numFullBlocks * LPDU_DATA_PLUS_CRC_SIZE;
+
+    return CRC::IsCorrectCRC(apFrame, LI_CRC) && CRC::AreCorrectCRCs(pBody, numFullBlocks, LPDU_DATA_BLOCK_SIZE)
+        && (partialSize == 0 || CRC::IsCorrectCRC(pPartial, partialSize));
+}
+
 size_t LinkFrame::CalcFrameSize(size_t dataLength)
 {
     return LPDU_HEADER_SIZE + CalcUserDataSize(dataLength);
@@ -181,6 +193,50 @@ ser4cpp::rseq_t LinkFrame::FormatUnconfirmedUserData(
     return ret;
 }
 
+ser4cpp::rseq_t LinkFrame::FormatUnconfirmedUserData(ser4cpp::wseq_t& buffer,
+                                                     bool aIsMaster,
+                                                     uint16_t aDest,
+                                                     uint16_t aSrc,
+                                                     uint8_t transportHeader,
+                                                     ser4cpp::rseq_t payload,
+                                                     Logger* pLogger)
+{
+    const auto length = payload.length() + 1;
+    if (length > LPDU_MAX_USER_DATA_SIZE)
+    {
+        return ser4cpp::rseq_t::empty();
+    }
+
+    const auto userDataSize = CalcUserDataSize(length);
+    if (buffer.length() < userDataSize + LPDU_HEADER_SIZE)
+    {
+        return ser4cpp::rseq_t::empty();
+    }
+
+    auto ret = buffer.readonly().take(userDataSize + LPDU_HEADER_SIZE);
+    FormatHeader(buffer, static_cast<uint8_t>(length), aIsMaster, false, false,
+                 LinkFunction::PRI_UNCONFIRMED_USER_DATA, aDest, aSrc, pLogger);
+
+    // the first block holds the transport header and the start of the payload
+    uint8_t* dest = buffer;
+    dest[0] = transportHeader;
+    const auto first = (payload.length() < (LPDU_DATA_BLOCK_SIZE - 1u)) ? payload.length() : (LPDU_DATA_BLOCK_SIZE - 1u);
+    CRC::CopyWithCrc(dest, 1, payload, first);
+    dest += (first + 1 + LPDU_CRC_SIZE);
+    payload.advance(first);
+
+    while (payload.is_not_empty())
+    {
+        const auto num = (payload.length() < LPDU_DATA_BLOCK_SIZE) ? payload.length() : LPDU_DATA_BLOCK_SIZE;
+        CRC::CopyWithCrc(dest, 0, payload, num);
+        dest += (num + LPDU_CRC_SIZE);
+        payload.advance(num);
+    }
+
+    buffer.advance(userDataSize);
+    return ret;
+}
+
 ser4cpp::rseq_t LinkFrame::FormatHeader(ser4cpp::wseq_t& buffer,
                                         uint8_t aDataLength,
                                         bool aIsMaster,
@@ -71,6 +71,16 @@ public:
                                                      ser4cpp::rseq_t user_data,
                                                      Logger* pLogger);
 
+    /** Formats an unconfirmed user data frame whose user data is a transport header followed by the payload.
+        The payload is copied straight from the APDU into the CRC blocks of the frame. */
+    static ser4cpp::rseq_t FormatUnconfirmedUserData(ser4cpp::wseq_t& buffer,
+                                                     bool aIsMaster,
+                                                     uint16_t aDest,
+                                                     uint16_t aSrc,
+                                                     uint8_t transportHeader,
+                                                     ser4cpp::rseq_t payload,
+                                                     Logger* pLogger);
+
     ////////////////////////////////////////////////
     //  Reusable static formatting functions to any buffer
     ////////////////////////////////////////////////
@@ -88,6 +98,12 @@ public:
     @return True if the body CRC is correct */
     static bool ValidateBodyCRC(const uint8_t* apBody, size_t aLength);
 
+    /** Validates the header CRC and all of the body CRCs of a complete FT3 frame
+    @param apFrame Beginning of the frame, i.e. the start bytes
+    @param aLength Number of user bytes in the frame, not user + crc.
+    @return True if every CRC in the frame is correct */
+    static bool ValidateFrameCRC(const uint8_t* apFrame, size_t aLength);
+
     // @return Total frame size based on user data length
     static size_t CalcFrameSize(size_t dataLength);
 
@@ -89,6 +89,11 @@ bool LinkLayer::OnTxReady()
 // IFrameSink
 ////////////////////////////////
 
+ser4cpp::wseq_t LinkLayer::GetUserDataBuffer(const LinkHeaderFields& header, size_t length)
+{
+    return this->ctx->GetUserDataBuffer(header, length);
+}
+
 bool LinkLayer::OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata)
 {
     auto ret = this->ctx->OnFrame(header, userdata);
@@ -47,6 +47,7 @@ public:
     bool OnLowerLayerDown(LinkStateChangeSource source) override;
     bool OnTxReady() override;
     bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) override;
+    ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length) override;
     void OnResponseTimeout() override;
 
     // ---- Events from above: ILinkLayer ----
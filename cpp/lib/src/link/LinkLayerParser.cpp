@@ -49,7 +49,7 @@ void LinkLayerParser::OnRead(size_t numBytes, IFrameSink& sink)
 {
     buffer.AdvanceWrite(numBytes);
 
-    while (ParseUntilComplete() == State::Complete)
+    while (this->ParseNextFrame(sink))
     {
         ++statistics.numLinkFrameRx;
         this->PushFrame(sink);
@@ -59,18 +59,66 @@ void LinkLayerParser::OnRead(size_t numBytes, IFrameSink& sink)
     buffer.Shift();
 }
 
-LinkLayerParser::State LinkLayerParser::ParseUntilComplete()
+bool LinkLayerParser::ParseNextFrame(IFrameSink& sink)
+{
+    // between frames, a reliable stream almost always has the next frame buffered at the read position
+    if (this->reliableTransport && this->state == State::FindSync && this->ParseContiguousFrame(sink))
+    {
+        return true;
+    }
+
+    return this->ParseUntilComplete(sink) == State::Complete;
+}
+
+bool LinkLayerParser::ParseContiguousFrame(IFrameSink& sink)
+{
+    if (buffer.NumBytesRead() < LPDU_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    const uint8_t* frame = buffer.ReadBuffer();
+
+    if (frame[LI_START_05] != 0x05 || frame[LI_START_64] != 0x64 || frame[LI_LENGTH] < LPDU_MIN_LENGTH)
+    {
+        return false;
+    }
+
+    const size_t userDataLength = frame[LI_LENGTH] - LPDU_MIN_LENGTH;
+
+    // the state machine counts and logs CRC failures
+    if (buffer.NumBytesRead() < LinkFrame::CalcFrameSize(userDataLength)
+        || !LinkFrame::ValidateFrameCRC(frame, userDataLength))
+    {
+        return false;
+    }
+
+    header.Read(buffer.ReadBuffer());
+
+    if (!this->ValidateHeaderParameters())
+    {
+        // same as the state machine rejecting the header
+        this->FailFrame();
+        return false;
+    }
+
+    this->LogFrame();
+    this->TransferUserData(sink.GetUserDataBuffer(this->GetFields(), userDataLength));
+    return true;
+}
+
+LinkLayerParser::State LinkLayerParser::ParseUntilComplete(IFrameSink& sink)
 {
     auto lastState = this->state;
     // continue as long as we're making progress, i.e. a state change
-    while ((this->state = ParseOneStep()) != lastState)
+    while ((this->state = ParseOneStep(sink)) != lastState)
     {
         lastState = state;
     }
     return state;
 }
 
-LinkLayerParser::State LinkLayerParser::ParseOneStep()
+LinkLayerParser::State LinkLayerParser::ParseOneStep(IFrameSink& sink)
 {
     switch (state)
     {
@@ -79,7 +127,7 @@ LinkLayerParser::State LinkLayerParser::ParseOneStep()
     case (State::ReadHeader):
         return ParseHeader();
     case (State::ReadBody):
-        return ParseBody();
+        return ParseBody(sink);
     default:
         return state;
     }
@@ -120,16 +168,19 @@ LinkLayerParser::State LinkLayerParser::ParseHeader()
     }
 }
 
-LinkLayerParser::State LinkLayerParser::ParseBody()
+LinkLayerParser::State LinkLayerParser::ParseBody(IFrameSink& sink)
 {
     if (buffer.NumBytesRead() < this->frameSize)
     {
         return State::ReadBody;
     }
 
+    // ask the destination for storage up front so that the user data is only copied once
+    const auto dest = sink.GetUserDataBuffer(this->GetFields(), header.GetLength() - LPDU_MIN_LENGTH);
+
     if (this->ValidateBody())
     {
-        this->TransferUserData();
+        this->TransferUserData(dest);
         return State::Complete;
     }
 
@@ -137,21 +188,26 @@ LinkLayerParser::State LinkLayerParser::ParseBody()
     return State::FindSync;
 }
 
-void LinkLayerParser::PushFrame(IFrameSink& sink)
+LinkHeaderFields LinkLayerParser::GetFields() const
 {
-    LinkHeaderFields fields(header.GetFuncEnum(), header.IsFromMaster(), header.IsFcbSet(), header.IsFcvDfcSet(),
+    return LinkHeaderFields(header.GetFuncEnum(), header.IsFromMaster(), header.IsFcbSet(), header.IsFcvDfcSet(),
                             Addresses(header.GetSrc(), header.GetDest()));
+}
 
-    sink.OnFrame(fields, userData);
+void LinkLayerParser::PushFrame(IFrameSink& sink)
+{
+    sink.OnFrame(this->GetFields(), userData);
 
     buffer.AdvanceRead(frameSize);
 }
 
-void LinkLayerParser::TransferUserData()
+void LinkLayerParser::TransferUserData(ser4cpp::wseq_t dest)
 {
     uint32_t len = header.GetLength() - LPDU_MIN_LENGTH;
-    LinkFrame::ReadUserData(buffer.ReadBuffer() + LPDU_HEADER_SIZE, rxBuffer, len);
-    userData = ser4cpp::rseq_t(rxBuffer, len);
+    // fall back to compacting the data within the receive buffer if the sink didn't provide storage
+    uint8_t* const pDest = (dest.length() < len) ? rxBuffer : static_cast<uint8_t*>(dest);
+    LinkFrame::ReadUserData(buffer.ReadBuffer() + LPDU_HEADER_SIZE, pDest, len);
+    userData = ser4cpp::rseq_t(pDest, len);
 }
 
 bool LinkLayerParser::ReadHeader()
@@ -174,12 +230,7 @@ bool LinkLayerParser::ValidateBody()
     uint32_t len = header.GetLength() - LPDU_MIN_LENGTH;
     if (LinkFrame::ValidateBodyCRC(buffer.ReadBuffer() + LPDU_HEADER_SIZE, len))
     {
-        FORMAT_LOG_BLOCK(logger, flags::LINK_RX, "Function: %s Dest: %u Source: %u Length: %u",
-                         LinkFunctionSpec::to_human_string(header.GetFuncEnum()), header.GetDest(), header.GetSrc(),
-                         header.GetLength());
-
-        FORMAT_HEX_BLOCK(logger, flags::LINK_RX_HEX, buffer.ReadBuffer().take(frameSize), 10, 18);
-
+        this->LogFrame();
         return true;
     }
 
@@ -188,6 +239,15 @@ bool LinkLayerParser::ValidateBody()
     return false;
 }
 
+void LinkLayerParser::LogFrame()
+{
+    FORMAT_LOG_BLOCK(logger, flags::LINK_RX, "Function: %s Dest: %u Source: %u Length: %u",
+                     LinkFunctionSpec::to_human_string(header.GetFuncEnum()), header.GetDest(), header.GetSrc(),
+                     header.GetLength());
+
+    FORMAT_HEX_BLOCK(logger, flags::LINK_RX_HEX, buffer.ReadBuffer().take(frameSize), 10, 18);
+}
+
 bool LinkLayerParser::ValidateHeaderParameters()
 {
     if (!header.ValidLength())
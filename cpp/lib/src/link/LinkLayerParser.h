@@ -60,6 +60,14 @@ public:
     /// Resets the state of parser
     void Reset();
 
+    /// Enables a fast path for channels like TCP and TLS that never corrupt or drop bytes. Each frame that is
+    /// completely buffered is checked and passed to the sink in one pass, and anything unusual is left to the
+    /// state machine.
+    void SetReliableTransport(bool value)
+    {
+        this->reliableTransport = value;
+    }
+
     const LinkStatistics::Parser& Statistics() const
     {
         return this->statistics;
@@ -76,11 +84,15 @@ public:
     }
 
 private:
-    State ParseUntilComplete();
-    State ParseOneStep();
+    bool ParseNextFrame(IFrameSink& sink);
+    bool ParseContiguousFrame(IFrameSink& sink);
+    State ParseUntilComplete(IFrameSink& sink);
+    State ParseOneStep(IFrameSink& sink);
     State ParseSync();
     State ParseHeader();
-    State ParseBody();
+    State ParseBody(IFrameSink& sink);
+
+    LinkHeaderFields GetFields() const;
 
     void PushFrame(IFrameSink& sink);
 
@@ -89,8 +101,9 @@ private:
     bool ValidateHeaderParameters();
     bool ValidateFunctionCode();
     void FailFrame();
+    void LogFrame();
 
-    void TransferUserData();
+    void TransferUserData(ser4cpp::wseq_t dest);
 
     Logger logger;
     LinkStatistics::Parser statistics;
@@ -98,6 +111,7 @@ private:
     LinkHeader header;
 
     State state;
+    bool reliableTransport = false;
     size_t frameSize;
     ser4cpp::rseq_t userData;
 
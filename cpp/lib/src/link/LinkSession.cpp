@@ -42,6 +42,8 @@ LinkSession::LinkSession(const Logger& logger,
       channel(channel),
       parser(logger)
 {
+    // sessions are only accepted by the TCP and TLS servers
+    this->parser.SetReliableTransport(true);
 }
 
 void LinkSession::Shutdown()
@@ -107,11 +109,17 @@ void LinkSession::OnWriteComplete(const std::error_code& ec, size_t /*num*/)
     }
 }
 
-bool LinkSession::BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& /*session*/)
+bool LinkSession::BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& /*session*/, uint32_t /*numFrames*/)
 {
     return this->channel->BeginWrite(buffer);
 }
 
+ser4cpp::wseq_t LinkSession::GetUserDataBuffer(const LinkHeaderFields& header, size_t length)
+{
+    // the first frame creates the stack, so it always goes through the parser's buffer
+    return this->stack ? this->stack->GetUserDataBuffer(header, length) : ser4cpp::wseq_t::empty();
+}
+
 bool LinkSession::OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata)
 {
     if (this->stack)
@@ -78,10 +78,11 @@ private:
     void OnWriteComplete(const std::error_code& ec, size_t num) final;
 
     // ILinkTx
-    bool BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& session) final;
+    bool BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& session, uint32_t numFrames) final;
 
     // IFrameSink
     bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) final;
+    ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length) final;
 
     // ISessionAcceptor
     std::shared_ptr<IMasterSession> AcceptSession(const std::string& loggerid,
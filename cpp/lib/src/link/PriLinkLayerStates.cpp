@@ -89,9 +89,16 @@ PLLS_Idle PLLS_Idle::instance;
 
 PriStateBase& PLLS_Idle::TrySendUnconfirmed(LinkContext& ctx, ITransportSegment& segments)
 {
-    auto first = segments.GetSegment();
-    auto output = ctx.FormatPrimaryBufferWithUnconfirmed(segments.GetAddresses(), first);
-    if (ctx.QueueTransmit(output, true))
+    // prefer writing the whole fragment at once
+    auto output = ctx.FormatFragmentBufferWithUnconfirmed(segments);
+    auto numFrames = segments.GetNumEncodedFrames();
+    if (output.is_empty())
+    {
+        output = ctx.FormatPrimaryBufferWithUnconfirmed(segments.GetAddresses(), segments.GetSegment());
+        numFrames = 1;
+    }
+
+    if (ctx.QueueTransmit(output, true, numFrames))
     {
         return PLLS_SendUnconfirmedTransmitWait::Instance();
     }
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "master/AdaptiveScanPolicy.h"
+
+#include <chrono>
+
+namespace opendnp3
+{
+
+TimeDuration AdaptiveScanPolicy::NextPeriod(const AdaptiveScanConfig& config,
+                                            const TimeDuration& current,
+                                            const Outcome& outcome)
+{
+    // back off on a busy channel even if the outstation has data, the extra polls would only queue up
+    if (IsCongested(config, outcome))
+    {
+        return Clamp(config, Scale(current, config.stretchFactor));
+    }
+
+    if (outcome.eventsPending || outcome.numValues > 0)
+    {
+        return Clamp(config, Scale(current, config.shrinkFactor));
+    }
+
+    return Clamp(config, Scale(current, config.stretchFactor));
+}
+
+bool AdaptiveScanPolicy::IsCongested(const AdaptiveScanConfig& config, const Outcome& outcome)
+{
+    const auto slow = config.slowResponse > TimeDuration::Zero() && outcome.responseTime >= config.slowResponse;
+    const auto waited
+        = config.congestedQueueWait > TimeDuration::Zero() && outcome.queueWait >= config.congestedQueueWait;
+    return slow || waited;
+}
+
+TimeDuration AdaptiveScanPolicy::Scale(const TimeDuration& period, double factor)
+{
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(period.value).count();
+    return TimeDuration::Milliseconds(static_cast<int64_t>(static_cast<double>(ms) * factor));
+}
+
+TimeDuration AdaptiveScanPolicy::Clamp(const AdaptiveScanConfig& config, const TimeDuration& period)
+{
+    if (period < config.minPeriod)
+    {
+        return config.minPeriod;
+    }
+
+    if (config.maxPeriod < period)
+    {
+        return config.maxPeriod;
+    }
+
+    return period;
+}
+
+} // namespace opendnp3
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_ADAPTIVESCANPOLICY_H
+#define OPENDNP3_ADAPTIVESCANPOLICY_H
+
+#include "opendnp3/master/AdaptiveScanConfig.h"
+#include "opendnp3/util/StaticOnly.h"
+#include "opendnp3/util/TimeDuration.h"
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+ * Computes the next period of an adaptive scan from the outcome of its last run
+ */
+class AdaptiveScanPolicy : private StaticOnly
+{
+public:
+    struct Outcome
+    {
+        // number of measurements the scan returned
+        uint32_t numValues = 0;
+        // the outstation reported events in the IIN class bits of the final response
+        bool eventsPending = false;
+        // time from the request to the final response
+        TimeDuration responseTime = TimeDuration::Zero();
+        // time the scan waited for the channel before it started
+        TimeDuration queueWait = TimeDuration::Zero();
+    };
+
+    static TimeDuration NextPeriod(const AdaptiveScanConfig& config, const TimeDuration& current, const Outcome& outcome);
+
+    static bool IsCongested(const AdaptiveScanConfig& config, const Outcome& outcome);
+
+private:
+    static TimeDuration Scale(const TimeDuration& period, double factor);
+
+    static TimeDuration Clamp(const AdaptiveScanConfig& config, const TimeDuration& period);
+};
+
+} // namespace opendnp3
+
+#endif
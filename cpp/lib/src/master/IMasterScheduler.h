@@ -23,6 +23,8 @@
 #include "master/IMasterTask.h"
 #include "master/IMasterTaskRunner.h"
 
+#include "opendnp3/master/MasterSchedulerConfig.h"
+
 namespace opendnp3
 {
 
@@ -73,6 +75,16 @@ public:
     }
 
     virtual void ChannelChanging(bool value) = 0;
+
+    /**
+     * Change the number of tasks that may run at the same time
+     */
+    virtual void Configure(const MasterSchedulerConfig& config) = 0;
+
+    /**
+     * Called when the channel switches between a full-duplex and a half-duplex (serial) physical layer
+     */
+    virtual void SetFullDuplex(bool value) = 0;
 };
 
 } // namespace opendnp3
@@ -23,6 +23,7 @@
 
 #include "opendnp3/logging/LogLevels.h"
 
+#include <algorithm>
 #include <utility>
 
 namespace opendnp3
@@ -60,6 +61,29 @@ Timestamp IMasterTask::StartExpirationTime() const
 IMasterTask::ResponseResult IMasterTask::OnResponse(const APDUResponseHeader& response,
                                                     const ser4cpp::rseq_t& objects,
                                                     Timestamp now)
+{
+    auto& statistics = this->context->Statistics(this->GetTaskType());
+    ++statistics.numResponses;
+    statistics.numBytesRx += APDUHeader::RESPONSE_SIZE + objects.length();
+    if (this->awaitingFirstResponse)
+    {
+        this->awaitingFirstResponse = false;
+        statistics.requestToFirstResponse.Record((now - this->started).value);
+    }
+
+    return this->HandleResponse(response, objects, now);
+}
+
+IMasterTask::ResponseResult IMasterTask::OnMergedResponse(const APDUResponseHeader& response,
+                                                          const ser4cpp::rseq_t& objects,
+                                                          Timestamp now)
+{
+    return this->HandleResponse(response, objects, now);
+}
+
+IMasterTask::ResponseResult IMasterTask::HandleResponse(const APDUResponseHeader& response,
+                                                        const ser4cpp::rseq_t& objects,
+                                                        Timestamp now)
 {
     auto result = this->ProcessResponse(response, objects);
 
@@ -80,6 +104,13 @@ IMasterTask::ResponseResult IMasterTask::OnResponse(const APDUResponseHeader& re
 
 void IMasterTask::CompleteTask(TaskCompletion result, Timestamp now)
 {
+    auto& statistics = this->context->Statistics(this->GetTaskType());
+    if (this->running)
+    {
+        this->running = false;
+        statistics.duration.Record((now - this->started).value);
+    }
+
     switch (result)
     {
 
@@ -99,6 +130,7 @@ void IMasterTask::CompleteTask(TaskCompletion result, Timestamp now)
         if (timeoutStats.IsFixedRetriesCount) {
             if (!timeoutStats.IsFinished) {
                 _retriesFinished = false;
+                ++statistics.numRetries;
                 FORMAT_LOG_BLOCK(
                     logger,
                     flags::WARN,
@@ -147,6 +179,15 @@ void IMasterTask::CompleteTask(TaskCompletion result, Timestamp now)
     }
     }
 
+    if (result == TaskCompletion::SUCCESS)
+    {
+        ++statistics.numSucceeded;
+    }
+    else
+    {
+        ++statistics.numFailed;
+    }
+
     if (config.pCallback)
     {
         config.pCallback->OnComplete(result, Name());
@@ -184,6 +225,11 @@ void IMasterTask::OnMessageFormatError(Timestamp now)
     this->CompleteTask(TaskCompletion::FAILURE_MESSAGE_FORMAT_ERROR, now);
 }
 
+void IMasterTask::OnBadResponse(Timestamp now)
+{
+    this->CompleteTask(TaskCompletion::FAILURE_BAD_RESPONSE, now);
+}
+
 bool IMasterTask::OnStart(Timestamp now)
 {
     if (config.pCallback)
@@ -194,6 +240,22 @@ bool IMasterTask::OnStart(Timestamp now)
     bool isTaskStarted = this->application->OnTaskStart(this->GetTaskType(), config.taskId);
     if (isTaskStarted)
     {
+        // the task became runnable when it was queued or when it expired, whichever is later
+        auto ready = std::max(this->queued, this->ExpirationTime());
+        if (ready > now)
+        {
+            ready = now;
+        }
+
+        auto& statistics = this->context->Statistics(this->GetTaskType());
+        ++statistics.numStarted;
+        this->queueWait = now - ready;
+        statistics.queueWait.Record(this->queueWait.value);
+
+        this->started = now;
+        this->running = true;
+        this->awaitingFirstResponse = true;
+
         this->Initialize();
     }
     else
@@ -203,6 +265,11 @@ bool IMasterTask::OnStart(Timestamp now)
     return isTaskStarted;
 }
 
+void IMasterTask::OnQueued(Timestamp now)
+{
+    this->queued = now;
+}
+
 void IMasterTask::SetMinExpiration()
 {
     this->behavior.Reset();
@@ -228,6 +295,21 @@ void IMasterTask::DelayByPeriod(const Timestamp& now)
     this->behavior.DelayByPeriod(now);
 }
 
+TimeDuration IMasterTask::GetPeriod() const
+{
+    return this->behavior.GetPeriod();
+}
+
+void IMasterTask::AdjustPeriod(const TimeDuration& period, Timestamp now)
+{
+    this->behavior.AdjustPeriod(period, now);
+}
+
+void IMasterTask::RecordObjects(uint32_t count)
+{
+    this->context->Statistics(this->GetTaskType()).numObjects += count;
+}
+
 bool IMasterTask::ValidateSingleResponse(const APDUResponseHeader& header)
 {
     if (header.control.FIR && header.control.FIN)
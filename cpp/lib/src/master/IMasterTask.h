@@ -35,6 +35,8 @@
 namespace opendnp3
 {
 
+class ISOEHandler;
+
 /**
  * A generic interface for defining master request/response style tasks
  */
@@ -113,6 +115,12 @@ public:
      */
     ResponseResult OnResponse(const APDUResponseHeader& response, const ser4cpp::rseq_t& objects, Timestamp now);
 
+    /**
+     * Handler for responses to a request this task was merged into. The response statistics are only recorded by
+     * the task that owns the request, so a shared response is counted once.
+     */
+    ResponseResult OnMergedResponse(const APDUResponseHeader& response, const ser4cpp::rseq_t& objects, Timestamp now);
+
     /**
      * Called when a response times out
      */
@@ -133,11 +141,22 @@ public:
      */
     void OnMessageFormatError(Timestamp now);
 
+    /**
+     * Called when a merged task still expects fragments after the task owning the request ended, which means the
+     * response sequence it was following was cut short
+     */
+    void OnBadResponse(Timestamp now);
+
     /**
      * Called when the task first starts, before the first request is formatted
      */
     bool OnStart(Timestamp now);
 
+    /**
+     * Called by the scheduler when the task is queued or demanded, used to measure queue wait
+     */
+    void OnQueued(Timestamp now);
+
     /**
      * Set the expiration time to minimum. The scheduler must also be informed
      */
@@ -150,6 +169,31 @@ public:
 
     virtual MasterTaskType GetTaskType() const = 0;
 
+    /**
+     * Append the object headers of this task to a READ request formatted by another task, so that polls that fall
+     * due together share a single request.
+     *
+     * Return false if the task can't be merged or its headers don't fit.
+     */
+    virtual bool AppendMergedHeaders(HeaderWriter& /*writer*/)
+    {
+        return false;
+    }
+
+    /**
+     * The handler that receives the measurements of a poll task, if any
+     */
+    virtual ISOEHandler* GetMeasurementHandler() const
+    {
+        return nullptr;
+    }
+
+    /**
+     * Merged polls share the handler of the task whose request they joined, which delivers each response to it once.
+     * The merged polls just track the response sequence. Reset to true each time the task starts.
+     */
+    virtual void SetDeliverMeasurements(bool /*value*/) {}
+
     bool CanBeExecutedOnBackupChannel() const;
 
     bool OutOfRetries() const;
@@ -164,10 +208,31 @@ protected:
 
     void CompleteTask(TaskCompletion result, Timestamp now);
 
+    ResponseResult HandleResponse(const APDUResponseHeader& response, const ser4cpp::rseq_t& objects, Timestamp now);
+
     virtual void OnTaskComplete(TaskCompletion result, Timestamp now) {}
 
     virtual bool IsEnabled() const;
 
+    // record the number of measurement values parsed from a response
+    void RecordObjects(uint32_t count);
+
+    TimeDuration GetPeriod() const;
+
+    // change the period of a periodic task after it succeeds
+    void AdjustPeriod(const TimeDuration& period, Timestamp now);
+
+    // how long the current run waited to start after becoming runnable
+    TimeDuration GetQueueWait() const
+    {
+        return queueWait;
+    }
+
+    Timestamp GetStartTime() const
+    {
+        return started;
+    }
+
     const std::shared_ptr<TaskContext> context;
     IMasterApplication* const application;
     Logger logger;
@@ -188,6 +253,12 @@ private:
 
     TaskBehavior behavior;
     bool _retriesFinished{ false };
+
+    Timestamp queued;
+    Timestamp started;
+    TimeDuration queueWait;
+    bool running{ false };
+    bool awaitingFirstResponse{ false };
 };
 
 } // namespace opendnp3
@@ -22,6 +22,9 @@
 
 #include "master/IMasterTask.h"
 
+#include <memory>
+#include <vector>
+
 namespace opendnp3
 {
 
@@ -39,6 +42,18 @@ public:
      * @return true if the task can be started, false otherwise
      */
     virtual bool Run(const std::shared_ptr<IMasterTask>& task) = 0;
+
+    /**
+     * Start running the task with other poll tasks merged into its request
+     *
+     * @param merged candidates for merging. On return, contains only the tasks that were merged and are running.
+     * @return true if the task can be started, false otherwise
+     */
+    virtual bool Run(const std::shared_ptr<IMasterTask>& task, std::vector<std::shared_ptr<IMasterTask>>& merged)
+    {
+        merged.clear();
+        return this->Run(task);
+    }
 };
 
 } // namespace opendnp3
@@ -39,6 +39,8 @@
 #include "opendnp3/logging/LogLevels.h"
 #include "transport/TransportHeader.h"
 
+#include <algorithm>
+#include <cassert>
 #include <utility>
 
 namespace opendnp3
@@ -138,6 +140,7 @@ bool MContext::OnLowerLayerDown()
     solSeq = unsolSeq = 0;
     isOnline = isSending = false;
     activeTask.reset();
+    mergedTasks.clear();
 
     this->scheduler->SetRunnerOffline(*this);
     this->application->OnClose();
@@ -166,6 +169,8 @@ bool MContext::OnReceive(const Message& message)
         return false;
     }
 
+    const auto received = this->latency ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
     const auto result = APDUHeaderParser::ParseResponse(message.payload, &this->logger);
     if (!result.success)
     {
@@ -174,7 +179,17 @@ bool MContext::OnReceive(const Message& message)
 
     logging::LogHeader(this->logger, flags::APP_HEADER_RX, result.header);
 
-    this->OnParsedHeader(message.payload, result.header, result.objects);
+    if (this->latency)
+    {
+        const auto parsed = std::chrono::steady_clock::now();
+        this->latency->fragmentToParsed.Record(parsed - received);
+        this->OnParsedHeader(message.payload, result.header, result.objects);
+        this->latency->parsedToDispatched.Record(std::chrono::steady_clock::now() - parsed);
+    }
+    else
+    {
+        this->OnParsedHeader(message.payload, result.header, result.objects);
+    }
 
     return true;
 }
@@ -205,6 +220,8 @@ void MContext::OnResponseTimeout()
 
 void MContext::CompleteActiveTask()
 {
+    // every merged task has been completed by the caller at this point
+    assert(this->mergedTasks.empty());
     this->activeTask.reset();
     this->scheduler->CompleteCurrentFor(*this);
 }
@@ -417,6 +434,11 @@ void MContext::AddStatisticsHandler(const StatisticsChangeHandler_t& changeHandl
     statisticsChangeHandler = changeHandler;
 }
 
+void MContext::SetLatencyTracing(StackStatistics::Latency& latency)
+{
+    this->latency = &latency;
+}
+
 void MContext::RemoveStatisticsHandler()
 {
     std::lock_guard<std::mutex> lock{ _mtx };
@@ -579,6 +601,8 @@ bool MContext::Run(const std::shared_ptr<IMasterTask>& task)
     else {
         FORMAT_LOG_BLOCK(logger, flags::INFO, "Begining task: %s", this->activeTask->Name())
 
+        this->StartMergedTasks(Timestamp(executor->get_time()));
+
         if (!this->isSending)
         {
             this->tstate = this->ResumeActiveTask();
@@ -587,8 +611,100 @@ bool MContext::Run(const std::shared_ptr<IMasterTask>& task)
     return true;
 }
 
+bool MContext::Run(const std::shared_ptr<IMasterTask>& task, std::vector<std::shared_ptr<IMasterTask>>& merged)
+{
+    if (!merged.empty() && !this->activeTask && this->tstate == TaskState::IDLE)
+    {
+        this->SelectMergedTasks(task, merged);
+        this->pendingMerge = merged;
+    }
+
+    merged.clear();
+
+    const auto result = this->Run(task);
+    this->pendingMerge.clear();
+
+    if (result && this->activeTask == task)
+    {
+        merged = this->mergedTasks;
+    }
+
+    return result;
+}
+
 /// ------ private helpers ----------
 
+void MContext::SelectMergedTasks(const std::shared_ptr<IMasterTask>& task,
+                                 std::vector<std::shared_ptr<IMasterTask>>& candidates)
+{
+    // format the request into a scratch buffer to find out which polls fit alongside the task
+    ser4cpp::Buffer scratch(this->params.maxTxFragSize);
+    APDURequest request(scratch.as_wslice());
+
+    if (!task->BuildRequest(request, this->solSeq) || request.GetFunction() != FunctionCode::READ)
+    {
+        candidates.clear();
+        return;
+    }
+
+    auto writer = request.GetWriter();
+
+    // the handler of the task receives the whole response, so only its own polls can share the request
+    auto cannotMerge = [&writer, handler = task->GetMeasurementHandler()](const std::shared_ptr<IMasterTask>& candidate) {
+        if (candidate->GetMeasurementHandler() != handler)
+        {
+            return true;
+        }
+
+        writer.Mark();
+        if (candidate->AppendMergedHeaders(writer))
+        {
+            return false;
+        }
+
+        writer.Rollback();
+        return true;
+    };
+
+    candidates.erase(std::remove_if(candidates.begin(), candidates.end(), cannotMerge), candidates.end());
+}
+
+void MContext::StartMergedTasks(Timestamp now)
+{
+    for (const auto& task : this->pendingMerge)
+    {
+        if (task->OnStart(now))
+        {
+            FORMAT_LOG_BLOCK(logger, flags::INFO, "Merging task: %s", task->Name())
+            // the active task already delivers the response to the shared handler
+            task->SetDeliverMeasurements(false);
+            this->mergedTasks.push_back(task);
+        }
+    }
+
+    this->pendingMerge.clear();
+}
+
+void MContext::AppendMergedTasks(APDURequest& request, Timestamp now)
+{
+    auto writer = request.GetWriter();
+
+    auto failed = [&writer, now](const std::shared_ptr<IMasterTask>& task) {
+        writer.Mark();
+        if (task->AppendMergedHeaders(writer))
+        {
+            return false;
+        }
+
+        writer.Rollback();
+        task->OnMessageFormatError(now);
+        return true;
+    };
+
+    this->mergedTasks.erase(std::remove_if(this->mergedTasks.begin(), this->mergedTasks.end(), failed),
+                            this->mergedTasks.end());
+}
+
 void MContext::ScheduleRecurringPollTask(const std::shared_ptr<IMasterTask>& task)
 {
     this->tasks.BindTask(task);
@@ -625,11 +741,22 @@ MContext::TaskState MContext::ResumeActiveTask()
     /// try to build a requst for the task
     if (!this->activeTask->BuildRequest(request, this->solSeq))
     {
-        activeTask->OnMessageFormatError(Timestamp(executor->get_time()));
+        const auto now = Timestamp(executor->get_time());
+        activeTask->OnMessageFormatError(now);
+        for (const auto& task : this->mergedTasks)
+        {
+            task->OnMessageFormatError(now);
+        }
+        this->mergedTasks.clear();
         this->CompleteActiveTask();
         return TaskState::IDLE;
     }
 
+    if (!this->mergedTasks.empty())
+    {
+        this->AppendMergedTasks(request, Timestamp(executor->get_time()));
+    }
+
     this->StartResponseTimer();
     auto apdu = request.ToRSeq();
     this->RecordLastRequest(apdu);
@@ -708,6 +835,13 @@ MContext::TaskState MContext::OnResponse_WaitForResponse(const APDUResponseHeade
 
     const auto result = this->activeTask->OnResponse(header, objects, now);
 
+    // merged polls follow the same response sequence until they complete
+    auto completed = [&](const std::shared_ptr<IMasterTask>& task) {
+        return task->OnMergedResponse(header, objects, now) != IMasterTask::ResponseResult::OK_CONTINUE;
+    };
+    this->mergedTasks.erase(std::remove_if(this->mergedTasks.begin(), this->mergedTasks.end(), completed),
+                            this->mergedTasks.end());
+
     if (header.control.CON)
     {
         this->QueueConfirm(APDUHeader::SolicitedConfirm(header.control.SEQ));
@@ -727,6 +861,13 @@ MContext::TaskState MContext::OnResponse_WaitForResponse(const APDUResponseHeade
                 this->activeTask->GetTaskType() == MasterTaskType::USER_POLL
             );
         }
+        // merged polls can't receive the rest of a response sequence the active task abandoned
+        for (const auto& task : this->mergedTasks)
+        {
+            task->OnBadResponse(now);
+        }
+        this->mergedTasks.clear();
+
         // task completed or failed, either way go back to idle
         this->CompleteActiveTask();
         return TaskState::IDLE;
@@ -739,6 +880,11 @@ MContext::TaskState MContext::OnResponseTimeout_WaitForResponse()
 
     const auto now = Timestamp(this->executor->get_time());
     this->activeTask->OnResponseTimeout(now);
+    for (const auto& task : this->mergedTasks)
+    {
+        task->OnResponseTimeout(now);
+    }
+    this->mergedTasks.clear();
     this->solSeq.Increment();
     if (this->activeTask->OutOfRetries() && this->iohandlersManager)
     {
@@ -26,6 +26,7 @@
 #include "master/HeaderBuilder.h"
 #include "master/IMasterScheduler.h"
 #include "master/MasterTasks.h"
+#include "opendnp3/StackStatistics.h"
 #include "opendnp3/StatisticsTypes.h"
 
 #include "opendnp3/app/MeasurementTypes.h"
@@ -45,6 +46,7 @@
 
 #include <deque>
 #include <memory>
+#include <vector>
 
 namespace opendnp3
 {
@@ -101,6 +103,9 @@ public:
     AppSeqNum solSeq;
     AppSeqNum unsolSeq;
     std::shared_ptr<IMasterTask> activeTask;
+    // polls merged into the request of the active task
+    std::vector<std::shared_ptr<IMasterTask>> mergedTasks;
+    std::vector<std::shared_ptr<IMasterTask>> pendingMerge;
     exe4cpp::Timer responseTimer;
 
     MasterTasks tasks;
@@ -200,11 +205,23 @@ public:
     void AddStatisticsHandler(const StatisticsChangeHandler_t& changeHandler);
     void RemoveStatisticsHandler();
 
+    void SetLatencyTracing(StackStatistics::Latency& latency);
+
 private:
     // --- implement  IMasterTaskRunner ------
 
     virtual bool Run(const std::shared_ptr<IMasterTask>& task) override;
 
+    virtual bool Run(const std::shared_ptr<IMasterTask>& task,
+                     std::vector<std::shared_ptr<IMasterTask>>& merged) override;
+
+    void SelectMergedTasks(const std::shared_ptr<IMasterTask>& task,
+                           std::vector<std::shared_ptr<IMasterTask>>& candidates);
+
+    void StartMergedTasks(Timestamp now);
+
+    void AppendMergedTasks(APDURequest& request, Timestamp now);
+
     void ScheduleRecurringPollTask(const std::shared_ptr<IMasterTask>& task);
 
     void ProcessIIN(const IINField& iin);
@@ -260,6 +277,9 @@ private:
 
     std::shared_ptr<IOHandlersManager> iohandlersManager;
 
+    // receive path histograms, only set when latency tracing is enabled
+    StackStatistics::Latency* latency = nullptr;
+
     std::mutex _mtx;
 };
 
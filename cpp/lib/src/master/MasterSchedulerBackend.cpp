@@ -20,6 +20,7 @@
 #include "MasterSchedulerBackend.h"
 
 #include <algorithm>
+#include <limits>
 
 namespace opendnp3
 {
@@ -33,7 +34,7 @@ void MasterSchedulerBackend::Shutdown()
     std::lock_guard<std::mutex> lock{ _mtx };
     this->isShutdown = true;
     this->tasks.clear();
-    this->current.Clear();
+    this->running.clear();
     this->taskTimer.cancel();
     this->taskStartTimeout.cancel();
     this->executor.reset();
@@ -67,10 +68,9 @@ void MasterSchedulerBackend::SetRunnerOffline(const IMasterTaskRunner& runner)
         return false;
     };
 
-    if (this->current && checkForOwnership(this->current))
-        this->current.Clear();
-
     // move erase idiom
+    this->running.erase(std::remove_if(this->running.begin(), this->running.end(), checkForOwnership),
+                        this->running.end());
     this->tasks.erase(std::remove_if(this->tasks.begin(), this->tasks.end(), checkForOwnership), this->tasks.end());
 
     this->PostCheckForTaskRun();
@@ -79,21 +79,26 @@ void MasterSchedulerBackend::SetRunnerOffline(const IMasterTaskRunner& runner)
 bool MasterSchedulerBackend::CompleteCurrentFor(const IMasterTaskRunner& runner)
 {
     std::lock_guard<std::mutex> lock{ _mtx };
-    // no active task
-    if (!this->current)
-        return false;
 
-    // active task not for this runner
-    if (!this->current.BelongsTo(runner))
+    // the runner may have several polls merged into a single request
+    const auto first = std::stable_partition(this->running.begin(), this->running.end(),
+                                             [&runner](const Record& record) { return !record.BelongsTo(runner); });
+
+    // no active task for this runner
+    if (first == this->running.end())
         return false;
 
-    if (this->current.task->IsRecurring())
+    const std::vector<Record> completed(first, this->running.end());
+    this->running.erase(first, this->running.end());
+
+    for (const auto& current : completed)
     {
-        this->add(this->current.task, *this->current.runner);
+        if (current.task->IsRecurring())
+        {
+            this->add(current.task, *current.runner);
+        }
     }
 
-    this->current.Clear();
-
     this->PostCheckForTaskRun();
 
     return true;
@@ -104,6 +109,7 @@ void MasterSchedulerBackend::Demand(const std::shared_ptr<IMasterTask>& task)
     std::lock_guard<std::mutex> lock{ _mtx };
     auto callback = [this, task, self = shared_from_this()]() {
         task->SetMinExpiration();
+        task->OnQueued(Timestamp(this->executor->get_time()));
         this->CheckForTaskRun();
     };
 
@@ -121,6 +127,21 @@ void MasterSchedulerBackend::ChannelChanging(bool value)
     tasksPaused = value;
 }
 
+void MasterSchedulerBackend::Configure(const MasterSchedulerConfig& config)
+{
+    std::lock_guard<std::mutex> lock{ _mtx };
+    this->config = config;
+    this->PostCheckForTaskRun();
+}
+
+void MasterSchedulerBackend::SetFullDuplex(bool value)
+{
+    std::lock_guard<std::mutex> lock{ _mtx };
+    this->fullDuplex = value;
+    // switching to full-duplex may unblock tasks waiting on another master
+    this->PostCheckForTaskRun();
+}
+
 void MasterSchedulerBackend::PostCheckForTaskRun()
 {
     if (!this->taskCheckPending)
@@ -139,37 +160,69 @@ bool MasterSchedulerBackend::CheckForTaskRun()
 
     this->RestartTimeoutTimer();
 
-    if (this->current)
-        return false;
-
     const auto now = Timestamp(this->executor->get_time());
 
-    // try to find a task that can run
-    auto currentIt = this->tasks.begin();
-    auto best_task = currentIt;
-    if (currentIt == this->tasks.end())
-        return false;
-    ++currentIt;
+    bool started = false;
 
-    while (currentIt != this->tasks.end())
+    while (!this->isShutdown && (this->running.size() < this->MaxRunningTasks()))
     {
-        if (GetBestTaskToRun(now, *best_task, *currentIt) == Comparison::RIGHT)
+        if (!this->StartNextTask(now))
         {
-            best_task = currentIt;
+            break;
         }
 
-        ++currentIt;
+        started = true;
     }
 
+    return started;
+}
+
+bool MasterSchedulerBackend::StartNextTask(const Timestamp& now)
+{
+    // try to find a task that can run, skipping runners that already have a task in flight
+    auto best_task = this->tasks.end();
+
+    for (auto currentIt = this->tasks.begin(); currentIt != this->tasks.end(); ++currentIt)
+    {
+        if (this->IsRunning(*currentIt->runner))
+        {
+            continue;
+        }
+
+        if (best_task == this->tasks.end() || GetBestTaskToRun(now, *best_task, *currentIt) == Comparison::RIGHT)
+        {
+            best_task = currentIt;
+        }
+    }
+
+    if (best_task == this->tasks.end())
+        return false;
+
     // is the task runnable now?
     const auto is_expired = now >= best_task->task->ExpirationTime();
     if (is_expired && !this->tasksPaused)
     {
-        this->current = *best_task;
+        const auto record = *best_task;
+        auto merged = this->GetMergeCandidates(now, record);
         this->tasks.erase(best_task);
-        if (!this->current.runner->Run(this->current.task))
+        this->running.push_back(record);
+        if (!record.runner->Run(record.task, merged))
+        {
+            // the runner may have already completed the task
+            this->running.erase(std::remove_if(this->running.begin(), this->running.end(),
+                                               [&record](const Record& running) {
+                                                   return running.task == record.task;
+                                               }),
+                                this->running.end());
+        }
+
+        // polls merged into the request run alongside the task
+        for (const auto& task : merged)
         {
-            this->current.Clear();
+            this->tasks.erase(std::remove_if(this->tasks.begin(), this->tasks.end(),
+                                             [&task](const Record& queued) { return queued.task == task; }),
+                              this->tasks.end());
+            this->running.emplace_back(task, *record.runner);
         }
 
         return true;
@@ -183,6 +236,60 @@ bool MasterSchedulerBackend::CheckForTaskRun()
     return false;
 }
 
+size_t MasterSchedulerBackend::MaxRunningTasks() const
+{
+    // half-duplex links can only ever have a single request in flight
+    if (!this->fullDuplex || !this->config.concurrentTasksPerMaster)
+    {
+        return 1;
+    }
+
+    return (this->config.maxConcurrentTasks == 0) ? std::numeric_limits<size_t>::max()
+                                                  : this->config.maxConcurrentTasks;
+}
+
+bool MasterSchedulerBackend::IsRunning(const IMasterTaskRunner& runner) const
+{
+    return std::any_of(this->running.begin(), this->running.end(),
+                       [&runner](const Record& record) { return record.BelongsTo(runner); });
+}
+
+std::vector<std::shared_ptr<IMasterTask>> MasterSchedulerBackend::GetMergeCandidates(const Timestamp& now,
+                                                                                     const Record& record) const
+{
+    std::vector<std::shared_ptr<IMasterTask>> candidates;
+
+    if (this->config.pollMergeWindow <= TimeDuration::Zero() || record.task->GetTaskType() != MasterTaskType::USER_POLL)
+    {
+        return candidates;
+    }
+
+    const auto horizon = now + this->config.pollMergeWindow;
+
+    std::vector<Record> due;
+    for (const auto& queued : this->tasks)
+    {
+        if (queued.BelongsTo(*record.runner) && queued.task != record.task
+            && queued.task->GetTaskType() == MasterTaskType::USER_POLL && queued.task->IsRecurring()
+            && !queued.task->IsBlocked() && queued.task->ExpirationTime() <= horizon)
+        {
+            due.push_back(queued);
+        }
+    }
+
+    // the polls that are due soonest get the space in the request first
+    std::stable_sort(due.begin(), due.end(), [now](const Record& left, const Record& right) {
+        return CompareTime(now, left, right) == Comparison::LEFT;
+    });
+
+    for (const auto& queued : due)
+    {
+        candidates.push_back(queued.task);
+    }
+
+    return candidates;
+}
+
 void MasterSchedulerBackend::RestartTimeoutTimer()
 {
     if (this->isShutdown)
@@ -236,6 +343,7 @@ void MasterSchedulerBackend::add(const std::shared_ptr<IMasterTask>& task, IMast
     if (this->isShutdown)
         return;
 
+    task->OnQueued(Timestamp(this->executor->get_time()));
     this->tasks.emplace_back(task, runner);
     this->PostCheckForTaskRun();
 }
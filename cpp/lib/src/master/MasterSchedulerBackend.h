@@ -81,18 +81,34 @@ public:
 
     void ChannelChanging(bool value) override;
 
+    void Configure(const MasterSchedulerConfig& config) override;
+
+    void SetFullDuplex(bool value) override;
+
 private:
     bool isShutdown = false;
     bool taskCheckPending = false;
     bool tasksPaused = false;
+    bool fullDuplex = false;
 
-    Record current;
+    MasterSchedulerConfig config;
+
+    // tasks in flight, a single task or a set of merged polls per runner
+    std::vector<Record> running;
     std::vector<Record> tasks;
 
     void PostCheckForTaskRun();
 
     bool CheckForTaskRun();
 
+    bool StartNextTask(const Timestamp& now);
+
+    size_t MaxRunningTasks() const;
+
+    bool IsRunning(const IMasterTaskRunner& runner) const;
+
+    std::vector<std::shared_ptr<IMasterTask>> GetMergeCandidates(const Timestamp& now, const Record& record) const;
+
     void RestartTimeoutTimer();
 
     void TimeoutTasks();
@@ -64,6 +64,12 @@ MasterSessionStack::MasterSessionStack(const Logger& logger,
 {
     stack.link->SetRouter(linktx);
     stack.transport->SetAppLayer(*context);
+
+    if (config.master.traceLatency)
+    {
+        stack.transport->SetLatencyTracing(this->latency);
+        context->SetLatencyTracing(this->latency);
+    }
 }
 
 void MasterSessionStack::AddStatisticsHandler(const StatisticsChangeHandler_t& changeHandler)
@@ -91,6 +97,11 @@ bool MasterSessionStack::OnFrame(const LinkHeaderFields& header, const ser4cpp::
     return stack.link->OnFrame(header, userdata);
 }
 
+ser4cpp::wseq_t MasterSessionStack::GetUserDataBuffer(const LinkHeaderFields& header, size_t length) const
+{
+    return stack.link->GetUserDataBuffer(header, length);
+}
+
 void MasterSessionStack::OnTxReady() const
 {
     this->stack.link->OnTxReady();
@@ -129,6 +140,14 @@ StackStatistics MasterSessionStack::GetStackStatistics()
     return executor->return_from<StackStatistics>(get);
 }
 
+MasterTaskStatistics MasterSessionStack::GetTaskStatistics()
+{
+    auto get = [self = shared_from_this()]() -> MasterTaskStatistics {
+        return self->context->tasks.context->GetStatistics();
+    };
+    return executor->return_from<MasterTaskStatistics>(get);
+}
+
 std::shared_ptr<IMasterScan> MasterSessionStack::AddScan(TimeDuration period,
                                                          const std::vector<Header>& headers,
                                                          std::shared_ptr<ISOEHandler> soe_handler,
@@ -346,7 +365,9 @@ void MasterSessionStack::Operate(CommandSet&& commands,
 
 StackStatistics MasterSessionStack::CreateStatistics() const
 {
-    return StackStatistics(this->stack.link->GetStatistics(), this->stack.transport->GetStatistics());
+    StackStatistics statistics(this->stack.link->GetStatistics(), this->stack.transport->GetStatistics());
+    statistics.latency = this->latency;
+    return statistics;
 }
 
 } // namespace opendnp3
@@ -57,6 +57,8 @@ public:
 
     bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) const;
 
+    ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length) const;
+
     void OnTxReady() const;
 
     void SetLogFilters(const opendnp3::LogLevels& filters) final;
@@ -68,6 +70,7 @@ public:
     /// --- ICommandOperations ---
 
     StackStatistics GetStackStatistics() final;
+    MasterTaskStatistics GetTaskStatistics() final;
     std::shared_ptr<IMasterScan> AddScan(TimeDuration period,
                                          const std::vector<Header>& headers,
                                          std::shared_ptr<ISOEHandler> soe_handler,
@@ -149,6 +152,7 @@ private:
 
     TransportStack stack;
     std::shared_ptr<MContext> context;
+    StackStatistics::Latency latency;
 };
 
 } // namespace opendnp3
@@ -54,6 +54,11 @@ MasterStack::MasterStack(const Logger& logger,
                iohandlersManager))
 {
     tstack.transport->SetAppLayer(*mcontext);
+
+    if (config.master.traceLatency)
+    {
+        mcontext->SetLatencyTracing(this->EnableLatencyTracing());
+    }
 }
 
 bool MasterStack::Enable()
@@ -79,7 +84,15 @@ StackStatistics MasterStack::GetStackStatistics()
     return this->executor->return_from<StackStatistics>(get);
 }
 
-bool MasterStack::BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& /*context*/)
+MasterTaskStatistics MasterStack::GetTaskStatistics()
+{
+    auto get = [self = shared_from_this()]() -> MasterTaskStatistics {
+        return self->mcontext->tasks.context->GetStatistics();
+    };
+    return this->executor->return_from<MasterTaskStatistics>(get);
+}
+
+bool MasterStack::BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& /*context*/, uint32_t numFrames)
 {
     if (this->iohandlersManager)
     {
@@ -90,7 +103,7 @@ bool MasterStack::BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& /*c
         }
         if (const auto current = this->iohandlersManager->GetCurrent())
         {
-            return current->BeginTransmit(shared_from_this(), buffer);
+            return current->BeginTransmit(shared_from_this(), buffer, numFrames);
         }
     }
     return false;
@@ -77,6 +77,7 @@ public:
     void Shutdown() override;
 
     StackStatistics GetStackStatistics() override;
+    MasterTaskStatistics GetTaskStatistics() override;
 
     // --------- Implement ILinkSession ---------
 
@@ -100,7 +101,12 @@ public:
         return this->tstack.link->OnFrame(header, userdata);
     }
 
-    bool BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& context) override;
+    ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length) override
+    {
+        return this->tstack.link->GetUserDataBuffer(header, length);
+    }
+
+    bool BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& context, uint32_t numFrames) override;
 
     void OnResponseTimeout() override;
 
@@ -28,10 +28,16 @@ namespace opendnp3
 ParseResult MeasurementHandler::ProcessMeasurements(ResponseInfo info,
                                                     const ser4cpp::rseq_t& objects,
                                                     Logger& logger,
-                                                    ISOEHandler* pHandler)
+                                                    ISOEHandler* pHandler,
+                                                    uint32_t* pNumValues)
 {
     MeasurementHandler handler(info, logger, pHandler);
-    return APDUParser::Parse(objects, handler, &logger);
+    const auto result = APDUParser::Parse(objects, handler, &logger);
+    if (pNumValues)
+    {
+        *pNumValues = handler.numValues;
+    }
+    return result;
 }
 
 MeasurementHandler::MeasurementHandler(ResponseInfo info, const Logger& logger, ISOEHandler* pSOEHandler)
@@ -72,9 +78,13 @@ IINField MeasurementHandler::ProcessHeader(const CountHeader& header, const ICol
     auto transform = [](const Group50Var1& input) -> DNPTime { return input.time; };
 
     auto collection = Map<Group50Var1, DNPTime>(values, transform);
+    this->numValues += static_cast<uint32_t>(values.Count());
 
-    HeaderInfo info(header.enumeration, header.GetQualifierCode(), TimestampQuality::INVALID, header.headerIndex);
-    this->pSOEHandler->Process(info, collection);
+    if (pSOEHandler)
+    {
+        HeaderInfo info(header.enumeration, header.GetQualifierCode(), TimestampQuality::INVALID, header.headerIndex);
+        this->pSOEHandler->Process(info, collection);
+    }
 
     return IINField();
 }
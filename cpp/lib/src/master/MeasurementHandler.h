@@ -42,12 +42,14 @@ class MeasurementHandler final : public IAPDUHandler
 
 public:
     /**
-     * Static helper function for interpreting a response as a measurement response
+     * Static helper function for interpreting a response as a measurement response. A null handler only counts
+     * the values.
      */
     static ParseResult ProcessMeasurements(ResponseInfo info,
                                            const ser4cpp::rseq_t& objects,
                                            Logger& logger,
-                                           ISOEHandler* pHandler);
+                                           ISOEHandler* pHandler,
+                                           uint32_t* pNumValues = nullptr);
 
     // TODO
     virtual bool IsAllowed(uint32_t headerCount, GroupVariation gv, QualifierCode qc) override
@@ -111,8 +113,12 @@ private:
     IINField LoadValues(const HeaderRecord& record, TimestampQuality tsquality, const ICollection<Indexed<T>>& values)
     {
         this->CheckForTxStart();
-        HeaderInfo info(record.enumeration, record.GetQualifierCode(), tsquality, record.headerIndex);
-        this->pSOEHandler->Process(info, values);
+        this->numValues += static_cast<uint32_t>(values.Count());
+        if (pSOEHandler)
+        {
+            HeaderInfo info(record.enumeration, record.GetQualifierCode(), tsquality, record.headerIndex);
+            this->pSOEHandler->Process(info, values);
+        }
         return IINField();
     }
 
@@ -120,6 +126,7 @@ private:
 
     bool txInitiated;
     ISOEHandler* pSOEHandler;
+    uint32_t numValues = 0;
 
     DNPTime commonTimeOccurence;
 
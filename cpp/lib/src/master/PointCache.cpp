@@ -0,0 +1,447 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "opendnp3/master/PointCache.h"
+
+#include "util/MappedRegion.h"
+
+#include "opendnp3/ErrorCodes.h"
+
+#include <chrono>
+#include <cstring>
+#include <new>
+
+namespace opendnp3
+{
+
+template<class T> struct PointCacheTraits;
+
+template<> struct PointCacheTraits<Binary>
+{
+    using Storage = uint8_t;
+    static const PointCacheType type = PointCacheType::Binary;
+    static Storage Get(const Binary& meas)
+    {
+        return meas.value ? 1 : 0;
+    }
+};
+
+template<> struct PointCacheTraits<DoubleBitBinary>
+{
+    using Storage = uint8_t;
+    static const PointCacheType type = PointCacheType::DoubleBitBinary;
+    static Storage Get(const DoubleBitBinary& meas)
+    {
+        return static_cast<Storage>(meas.value);
+    }
+};
+
+template<> struct PointCacheTraits<Analog>
+{
+    using Storage = double;
+    static const PointCacheType type = PointCacheType::Analog;
+    static Storage Get(const Analog& meas)
+    {
+        return meas.value;
+    }
+};
+
+template<> struct PointCacheTraits<Counter>
+{
+    using Storage = uint32_t;
+    static const PointCacheType type = PointCacheType::Counter;
+    static Storage Get(const Counter& meas)
+    {
+        return meas.value;
+    }
+};
+
+template<> struct PointCacheTraits<FrozenCounter>
+{
+    using Storage = uint32_t;
+    static const PointCacheType type = PointCacheType::FrozenCounter;
+    static Storage Get(const FrozenCounter& meas)
+    {
+        return meas.value;
+    }
+};
+
+template<> struct PointCacheTraits<BinaryOutputStatus>
+{
+    using Storage = uint8_t;
+    static const PointCacheType type = PointCacheType::BinaryOutputStatus;
+    static Storage Get(const BinaryOutputStatus& meas)
+    {
+        return meas.value ? 1 : 0;
+    }
+};
+
+template<> struct PointCacheTraits<AnalogOutputStatus>
+{
+    using Storage = double;
+    static const PointCacheType type = PointCacheType::AnalogOutputStatus;
+    static Storage Get(const AnalogOutputStatus& meas)
+    {
+        return meas.value;
+    }
+};
+
+static uint64_t Align(uint64_t offset)
+{
+    return (offset + 7) & ~static_cast<uint64_t>(7);
+}
+
+static uint16_t GetCount(const PointCacheConfig& config, PointCacheType type)
+{
+    switch (type)
+    {
+    case (PointCacheType::Binary):
+        return config.numBinary;
+    case (PointCacheType::DoubleBitBinary):
+        return config.numDoubleBinary;
+    case (PointCacheType::Analog):
+        return config.numAnalog;
+    case (PointCacheType::Counter):
+        return config.numCounter;
+    case (PointCacheType::FrozenCounter):
+        return config.numFrozenCounter;
+    case (PointCacheType::BinaryOutputStatus):
+        return config.numBinaryOutputStatus;
+    default:
+        return config.numAnalogOutputStatus;
+    }
+}
+
+static uint32_t GetValueSize(PointCacheType type)
+{
+    switch (type)
+    {
+    case (PointCacheType::Analog):
+    case (PointCacheType::AnalogOutputStatus):
+        return sizeof(double);
+    case (PointCacheType::Counter):
+    case (PointCacheType::FrozenCounter):
+        return sizeof(uint32_t);
+    default:
+        return sizeof(uint8_t);
+    }
+}
+
+// computes the offsets of every column and returns the total size of the region
+static uint64_t PlanLayout(const PointCacheConfig& config, PointCacheLayout::Table (&tables)[NUM_POINT_CACHE_TYPES])
+{
+    uint64_t offset = Align(sizeof(PointCacheLayout));
+    for (uint8_t i = 0; i < NUM_POINT_CACHE_TYPES; ++i)
+    {
+        auto& table = tables[i];
+        table.count = GetCount(config, static_cast<PointCacheType>(i));
+        table.valueSize = GetValueSize(static_cast<PointCacheType>(i));
+        table.changesOffset = offset;
+        offset += table.count * sizeof(uint64_t);
+        table.timesOffset = offset;
+        offset += table.count * sizeof(uint64_t);
+        table.valuesOffset = offset;
+        offset = Align(offset + table.count * table.valueSize);
+        table.flagsOffset = offset;
+        offset = Align(offset + table.count);
+    }
+    return offset;
+}
+
+template<class T> static T* Column(uint8_t* base, uint64_t offset)
+{
+    return reinterpret_cast<T*>(base + offset);
+}
+
+static uint64_t Now()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count());
+}
+
+std::shared_ptr<PointCache> PointCache::Create(const PointCacheConfig& config, std::shared_ptr<ISOEHandler> next)
+{
+    return std::make_shared<PointCache>(config, std::move(next));
+}
+
+PointCache::PointCache(const PointCacheConfig& config, std::shared_ptr<ISOEHandler> next) : next(std::move(next))
+{
+    PointCacheLayout::Table tables[NUM_POINT_CACHE_TYPES];
+    const auto size = PlanLayout(config, tables);
+
+    std::error_code ec;
+    this->region = MappedRegion::Create(static_cast<size_t>(size), config.mappedFilePath, ec);
+    if (!this->region)
+    {
+        throw DNP3Error(Error::UNABLE_TO_MAP_POINT_CACHE, ec);
+    }
+
+    auto layout = new (this->region->Data()) PointCacheLayout();
+    layout->magic = PointCacheLayout::MAGIC;
+    layout->version = PointCacheLayout::VERSION;
+    layout->writeCount.store(0);
+    layout->lastChange = 0;
+    std::memcpy(layout->tables, tables, sizeof(tables));
+}
+
+PointCache::~PointCache() = default;
+
+PointCacheLayout& PointCache::Layout() const
+{
+    return *reinterpret_cast<PointCacheLayout*>(this->region->Data());
+}
+
+bool PointCache::Get(PointCacheType type, uint16_t index, CachedPoint& point) const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    if (index >= this->Layout().tables[static_cast<uint8_t>(type)].count)
+    {
+        return false;
+    }
+
+    this->Read(type, index, point);
+    return true;
+}
+
+uint64_t PointCache::ForEachChange(uint64_t since, const std::function<void(const CachedPoint&)>& visitor) const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    const auto& layout = this->Layout();
+    for (uint8_t i = 0; i < NUM_POINT_CACHE_TYPES; ++i)
+    {
+        const auto& table = layout.tables[i];
+        const auto changes = Column<const uint64_t>(this->region->Data(), table.changesOffset);
+        for (uint32_t index = 0; index < table.count; ++index)
+        {
+            if (changes[index] > since)
+            {
+                CachedPoint point;
+                this->Read(static_cast<PointCacheType>(i), static_cast<uint16_t>(index), point);
+                visitor(point);
+            }
+        }
+    }
+
+    return layout.lastChange;
+}
+
+uint64_t PointCache::GetLastChange() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->Layout().lastChange;
+}
+
+const PointCacheLayout& PointCache::GetLayout() const
+{
+    return this->Layout();
+}
+
+void PointCache::Read(PointCacheType type, uint16_t index, CachedPoint& point) const
+{
+    const auto base = this->region->Data();
+    const auto& table = this->Layout().tables[static_cast<uint8_t>(type)];
+
+    point.type = type;
+    point.index = index;
+    point.flags = Column<const uint8_t>(base, table.flagsOffset)[index];
+    point.time = Column<const uint64_t>(base, table.timesOffset)[index];
+    point.changeSequence = Column<const uint64_t>(base, table.changesOffset)[index];
+
+    switch (table.valueSize)
+    {
+    case (sizeof(double)):
+        point.value = Column<const double>(base, table.valuesOffset)[index];
+        break;
+    case (sizeof(uint32_t)):
+        point.value = Column<const uint32_t>(base, table.valuesOffset)[index];
+        break;
+    default:
+        point.value = Column<const uint8_t>(base, table.valuesOffset)[index];
+        break;
+    }
+}
+
+template<class T> void PointCache::Update(const ICollection<Indexed<T>>& values)
+{
+    using Traits = PointCacheTraits<T>;
+    using Storage = typename Traits::Storage;
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    auto& layout = this->Layout();
+    const auto& table = layout.tables[static_cast<uint8_t>(Traits::type)];
+    const auto base = this->region->Data();
+
+    const auto changes = Column<uint64_t>(base, table.changesOffset);
+    const auto times = Column<uint64_t>(base, table.timesOffset);
+    const auto storage = Column<Storage>(base, table.valuesOffset);
+    const auto flags = Column<uint8_t>(base, table.flagsOffset);
+
+    const auto now = Now();
+
+    layout.writeCount.fetch_add(1, std::memory_order_acq_rel);
+
+    auto update = [&](const Indexed<T>& item) {
+        if (item.index >= table.count)
+        {
+            return;
+        }
+
+        const auto value = Traits::Get(item.value);
+        const auto index = item.index;
+
+        if (changes[index] != 0 && storage[index] == value && flags[index] == item.value.flags.value)
+        {
+            return;
+        }
+
+        storage[index] = value;
+        flags[index] = item.value.flags.value;
+        times[index] = (item.value.time.quality == TimestampQuality::INVALID) ? now : item.value.time.value;
+        changes[index] = ++layout.lastChange;
+    };
+
+    values.ForeachItem(update);
+
+    layout.writeCount.fetch_add(1, std::memory_order_release);
+}
+
+void PointCache::BeginFragment(const ResponseInfo& info)
+{
+    if (this->next)
+    {
+        this->next->BeginFragment(info);
+    }
+}
+
+void PointCache::EndFragment(const ResponseInfo& info)
+{
+    if (this->next)
+    {
+        this->next->EndFragment(info);
+    }
+}
+
+void PointCache::Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values)
+{
+    this->Update(values);
+    if (this->next)
+    {
+        this->next->Process(info, values);
+    }
+}
+
+void PointCache::Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values)
+{
+    this->Update(values);
+    if (this->next)
+    {
+        this->next->Process(info, values);
+    }
+}
+
+void PointCache::Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values)
+{
+    this->Update(values);
+    if (this->next)
+    {
+        this->next->Process(info, values);
+    }
+}
+
+void PointCache::Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values)
+{
+    this->Update(values);
+    if (this->next)
+    {
+        this->next->Process(info, values);
+    }
+}
+
+void PointCache::Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values)
+{
+    this->Update(values);
+    if (this->next)
+    {
+        this->next->Process(info, values);
+    }
+}
+
+void PointCache::Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values)
+{
+    this->Update(values);
+    if (this->next)
+    {
+        this->next->Process(info, values);
+    }
+}
+
+void PointCache::Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values)
+{
+    this->Update(values);
+    if (this->next)
+    {
+        this->next->Process(info, values);
+    }
+}
+
+void PointCache::Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values)
+{
+    if (this->next)
+    {
+        this->next->Process(info, values);
+    }
+}
+
+void PointCache::Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values)
+{
+    if (this->next)
+    {
+        this->next->Process(info, values);
+    }
+}
+
+void PointCache::Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values)
+{
+    if (this->next)
+    {
+        this->next->Process(info, values);
+    }
+}
+
+void PointCache::Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values)
+{
+    if (this->next)
+    {
+        this->next->Process(info, values);
+    }
+}
+
+void PointCache::Process(const HeaderInfo& info, const ICollection<DNPTime>& values)
+{
+    if (this->next)
+    {
+        this->next->Process(info, values);
+    }
+}
+
+} // namespace opendnp3
@@ -20,10 +20,12 @@
 #include "PollTaskBase.h"
 
 #include "logging/LogMacros.h"
+#include "master/AdaptiveScanPolicy.h"
 #include "master/MeasurementHandler.h"
 
 #include "opendnp3/logging/LogLevels.h"
 
+#include <chrono>
 #include <utility>
 
 namespace opendnp3
@@ -45,9 +47,43 @@ const char* PollTaskBase::Name() const
     return _taskName.c_str();
 }
 
+ISOEHandler* PollTaskBase::GetMeasurementHandler() const
+{
+    return this->handler.get();
+}
+
+void PollTaskBase::SetDeliverMeasurements(bool value)
+{
+    this->deliverMeasurements = value;
+}
+
 void PollTaskBase::Initialize()
 {
     this->rxCount = 0;
+    this->deliverMeasurements = true;
+    this->numValuesRx = 0;
+    this->eventsPending = false;
+}
+
+void PollTaskBase::OnTaskComplete(TaskCompletion result, Timestamp now)
+{
+    if (result != TaskCompletion::SUCCESS || !this->config.adaptiveScan)
+    {
+        return;
+    }
+
+    AdaptiveScanPolicy::Outcome outcome;
+    outcome.numValues = this->numValuesRx;
+    outcome.eventsPending = this->eventsPending;
+    outcome.responseTime = now - this->GetStartTime();
+    outcome.queueWait = this->GetQueueWait();
+
+    const auto period = AdaptiveScanPolicy::NextPeriod(*this->config.adaptiveScan, this->GetPeriod(), outcome);
+
+    FORMAT_LOG_BLOCK(logger, flags::DBG, "Task '%s' period adapted to %lld ms", this->Name(),
+                     static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(period.value).count()));
+
+    this->AdjustPeriod(period, now);
 }
 
 IMasterTask::ResponseResult PollTaskBase::ProcessResponse(const APDUResponseHeader& header,
@@ -80,8 +116,29 @@ IMasterTask::ResponseResult PollTaskBase::ProcessMeasurements(const APDUResponse
 {
     ++rxCount;
 
-    if (MeasurementHandler::ProcessMeasurements(header.as_response_info(), objects, logger, handler.get())
-        == ParseResult::OK)
+    this->eventsPending = header.IIN.IsSet(IINBit::CLASS1_EVENTS) || header.IIN.IsSet(IINBit::CLASS2_EVENTS)
+        || header.IIN.IsSet(IINBit::CLASS3_EVENTS);
+
+    if (!this->deliverMeasurements)
+    {
+        // another poll merged into the same request delivers the measurements to the shared handler and reports
+        // the object statistics, this one only counts the values for its adaptive period
+        if (this->config.adaptiveScan)
+        {
+            uint32_t numValues = 0;
+            MeasurementHandler::ProcessMeasurements(header.as_response_info(), objects, logger, nullptr, &numValues);
+            this->numValuesRx += numValues;
+        }
+        return header.control.FIN ? ResponseResult::OK_FINAL : ResponseResult::OK_CONTINUE;
+    }
+
+    uint32_t numValues = 0;
+    const auto result
+        = MeasurementHandler::ProcessMeasurements(header.as_response_info(), objects, logger, handler.get(), &numValues);
+    this->RecordObjects(numValues);
+    this->numValuesRx += numValues;
+
+    if (result == ParseResult::OK)
     {
         return header.control.FIN ? ResponseResult::OK_FINAL : ResponseResult::OK_CONTINUE;
     }
@@ -46,6 +46,10 @@ public:
 
     const char* Name() const override;
 
+    ISOEHandler* GetMeasurementHandler() const override;
+
+    void SetDeliverMeasurements(bool value) override;
+
 protected:
     ResponseResult ProcessResponse(const APDUResponseHeader& header,
                                    const ser4cpp::rseq_t& objects) final;
@@ -54,7 +58,13 @@ protected:
 
     void Initialize() final;
 
+    void OnTaskComplete(TaskCompletion result, Timestamp now) override;
+
     uint32_t rxCount = 0;
+    bool deliverMeasurements = true;
+    // outcome of the current run, used to adapt the period of adaptive scans
+    uint32_t numValuesRx = 0;
+    bool eventsPending = false;
     std::shared_ptr<ISOEHandler> handler;
 private:
     std::string _taskName;
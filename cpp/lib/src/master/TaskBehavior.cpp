@@ -130,6 +130,17 @@ void TaskBehavior::DelayByPeriod(const Timestamp& now)
     _retryCount.Reset();
 }
 
+void TaskBehavior::AdjustPeriod(const TimeDuration& period, const Timestamp& now)
+{
+    if (this->period.IsNegative() || this->disabled)
+    {
+        return;
+    }
+
+    this->period = period;
+    this->expiration = now + period;
+}
+
 TimeDuration TaskBehavior::CalcNextRetryTimeout()
 {
     if (_retryCount.IsFixed()) {
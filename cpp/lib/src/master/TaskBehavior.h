@@ -111,6 +111,16 @@ public:
 
     void DelayByPeriod(const Timestamp& now);
 
+    TimeDuration GetPeriod() const
+    {
+        return period;
+    }
+
+    /**
+     * Change the period of a periodic task that just succeeded, rescheduling it relative to now
+     */
+    void AdjustPeriod(const TimeDuration& period, const Timestamp& now);
+
 private:
     TimeDuration CalcNextRetryTimeout();
 
@@ -123,7 +133,7 @@ private:
                  const Timestamp& startExpiration,
                  const NumRetries& retryCount);
 
-    const TimeDuration period;
+    TimeDuration period;
     const TimeDuration minRetryDelay;
     const TimeDuration maxRetryDelay;
     const Timestamp startExpiration;
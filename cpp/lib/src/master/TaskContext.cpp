@@ -47,4 +47,14 @@ bool TaskContext::IsBlocked(const IMasterTask& task) const
     return false;
 }
 
+TaskStatistics& TaskContext::Statistics(MasterTaskType type)
+{
+    return this->statistics[type];
+}
+
+MasterTaskStatistics TaskContext::GetStatistics() const
+{
+    return this->statistics;
+}
+
 } // namespace opendnp3
@@ -20,6 +20,7 @@
 #ifndef OPENDNP3_TASKCONTEXT_H
 #define OPENDNP3_TASKCONTEXT_H
 
+#include "opendnp3/master/TaskStatistics.h"
 #include "opendnp3/util/Uncopyable.h"
 
 #include <set>
@@ -39,6 +40,7 @@ class IMasterTask; // break circular dependency
 class TaskContext : private Uncopyable
 {
     std::set<const IMasterTask*> blocking_tasks;
+    MasterTaskStatistics statistics;
 
 public:
     void AddBlock(const IMasterTask& task);
@@ -46,6 +48,11 @@ public:
     void RemoveBlock(const IMasterTask& task);
 
     bool IsBlocked(const IMasterTask& task) const;
+
+    // mutable statistics shared by every task of the specified type
+    TaskStatistics& Statistics(MasterTaskType type);
+
+    MasterTaskStatistics GetStatistics() const;
 };
 
 } // namespace opendnp3
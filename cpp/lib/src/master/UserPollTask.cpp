@@ -72,4 +72,10 @@ bool UserPollTask::BuildRequest(APDURequest& request, uint8_t seq)
     return builder(writer);
 }
 
+bool UserPollTask::AppendMergedHeaders(HeaderWriter& writer)
+{
+    this->rxCount = 0;
+    return builder(writer);
+}
+
 } // namespace opendnp3
@@ -54,6 +54,8 @@ public:
 
     bool BuildRequest(APDURequest& request, uint8_t seq) override;
 
+    bool AppendMergedHeaders(HeaderWriter& writer) override;
+
     bool BlocksLowerPriority() const override;
 
     bool IsRecurring() const override;
@@ -22,6 +22,8 @@
 
 #include "outstation/StaticWriters.h"
 
+#include <vector>
+
 namespace opendnp3
 {
 
@@ -56,7 +58,7 @@ template<class Spec> IINField select_indices(StaticDataMap<Spec>& map, const ICo
     return missing_index ? IINField(IINBit::PARAM_ERROR) : IINField::Empty();
 }
 
-template<class Spec> bool load_type(StaticDataMap<Spec>& map, HeaderWriter& writer)
+template<class Spec> bool load_type(StaticDataMap<Spec>& map, HeaderWriter& writer, StaticPacking packing)
 {
     while (true)
     {
@@ -68,7 +70,7 @@ template<class Spec> bool load_type(StaticDataMap<Spec>& map, HeaderWriter& writ
             return true;
         }
 
-        if (!StaticWriters::get((*iter).second.variation)(map, writer))
+        if (!StaticWriters::get((*iter).second.variation, packing)(map, writer))
         {
             // the APDU is full
             return false;
@@ -79,10 +81,12 @@ template<class Spec> bool load_type(StaticDataMap<Spec>& map, HeaderWriter& writ
 Database::Database(const DatabaseConfig& config,
                    IEventReceiver& event_receiver,
                    IDnpTimeSource& time_source,
-                   StaticTypeBitField allowed_class_zero_types)
+                   StaticTypeBitField allowed_class_zero_types,
+                   StaticPacking static_packing)
     : event_receiver(event_receiver),
       time_source(time_source),
       allowed_class_zero_types(allowed_class_zero_types),
+      static_packing(static_packing),
       binary_input(config.binary_input),
       double_binary(config.double_binary),
       analog_input(config.analog_input),
@@ -442,11 +446,13 @@ bool Database::HasAnySelection() const
 
 bool Database::Load(HeaderWriter& writer)
 {
-    return load_type(this->binary_input, writer) && load_type(this->double_binary, writer)
-        && load_type(this->analog_input, writer) && load_type(this->counter, writer)
-        && load_type(this->frozen_counter, writer) && load_type(this->binary_output_status, writer)
-        && load_type(this->analog_output_status, writer) && load_type(this->time_and_interval, writer)
-        && load_type(this->octet_string, writer);
+    const auto packing = this->static_packing;
+    return load_type(this->binary_input, writer, packing) && load_type(this->double_binary, writer, packing)
+        && load_type(this->analog_input, writer, packing) && load_type(this->counter, writer, packing)
+        && load_type(this->frozen_counter, writer, packing)
+        && load_type(this->binary_output_status, writer, packing)
+        && load_type(this->analog_output_status, writer, packing)
+        && load_type(this->time_and_interval, writer, packing) && load_type(this->octet_string, writer, packing);
 }
 
 bool Database::Update(const Binary& meas, uint16_t index, EventMode mode)
@@ -527,19 +533,25 @@ bool Database::Modify(uint16_t index, DoubleBitBinary value, EventMode mode)
 
 bool Database::FreezeSelectedCounters(bool clear, EventMode mode)
 {
-    for (auto c : this->counter)
+    const auto now = time_source.Now();
+
+    // collect the selected counters in index order so that both maps are updated in a single pass
+    std::vector<Indexed<FrozenCounter>> frozen;
+    std::vector<Indexed<Counter>> cleared;
+
+    for (const auto& c : this->counter)
     {
-        FrozenCounter new_value(c.second.value.value, c.second.value.flags, time_source.Now());
-        this->frozen_counter.update(new_value, c.first, mode, this->event_receiver);
+        frozen.push_back(WithIndex(FrozenCounter(c.second.value.value, c.second.value.flags, now), c.first));
 
         if (clear)
         {
-            c.second.value.value = 0;
-            c.second.value.time = time_source.Now();
-            this->counter.update(c.second.value, c.first, mode, this->event_receiver);
+            cleared.push_back(WithIndex(Counter(0, c.second.value.flags, now), c.first));
         }
     }
 
+    this->frozen_counter.update(frozen, mode, this->event_receiver);
+    this->counter.update(cleared, mode, this->event_receiver);
+
     this->counter.clear_selection();
 
     return true;
@@ -31,6 +31,7 @@
 #include "opendnp3/outstation/DatabaseConfig.h"
 #include "opendnp3/outstation/IDnpTimeSource.h"
 #include "opendnp3/outstation/IUpdateHandler.h"
+#include "opendnp3/outstation/StaticPacking.h"
 #include "opendnp3/outstation/StaticTypeBitfield.h"
 
 namespace opendnp3
@@ -42,7 +43,8 @@ public:
     Database(const DatabaseConfig& config,
              IEventReceiver& event_receiver,
              IDnpTimeSource& time_source,
-             StaticTypeBitField allowed_class_zero_types);
+             StaticTypeBitField allowed_class_zero_types,
+             StaticPacking static_packing = StaticPacking::Ranges);
 
     // ------- IStaticSelector -------------
     IINField SelectAll(GroupVariation gv) override;
@@ -77,6 +79,7 @@ private:
     IEventReceiver& event_receiver;
     IDnpTimeSource& time_source;
     StaticTypeBitField allowed_class_zero_types;
+    StaticPacking static_packing;
 
     StaticDataMap<BinarySpec> binary_input;
     StaticDataMap<DoubleBitBinarySpec> double_binary;
@@ -23,6 +23,8 @@
 #include "app/MeasurementTypeSpecs.h"
 #include "outstation/Event.h"
 
+#include <cstddef>
+
 namespace opendnp3
 {
 
@@ -49,6 +51,57 @@ public:
     virtual void Update(const Event<AnalogOutputStatusSpec>& evt) = 0;
 
     virtual void Update(const Event<OctetStringSpec>& evt) = 0;
+
+    // ---- batches of events of one type, by default received one at a time ----
+
+    virtual void Update(const Event<BinarySpec>* events, size_t count)
+    {
+        this->UpdateEach(events, count);
+    }
+
+    virtual void Update(const Event<DoubleBitBinarySpec>* events, size_t count)
+    {
+        this->UpdateEach(events, count);
+    }
+
+    virtual void Update(const Event<AnalogSpec>* events, size_t count)
+    {
+        this->UpdateEach(events, count);
+    }
+
+    virtual void Update(const Event<CounterSpec>* events, size_t count)
+    {
+        this->UpdateEach(events, count);
+    }
+
+    virtual void Update(const Event<FrozenCounterSpec>* events, size_t count)
+    {
+        this->UpdateEach(events, count);
+    }
+
+    virtual void Update(const Event<BinaryOutputStatusSpec>* events, size_t count)
+    {
+        this->UpdateEach(events, count);
+    }
+
+    virtual void Update(const Event<AnalogOutputStatusSpec>* events, size_t count)
+    {
+        this->UpdateEach(events, count);
+    }
+
+    virtual void Update(const Event<OctetStringSpec>* events, size_t count)
+    {
+        this->UpdateEach(events, count);
+    }
+
+private:
+    template<class Spec> void UpdateEach(const Event<Spec>* events, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            this->Update(events[i]);
+        }
+    }
 };
 
 } // namespace opendnp3
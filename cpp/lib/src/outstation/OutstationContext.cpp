@@ -60,8 +60,12 @@ OContext::OContext(const Addresses& addresses,
       lower(std::move(lower)),
       commandHandler(std::move(commandHandler)),
       application(std::move(application)),
-      eventBuffer(config.eventBufferConfig),
-      database(db_config, eventBuffer, *this->application, config.params.typesAllowedInClass0),
+      eventBuffer(config.eventBufferConfig, config.params.compactEventEncoding),
+      database(db_config,
+               eventBuffer,
+               *this->application,
+               config.params.typesAllowedInClass0,
+               config.params.staticPacking),
       rspContext(database, eventBuffer),
       params(config.params),
       isOnline(false),
@@ -290,6 +294,7 @@ void OContext::BeginUnsolTx(APDUResponse& response)
 
 void OContext::BeginTx(uint16_t destination, const ser4cpp::rseq_t& message)
 {
+    this->RecordResponseQueued();
     logging::ParseAndLogResponseTx(this->logger, message);
     this->isTransmitting = this->lower->BeginTransmit(Message(Addresses(this->addresses.source, destination), message));
 }
@@ -348,6 +353,7 @@ void OContext::CheckForUnsolicited()
                 auto response = this->unsol.tx.Start();
                 auto writer = response.GetWriter();
 
+                this->MarkResponseStart();
                 this->unsolRetries.Reset();
                 this->eventBuffer.Unselect();
                 this->eventBuffer.SelectAllByClass(this->params.unsolClassMask);
@@ -439,6 +445,8 @@ OutstationState& OContext::RespondToReadRequest(const ParsedRequest& request)
 
 OutstationState& OContext::ContinueMultiFragResponse(const Addresses& addresses, const AppSeqNum& seq)
 {
+    this->MarkResponseStart();
+
     auto response = this->sol.tx.Start();
     auto writer = response.GetWriter();
     response.SetFunction(FunctionCode::RESPONSE);
@@ -711,6 +719,7 @@ IINField OContext::HandleNonReadResponse(const APDUHeader& header, const ser4cpp
 
 ser4cpp::Pair<IINField, AppControlField> OContext::HandleRead(const ser4cpp::rseq_t& objects, HeaderWriter& writer)
 {
+    this->MarkResponseStart();
     this->rspContext.Reset();
     this->eventBuffer.Unselect(); // always un-select any previously selected points when we start a new read request
     this->database.Unselect();
@@ -955,4 +964,28 @@ IINField OContext::HandleFileTransfer(const ser4cpp::rseq_t& objects, HeaderWrit
     }
 }
 
+void OContext::SetLatencyTracing(StackStatistics::Latency& latency)
+{
+    this->eventBuffer.SetLatencyTracing(&latency.updateToSelected);
+    this->responseLatency = &latency.selectedToQueued;
+}
+
+void OContext::MarkResponseStart()
+{
+    if (this->responseLatency)
+    {
+        this->responseStart = std::chrono::steady_clock::now();
+    }
+}
+
+void OContext::RecordResponseQueued()
+{
+    // retransmissions don't have a start mark and are not recorded
+    if (this->responseLatency && this->responseStart != std::chrono::steady_clock::time_point())
+    {
+        this->responseLatency->Record(std::chrono::steady_clock::now() - this->responseStart);
+        this->responseStart = std::chrono::steady_clock::time_point();
+    }
+}
+
 } // namespace opendnp3
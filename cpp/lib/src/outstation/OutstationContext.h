@@ -35,6 +35,7 @@
 #include "outstation/TimeSyncState.h"
 #include "outstation/event/EventBuffer.h"
 
+#include "opendnp3/StackStatistics.h"
 #include "opendnp3/link/Addresses.h"
 #include "opendnp3/logging/Logger.h"
 #include "opendnp3/outstation/ICommandHandler.h"
@@ -87,6 +88,8 @@ public:
 
     void SetRestartIIN();
 
+    void SetLatencyTracing(StackStatistics::Latency& latency);
+
 private:
     /// ---- Helper functions that operate on the current state, and may return a new state ----
 
@@ -218,6 +221,13 @@ private:
     ser4cpp::Settable<LinkBroadcastAddress> lastBroadcastMessageReceived;
 
     FileTransferWorker _fileTransferWorker;
+
+    // ------ Latency tracing, only used when enabled ------
+    void MarkResponseStart();
+    void RecordResponseQueued();
+
+    LatencyHistogram* responseLatency = nullptr;
+    std::chrono::steady_clock::time_point responseStart;
 };
 
 } // namespace opendnp3
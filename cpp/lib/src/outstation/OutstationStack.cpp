@@ -19,6 +19,8 @@
  */
 #include "outstation/OutstationStack.h"
 
+#include "opendnp3/outstation/UpdateBuilder.h"
+
 namespace opendnp3
 {
 
@@ -45,9 +47,18 @@ OutstationStack::OutstationStack(const Logger& logger,
                executor,
                tstack.transport,
                commandHandler,
-               application)
+               application),
+      updateChannel(config.outstation.params.updateQueueSize, [this]() {
+          auto drain = [self = this->shared_from_this()]() { self->DrainUpdateChannel(); };
+          this->executor->post(drain);
+      })
 {
     this->tstack.transport->SetAppLayer(ocontext);
+
+    if (config.outstation.params.traceLatency)
+    {
+        this->ocontext.SetLatencyTracing(this->EnableLatencyTracing());
+    }
 }
 
 bool OutstationStack::Enable()
@@ -106,4 +117,40 @@ void OutstationStack::Apply(const Updates& updates)
     this->executor->post(task);
 }
 
+IUpdateHandler& OutstationStack::GetUpdateChannel()
+{
+    return this->updateChannel;
+}
+
+void OutstationStack::UpdateBatch(size_t count, const std::function<void(IUpdateHandler&)>& writer)
+{
+    if (this->updateChannel.UpdateBatch(count, writer))
+        return;
+
+    UpdateBuilder builder;
+    writer(builder);
+    const auto updates = builder.Build();
+
+    // hold back later writes to the channel so that they can't be drained ahead of this batch
+    this->updateChannel.Block();
+
+    auto task = [self = this->shared_from_this(), updates]() {
+        // anything written to the channel before the batch goes first
+        self->updateChannel.Drain(self->ocontext.GetUpdateHandler());
+        updates.Apply(self->ocontext.GetUpdateHandler());
+        self->updateChannel.Unblock();
+        self->ocontext.HandleNewEvents();
+    };
+
+    this->executor->post(task);
+}
+
+void OutstationStack::DrainUpdateChannel()
+{
+    if (this->updateChannel.Drain(this->ocontext.GetUpdateHandler()) > 0)
+    {
+        this->ocontext.HandleNewEvents(); // check for updates once for the whole batch
+    }
+}
+
 } // namespace opendnp3
@@ -24,6 +24,7 @@
 #include "channel/IOHandler.h"
 #include "logging/LogMacros.h"
 #include "outstation/OutstationContext.h"
+#include "outstation/UpdateChannel.h"
 #include "transport/TransportStack.h"
 
 #include "opendnp3/outstation/IOutstation.h"
@@ -102,7 +103,12 @@ public:
         return this->tstack.link->OnFrame(header, userdata);
     }
 
-    bool BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& /*context*/) final
+    ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length) final
+    {
+        return this->tstack.link->GetUserDataBuffer(header, length);
+    }
+
+    bool BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& /*context*/, uint32_t numFrames) final
     {
         if (this->iohandlersManager)
         {
@@ -113,7 +119,7 @@ public:
             }
             if (const auto current = this->iohandlersManager->GetCurrent())
             {
-                return current->BeginTransmit(shared_from_this(), buffer);
+                return current->BeginTransmit(shared_from_this(), buffer, numFrames);
             }
         }
         
@@ -130,8 +136,15 @@ public:
 
     void Apply(const Updates& updates) final;
 
+    IUpdateHandler& GetUpdateChannel() final;
+
+    void UpdateBatch(size_t count, const std::function<void(IUpdateHandler&)>& writer) final;
+
 private:
+    void DrainUpdateChannel();
+
     OContext ocontext;
+    UpdateChannel updateChannel;
 };
 
 } // namespace opendnp3
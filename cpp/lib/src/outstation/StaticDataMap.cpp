@@ -47,7 +47,7 @@ bool StaticDataMap<TimeAndIntervalSpec>::update(const TimeAndInterval& value,
                                                 EventMode /*mode*/,
                                                 IEventReceiver& /*receiver*/)
 {
-    const auto iter = this->map.find(index);
+    const auto iter = this->find(index);
     if (iter == this->map.end())
     {
         return false;
@@ -25,11 +25,15 @@
 #include "outstation/IEventReceiver.h"
 #include "outstation/StaticDataCell.h"
 
+#include "opendnp3/app/Indexed.h"
 #include "opendnp3/gen/EventMode.h"
 #include "opendnp3/util/Uncopyable.h"
 
+#include <algorithm>
 #include <iterator>
 #include <map>
+#include <utility>
+#include <vector>
 
 namespace opendnp3
 {
@@ -45,9 +49,12 @@ typename Spec::static_variation_t check_for_promotion(const typename Spec::meas_
 
 template<> StaticBinaryVariation check_for_promotion<BinarySpec>(const Binary& value, StaticBinaryVariation variation);
 
+/**
+ * Points of a single type, stored densely in a vector sorted by index
+ */
 template<class Spec> class StaticDataMap : private Uncopyable
 {
-    using map_t = std::map<uint16_t, StaticDataCell<Spec>>;
+    using map_t = std::vector<std::pair<uint16_t, StaticDataCell<Spec>>>;
     using map_iter_t = typename map_t::iterator;
 
 public:
@@ -113,6 +120,10 @@ public:
 
     bool update(const typename Spec::meas_t& value, uint16_t index, EventMode mode, IEventReceiver& receiver);
 
+    // updates values sorted by index in a single pass, events are delivered to the receiver as one batch
+    size_t update(const std::vector<Indexed<typename Spec::meas_t>>& values, EventMode mode, IEventReceiver& receiver);
+
+    // changes the flags of every point in [start, stop] in a single pass, events are delivered as one batch
     bool modify(uint16_t start, uint16_t stop, uint8_t flags, IEventReceiver& receiver);
 
     // function specifically for DoubleBit due to the possibility of the different sources for each bit
@@ -164,6 +175,11 @@ public:
 
     Range assign_class(PointClass clazz, const Range& range);
 
+    // visits the selected points in index order without changing the selection, stopping when the visitor returns
+    // false. The visitor receives (index, selection, follows_previous), follows_previous being true when no other
+    // point of the database lies between this point and the previously visited one
+    template<class F> void visit_selected(F visitor) const;
+
     iterator begin();
 
     iterator end();
@@ -174,11 +190,18 @@ private:
 
     Range get_full_range() const;
 
+    map_iter_t find(uint16_t index);
+
+    map_iter_t lower_bound(uint16_t index);
+
     bool update(const map_iter_t& iter,
                 const typename Spec::meas_t& new_value,
                 EventMode mode,
                 IEventReceiver& receiver);
 
+    // stores the value in the cell and returns true if it produces an event that should be reported
+    static bool apply(StaticDataCell<Spec>& cell, const typename Spec::meas_t& new_value, EventMode mode, EventClass& ec);
+
     // generic implementation of select_all that accepts a function
     // that can use or override the default variation
     template<class F> size_t select_all(F get_variation);
@@ -190,21 +213,24 @@ private:
 
 template<class Spec> StaticDataMap<Spec>::StaticDataMap(const std::map<uint16_t, typename Spec::config_t>& config)
 {
+    // the config is already ordered by index
+    this->map.reserve(config.size());
     for (const auto& item : config)
     {
-        this->map[item.first] = StaticDataCell<Spec>{item.second};
+        this->map.emplace_back(item.first, StaticDataCell<Spec>{item.second});
     }
 }
 
 template<class Spec>
 bool StaticDataMap<Spec>::add(const typename Spec::meas_t& value, uint16_t index, typename Spec::config_t config)
 {
-    if (this->map.find(index) != this->map.end())
+    const auto iter = this->lower_bound(index);
+    if (iter != this->map.end() && iter->first == index)
     {
         return false;
     }
 
-    this->map[index] = StaticDataCell<Spec>{value, config};
+    this->map.emplace(iter, index, StaticDataCell<Spec>{value, config});
 
     return true;
 }
@@ -221,7 +247,49 @@ bool StaticDataMap<Spec>::update(const typename Spec::meas_t& value,
                                  EventMode mode,
                                  IEventReceiver& receiver)
 {
-    return update(this->map.find(index), value, mode, receiver);
+    return update(this->find(index), value, mode, receiver);
+}
+
+template<class Spec>
+size_t StaticDataMap<Spec>::update(const std::vector<Indexed<typename Spec::meas_t>>& values,
+                                   EventMode mode,
+                                   IEventReceiver& receiver)
+{
+    std::vector<Event<Spec>> events;
+    size_t count = 0;
+
+    auto iter = this->map.begin();
+    for (const auto& item : values)
+    {
+        while (iter != this->map.end() && iter->first < item.index)
+        {
+            ++iter;
+        }
+
+        if (iter == this->map.end())
+        {
+            break;
+        }
+
+        if (iter->first != item.index)
+        {
+            continue;
+        }
+
+        EventClass ec;
+        if (apply(iter->second, item.value, mode, ec))
+        {
+            events.emplace_back(item.value, iter->first, ec, iter->second.config.evariation);
+        }
+        ++count;
+    }
+
+    if (!events.empty())
+    {
+        receiver.Update(events.data(), events.size());
+    }
+
+    return count;
 }
 
 template<class Spec> void StaticDataMap<Spec>::clear_selection()
@@ -232,11 +300,48 @@ template<class Spec> void StaticDataMap<Spec>::clear_selection()
     }
 }
 
+template<class Spec> template<class F> void StaticDataMap<Spec>::visit_selected(F visitor) const
+{
+    if (!this->selected.IsValid())
+        return;
+
+    auto iter = std::lower_bound(
+        this->map.begin(), this->map.end(), this->selected.start,
+        [](const typename map_t::value_type& item, uint16_t value) { return item.first < value; });
+
+    bool follows_previous = false;
+    for (; iter != this->map.end() && iter->first <= this->selected.stop; ++iter)
+    {
+        if (!iter->second.selection.selected)
+        {
+            follows_previous = false;
+            continue;
+        }
+
+        if (!visitor(iter->first, iter->second.selection, follows_previous))
+            return;
+
+        follows_previous = true;
+    }
+}
+
 template<class Spec> Range StaticDataMap<Spec>::get_full_range() const
 {
     return this->map.empty() ? Range::Invalid() : Range::From(this->map.begin()->first, this->map.rbegin()->first);
 }
 
+template<class Spec> typename StaticDataMap<Spec>::map_iter_t StaticDataMap<Spec>::find(uint16_t index)
+{
+    const auto iter = this->lower_bound(index);
+    return (iter != this->map.end() && iter->first == index) ? iter : this->map.end();
+}
+
+template<class Spec> typename StaticDataMap<Spec>::map_iter_t StaticDataMap<Spec>::lower_bound(uint16_t index)
+{
+    return std::lower_bound(this->map.begin(), this->map.end(), index,
+                            [](const typename map_t::value_type& item, uint16_t value) { return item.first < value; });
+}
+
 template<class Spec>
 bool StaticDataMap<Spec>::update(const map_iter_t& iter,
                                  const typename Spec::meas_t& new_value,
@@ -248,25 +353,33 @@ bool StaticDataMap<Spec>::update(const map_iter_t& iter,
         return false;
     }
 
+    EventClass ec;
+    if (apply(iter->second, new_value, mode, ec))
+    {
+        receiver.Update(Event<Spec>(new_value, iter->first, ec, iter->second.config.evariation));
+    }
+
+    return true;
+}
+
+template<class Spec>
+bool StaticDataMap<Spec>::apply(StaticDataCell<Spec>& cell,
+                                const typename Spec::meas_t& new_value,
+                                EventMode mode,
+                                EventClass& ec)
+{
     if (mode != EventMode::EventOnly)
     {
-        iter->second.value = new_value;
+        cell.value = new_value;
     }
 
-    if (mode == EventMode::Force || mode == EventMode::EventOnly || Spec::IsEvent(iter->second.event.lastEvent, new_value, iter->second.config))
+    if (mode == EventMode::Force || mode == EventMode::EventOnly || Spec::IsEvent(cell.event.lastEvent, new_value, cell.config))
     {
-        iter->second.event.lastEvent = new_value;
-        if (mode != EventMode::Suppress)
-        {
-            EventClass ec;
-            if (convert_to_event_class(iter->second.config.clazz, ec))
-            {
-                receiver.Update(Event<Spec>(new_value, iter->first, ec, iter->second.config.evariation));
-            }
-        }
+        cell.event.lastEvent = new_value;
+        return (mode != EventMode::Suppress) && convert_to_event_class(cell.config.clazz, ec);
     }
 
-    return true;
+    return false;
 }
 
 template<class Spec>
@@ -277,25 +390,43 @@ bool StaticDataMap<Spec>::modify(uint16_t start, uint16_t stop, uint8_t flags, I
         return false;
     }
 
-    for (auto iter = this->map.lower_bound(start); iter != this->map.end(); ++iter)
+    const auto begin = this->lower_bound(start);
+    auto end = begin;
+    while (end != this->map.end() && end->first <= stop)
     {
-        if (iter->first > stop)
-        {
-            return false;
-        }
+        ++end;
+    }
 
+    std::vector<Event<Spec>> events;
+
+    for (auto iter = begin; iter != end; ++iter)
+    {
         auto new_value = iter->second.value;
         new_value.flags = Flags(flags);
-        this->update(iter, new_value, EventMode::Detect, receiver);
+
+        EventClass ec;
+        if (apply(iter->second, new_value, EventMode::Detect, ec))
+        {
+            if (events.empty())
+            {
+                events.reserve(static_cast<size_t>(std::distance(iter, end)));
+            }
+            events.emplace_back(new_value, iter->first, ec, iter->second.config.evariation);
+        }
     }
 
-    return true;
+    if (!events.empty())
+    {
+        receiver.Update(events.data(), events.size());
+    }
+
+    return begin != end;
 }
 
 template<>
 inline bool StaticDataMap<DoubleBitBinarySpec>::modify(uint16_t index, DoubleBitBinary value, EventMode mode, IEventReceiver& receiver)
 {
-    const auto iter = this->map.find(index);
+    const auto iter = this->find(index);
     if (iter == this->map.end())
     {
         return false;
@@ -332,7 +463,7 @@ template<class Spec> template<class F> size_t StaticDataMap<Spec>::select(Range
         return 0;
     }
 
-    const auto start = this->map.lower_bound(range.start);
+    const auto start = this->lower_bound(range.start);
 
     if (start == this->map.end())
     {
@@ -378,7 +509,7 @@ template<class Spec> Range StaticDataMap<Spec>::assign_class(PointClass clazz)
 
 template<class Spec> Range StaticDataMap<Spec>::assign_class(PointClass clazz, const Range& range)
 {
-    for (auto iter = this->map.lower_bound(range.start); iter != this->map.end() && range.Contains(iter->first); iter++)
+    for (auto iter = this->lower_bound(range.start); iter != this->map.end() && range.Contains(iter->first); iter++)
     {
         iter->second.config.clazz = clazz;
     }
@@ -393,7 +524,7 @@ template<class Spec> typename StaticDataMap<Spec>::iterator StaticDataMap<Spec>:
         return iterator(this->map.end(), this->map.end(), this->selected);
     }
 
-    const auto begin = this->map.lower_bound(this->selected.start);
+    const auto begin = this->lower_bound(this->selected.start);
 
     return iterator(begin, this->map.end(), this->selected);
 }
@@ -29,14 +29,28 @@
 #include "gen/objects/Group50.h"
 #include "outstation/OctetStringSerializer.h"
 
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
 namespace opendnp3
 {
 
-template<class Spec, class IndexType>
-bool LoadWithRangeIterator(StaticDataMap<Spec>& map,
-                           RangeWriteIterator<IndexType, typename Spec::meas_t>& writer,
-                           typename Spec::static_variation_t variation)
+/**
+ * Loads the leading contiguous run of selected points with the given variation. Values are staged so
+ * that the iterator can convert them in batches. Iterating the map unselects points, so never stage
+ * more than the iterator has room for.
+ */
+template<class Spec, class Iterator, class T, size_t BATCH_SIZE, class GetValue>
+bool LoadInBatches(StaticDataMap<Spec>& map,
+                   Iterator& writer,
+                   typename Spec::static_variation_t variation,
+                   const GetValue& get_value)
 {
+    std::array<T, BATCH_SIZE> batch;
+    uint32_t num_batched = 0;
+    auto remaining = writer.Remaining();
     auto next_index = map.get_selected_range().start;
 
     for (const auto& elem : map)
@@ -44,24 +58,45 @@ bool LoadWithRangeIterator(StaticDataMap<Spec>& map,
         if (elem.second.variation != variation)
         {
             // the variation has changed
-            return true;
+            return writer.WriteArray(batch.data(), num_batched);
         }
 
         if (elem.first != next_index)
         {
             // we've loaded all we can with a contiguous range
-            return true;
+            return writer.WriteArray(batch.data(), num_batched);
         }
 
-        if (!writer.Write(elem.second.value))
+        if (remaining == 0)
         {
+            writer.WriteArray(batch.data(), num_batched);
             return false;
         }
 
+        batch[num_batched] = get_value(elem.second.value);
+        ++num_batched;
+        --remaining;
+
+        if (num_batched == batch.size())
+        {
+            writer.WriteArray(batch.data(), num_batched);
+            num_batched = 0;
+        }
+
         ++next_index;
     }
 
-    return true;
+    return writer.WriteArray(batch.data(), num_batched);
+}
+
+template<class Spec, class IndexType>
+bool LoadWithRangeIterator(StaticDataMap<Spec>& map,
+                           RangeWriteIterator<IndexType, typename Spec::meas_t>& writer,
+                           typename Spec::static_variation_t variation)
+{
+    using meas_t = typename Spec::meas_t;
+    return LoadInBatches<Spec, RangeWriteIterator<IndexType, meas_t>, meas_t, 32>(
+        map, writer, variation, [](const meas_t& value) { return value; });
 }
 
 template<class Spec, class IndexType>
@@ -69,31 +104,9 @@ bool LoadWithBitfieldIterator(StaticDataMap<Spec>& map,
                               BitfieldRangeWriteIterator<IndexType>& iter,
                               typename Spec::static_variation_t variation)
 {
-    auto next_index = map.get_selected_range().start;
-
-    for (const auto& elem : map)
-    {
-        if (elem.second.variation != variation)
-        {
-            // the variation has changed
-            return true;
-        }
-
-        if (elem.first != next_index)
-        {
-            // we've loaded all we can with a contiguous range
-            return true;
-        }
-
-        if (!iter.Write(elem.second.value.value))
-        {
-            return false;
-        }
-
-        ++next_index;
-    }
-
-    return true;
+    // a multiple of 8 so that batches after the first are packed a whole byte at a time
+    return LoadInBatches<Spec, BitfieldRangeWriteIterator<IndexType>, bool, 256>(
+        map, iter, variation, [](const typename Spec::meas_t& value) { return value.value; });
 }
 
 template<class Spec, class GV> bool WriteSingleBitfield(StaticDataMap<Spec>& map, HeaderWriter& writer)
@@ -128,123 +141,430 @@ template<class Spec, class Serializer> bool WriteWithSerializer(StaticDataMap<Sp
     return LoadWithRangeIterator<Spec, ser4cpp::UInt16>(map, iter, Serializer::svariation);
 }
 
-static_write_func_t<BinarySpec> StaticWriters::get(StaticBinaryVariation variation)
+// ---------------- packed writers, used when StaticPacking != Ranges ----------------
+
+enum class PackedHeader : uint8_t
+{
+    range,
+    prefixed
+};
+
+struct PackedSegment
+{
+    PackedHeader type;
+    bool one_byte;
+    // number of selected points the header carries, not counting padding
+    uint16_t count;
+};
+
+struct PackedPoint
+{
+    uint16_t index;
+    bool follows_previous;
+};
+
+/**
+ * Plans the headers for the leading run of selected points with the given variation so that the total size is
+ * minimal. Costs are in bits so that packed bitfields can share the planner.
+ *
+ * This is a shortest path over the points where each point is in one of four states: carried by a start-stop
+ * header or an index-prefixed header, each with 1 or 2 byte indices. A point either continues the header of the
+ * previous point or starts a new one.
+ */
+template<class Spec>
+void PlanPacking(const StaticDataMap<Spec>& map,
+                 typename Spec::static_variation_t variation,
+                 size_t object_bits,
+                 bool allow_prefixed,
+                 bool pad_gaps,
+                 size_t max_points,
+                 std::vector<PackedSegment>& plan)
+{
+    std::vector<PackedPoint> points;
+    map.visit_selected([&](uint16_t index, const SelectedValue<Spec>& value, bool follows_previous) {
+        if (value.variation != variation || points.size() == max_points)
+            return false;
+        points.push_back(PackedPoint{index, follows_previous});
+        return true;
+    });
+
+    if (points.empty())
+        return;
+
+    // states: 0 = range/1-byte, 1 = range/2-byte, 2 = prefixed/1-byte, 3 = prefixed/2-byte
+    const size_t NUM_STATES = 4;
+    const uint64_t INFINITE = std::numeric_limits<uint64_t>::max();
+    const uint8_t NEW_HEADER = 0x80;
+
+    std::vector<std::array<uint8_t, NUM_STATES>> previous(points.size());
+    std::array<uint64_t, NUM_STATES> cost{};
+
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        const auto index = points[i].index;
+        std::array<uint64_t, NUM_STATES> next;
+
+        size_t best_state = 0;
+        for (size_t state = 1; state < NUM_STATES; ++state)
+        {
+            if (cost[state] < cost[best_state])
+                best_state = state;
+        }
+
+        for (size_t state = 0; state < NUM_STATES; ++state)
+        {
+            const bool prefixed = state >= 2;
+            const size_t width = (state % 2 == 0) ? 1 : 2;
+
+            if ((prefixed && !allow_prefixed) || (width == 1 && index > ser4cpp::UInt8::max_value))
+            {
+                next[state] = INFINITE;
+                continue;
+            }
+
+            const uint64_t header_bits = 8 * (prefixed ? (3 + width) : (3 + 2 * width));
+            const uint64_t point_bits = object_bits + (prefixed ? 8 * width : 0);
+
+            // start a new header after the cheapest previous state
+            next[state] = (i == 0 ? 0 : cost[best_state]) + header_bits + point_bits;
+            previous[i][state] = static_cast<uint8_t>(NEW_HEADER | best_state);
+
+            if (i == 0 || cost[state] == INFINITE)
+                continue;
+
+            // or continue the header of the previous point
+            const auto gap = static_cast<uint64_t>(index - points[i - 1].index - 1);
+            uint64_t continued = INFINITE;
+            if (prefixed)
+            {
+                continued = cost[state] + point_bits;
+            }
+            else if (gap == 0 || (pad_gaps && points[i].follows_previous))
+            {
+                continued = cost[state] + (gap + 1) * object_bits;
+            }
+
+            if (continued <= next[state])
+            {
+                next[state] = continued;
+                previous[i][state] = static_cast<uint8_t>(state);
+            }
+        }
+
+        cost = next;
+    }
+
+    size_t state = 0;
+    for (size_t s = 1; s < NUM_STATES; ++s)
+    {
+        if (cost[s] < cost[state])
+            state = s;
+    }
+
+    // walk back from the last point, emitting a segment each time a header was started
+    const auto first = plan.size();
+    uint16_t count = 0;
+    for (size_t i = points.size(); i > 0; --i)
+    {
+        ++count;
+        const auto link = previous[i - 1][state];
+        if (link & NEW_HEADER)
+        {
+            const auto type = (state >= 2) ? PackedHeader::prefixed : PackedHeader::range;
+            plan.push_back(PackedSegment{type, state % 2 == 0, count});
+            count = 0;
+        }
+        state = link & ~NEW_HEADER;
+    }
+    std::reverse(plan.begin() + first, plan.end());
+}
+
+size_t MaxPlannedPoints(const HeaderWriter& writer, size_t object_bits)
+{
+    // nothing beyond this can fit in the fragment, whatever the headers
+    return (writer.Remaining() * 8) / object_bits + 1;
+}
+
+template<class Spec, class Serializer, class IndexType>
+bool WritePackedRange(typename StaticDataMap<Spec>::iterator& iter, HeaderWriter& writer, uint16_t count)
+{
+    const auto qc = (IndexType::size == 1) ? QualifierCode::UINT8_START_STOP : QualifierCode::UINT16_START_STOP;
+    auto range = writer.IterateOverRange<IndexType, typename Serializer::Target>(
+        qc, Serializer::Inst(), static_cast<typename IndexType::type_t>((*iter).first));
+
+    uint32_t next_index = (*iter).first;
+    for (uint16_t i = 0; i < count; ++i, ++iter)
+    {
+        const auto elem = *iter;
+
+        // bridge the gap with padding points
+        for (; next_index < elem.first; ++next_index)
+        {
+            if (!range.Write(typename Spec::meas_t()))
+                return false;
+        }
+
+        if (!range.Write(elem.second.value))
+            return false;
+
+        ++next_index;
+    }
+
+    return true;
+}
+
+template<class Spec, class GV, class IndexType>
+bool WritePackedBitfield(typename StaticDataMap<Spec>::iterator& iter, HeaderWriter& writer, uint16_t count)
+{
+    const auto qc = (IndexType::size == 1) ? QualifierCode::UINT8_START_STOP : QualifierCode::UINT16_START_STOP;
+    auto range = writer.IterateOverSingleBitfield<IndexType>(GV::ID(), qc,
+                                                              static_cast<typename IndexType::type_t>((*iter).first));
+
+    uint32_t next_index = (*iter).first;
+    for (uint16_t i = 0; i < count; ++i, ++iter)
+    {
+        const auto elem = *iter;
+
+        for (; next_index < elem.first; ++next_index)
+        {
+            if (!range.Write(false))
+                return false;
+        }
+
+        if (!range.Write(elem.second.value.value))
+            return false;
+
+        ++next_index;
+    }
+
+    return true;
+}
+
+template<class Spec, class Serializer, class IndexType>
+bool WritePackedPrefixed(typename StaticDataMap<Spec>::iterator& iter, HeaderWriter& writer, uint16_t count)
+{
+    const auto qc = (IndexType::size == 1) ? QualifierCode::UINT8_CNT_UINT8_INDEX
+                                           : QualifierCode::UINT16_CNT_UINT16_INDEX;
+
+    while (count > 0)
+    {
+        // a 1-byte count can't describe more than 255 objects, so long segments are split
+        const auto num = std::min<uint32_t>(count, IndexType::max_value);
+        auto prefixed
+            = writer.IterateOverCountWithPrefix<IndexType, typename Serializer::Target>(qc, Serializer::Inst());
+
+        for (uint32_t i = 0; i < num; ++i, ++iter)
+        {
+            const auto elem = *iter;
+            if (!prefixed.Write(elem.second.value, static_cast<typename IndexType::type_t>(elem.first)))
+                return false;
+        }
+
+        count -= static_cast<uint16_t>(num);
+    }
+
+    return true;
+}
+
+template<class Spec, class Serializer, bool PadGaps> bool WritePacked(StaticDataMap<Spec>& map, HeaderWriter& writer)
+{
+    const auto object_bits = 8 * Serializer::Inst().get_size();
+
+    std::vector<PackedSegment> plan;
+    PlanPacking(map, Serializer::svariation, object_bits, true, PadGaps,
+                MaxPlannedPoints(writer, object_bits), plan);
+
+    auto iter = map.begin();
+    for (const auto& segment : plan)
+    {
+        bool success = false;
+        if (segment.type == PackedHeader::range)
+        {
+            success = segment.one_byte
+                ? WritePackedRange<Spec, Serializer, ser4cpp::UInt8>(iter, writer, segment.count)
+                : WritePackedRange<Spec, Serializer, ser4cpp::UInt16>(iter, writer, segment.count);
+        }
+        else
+        {
+            success = segment.one_byte
+                ? WritePackedPrefixed<Spec, Serializer, ser4cpp::UInt8>(iter, writer, segment.count)
+                : WritePackedPrefixed<Spec, Serializer, ser4cpp::UInt16>(iter, writer, segment.count);
+        }
+
+        if (!success)
+            return false;
+    }
+
+    return true;
+}
+
+template<class Spec, class GV, bool PadGaps> bool WritePackedBitfields(StaticDataMap<Spec>& map, HeaderWriter& writer)
+{
+    // packed bitfields can't be index-prefixed, so only the padding decision remains
+    std::vector<PackedSegment> plan;
+    PlanPacking(map, GV::svariation, 1, false, PadGaps, MaxPlannedPoints(writer, 1), plan);
+
+    auto iter = map.begin();
+    for (const auto& segment : plan)
+    {
+        const bool success = segment.one_byte
+            ? WritePackedBitfield<Spec, GV, ser4cpp::UInt8>(iter, writer, segment.count)
+            : WritePackedBitfield<Spec, GV, ser4cpp::UInt16>(iter, writer, segment.count);
+
+        if (!success)
+            return false;
+    }
+
+    return true;
+}
+
+template<class Spec, class Serializer> static_write_func_t<Spec> serializer_writer(StaticPacking packing)
+{
+    switch (packing)
+    {
+    case (StaticPacking::Optimized):
+        return &WritePacked<Spec, Serializer, false>;
+    case (StaticPacking::OptimizedWithPadding):
+        return &WritePacked<Spec, Serializer, true>;
+    default:
+        return &WriteWithSerializer<Spec, Serializer>;
+    }
+}
+
+template<class Spec, class GV> static_write_func_t<Spec> bitfield_writer(StaticPacking packing)
+{
+    switch (packing)
+    {
+    case (StaticPacking::OptimizedWithPadding):
+        return &WritePackedBitfields<Spec, GV, true>;
+    default:
+        // without padding, one start-stop header per contiguous run is already optimal
+        return &WriteSingleBitfield<Spec, GV>;
+    }
+}
+
+static_write_func_t<BinarySpec> StaticWriters::get(StaticBinaryVariation variation, StaticPacking packing)
 {
     switch (variation)
     {
     case (StaticBinaryVariation::Group1Var1):
-        return &WriteSingleBitfield<BinarySpec, Group1Var1>;
+        return bitfield_writer<BinarySpec, Group1Var1>(packing);
     default:
-        return &WriteWithSerializer<BinarySpec, Group1Var2>;
+        return serializer_writer<BinarySpec, Group1Var2>(packing);
     }
 }
 
-static_write_func_t<DoubleBitBinarySpec> StaticWriters::get(StaticDoubleBinaryVariation variation)
+static_write_func_t<DoubleBitBinarySpec> StaticWriters::get(StaticDoubleBinaryVariation variation,
+                                                            StaticPacking packing)
 {
     switch (variation)
     {
     case (StaticDoubleBinaryVariation::Group3Var2):
-        return &WriteWithSerializer<DoubleBitBinarySpec, Group3Var2>;
+        return serializer_writer<DoubleBitBinarySpec, Group3Var2>(packing);
     default:
-        return &WriteWithSerializer<DoubleBitBinarySpec, Group3Var2>;
+        return serializer_writer<DoubleBitBinarySpec, Group3Var2>(packing);
     }
 }
 
-static_write_func_t<AnalogSpec> StaticWriters::get(StaticAnalogVariation variation)
+static_write_func_t<AnalogSpec> StaticWriters::get(StaticAnalogVariation variation, StaticPacking packing)
 {
     switch (variation)
     {
     case (StaticAnalogVariation::Group30Var1):
-        return &WriteWithSerializer<AnalogSpec, Group30Var1>;
+        return serializer_writer<AnalogSpec, Group30Var1>(packing);
     case (StaticAnalogVariation::Group30Var2):
-        return &WriteWithSerializer<AnalogSpec, Group30Var2>;
+        return serializer_writer<AnalogSpec, Group30Var2>(packing);
     case (StaticAnalogVariation::Group30Var3):
-        return &WriteWithSerializer<AnalogSpec, Group30Var3>;
+        return serializer_writer<AnalogSpec, Group30Var3>(packing);
     case (StaticAnalogVariation::Group30Var4):
-        return &WriteWithSerializer<AnalogSpec, Group30Var4>;
+        return serializer_writer<AnalogSpec, Group30Var4>(packing);
     case (StaticAnalogVariation::Group30Var5):
-        return &WriteWithSerializer<AnalogSpec, Group30Var5>;
+        return serializer_writer<AnalogSpec, Group30Var5>(packing);
     case (StaticAnalogVariation::Group30Var6):
-        return &WriteWithSerializer<AnalogSpec, Group30Var6>;
+        return serializer_writer<AnalogSpec, Group30Var6>(packing);
     default:
-        return &WriteWithSerializer<AnalogSpec, Group30Var1>;
+        return serializer_writer<AnalogSpec, Group30Var1>(packing);
     }
 }
 
-static_write_func_t<CounterSpec> StaticWriters::get(StaticCounterVariation variation)
+static_write_func_t<CounterSpec> StaticWriters::get(StaticCounterVariation variation, StaticPacking packing)
 {
     switch (variation)
     {
     case (StaticCounterVariation::Group20Var1):
-        return &WriteWithSerializer<CounterSpec, Group20Var1>;
+        return serializer_writer<CounterSpec, Group20Var1>(packing);
     case (StaticCounterVariation::Group20Var2):
-        return &WriteWithSerializer<CounterSpec, Group20Var2>;
+        return serializer_writer<CounterSpec, Group20Var2>(packing);
     case (StaticCounterVariation::Group20Var5):
-        return &WriteWithSerializer<CounterSpec, Group20Var5>;
+        return serializer_writer<CounterSpec, Group20Var5>(packing);
     case (StaticCounterVariation::Group20Var6):
-        return &WriteWithSerializer<CounterSpec, Group20Var6>;
+        return serializer_writer<CounterSpec, Group20Var6>(packing);
     default:
-        return &WriteWithSerializer<CounterSpec, Group20Var1>;
+        return serializer_writer<CounterSpec, Group20Var1>(packing);
     }
 }
 
-static_write_func_t<FrozenCounterSpec> StaticWriters::get(StaticFrozenCounterVariation variation)
+static_write_func_t<FrozenCounterSpec> StaticWriters::get(StaticFrozenCounterVariation variation, StaticPacking packing)
 {
     switch (variation)
     {
     case (StaticFrozenCounterVariation::Group21Var1):
-        return &WriteWithSerializer<FrozenCounterSpec, Group21Var1>;
+        return serializer_writer<FrozenCounterSpec, Group21Var1>(packing);
     case (StaticFrozenCounterVariation::Group21Var2):
-        return &WriteWithSerializer<FrozenCounterSpec, Group21Var2>;
+        return serializer_writer<FrozenCounterSpec, Group21Var2>(packing);
     case (StaticFrozenCounterVariation::Group21Var5):
-        return &WriteWithSerializer<FrozenCounterSpec, Group21Var5>;
+        return serializer_writer<FrozenCounterSpec, Group21Var5>(packing);
     case (StaticFrozenCounterVariation::Group21Var6):
-        return &WriteWithSerializer<FrozenCounterSpec, Group21Var6>;
+        return serializer_writer<FrozenCounterSpec, Group21Var6>(packing);
     case (StaticFrozenCounterVariation::Group21Var9):
-        return &WriteWithSerializer<FrozenCounterSpec, Group21Var9>;
+        return serializer_writer<FrozenCounterSpec, Group21Var9>(packing);
     case (StaticFrozenCounterVariation::Group21Var10):
-        return &WriteWithSerializer<FrozenCounterSpec, Group21Var10>;
+        return serializer_writer<FrozenCounterSpec, Group21Var10>(packing);
     default:
-        return &WriteWithSerializer<FrozenCounterSpec, Group21Var1>;
+        return serializer_writer<FrozenCounterSpec, Group21Var1>(packing);
     }
 }
 
-static_write_func_t<BinaryOutputStatusSpec> StaticWriters::get(StaticBinaryOutputStatusVariation variation)
+static_write_func_t<BinaryOutputStatusSpec> StaticWriters::get(StaticBinaryOutputStatusVariation variation,
+                                                               StaticPacking packing)
 {
     switch (variation)
     {
     case (StaticBinaryOutputStatusVariation::Group10Var2):
-        return &WriteWithSerializer<BinaryOutputStatusSpec, Group10Var2>;
+        return serializer_writer<BinaryOutputStatusSpec, Group10Var2>(packing);
     default:
-        return &WriteWithSerializer<BinaryOutputStatusSpec, Group10Var2>;
+        return serializer_writer<BinaryOutputStatusSpec, Group10Var2>(packing);
     }
 }
 
-static_write_func_t<AnalogOutputStatusSpec> StaticWriters::get(StaticAnalogOutputStatusVariation variation)
+static_write_func_t<AnalogOutputStatusSpec> StaticWriters::get(StaticAnalogOutputStatusVariation variation,
+                                                               StaticPacking packing)
 {
     switch (variation)
     {
     case (StaticAnalogOutputStatusVariation::Group40Var1):
-        return &WriteWithSerializer<AnalogOutputStatusSpec, Group40Var1>;
+        return serializer_writer<AnalogOutputStatusSpec, Group40Var1>(packing);
     case (StaticAnalogOutputStatusVariation::Group40Var2):
-        return &WriteWithSerializer<AnalogOutputStatusSpec, Group40Var2>;
+        return serializer_writer<AnalogOutputStatusSpec, Group40Var2>(packing);
     case (StaticAnalogOutputStatusVariation::Group40Var3):
-        return &WriteWithSerializer<AnalogOutputStatusSpec, Group40Var3>;
+        return serializer_writer<AnalogOutputStatusSpec, Group40Var3>(packing);
     case (StaticAnalogOutputStatusVariation::Group40Var4):
-        return &WriteWithSerializer<AnalogOutputStatusSpec, Group40Var4>;
+        return serializer_writer<AnalogOutputStatusSpec, Group40Var4>(packing);
     default:
-        return &WriteWithSerializer<AnalogOutputStatusSpec, Group40Var1>;
+        return serializer_writer<AnalogOutputStatusSpec, Group40Var1>(packing);
     }
 }
 
 bool write_octet_strings(StaticDataMap<OctetStringSpec>& map, HeaderWriter& writer);
 
-static_write_func_t<OctetStringSpec> StaticWriters::get(StaticOctetStringVariation /*variation*/)
+static_write_func_t<OctetStringSpec> StaticWriters::get(StaticOctetStringVariation /*variation*/,
+                                                        StaticPacking /*packing*/)
 {
     return write_octet_strings;
 }
 
-static_write_func_t<TimeAndIntervalSpec> StaticWriters::get(StaticTimeAndIntervalVariation /*variation*/)
+static_write_func_t<TimeAndIntervalSpec> StaticWriters::get(StaticTimeAndIntervalVariation /*variation*/,
+                                                            StaticPacking /*packing*/)
 {
     return &WriteWithSerializer<TimeAndIntervalSpec, Group50Var4>;
 }
@@ -31,6 +31,7 @@
 #include "opendnp3/gen/StaticCounterVariation.h"
 #include "opendnp3/gen/StaticDoubleBinaryVariation.h"
 #include "opendnp3/gen/StaticFrozenCounterVariation.h"
+#include "opendnp3/outstation/StaticPacking.h"
 #include "opendnp3/util/StaticOnly.h"
 
 namespace opendnp3
@@ -40,15 +41,24 @@ template<class Spec> using static_write_func_t = bool (*)(StaticDataMap<Spec>& m
 
 struct StaticWriters : private StaticOnly
 {
-    static static_write_func_t<BinarySpec> get(StaticBinaryVariation variation);
-    static static_write_func_t<DoubleBitBinarySpec> get(StaticDoubleBinaryVariation variation);
-    static static_write_func_t<CounterSpec> get(StaticCounterVariation variation);
-    static static_write_func_t<FrozenCounterSpec> get(StaticFrozenCounterVariation variation);
-    static static_write_func_t<AnalogSpec> get(StaticAnalogVariation variation);
-    static static_write_func_t<AnalogOutputStatusSpec> get(StaticAnalogOutputStatusVariation variation);
-    static static_write_func_t<BinaryOutputStatusSpec> get(StaticBinaryOutputStatusVariation variation);
-    static static_write_func_t<OctetStringSpec> get(StaticOctetStringVariation variation);
-    static static_write_func_t<TimeAndIntervalSpec> get(StaticTimeAndIntervalVariation variation);
+    static static_write_func_t<BinarySpec> get(StaticBinaryVariation variation,
+                                               StaticPacking packing = StaticPacking::Ranges);
+    static static_write_func_t<DoubleBitBinarySpec> get(StaticDoubleBinaryVariation variation,
+                                                        StaticPacking packing = StaticPacking::Ranges);
+    static static_write_func_t<CounterSpec> get(StaticCounterVariation variation,
+                                                StaticPacking packing = StaticPacking::Ranges);
+    static static_write_func_t<FrozenCounterSpec> get(StaticFrozenCounterVariation variation,
+                                                      StaticPacking packing = StaticPacking::Ranges);
+    static static_write_func_t<AnalogSpec> get(StaticAnalogVariation variation,
+                                               StaticPacking packing = StaticPacking::Ranges);
+    static static_write_func_t<AnalogOutputStatusSpec> get(StaticAnalogOutputStatusVariation variation,
+                                                           StaticPacking packing = StaticPacking::Ranges);
+    static static_write_func_t<BinaryOutputStatusSpec> get(StaticBinaryOutputStatusVariation variation,
+                                                           StaticPacking packing = StaticPacking::Ranges);
+    static static_write_func_t<OctetStringSpec> get(StaticOctetStringVariation variation,
+                                                    StaticPacking packing = StaticPacking::Ranges);
+    static static_write_func_t<TimeAndIntervalSpec> get(StaticTimeAndIntervalVariation variation,
+                                                        StaticPacking packing = StaticPacking::Ranges);
 };
 
 } // namespace opendnp3
@@ -0,0 +1,363 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "outstation/UpdateChannel.h"
+
+namespace opendnp3
+{
+
+UpdateChannel::UpdateChannel(uint32_t capacity, std::function<void()> onPending)
+    : capacity(GetCapacity(capacity)),
+      onPending(std::move(onPending)),
+      cells(new Cell[this->capacity]),
+      head(0),
+      pending(false),
+      blocked(0)
+{
+    for (size_t i = 0; i < this->capacity; ++i)
+    {
+        this->cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+size_t UpdateChannel::GetCapacity(uint32_t requested)
+{
+    // round up to a power of two so that positions wrap with a mask
+    size_t capacity = 2;
+    while (capacity < requested)
+    {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+size_t UpdateChannel::Drain(IUpdateHandler& handler)
+{
+    // producers that write after this point schedule another drain
+    this->pending.exchange(false, std::memory_order_acq_rel);
+
+    const auto mask = this->capacity - 1;
+    size_t count = 0;
+
+    // bound the work per call so that a steady stream of producers cannot starve the strand
+    while (count < this->capacity)
+    {
+        auto& cell = this->cells[this->tail & mask];
+        if (cell.sequence.load(std::memory_order_acquire) != this->tail + 1)
+        {
+            break;
+        }
+
+        Apply(cell.record, handler);
+        cell.sequence.store(this->tail + this->capacity, std::memory_order_release);
+        ++this->tail;
+        ++count;
+    }
+
+    return count;
+}
+
+/**
+ * Fills the run of cells reserved by UpdateBatch, publishing each record as soon as it is written
+ */
+class UpdateChannel::BatchWriter final : public UpdateRecorder
+{
+
+public:
+    BatchWriter(UpdateChannel& channel, size_t start, size_t count) : channel(channel), start(start), count(count) {}
+
+    ~BatchWriter()
+    {
+        // the consumer stops at the first unpublished cell, so every reserved cell must be released
+        Record skip;
+        skip.kind = Kind::Skip;
+        while (this->Write(skip))
+        {
+        }
+    }
+
+protected:
+    bool Write(const Record& record) override
+    {
+        if (this->written == this->count)
+        {
+            return false;
+        }
+
+        const auto pos = this->start + this->written;
+        auto& cell = this->channel.cells[pos & (this->channel.capacity - 1)];
+        cell.record = record;
+        cell.sequence.store(pos + 1, std::memory_order_release);
+        ++this->written;
+        return true;
+    }
+
+private:
+    UpdateChannel& channel;
+    const size_t start;
+    const size_t count;
+    size_t written = 0;
+};
+
+bool UpdateChannel::UpdateBatch(size_t count, const std::function<void(IUpdateHandler&)>& writer)
+{
+    if (count == 0)
+    {
+        return true;
+    }
+
+    if (count > this->capacity || this->blocked.load(std::memory_order_acquire) > 0)
+    {
+        return false;
+    }
+
+    const auto mask = this->capacity - 1;
+    auto pos = this->head.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        // cells are released in order, so if the last cell of the run is free all of them are
+        const auto last = pos + count - 1;
+        const auto sequence = this->cells[last & mask].sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(last);
+
+        if (diff == 0)
+        {
+            if (this->head.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = this->head.load(std::memory_order_relaxed);
+        }
+    }
+
+    {
+        BatchWriter batch(*this, pos, count);
+        writer(batch);
+    }
+
+    this->Notify();
+    return true;
+}
+
+void UpdateChannel::Block()
+{
+    this->blocked.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void UpdateChannel::Unblock()
+{
+    this->blocked.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+bool UpdateChannel::Write(const Record& record)
+{
+    if (this->blocked.load(std::memory_order_acquire) > 0)
+    {
+        return false;
+    }
+
+    const auto mask = this->capacity - 1;
+    auto pos = this->head.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        auto& cell = this->cells[pos & mask];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+        if (diff == 0)
+        {
+            if (this->head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.record = record;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // the consumer has not yet released this cell, the ring is full
+            return false;
+        }
+        else
+        {
+            pos = this->head.load(std::memory_order_relaxed);
+        }
+    }
+
+    this->Notify();
+    return true;
+}
+
+void UpdateChannel::Notify()
+{
+    if (!this->pending.exchange(true, std::memory_order_acq_rel))
+    {
+        this->onPending();
+    }
+}
+
+static double ToValue(double value)
+{
+    return value;
+}
+
+static double ToValue(DoubleBit value)
+{
+    return static_cast<uint8_t>(value);
+}
+
+template<class T> bool UpdateRecorder::WriteMeas(Kind kind, const T& meas, uint16_t index, EventMode mode)
+{
+    Record record;
+    record.kind = kind;
+    record.mode = mode;
+    record.index = index;
+    record.flags = meas.flags.value;
+    record.value = ToValue(meas.value);
+    record.time = meas.time;
+    return this->Write(record);
+}
+
+bool UpdateRecorder::Update(const Binary& meas, uint16_t index, EventMode mode)
+{
+    return this->WriteMeas(Kind::Binary, meas, index, mode);
+}
+
+bool UpdateRecorder::Update(const DoubleBitBinary& meas, uint16_t index, EventMode mode)
+{
+    return this->WriteMeas(Kind::DoubleBitBinary, meas, index, mode);
+}
+
+bool UpdateRecorder::Update(const Analog& meas, uint16_t index, EventMode mode)
+{
+    return this->WriteMeas(Kind::Analog, meas, index, mode);
+}
+
+bool UpdateRecorder::Update(const Counter& meas, uint16_t index, EventMode mode)
+{
+    return this->WriteMeas(Kind::Counter, meas, index, mode);
+}
+
+bool UpdateRecorder::FreezeCounter(uint16_t index, bool clear, EventMode mode)
+{
+    Record record;
+    record.kind = Kind::FreezeCounter;
+    record.mode = mode;
+    record.index = index;
+    record.extra = clear ? 1 : 0;
+    return this->Write(record);
+}
+
+bool UpdateRecorder::Update(const BinaryOutputStatus& meas, uint16_t index, EventMode mode)
+{
+    return this->WriteMeas(Kind::BinaryOutputStatus, meas, index, mode);
+}
+
+bool UpdateRecorder::Update(const AnalogOutputStatus& meas, uint16_t index, EventMode mode)
+{
+    return this->WriteMeas(Kind::AnalogOutputStatus, meas, index, mode);
+}
+
+bool UpdateRecorder::Update(const OctetString& /*meas*/, uint16_t /*index*/, EventMode /*mode*/)
+{
+    return false;
+}
+
+bool UpdateRecorder::Update(const TimeAndInterval& meas, uint16_t index)
+{
+    Record record;
+    record.kind = Kind::TimeAndInterval;
+    record.index = index;
+    record.time = meas.time;
+    record.interval = meas.interval;
+    record.extra = meas.units;
+    return this->Write(record);
+}
+
+bool UpdateRecorder::Modify(FlagsType type, uint16_t start, uint16_t stop, uint8_t flags)
+{
+    Record record;
+    record.kind = Kind::ModifyFlags;
+    record.index = start;
+    record.stop = stop;
+    record.flags = flags;
+    record.extra = FlagsTypeSpec::to_type(type);
+    return this->Write(record);
+}
+
+bool UpdateRecorder::Modify(uint16_t index, DoubleBitBinary value, EventMode mode)
+{
+    return this->WriteMeas(Kind::ModifyDoubleBit, value, index, mode);
+}
+
+void UpdateRecorder::Apply(const Record& record, IUpdateHandler& handler)
+{
+    const Flags flags(record.flags);
+
+    switch (record.kind)
+    {
+    case (Kind::Binary):
+        handler.Update(Binary(record.value != 0, flags, record.time), record.index, record.mode);
+        break;
+    case (Kind::DoubleBitBinary):
+        handler.Update(DoubleBitBinary(static_cast<DoubleBit>(static_cast<uint8_t>(record.value)), flags, record.time),
+                       record.index, record.mode);
+        break;
+    case (Kind::Analog):
+        handler.Update(Analog(record.value, flags, record.time), record.index, record.mode);
+        break;
+    case (Kind::Counter):
+        handler.Update(Counter(static_cast<uint32_t>(record.value), flags, record.time), record.index, record.mode);
+        break;
+    case (Kind::FreezeCounter):
+        handler.FreezeCounter(record.index, record.extra != 0, record.mode);
+        break;
+    case (Kind::BinaryOutputStatus):
+        handler.Update(BinaryOutputStatus(record.value != 0, flags, record.time), record.index, record.mode);
+        break;
+    case (Kind::AnalogOutputStatus):
+        handler.Update(AnalogOutputStatus(record.value, flags, record.time), record.index, record.mode);
+        break;
+    case (Kind::TimeAndInterval):
+        handler.Update(TimeAndInterval(record.time, record.interval, record.extra), record.index);
+        break;
+    case (Kind::ModifyFlags):
+        handler.Modify(FlagsTypeSpec::from_type(record.extra), record.index, record.stop, record.flags);
+        break;
+    case (Kind::ModifyDoubleBit):
+        handler.Modify(record.index,
+                       DoubleBitBinary(static_cast<DoubleBit>(static_cast<uint8_t>(record.value)), flags, record.time),
+                       record.mode);
+        break;
+    case (Kind::Skip):
+    default:
+        break;
+    }
+}
+
+} // namespace opendnp3
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_UPDATECHANNEL_H
+#define OPENDNP3_UPDATECHANNEL_H
+
+#include "opendnp3/outstation/IUpdateHandler.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace opendnp3
+{
+
+/**
+ * Converts fixed size updates into flat records that can be stored in a ring
+ *
+ * Octet strings are rejected since they do not have a fixed size.
+ */
+class UpdateRecorder : public IUpdateHandler
+{
+
+public:
+    bool Update(const Binary& meas, uint16_t index, EventMode mode = EventMode::Detect) final;
+    bool Update(const DoubleBitBinary& meas, uint16_t index, EventMode mode = EventMode::Detect) final;
+    bool Update(const Analog& meas, uint16_t index, EventMode mode = EventMode::Detect) final;
+    bool Update(const Counter& meas, uint16_t index, EventMode mode = EventMode::Detect) final;
+    bool FreezeCounter(uint16_t index, bool clear = false, EventMode mode = EventMode::Detect) final;
+    bool Update(const BinaryOutputStatus& meas, uint16_t index, EventMode mode = EventMode::Detect) final;
+    bool Update(const AnalogOutputStatus& meas, uint16_t index, EventMode mode = EventMode::Detect) final;
+    bool Update(const OctetString& meas, uint16_t index, EventMode mode = EventMode::Detect) final;
+    bool Update(const TimeAndInterval& meas, uint16_t index) final;
+    bool Modify(FlagsType type, uint16_t start, uint16_t stop, uint8_t flags) final;
+    bool Modify(uint16_t index, DoubleBitBinary value, EventMode mode = EventMode::Detect) final;
+
+protected:
+    enum class Kind : uint8_t
+    {
+        Binary,
+        DoubleBitBinary,
+        Analog,
+        Counter,
+        FreezeCounter,
+        BinaryOutputStatus,
+        AnalogOutputStatus,
+        TimeAndInterval,
+        ModifyFlags,
+        ModifyDoubleBit,
+        // fills a reserved slot that a batch did not use
+        Skip
+    };
+
+    // flat record that can describe any fixed size update
+    struct Record
+    {
+        Kind kind = Kind::Binary;
+        EventMode mode = EventMode::Detect;
+        uint16_t index = 0;
+        uint16_t stop = 0;
+        uint8_t flags = 0;
+        // clear flag of a freeze, units of a TimeAndInterval or the FlagsType of a modification
+        uint8_t extra = 0;
+        uint32_t interval = 0;
+        double value = 0;
+        DNPTime time;
+    };
+
+    virtual bool Write(const Record& record) = 0;
+
+    static void Apply(const Record& record, IUpdateHandler& handler);
+
+private:
+    template<class T> bool WriteMeas(Kind kind, const T& meas, uint16_t index, EventMode mode);
+};
+
+/**
+ * Bounded multi-producer single-consumer ring of measurement updates
+ *
+ * Any thread may write updates without allocating. The first update written after a drain invokes the 'onPending'
+ * callback, which is expected to schedule a single call to Drain on the thread that owns the database.
+ *
+ * Updates that do not have a fixed size (octet strings) are rejected and must go through IOutstation::Apply.
+ */
+class UpdateChannel final : public UpdateRecorder, private Uncopyable
+{
+
+public:
+    UpdateChannel(uint32_t capacity, std::function<void()> onPending);
+
+    /**
+     * Apply the queued updates in the order they were written
+     *
+     * @return the number of updates applied
+     */
+    size_t Drain(IUpdateHandler& handler);
+
+    /**
+     * Reserve room for 'count' updates and invoke the writer with a handler that fills it
+     *
+     * The batch occupies a contiguous run of the ring, so it is drained in order and is never interleaved with
+     * updates from other producers. Writes beyond 'count' are rejected.
+     *
+     * @return false without invoking the writer if the ring does not have room for the whole batch
+     */
+    bool UpdateBatch(size_t count, const std::function<void(IUpdateHandler&)>& writer);
+
+    /**
+     * Reject all writes until a matching call to Unblock
+     *
+     * Used to keep later updates behind a batch that is being applied some other way.
+     */
+    void Block();
+
+    void Unblock();
+
+protected:
+    bool Write(const Record& record) override;
+
+private:
+    class BatchWriter;
+
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        Record record;
+    };
+
+    void Notify();
+
+    static size_t GetCapacity(uint32_t requested);
+
+    const size_t capacity;
+    const std::function<void()> onPending;
+    const std::unique_ptr<Cell[]> cells;
+
+    std::atomic<size_t> head;
+    size_t tail = 0;
+    std::atomic<bool> pending;
+    std::atomic<uint32_t> blocked;
+};
+
+} // namespace opendnp3
+
+#endif
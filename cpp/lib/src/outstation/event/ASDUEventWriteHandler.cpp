@@ -38,13 +38,13 @@ uint16_t ASDUEventWriteHandler::Write(EventBinaryVariation variation,
     switch (variation)
     {
     case (EventBinaryVariation::Group2Var1):
-        return EventWriters::Write(this->writer, items, Group2Var1::Inst());
+        return EventWriters::Write(this->writer, items, Group2Var1::Inst(), this->compactIndices);
     case (EventBinaryVariation::Group2Var2):
-        return EventWriters::Write(this->writer, items, Group2Var2::Inst());
+        return EventWriters::Write(this->writer, items, Group2Var2::Inst(), this->compactIndices);
     case (EventBinaryVariation::Group2Var3):
-        return EventWriters::WriteWithCTO(first.time, this->writer, items, Group2Var3::Inst());
+        return EventWriters::WriteWithCTO(first.time, this->writer, items, Group2Var3::Inst(), this->compactIndices);
     default:
-        return EventWriters::Write(this->writer, items, Group2Var1::Inst());
+        return EventWriters::Write(this->writer, items, Group2Var1::Inst(), this->compactIndices);
     }
 }
 
@@ -55,13 +55,13 @@ uint16_t ASDUEventWriteHandler::Write(EventDoubleBinaryVariation variation,
     switch (variation)
     {
     case (EventDoubleBinaryVariation::Group4Var1):
-        return EventWriters::Write(this->writer, items, Group4Var1::Inst());
+        return EventWriters::Write(this->writer, items, Group4Var1::Inst(), this->compactIndices);
     case (EventDoubleBinaryVariation::Group4Var2):
-        return EventWriters::Write(this->writer, items, Group4Var2::Inst());
+        return EventWriters::Write(this->writer, items, Group4Var2::Inst(), this->compactIndices);
     case (EventDoubleBinaryVariation::Group4Var3):
-        return EventWriters::WriteWithCTO(first.time, this->writer, items, Group4Var3::Inst());
+        return EventWriters::WriteWithCTO(first.time, this->writer, items, Group4Var3::Inst(), this->compactIndices);
     default:
-        return EventWriters::Write(this->writer, items, Group4Var1::Inst());
+        return EventWriters::Write(this->writer, items, Group4Var1::Inst(), this->compactIndices);
     }
 }
 
@@ -72,15 +72,15 @@ uint16_t ASDUEventWriteHandler::Write(EventCounterVariation variation,
     switch (variation)
     {
     case (EventCounterVariation::Group22Var1):
-        return EventWriters::Write(this->writer, items, Group22Var1::Inst());
+        return EventWriters::Write(this->writer, items, Group22Var1::Inst(), this->compactIndices);
     case (EventCounterVariation::Group22Var2):
-        return EventWriters::Write(this->writer, items, Group22Var2::Inst());
+        return EventWriters::Write(this->writer, items, Group22Var2::Inst(), this->compactIndices);
     case (EventCounterVariation::Group22Var5):
-        return EventWriters::Write(this->writer, items, Group22Var5::Inst());
+        return EventWriters::Write(this->writer, items, Group22Var5::Inst(), this->compactIndices);
     case (EventCounterVariation::Group22Var6):
-        return EventWriters::Write(this->writer, items, Group22Var6::Inst());
+        return EventWriters::Write(this->writer, items, Group22Var6::Inst(), this->compactIndices);
     default:
-        return EventWriters::Write(this->writer, items, Group22Var1::Inst());
+        return EventWriters::Write(this->writer, items, Group22Var1::Inst(), this->compactIndices);
     }
 }
 
@@ -91,13 +91,13 @@ uint16_t ASDUEventWriteHandler::Write(EventFrozenCounterVariation variation,
     switch (variation)
     {
     case (EventFrozenCounterVariation::Group23Var1):
-        return EventWriters::Write(this->writer, items, Group23Var1::Inst());
+        return EventWriters::Write(this->writer, items, Group23Var1::Inst(), this->compactIndices);
     case (EventFrozenCounterVariation::Group23Var2):
-        return EventWriters::Write(this->writer, items, Group23Var2::Inst());
+        return EventWriters::Write(this->writer, items, Group23Var2::Inst(), this->compactIndices);
     case (EventFrozenCounterVariation::Group23Var5):
-        return EventWriters::Write(this->writer, items, Group23Var5::Inst());
+        return EventWriters::Write(this->writer, items, Group23Var5::Inst(), this->compactIndices);
     case (EventFrozenCounterVariation::Group23Var6):
-        return EventWriters::Write(this->writer, items, Group23Var6::Inst());
+        return EventWriters::Write(this->writer, items, Group23Var6::Inst(), this->compactIndices);
     default:
         return 0;
     }
@@ -110,23 +110,23 @@ uint16_t ASDUEventWriteHandler::Write(EventAnalogVariation variation,
     switch (variation)
     {
     case (EventAnalogVariation::Group32Var1):
-        return EventWriters::Write(this->writer, items, Group32Var1::Inst());
+        return EventWriters::Write(this->writer, items, Group32Var1::Inst(), this->compactIndices);
     case (EventAnalogVariation::Group32Var2):
-        return EventWriters::Write(this->writer, items, Group32Var2::Inst());
+        return EventWriters::Write(this->writer, items, Group32Var2::Inst(), this->compactIndices);
     case (EventAnalogVariation::Group32Var3):
-        return EventWriters::Write(this->writer, items, Group32Var3::Inst());
+        return EventWriters::Write(this->writer, items, Group32Var3::Inst(), this->compactIndices);
     case (EventAnalogVariation::Group32Var4):
-        return EventWriters::Write(this->writer, items, Group32Var4::Inst());
+        return EventWriters::Write(this->writer, items, Group32Var4::Inst(), this->compactIndices);
     case (EventAnalogVariation::Group32Var5):
-        return EventWriters::Write(this->writer, items, Group32Var5::Inst());
+        return EventWriters::Write(this->writer, items, Group32Var5::Inst(), this->compactIndices);
     case (EventAnalogVariation::Group32Var6):
-        return EventWriters::Write(this->writer, items, Group32Var6::Inst());
+        return EventWriters::Write(this->writer, items, Group32Var6::Inst(), this->compactIndices);
     case (EventAnalogVariation::Group32Var7):
-        return EventWriters::Write(this->writer, items, Group32Var7::Inst());
+        return EventWriters::Write(this->writer, items, Group32Var7::Inst(), this->compactIndices);
     case (EventAnalogVariation::Group32Var8):
-        return EventWriters::Write(this->writer, items, Group32Var8::Inst());
+        return EventWriters::Write(this->writer, items, Group32Var8::Inst(), this->compactIndices);
     default:
-        return EventWriters::Write(this->writer, items, Group32Var1::Inst());
+        return EventWriters::Write(this->writer, items, Group32Var1::Inst(), this->compactIndices);
     }
 }
 
@@ -137,11 +137,11 @@ uint16_t ASDUEventWriteHandler::Write(EventBinaryOutputStatusVariation variation
     switch (variation)
     {
     case (EventBinaryOutputStatusVariation::Group11Var1):
-        return EventWriters::Write(this->writer, items, Group11Var1::Inst());
+        return EventWriters::Write(this->writer, items, Group11Var1::Inst(), this->compactIndices);
     case (EventBinaryOutputStatusVariation::Group11Var2):
-        return EventWriters::Write(this->writer, items, Group11Var2::Inst());
+        return EventWriters::Write(this->writer, items, Group11Var2::Inst(), this->compactIndices);
     default:
-        return EventWriters::Write(this->writer, items, Group11Var1::Inst());
+        return EventWriters::Write(this->writer, items, Group11Var1::Inst(), this->compactIndices);
     }
 }
 
@@ -152,23 +152,23 @@ uint16_t ASDUEventWriteHandler::Write(EventAnalogOutputStatusVariation variation
     switch (variation)
     {
     case (EventAnalogOutputStatusVariation::Group42Var1):
-        return EventWriters::Write(this->writer, items, Group42Var1::Inst());
+        return EventWriters::Write(this->writer, items, Group42Var1::Inst(), this->compactIndices);
     case (EventAnalogOutputStatusVariation::Group42Var2):
-        return EventWriters::Write(this->writer, items, Group42Var2::Inst());
+        return EventWriters::Write(this->writer, items, Group42Var2::Inst(), this->compactIndices);
     case (EventAnalogOutputStatusVariation::Group42Var3):
-        return EventWriters::Write(this->writer, items, Group42Var3::Inst());
+        return EventWriters::Write(this->writer, items, Group42Var3::Inst(), this->compactIndices);
     case (EventAnalogOutputStatusVariation::Group42Var4):
-        return EventWriters::Write(this->writer, items, Group42Var4::Inst());
+        return EventWriters::Write(this->writer, items, Group42Var4::Inst(), this->compactIndices);
     case (EventAnalogOutputStatusVariation::Group42Var5):
-        return EventWriters::Write(this->writer, items, Group42Var5::Inst());
+        return EventWriters::Write(this->writer, items, Group42Var5::Inst(), this->compactIndices);
     case (EventAnalogOutputStatusVariation::Group42Var6):
-        return EventWriters::Write(this->writer, items, Group42Var6::Inst());
+        return EventWriters::Write(this->writer, items, Group42Var6::Inst(), this->compactIndices);
     case (EventAnalogOutputStatusVariation::Group42Var7):
-        return EventWriters::Write(this->writer, items, Group42Var7::Inst());
+        return EventWriters::Write(this->writer, items, Group42Var7::Inst(), this->compactIndices);
     case (EventAnalogOutputStatusVariation::Group42Var8):
-        return EventWriters::Write(this->writer, items, Group42Var8::Inst());
+        return EventWriters::Write(this->writer, items, Group42Var8::Inst(), this->compactIndices);
     default:
-        return EventWriters::Write(this->writer, items, Group42Var1::Inst());
+        return EventWriters::Write(this->writer, items, Group42Var1::Inst(), this->compactIndices);
     }
 }
 
@@ -176,7 +176,7 @@ uint16_t ASDUEventWriteHandler::Write(EventOctetStringVariation /*variation*/,
                                       const OctetString& first,
                                       IEventCollection<OctetString>& items)
 {
-    return EventWriters::Write(first.Size(), this->writer, items);
+    return EventWriters::Write(first.Size(), this->writer, items, this->compactIndices);
 }
 
 } // namespace opendnp3
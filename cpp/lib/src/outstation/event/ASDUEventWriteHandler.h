@@ -33,7 +33,13 @@ class ASDUEventWriteHandler final : public IEventWriteHandler, private Uncopyabl
 {
 
 public:
-    explicit ASDUEventWriteHandler(const HeaderWriter& writer) : writer(writer) {}
+    /**
+     * @param compactIndices if true, headers whose indices all fit in a byte use 1-byte count and index prefixes
+     */
+    explicit ASDUEventWriteHandler(const HeaderWriter& writer, bool compactIndices = false)
+        : writer(writer), compactIndices(compactIndices)
+    {
+    }
 
     virtual uint16_t Write(EventBinaryVariation variation,
                            const Binary& first,
@@ -62,6 +68,7 @@ public:
 
 private:
     HeaderWriter writer;
+    const bool compactIndices;
 };
 
 } // namespace opendnp3
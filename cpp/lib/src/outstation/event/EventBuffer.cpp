@@ -24,7 +24,16 @@
 namespace opendnp3
 {
 
-EventBuffer::EventBuffer(const EventBufferConfig& config) : storage(config) {}
+EventBuffer::EventBuffer(const EventBufferConfig& config, bool compactEncoding)
+    : compactEncoding(compactEncoding), storage(config)
+{
+    this->storage.SetRelativeTimeDefaults(compactEncoding);
+}
+
+void EventBuffer::SetLatencyTracing(LatencyHistogram* selectionLatency)
+{
+    this->storage.SetLatencyTracing(selectionLatency);
+}
 
 void EventBuffer::Update(const Event<BinarySpec>& evt)
 {
@@ -66,6 +75,46 @@ void EventBuffer::Update(const Event<OctetStringSpec>& evt)
     this->UpdateAny(evt);
 }
 
+void EventBuffer::Update(const Event<BinarySpec>* events, size_t count)
+{
+    this->UpdateAny(events, count);
+}
+
+void EventBuffer::Update(const Event<DoubleBitBinarySpec>* events, size_t count)
+{
+    this->UpdateAny(events, count);
+}
+
+void EventBuffer::Update(const Event<AnalogSpec>* events, size_t count)
+{
+    this->UpdateAny(events, count);
+}
+
+void EventBuffer::Update(const Event<CounterSpec>* events, size_t count)
+{
+    this->UpdateAny(events, count);
+}
+
+void EventBuffer::Update(const Event<FrozenCounterSpec>* events, size_t count)
+{
+    this->UpdateAny(events, count);
+}
+
+void EventBuffer::Update(const Event<BinaryOutputStatusSpec>* events, size_t count)
+{
+    this->UpdateAny(events, count);
+}
+
+void EventBuffer::Update(const Event<AnalogOutputStatusSpec>* events, size_t count)
+{
+    this->UpdateAny(events, count);
+}
+
+void EventBuffer::Update(const Event<OctetStringSpec>* events, size_t count)
+{
+    this->UpdateAny(events, count);
+}
+
 void EventBuffer::Unselect()
 {
     this->storage.Unselect();
@@ -193,7 +242,7 @@ bool EventBuffer::HasAnySelection() const
 
 bool EventBuffer::Load(HeaderWriter& writer)
 {
-    ASDUEventWriteHandler handler(writer);
+    ASDUEventWriteHandler handler(writer, this->compactEncoding);
     this->storage.Write(handler);
     // all selected events were written?
     return this->storage.NumSelected() == 0;
@@ -45,7 +45,11 @@ class EventBuffer final : public IEventReceiver, public IEventSelector, public I
 {
 
 public:
-    explicit EventBuffer(const EventBufferConfig& config);
+    /**
+     * @param compactEncoding if true, events are written with 1-byte index prefixes whenever a header allows it
+     * and timed binary/double-bit events selected by class are written relative to a common time of occurrence
+     */
+    explicit EventBuffer(const EventBufferConfig& config, bool compactEncoding = false);
 
     // ------- IEventReceiver ------
 
@@ -58,6 +62,15 @@ public:
     virtual void Update(const Event<AnalogOutputStatusSpec>& evt) override;
     virtual void Update(const Event<OctetStringSpec>& evt) override;
 
+    virtual void Update(const Event<BinarySpec>* events, size_t count) override;
+    virtual void Update(const Event<DoubleBitBinarySpec>* events, size_t count) override;
+    virtual void Update(const Event<AnalogSpec>* events, size_t count) override;
+    virtual void Update(const Event<CounterSpec>* events, size_t count) override;
+    virtual void Update(const Event<FrozenCounterSpec>* events, size_t count) override;
+    virtual void Update(const Event<BinaryOutputStatusSpec>* events, size_t count) override;
+    virtual void Update(const Event<AnalogOutputStatusSpec>* events, size_t count) override;
+    virtual void Update(const Event<OctetStringSpec>* events, size_t count) override;
+
     // ------- IEventSelector ------
 
     virtual void Unselect();
@@ -83,10 +96,12 @@ public:
     void SelectAllByClass(const ClassField& clazz);
 
     uint32_t NumEvents(EventClass ec) const;
-    
+
+    void SetLatencyTracing(LatencyHistogram* selectionLatency);
 
 private:
     bool overflow = false;
+    const bool compactEncoding;
     EventStorage storage;
 
     IINField SelectMaxCount(GroupVariation gv, uint32_t maximum);
@@ -105,6 +120,14 @@ private:
         }
     }
 
+    template<class T> void UpdateAny(const Event<T>* events, size_t count)
+    {
+        if (this->storage.Update(events, count))
+        {
+            this->overflow = true;
+        }
+    }
+
     IINField SelectByClass(uint32_t max, EventClass clazz)
     {
         this->storage.SelectByClass(clazz, max);
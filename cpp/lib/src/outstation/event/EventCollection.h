@@ -44,6 +44,8 @@ public:
 
     virtual uint16_t WriteSome(IEventWriter<typename T::meas_t>& writer) override;
 
+    virtual bool IndicesFit(uint16_t maxIndex, uint16_t count) override;
+
 private:
     bool WriteOne(IEventWriter<typename T::meas_t>& writer);
 };
@@ -58,6 +60,25 @@ template<class T> uint16_t EventCollection<T>::WriteSome(IEventWriter<typename T
     return num_written;
 }
 
+template<class T> bool EventCollection<T>::IndicesFit(uint16_t maxIndex, uint16_t count)
+{
+    // walk a copy so that the write position is left untouched
+    auto iter = this->iterator;
+    for (uint16_t i = 0; i < count; ++i)
+    {
+        EventRecord* record = EventWriting::FindNextSelected(iter, T::EventTypeEnum);
+
+        if (!record || TypedStorage<T>::Retrieve(*record)->value.selectedVariation != this->variation)
+            return true;
+
+        if (record->index > maxIndex)
+            return false;
+
+        iter.Next();
+    }
+    return true;
+}
+
 template<class T> bool EventCollection<T>::WriteOne(IEventWriter<typename T::meas_t>& writer)
 {
     // don't bother searching
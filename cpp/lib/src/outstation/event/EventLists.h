@@ -26,6 +26,7 @@
 #include "app/MeasurementTypeSpecs.h"
 
 #include "opendnp3/outstation/EventBufferConfig.h"
+#include "opendnp3/util/LatencyHistogram.h"
 #include "opendnp3/util/Uncopyable.h"
 
 namespace opendnp3
@@ -49,6 +50,12 @@ public:
 
     EventClassCounters counters;
 
+    // if set, events are timestamped when added and the time until their first selection is recorded
+    LatencyHistogram* selectionLatency = nullptr;
+
+    // if set, timed binary and double-bit events default to their relative time variations
+    bool relativeTimeDefaults = false;
+
 private:
     // sub-lists just act as type-specific storage
     List<TypedEventRecord<BinarySpec>> binary;
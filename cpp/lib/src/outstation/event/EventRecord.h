@@ -26,6 +26,8 @@
 
 #include "opendnp3/app/EventType.h"
 
+#include <chrono>
+
 namespace opendnp3
 {
 
@@ -44,6 +46,9 @@ public:
     EventClass clazz = EventClass::EC1;
     EventState state = EventState::unselected;
 
+    // when the event was added to the buffer, only set if latency tracing is enabled
+    std::chrono::steady_clock::time_point applied;
+
     // always set as a unit
     IEventType* type = nullptr;
     void* storage_node = nullptr;
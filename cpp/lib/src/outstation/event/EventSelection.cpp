@@ -26,6 +26,7 @@ namespace opendnp3
 uint32_t EventSelection::SelectByClass(EventLists& lists, const ClassField& clazz, uint32_t max)
 {
     uint32_t num_selected = 0;
+    const auto now = SelectionTime(lists);
     auto iter = lists.events.Iterate();
 
     while (iter.HasNext() && num_selected < max)
@@ -37,6 +38,7 @@ uint32_t EventSelection::SelectByClass(EventLists& lists, const ClassField& claz
             node->value.state = EventState::selected;
             // TODO - set the storage to use the default variation
             // node->value.selectedVariation = useDefaultVariation ? node->value.defaultVariation : variation;
+            RecordSelection(lists, node->value, now);
             ++num_selected;
             lists.counters.OnSelect();
         }
@@ -45,4 +47,19 @@ uint32_t EventSelection::SelectByClass(EventLists& lists, const ClassField& claz
     return num_selected;
 }
 
+void EventSelection::RecordSelection(EventLists& lists, EventRecord& record, std::chrono::steady_clock::time_point now)
+{
+    // events that are unselected and selected again are only recorded the first time
+    if (lists.selectionLatency && record.applied != std::chrono::steady_clock::time_point())
+    {
+        lists.selectionLatency->Record(now - record.applied);
+        record.applied = std::chrono::steady_clock::time_point();
+    }
+}
+
+std::chrono::steady_clock::time_point EventSelection::SelectionTime(const EventLists& lists)
+{
+    return lists.selectionLatency ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+}
+
 } // namespace opendnp3
@@ -43,6 +43,10 @@ struct EventSelection : private StaticOnly
     static uint32_t SelectByClass(EventLists& lists, const ClassField& clazz, uint32_t max);
 
 private:
+    static void RecordSelection(EventLists& lists, EventRecord& record, std::chrono::steady_clock::time_point now);
+
+    static std::chrono::steady_clock::time_point SelectionTime(const EventLists& lists);
+
     template<class T>
     static uint32_t SelectByTypeGeneric(EventLists& lists,
                                         bool useDefaultVariation,
@@ -59,6 +63,7 @@ uint32_t EventSelection::SelectByTypeGeneric(EventLists& lists,
     auto& list = lists.GetList<T>();
 
     uint32_t num_selected = 0;
+    const auto now = SelectionTime(lists);
 
     auto select = [&](TypedEventRecord<T>& node) -> bool {
         if (num_selected == max)
@@ -68,6 +73,7 @@ uint32_t EventSelection::SelectByTypeGeneric(EventLists& lists,
         {
             node.record->value.state = EventState::selected;
             node.selectedVariation = useDefaultVariation ? node.defaultVariation : variation;
+            RecordSelection(lists, node.record->value, now);
             lists.counters.OnSelect();
             ++num_selected;
         }
@@ -29,6 +29,11 @@ namespace opendnp3
 
 EventStorage::EventStorage(const EventBufferConfig& config) : state(config) {}
 
+void EventStorage::SetRelativeTimeDefaults(bool enabled)
+{
+    this->state.relativeTimeDefaults = enabled;
+}
+
 bool EventStorage::IsAnyTypeFull() const
 {
     return this->state.IsAnyTypeFull();
@@ -44,6 +49,11 @@ uint32_t EventStorage::NumUnwritten(EventClass clazz) const
     return this->state.counters.total.Get(clazz) - this->state.counters.written.Get(clazz);
 }
 
+void EventStorage::SetLatencyTracing(LatencyHistogram* selectionLatency)
+{
+    this->state.selectionLatency = selectionLatency;
+}
+
 bool EventStorage::Update(const Event<BinarySpec>& evt)
 {
     return EventUpdate::Update(state, evt);
@@ -84,6 +94,46 @@ bool EventStorage::Update(const Event<OctetStringSpec>& evt)
     return EventUpdate::Update(state, evt);
 }
 
+bool EventStorage::Update(const Event<BinarySpec>* events, size_t count)
+{
+    return EventUpdate::Update(state, events, count);
+}
+
+bool EventStorage::Update(const Event<DoubleBitBinarySpec>* events, size_t count)
+{
+    return EventUpdate::Update(state, events, count);
+}
+
+bool EventStorage::Update(const Event<AnalogSpec>* events, size_t count)
+{
+    return EventUpdate::Update(state, events, count);
+}
+
+bool EventStorage::Update(const Event<CounterSpec>* events, size_t count)
+{
+    return EventUpdate::Update(state, events, count);
+}
+
+bool EventStorage::Update(const Event<FrozenCounterSpec>* events, size_t count)
+{
+    return EventUpdate::Update(state, events, count);
+}
+
+bool EventStorage::Update(const Event<BinaryOutputStatusSpec>* events, size_t count)
+{
+    return EventUpdate::Update(state, events, count);
+}
+
+bool EventStorage::Update(const Event<AnalogOutputStatusSpec>* events, size_t count)
+{
+    return EventUpdate::Update(state, events, count);
+}
+
+bool EventStorage::Update(const Event<OctetStringSpec>* events, size_t count)
+{
+    return EventUpdate::Update(state, events, count);
+}
+
 uint32_t EventStorage::SelectByType(EventBinaryVariation variation, uint32_t max)
 {
     return EventSelection::SelectByType<BinarySpec>(this->state, variation, max);
@@ -44,6 +44,9 @@ class EventStorage
 public:
     explicit EventStorage(const EventBufferConfig& config);
 
+    // timed binary and double-bit events inserted from now on default to their relative time variations
+    void SetRelativeTimeDefaults(bool enabled);
+
     bool IsAnyTypeFull() const;
 
     // number selected
@@ -52,6 +55,9 @@ public:
     // unselected/selected but not already written
     uint32_t NumUnwritten(EventClass clazz) const;
 
+    // record the time from insertion until selection of each event, nullptr disables tracing
+    void SetLatencyTracing(LatencyHistogram* selectionLatency);
+
     // write selected events to some handler
     uint32_t Write(IEventWriteHandler& handler);
 
@@ -72,6 +78,15 @@ public:
     bool Update(const Event<AnalogOutputStatusSpec>& evt);
     bool Update(const Event<OctetStringSpec>& evt);
 
+    bool Update(const Event<BinarySpec>* events, size_t count);
+    bool Update(const Event<DoubleBitBinarySpec>* events, size_t count);
+    bool Update(const Event<AnalogSpec>* events, size_t count);
+    bool Update(const Event<CounterSpec>* events, size_t count);
+    bool Update(const Event<FrozenCounterSpec>* events, size_t count);
+    bool Update(const Event<BinaryOutputStatusSpec>* events, size_t count);
+    bool Update(const Event<AnalogOutputStatusSpec>* events, size_t count);
+    bool Update(const Event<OctetStringSpec>* events, size_t count);
+
     // ---- function used to select distinct types ----
 
     uint32_t SelectByType(EventBinaryVariation variation, uint32_t max);
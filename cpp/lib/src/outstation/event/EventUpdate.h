@@ -24,12 +24,42 @@
 #include "EventTypeImpl.h"
 #include "outstation/Event.h"
 
+#include <chrono>
+#include <cstddef>
+
 namespace opendnp3
 {
 
 struct EventUpdate : private StaticOnly
 {
     template<class T> static bool Update(EventLists& lists, const Event<T>& event);
+
+    // inserts a batch of events of the same type, returns true if any of them caused an overflow
+    template<class T> static bool Update(EventLists& lists, const Event<T>* events, size_t count);
+
+private:
+    template<class T>
+    static bool Insert(EventLists& lists,
+                       List<TypedEventRecord<T>>& list,
+                       const Event<T>& event,
+                       const std::chrono::steady_clock::time_point& applied);
+
+    // maps absolute time variations to the equivalent variation written relative to a CTO
+    static EventBinaryVariation RelativeTime(EventBinaryVariation variation)
+    {
+        return (variation == EventBinaryVariation::Group2Var2) ? EventBinaryVariation::Group2Var3 : variation;
+    }
+
+    static EventDoubleBinaryVariation RelativeTime(EventDoubleBinaryVariation variation)
+    {
+        return (variation == EventDoubleBinaryVariation::Group4Var2) ? EventDoubleBinaryVariation::Group4Var3
+                                                                     : variation;
+    }
+
+    template<class V> static V RelativeTime(V variation)
+    {
+        return variation;
+    }
 };
 
 template<class T> bool EventUpdate::Update(EventLists& lists, const Event<T>& event)
@@ -40,6 +70,42 @@ template<class T> bool EventUpdate::Update(EventLists& lists, const Event<T>& ev
     if (list.Capacity() == 0)
         return false;
 
+    const auto applied
+        = lists.selectionLatency ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+    return Insert(lists, list, event, applied);
+}
+
+template<class T> bool EventUpdate::Update(EventLists& lists, const Event<T>* events, size_t count)
+{
+    auto& list = lists.GetList<T>();
+
+    // lists with no capacity don't cause "buffer overflow"
+    if (list.Capacity() == 0)
+        return false;
+
+    // the whole batch is applied at the same time
+    const auto applied
+        = lists.selectionLatency ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+    bool overflow = false;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (Insert(lists, list, events[i], applied))
+        {
+            overflow = true;
+        }
+    }
+
+    return overflow;
+}
+
+template<class T>
+bool EventUpdate::Insert(EventLists& lists,
+                         List<TypedEventRecord<T>>& list,
+                         const Event<T>& event,
+                         const std::chrono::steady_clock::time_point& applied)
+{
     bool overflow = false;
 
     if (list.IsFullAndCapacityNotZero())
@@ -62,12 +128,18 @@ template<class T> bool EventUpdate::Update(EventLists& lists, const Event<T>& ev
     const auto record_node = lists.events.Add(EventRecord(event.index, event.clazz));
 
     // followed by the typed record
-    const auto typed_node = list.Add(TypedEventRecord<T>(event.value, event.variation, record_node));
+    const auto variation = lists.relativeTimeDefaults ? RelativeTime(event.variation) : event.variation;
+    const auto typed_node = list.Add(TypedEventRecord<T>(event.value, variation, record_node));
 
     // configure the typed storage
     record_node->value.type = EventTypeImpl<T>::Instance();
     record_node->value.storage_node = typed_node;
 
+    if (lists.selectionLatency)
+    {
+        record_node->value.applied = applied;
+    }
+
     lists.counters.OnAdd(event.clazz);
 
     return overflow;
@@ -25,16 +25,15 @@
 namespace opendnp3
 {
 
-class OctetStringEventWriter : public IEventWriter<OctetString>
+template<class PrefixType> class OctetStringEventWriter : public IEventWriter<OctetString>
 {
     const OctetStringSerializer serializer;
-    PrefixedWriteIterator<ser4cpp::UInt16, OctetString> iterator;
+    PrefixedWriteIterator<PrefixType, OctetString> iterator;
+    uint16_t count = 0;
 
 public:
-    OctetStringEventWriter(HeaderWriter& writer, uint8_t size)
-        : serializer(true, size),
-          iterator(
-              writer.IterateOverCountWithPrefix<ser4cpp::UInt16>(QualifierCode::UINT16_CNT_UINT16_INDEX, serializer))
+    OctetStringEventWriter(HeaderWriter& writer, QualifierCode qc, uint8_t size)
+        : serializer(true, size), iterator(writer.IterateOverCountWithPrefix<PrefixType>(qc, serializer))
     {
     }
 
@@ -43,13 +42,29 @@ public:
         if (meas.Size() != this->serializer.get_size())
             return false;
 
-        return iterator.Write(meas, index);
+        if (count == PrefixType::max_value || index > PrefixType::max_value)
+            return false;
+
+        if (!iterator.Write(meas, static_cast<typename PrefixType::type_t>(index)))
+            return false;
+
+        ++count;
+        return true;
     }
 };
 
-uint16_t EventWriters::Write(uint8_t firstSize, HeaderWriter& writer, IEventCollection<OctetString>& items)
+uint16_t EventWriters::Write(uint8_t firstSize,
+                             HeaderWriter& writer,
+                             IEventCollection<OctetString>& items,
+                             bool compactIndices)
 {
-    OctetStringEventWriter handler(writer, firstSize);
+    if (UseOctetIndices(items, compactIndices))
+    {
+        OctetStringEventWriter<ser4cpp::UInt8> handler(writer, QualifierCode::UINT8_CNT_UINT8_INDEX, firstSize);
+        return items.WriteSome(handler);
+    }
+
+    OctetStringEventWriter<ser4cpp::UInt16> handler(writer, QualifierCode::UINT16_CNT_UINT16_INDEX, firstSize);
     return items.WriteSome(handler);
 }
 
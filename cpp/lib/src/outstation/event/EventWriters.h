@@ -36,9 +36,18 @@ class EventWriters
 
 public:
     template<class T>
-    static uint16_t Write(HeaderWriter& writer, IEventCollection<T>& items, const DNP3Serializer<T>& serializer)
+    static uint16_t Write(HeaderWriter& writer,
+                          IEventCollection<T>& items,
+                          const DNP3Serializer<T>& serializer,
+                          bool compactIndices = false)
     {
-        BasicEventWriter<T> handler(writer, serializer);
+        if (UseOctetIndices(items, compactIndices))
+        {
+            BasicEventWriter<ser4cpp::UInt8, T> handler(writer, serializer);
+            return items.WriteSome(handler);
+        }
+
+        BasicEventWriter<ser4cpp::UInt16, T> handler(writer, serializer);
         return items.WriteSome(handler);
     }
 
@@ -46,60 +55,95 @@ public:
     static uint16_t WriteWithCTO(const DNPTime& cto,
                                  HeaderWriter& writer,
                                  IEventCollection<T>& items,
-                                 const DNP3Serializer<T>& serializer)
+                                 const DNP3Serializer<T>& serializer,
+                                 bool compactIndices = false)
     {
         if (cto.quality == TimestampQuality::SYNCHRONIZED)
         {
             Group51Var1 value;
             value.time = cto;
-            CTOEventWriter<T, Group51Var1> handler(value, writer, serializer);
-            return items.WriteSome(handler);
+            return WriteWithCTO(value, writer, items, serializer, compactIndices);
         }
         else
         {
             Group51Var2 value;
             value.time = cto;
-            CTOEventWriter<T, Group51Var2> handler(value, writer, serializer);
-            return items.WriteSome(handler);
+            return WriteWithCTO(value, writer, items, serializer, compactIndices);
         }
     }
 
-    static uint16_t Write(uint8_t firstSize, HeaderWriter& writer, IEventCollection<OctetString>& items);
+    static uint16_t Write(uint8_t firstSize,
+                          HeaderWriter& writer,
+                          IEventCollection<OctetString>& items,
+                          bool compactIndices = false);
 
 private:
-    template<class T> class BasicEventWriter final : public IEventWriter<T>
+    template<class T> static bool UseOctetIndices(IEventCollection<T>& items, bool compactIndices)
+    {
+        // a header can only use 1-byte prefixes if everything it could hold fits in them
+        return compactIndices && items.IndicesFit(ser4cpp::UInt8::max_value, ser4cpp::UInt8::max_value);
+    }
+
+    template<class T, class U>
+    static uint16_t WriteWithCTO(const U& cto,
+                                 HeaderWriter& writer,
+                                 IEventCollection<T>& items,
+                                 const DNP3Serializer<T>& serializer,
+                                 bool compactIndices)
+    {
+        if (UseOctetIndices(items, compactIndices))
+        {
+            CTOEventWriter<ser4cpp::UInt8, T, U> handler(cto, writer, serializer);
+            return items.WriteSome(handler);
+        }
+
+        CTOEventWriter<ser4cpp::UInt16, T, U> handler(cto, writer, serializer);
+        return items.WriteSome(handler);
+    }
+
+    template<class PrefixType> static QualifierCode CountQualifier();
+
+    template<class PrefixType, class T> class BasicEventWriter final : public IEventWriter<T>
     {
-        PrefixedWriteIterator<ser4cpp::UInt16, T> iterator;
+        PrefixedWriteIterator<PrefixType, T> iterator;
+        uint16_t count = 0;
 
     public:
         BasicEventWriter(HeaderWriter& writer, const DNP3Serializer<T>& serializer)
-            : iterator(writer.IterateOverCountWithPrefix<ser4cpp::UInt16, T>(QualifierCode::UINT16_CNT_UINT16_INDEX,
-                                                                             serializer))
+            : iterator(writer.IterateOverCountWithPrefix<PrefixType, T>(CountQualifier<PrefixType>(), serializer))
         {
         }
 
         virtual bool Write(const T& meas, uint16_t index) override
         {
-            return iterator.IsValid() ? iterator.Write(meas, index) : false;
+            if (!iterator.IsValid() || count == PrefixType::max_value || index > PrefixType::max_value)
+                return false;
+
+            if (!iterator.Write(meas, static_cast<typename PrefixType::type_t>(index)))
+                return false;
+
+            ++count;
+            return true;
         }
     };
 
-    template<class T, class U> class CTOEventWriter final : public IEventWriter<T>
+    template<class PrefixType, class T, class U> class CTOEventWriter final : public IEventWriter<T>
     {
         const DNPTime cto;
-        PrefixedWriteIterator<ser4cpp::UInt16, T> iterator;
+        PrefixedWriteIterator<PrefixType, T> iterator;
+        uint16_t count = 0;
 
     public:
         CTOEventWriter(const U& cto, HeaderWriter& writer, const DNP3Serializer<T>& serializer)
             : cto(cto.time),
-              iterator(writer.IterateOverCountWithPrefixAndCTO<ser4cpp::UInt16, T, U>(
-                  QualifierCode::UINT16_CNT_UINT16_INDEX, serializer, cto))
+              iterator(writer.IterateOverCountWithPrefixAndCTO<PrefixType, T, U>(CountQualifier<PrefixType>(),
+                                                                                 serializer, cto))
         {
         }
 
         virtual bool Write(const T& meas, uint16_t index) override
         {
-            if (!this->iterator.IsValid())
+            if (!this->iterator.IsValid() || this->count == PrefixType::max_value || index > PrefixType::max_value)
                 return false;
 
             // Check that the quality of the measurement fits with the CTO variation
@@ -127,11 +171,25 @@ private:
             auto copy = meas;
             copy.time = DNPTime(diff);
 
-            return this->iterator.Write(copy, index);
+            if (!this->iterator.Write(copy, static_cast<typename PrefixType::type_t>(index)))
+                return false;
+
+            ++this->count;
+            return true;
         }
     };
 };
 
+template<> inline QualifierCode EventWriters::CountQualifier<ser4cpp::UInt8>()
+{
+    return QualifierCode::UINT8_CNT_UINT8_INDEX;
+}
+
+template<> inline QualifierCode EventWriters::CountQualifier<ser4cpp::UInt16>()
+{
+    return QualifierCode::UINT16_CNT_UINT16_INDEX;
+}
+
 } // namespace opendnp3
 
 #endif
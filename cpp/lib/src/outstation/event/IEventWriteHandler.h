@@ -44,6 +44,9 @@ template<class T> class IEventCollection
 {
 public:
     virtual uint16_t WriteSome(IEventWriter<T>& handler) = 0;
+
+    // true if none of the next 'count' events that WriteSome(..) would visit has an index above 'maxIndex'
+    virtual bool IndicesFit(uint16_t maxIndex, uint16_t count) = 0;
 };
 
 class IEventWriteHandler
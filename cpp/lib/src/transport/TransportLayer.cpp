@@ -89,6 +89,11 @@ bool TransportLayer::OnReceive(const Message& message)
     return false;
 }
 
+ser4cpp::wseq_t TransportLayer::GetReceiveBuffer(size_t length)
+{
+    return isOnline ? receiver.GetSegmentBuffer(length) : ser4cpp::wseq_t::empty();
+}
+
 bool TransportLayer::OnTxReady()
 {
     if (!isOnline)
@@ -130,6 +135,12 @@ StackStatistics::Transport TransportLayer::GetStatistics() const
     return StackStatistics::Transport(this->receiver.Statistics(), this->transmitter.Statistics());
 }
 
+void TransportLayer::SetLatencyTracing(StackStatistics::Latency& latency)
+{
+    this->receiver.SetLatencyTracing(&latency.firstSegmentToFragment);
+    this->transmitter.SetLatencyTracing(&latency.queuedToFirstFrame);
+}
+
 bool TransportLayer::OnLowerLayerUp()
 {
     if (isOnline)
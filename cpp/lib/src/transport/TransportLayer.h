@@ -49,6 +49,7 @@ public:
     // ------ IUpperLayer ------
 
     virtual bool OnReceive(const Message& message) override;
+    virtual ser4cpp::wseq_t GetReceiveBuffer(size_t length) override;
     virtual bool OnLowerLayerUp() override final;
     virtual bool OnLowerLayerDown() override;
     virtual bool OnTxReady() override;
@@ -59,6 +60,9 @@ public:
 
     StackStatistics::Transport GetStatistics() const;
 
+    // record transport latency into the stack's histograms
+    void SetLatencyTracing(StackStatistics::Latency& latency);
+
 private:
     Logger logger;
 
@@ -33,7 +33,7 @@ namespace opendnp3
 {
 
 TransportRx::TransportRx(const Logger& logger, uint32_t maxRxFragSize)
-    : logger(logger), rxBuffer(maxRxFragSize), numBytesRead(0)
+    : logger(logger), rxBuffer(maxRxFragSize + 1), numBytesRead(0)
 {
 }
 
@@ -49,7 +49,22 @@ void TransportRx::ClearRxBuffer()
 
 ser4cpp::wseq_t TransportRx::GetAvailable()
 {
-    return rxBuffer.as_wslice().skip(numBytesRead);
+    return rxBuffer.as_wslice().skip(1 + numBytesRead);
+}
+
+ser4cpp::wseq_t TransportRx::GetSegmentBuffer(size_t length)
+{
+    // the header goes one byte before the write position so the payload follows the bytes already read
+    auto dest = rxBuffer.as_wslice().skip(numBytesRead);
+    return (length <= dest.length()) ? ser4cpp::wseq_t(dest, length) : ser4cpp::wseq_t::empty();
+}
+
+void TransportRx::RestoreLastByte()
+{
+    if (numBytesRead > 0)
+    {
+        rxBuffer.as_wslice()[numBytesRead] = lastByte;
+    }
 }
 
 Message TransportRx::ProcessReceive(const Message& segment)
@@ -67,6 +82,9 @@ Message TransportRx::ProcessReceive(const Message& segment)
 
     const auto payload = segment.payload.skip(1);
 
+    // a segment staged by GetSegmentBuffer may have overwritten the end of the fragment with its header
+    this->RestoreLastByte();
+
     FORMAT_LOG_BLOCK(logger, flags::TRANSPORT_RX, "FIR: %d FIN: %d SEQ: %u LEN: %zu", header.fir, header.fin,
                      header.seq, payload.length());
 
@@ -118,17 +136,35 @@ Message TransportRx::ProcessReceive(const Message& segment)
         return Message();
     }
 
-    available.copy_from(payload);
+    // segments staged by GetSegmentBuffer are already in place
+    if (static_cast<const uint8_t*>(payload) != static_cast<uint8_t*>(available))
+    {
+        // the payload may have been staged at a different offset, so it can overlap the destination
+        std::memmove(available, payload, payload.length());
+    }
+
+    if (this->reassemblyLatency && header.fir)
+    {
+        this->firstSegmentTime = std::chrono::steady_clock::now();
+    }
 
     this->numBytesRead += payload.length();
+    if (this->numBytesRead > 0)
+    {
+        this->lastByte = rxBuffer.as_wslice()[numBytesRead];
+    }
     this->lastAddresses = segment.addresses;
     this->expectedSeq = header.seq;
     this->expectedSeq.Increment();
 
     if (header.fin)
     {
-        const auto ret = rxBuffer.as_rslice().take(numBytesRead);
+        const auto ret = rxBuffer.as_rslice().skip(1).take(numBytesRead);
         this->numBytesRead = 0;
+        if (this->reassemblyLatency)
+        {
+            this->reassemblyLatency->Record(std::chrono::steady_clock::now() - this->firstSegmentTime);
+        }
         return Message(segment.addresses, ret);
     }
 
@@ -44,8 +44,18 @@ public:
 
     Message ProcessReceive(const Message& segment);
 
+    // storage where the link layer can write a received segment of the given length so that its payload
+    // lands directly in the reassembly buffer, empty if the segment would overflow the buffer
+    ser4cpp::wseq_t GetSegmentBuffer(size_t length);
+
     void Reset();
 
+    // record the time from the first segment until reassembly of each fragment, nullptr disables tracing
+    void SetLatencyTracing(LatencyHistogram* reassemblyLatency)
+    {
+        this->reassemblyLatency = reassemblyLatency;
+    }
+
     const StackStatistics::Transport::Rx& Statistics() const
     {
         return statistics;
@@ -56,14 +66,22 @@ private:
 
     void ClearRxBuffer();
 
+    void RestoreLastByte();
+
     Logger logger;
     StackStatistics::Transport::Rx statistics;
 
+    // the fragment starts at offset 1, leaving room for the header of a segment staged in front of its payload
     ser4cpp::Buffer rxBuffer;
     size_t numBytesRead;
+    // the last byte of the fragment, which a staged segment header overwrites
+    uint8_t lastByte = 0;
     Addresses lastAddresses;
 
     TransportSeqNum expectedSeq;
+
+    LatencyHistogram* reassemblyLatency = nullptr;
+    std::chrono::steady_clock::time_point firstSegmentTime;
 };
 
 } // namespace opendnp3
@@ -20,6 +20,7 @@
 #include "TransportTx.h"
 
 #include "TransportHeader.h"
+#include "link/LinkFrame.h"
 #include "logging/LogMacros.h"
 
 #include "opendnp3/logging/LogLevels.h"
@@ -39,6 +40,11 @@ void TransportTx::Configure(const Message& message)
     txSegment.clear();
     this->message = message;
     this->tpduCount = 0;
+    this->numEncodedFrames = 0;
+    if (this->firstFrameLatency)
+    {
+        this->configureTime = std::chrono::steady_clock::now();
+    }
 }
 
 bool TransportTx::HasValue() const
@@ -76,6 +82,25 @@ ser4cpp::rseq_t TransportTx::GetSegment()
 
 bool TransportTx::Advance()
 {
+    if (this->firstFrameLatency && tpduCount == 0)
+    {
+        this->firstFrameLatency->Record(std::chrono::steady_clock::now() - this->configureTime);
+    }
+
+    // all the remaining segments were written as one block by EncodeFrames
+    if (this->numEncodedFrames > 0)
+    {
+        statistics.numTransportTx += this->numEncodedFrames;
+        tpduCount += this->numEncodedFrames;
+        for (uint32_t i = 0; i < this->numEncodedFrames; ++i)
+        {
+            sequence.Increment();
+        }
+        this->numEncodedFrames = 0;
+        this->message.payload.advance(this->message.payload.length());
+        return false;
+    }
+
     txSegment.clear();
     size_t numToSend
         = this->message.payload.length() < MAX_TPDU_PAYLOAD ? this->message.payload.length() : MAX_TPDU_PAYLOAD;
@@ -85,4 +110,54 @@ bool TransportTx::Advance()
     return this->message.payload.is_not_empty();
 }
 
+size_t TransportTx::GetFramesSize() const
+{
+    const auto length = this->message.payload.length();
+    const auto numFull = length / MAX_TPDU_PAYLOAD;
+    const auto remainder = length % MAX_TPDU_PAYLOAD;
+
+    return numFull * LinkFrame::CalcFrameSize(MAX_TPDU_LENGTH)
+        + ((remainder > 0) ? LinkFrame::CalcFrameSize(remainder + 1) : 0);
+}
+
+ser4cpp::rseq_t TransportTx::EncodeFrames(ser4cpp::wseq_t& buffer, bool isMaster, Logger* linkLogger)
+{
+    if (buffer.length() < this->GetFramesSize())
+    {
+        return ser4cpp::rseq_t::empty();
+    }
+
+    txSegment.clear();
+
+    // the segments are only consumed by Advance() once the frames have been written
+    auto payload = this->message.payload;
+    auto seq = this->sequence;
+    const auto start = buffer.readonly();
+    size_t total = 0;
+    this->numEncodedFrames = 0;
+
+    while (payload.is_not_empty())
+    {
+        const size_t numToSend = (payload.length() < MAX_TPDU_PAYLOAD) ? payload.length() : MAX_TPDU_PAYLOAD;
+
+        const bool fir = (tpduCount == 0 && this->numEncodedFrames == 0);
+        const bool fin = (numToSend == payload.length());
+
+        FORMAT_LOG_BLOCK(logger, flags::TRANSPORT_TX, "FIR: %d FIN: %d SEQ: %u LEN: %zu", fir, fin, seq.Get(),
+                         numToSend);
+
+        // the payload goes straight from the APDU into the frame
+        const auto frame = LinkFrame::FormatUnconfirmedUserData(
+            buffer, isMaster, this->message.addresses.destination, this->message.addresses.source,
+            TransportHeader::ToByte(fir, fin, seq), payload.take(numToSend), linkLogger);
+
+        total += frame.length();
+        payload.advance(numToSend);
+        seq.Increment();
+        ++this->numEncodedFrames;
+    }
+
+    return start.take(total);
+}
+
 } // namespace opendnp3
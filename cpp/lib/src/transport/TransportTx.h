@@ -45,6 +45,12 @@ public:
 
     void Configure(const Message& message);
 
+    // record the time from Configure() until the first segment is written, nullptr disables tracing
+    void SetLatencyTracing(LatencyHistogram* firstFrameLatency)
+    {
+        this->firstFrameLatency = firstFrameLatency;
+    }
+
     // -------  IBufferSegment ------------
 
     virtual const Addresses& GetAddresses() const override
@@ -58,6 +64,15 @@ public:
 
     virtual bool Advance() override;
 
+    virtual size_t GetFramesSize() const override;
+
+    virtual ser4cpp::rseq_t EncodeFrames(ser4cpp::wseq_t& buffer, bool isMaster, Logger* linkLogger) override;
+
+    virtual uint32_t GetNumEncodedFrames() const override
+    {
+        return numEncodedFrames;
+    }
+
     const StackStatistics::Transport::Tx& Statistics() const
     {
         return statistics;
@@ -75,6 +90,11 @@ private:
     StackStatistics::Transport::Tx statistics;
     TransportSeqNum sequence;
     uint32_t tpduCount = 0;
+    // number of frames written by EncodeFrames that Advance() has yet to consume
+    uint32_t numEncodedFrames = 0;
+
+    LatencyHistogram* firstFrameLatency = nullptr;
+    std::chrono::steady_clock::time_point configureTime;
 };
 
 } // namespace opendnp3
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "opendnp3/util/LatencyHistogram.h"
+
+#include <limits>
+
+namespace opendnp3
+{
+
+void LatencyHistogram::Record(std::chrono::steady_clock::duration latency)
+{
+    const auto count = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    const uint64_t micros = (count < 0) ? 0 : static_cast<uint64_t>(count);
+
+    // index of the highest set bit + 1, capped at the last bucket
+    uint8_t bucket = 0;
+    for (uint64_t value = micros; value != 0 && bucket < (NUM_BUCKETS - 1); value >>= 1)
+    {
+        ++bucket;
+    }
+
+    if (this->count == 0 || micros < this->minMicros)
+    {
+        this->minMicros = micros;
+    }
+    if (micros > this->maxMicros)
+    {
+        this->maxMicros = micros;
+    }
+
+    ++this->count;
+    this->sumMicros += micros;
+    ++this->buckets[bucket];
+}
+
+uint64_t LatencyHistogram::UpperBoundMicros(uint8_t bucket)
+{
+    if (bucket >= (NUM_BUCKETS - 1))
+    {
+        return std::numeric_limits<uint64_t>::max();
+    }
+
+    return static_cast<uint64_t>(1) << bucket;
+}
+
+uint64_t LatencyHistogram::MeanMicros() const
+{
+    return (this->count == 0) ? 0 : this->sumMicros / this->count;
+}
+
+uint64_t LatencyHistogram::PercentileMicros(double percentile) const
+{
+    if (this->count == 0)
+    {
+        return 0;
+    }
+
+    const auto target = static_cast<uint64_t>((percentile / 100.0) * static_cast<double>(this->count));
+
+    uint64_t total = 0;
+    for (uint8_t i = 0; i < NUM_BUCKETS; ++i)
+    {
+        total += this->buckets[i];
+        if (total > target || total == this->count)
+        {
+            // never report more than the largest observed sample
+            const auto bound = UpperBoundMicros(i);
+            return (bound > this->maxMicros) ? this->maxMicros : bound;
+        }
+    }
+
+    return this->maxMicros;
+}
+
+} // namespace opendnp3
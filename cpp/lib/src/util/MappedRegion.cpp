@@ -0,0 +1,143 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "util/MappedRegion.h"
+
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace opendnp3
+{
+
+#ifdef _WIN32
+
+static void* MapFile(size_t size, const std::string& path, std::error_code& ec)
+{
+    const auto file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                  nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        ec = std::error_code(static_cast<int>(GetLastError()), std::system_category());
+        return nullptr;
+    }
+
+    const auto size64 = static_cast<uint64_t>(size);
+    const auto mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(size64 >> 32),
+                                            static_cast<DWORD>(size64 & 0xFFFFFFFF), nullptr);
+    if (mapping == nullptr)
+    {
+        ec = std::error_code(static_cast<int>(GetLastError()), std::system_category());
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    // the view keeps the mapping alive once the handles are closed
+    const auto view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (view == nullptr)
+    {
+        ec = std::error_code(static_cast<int>(GetLastError()), std::system_category());
+    }
+
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return view;
+}
+
+static void UnmapFile(void* data, size_t /*size*/)
+{
+    UnmapViewOfFile(data);
+}
+
+#else
+
+static void* MapFile(size_t size, const std::string& path, std::error_code& ec)
+{
+    const auto fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        ec = std::error_code(errno, std::system_category());
+        return nullptr;
+    }
+
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+    {
+        ec = std::error_code(errno, std::system_category());
+        close(fd);
+        return nullptr;
+    }
+
+    // the mapping stays valid once the descriptor is closed
+    const auto view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (view == MAP_FAILED)
+    {
+        ec = std::error_code(errno, std::system_category());
+        close(fd);
+        return nullptr;
+    }
+
+    close(fd);
+    return view;
+}
+
+static void UnmapFile(void* data, size_t size)
+{
+    munmap(data, size);
+}
+
+#endif
+
+std::unique_ptr<MappedRegion> MappedRegion::Create(size_t size, const std::string& path, std::error_code& ec)
+{
+    if (path.empty())
+    {
+        return std::unique_ptr<MappedRegion>(new MappedRegion(new uint8_t[size](), size, false));
+    }
+
+    const auto view = MapFile(size, path, ec);
+    if (!view)
+    {
+        return nullptr;
+    }
+
+    // the file may hold the contents of a previous run
+    std::memset(view, 0, size);
+    return std::unique_ptr<MappedRegion>(new MappedRegion(static_cast<uint8_t*>(view), size, true));
+}
+
+MappedRegion::~MappedRegion()
+{
+    if (this->mapped)
+    {
+        UnmapFile(this->data, this->size);
+    }
+    else
+    {
+        delete[] this->data;
+    }
+}
+
+} // namespace opendnp3
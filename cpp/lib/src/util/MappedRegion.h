@@ -0,0 +1,70 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_MAPPEDREGION_H
+#define OPENDNP3_MAPPEDREGION_H
+
+#include "opendnp3/util/Uncopyable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <system_error>
+
+namespace opendnp3
+{
+
+/**
+ * Zero-initialized block of memory, either private to the process or a shared mapping of a file
+ */
+class MappedRegion final : private Uncopyable
+{
+
+public:
+    /**
+     * @param size number of bytes
+     * @param path file to map, the region is allocated on the heap if empty
+     * @return nullptr and sets 'ec' if the file could not be mapped
+     */
+    static std::unique_ptr<MappedRegion> Create(size_t size, const std::string& path, std::error_code& ec);
+
+    ~MappedRegion();
+
+    uint8_t* Data() const
+    {
+        return this->data;
+    }
+
+    size_t Size() const
+    {
+        return this->size;
+    }
+
+private:
+    MappedRegion(uint8_t* data, size_t size, bool mapped) : data(data), size(size), mapped(mapped) {}
+
+    uint8_t* const data;
+    const size_t size;
+    const bool mapped;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,260 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/SharedChannelData.h"
+#include "channel/TCPClientIOHandler.h"
+#include "mocks/MockIO.h"
+#include "mocks/MockTCPClient.h"
+
+#include <dnp3mocks/MockLogHandler.h>
+
+#include <catch.hpp>
+
+using namespace opendnp3;
+
+#define SUITE(name) "TCPClientIOHandlerSuite - " name
+
+namespace
+{
+const std::vector<IPEndpoint> endpoints{IPEndpoint::Localhost(20000), IPEndpoint::Localhost(20001),
+                                        IPEndpoint::Localhost(20002)};
+
+class RaceFixture
+{
+
+public:
+    explicit RaceFixture(std::chrono::milliseconds raceDelay,
+                         TimeDuration minOpenRetry = TimeDuration::Milliseconds(10),
+                         bool infiniteTries = true)
+        : io(MockIO::Create()),
+          executor(io->GetExecutor()),
+          factory(executor),
+          handler(TCPClientIOHandler::Create(log.logger,
+                                             nullptr,
+                                             executor,
+                                             Retry(minOpenRetry, infiniteTries),
+                                             Settings(raceDelay),
+                                             "127.0.0.1",
+                                             std::make_shared<SharedChannelData>(log.logger),
+                                             true,
+                                             [this] { ++this->numConnectionFailures; },
+                                             nullptr,
+                                             factory.Get()))
+    {
+    }
+
+    ~RaceFixture()
+    {
+        this->handler->Shutdown();
+        this->io->RunUntilOutOfWork();
+    }
+
+    static ChannelRetry Retry(TimeDuration minOpenRetry, bool infiniteTries)
+    {
+        ChannelRetry retry(minOpenRetry, TimeDuration::Seconds(1));
+        retry.InfiniteTries(infiniteTries);
+        return retry;
+    }
+
+    static TCPSettings Settings(std::chrono::milliseconds raceDelay)
+    {
+        TCPSettings settings;
+        settings.Endpoints = IPEndpointsList(endpoints);
+        settings.ConnectionRaceDelay = raceDelay;
+        return settings;
+    }
+
+    LinkStatistics::Channel Statistics() const
+    {
+        return this->handler->Statistics().channel;
+    }
+
+    MockLogHandler log;
+    size_t numConnectionFailures = 0;
+    const std::shared_ptr<MockIO> io;
+    const std::shared_ptr<exe4cpp::StrandExecutor> executor;
+    MockTCPClientFactory factory;
+    const std::shared_ptr<TCPClientIOHandler> handler;
+};
+} // namespace
+
+TEST_CASE(SUITE("Races one client per endpoint, starting with the first"))
+{
+    RaceFixture fixture(std::chrono::seconds(10));
+
+    fixture.handler->Prepare();
+
+    REQUIRE(fixture.factory.clients.size() == endpoints.size());
+    const auto connecting = fixture.factory.Connecting();
+    REQUIRE(connecting.size() == 1);
+    REQUIRE(connecting[0] == fixture.factory.clients[0]);
+    REQUIRE(connecting[0]->remote == endpoints[0]);
+}
+
+TEST_CASE(SUITE("Staggers the start of each attempt by the race delay"))
+{
+    const auto delay = std::chrono::milliseconds(50);
+    RaceFixture fixture(delay);
+
+    const auto start = std::chrono::steady_clock::now();
+    fixture.handler->Prepare();
+
+    // nothing else starts until the delay expires
+    fixture.io->RunUntilOutOfWork();
+    REQUIRE(fixture.factory.Connecting().size() == 1);
+
+    fixture.io->RunUntilTimeout([&]() { return fixture.factory.Connecting().size() == 2; });
+    REQUIRE(std::chrono::steady_clock::now() - start >= delay);
+    REQUIRE(fixture.factory.clients[1]->remote == endpoints[1]);
+
+    fixture.io->RunUntilTimeout([&]() { return fixture.factory.Connecting().size() == 3; });
+    REQUIRE(std::chrono::steady_clock::now() - start >= 2 * delay);
+    REQUIRE(fixture.factory.clients[2]->remote == endpoints[2]);
+}
+
+TEST_CASE(SUITE("A failed attempt starts the next one without waiting for the delay"))
+{
+    RaceFixture fixture(std::chrono::seconds(10));
+
+    fixture.handler->Prepare();
+    fixture.factory.clients[0]->Fail();
+
+    const auto connecting = fixture.factory.Connecting();
+    REQUIRE(connecting.size() == 1);
+    REQUIRE(connecting[0] == fixture.factory.clients[1]);
+    REQUIRE(fixture.Statistics().numOpenFail._value == 1);
+}
+
+TEST_CASE(SUITE("The first connection wins and cancels the others"))
+{
+    RaceFixture fixture(std::chrono::milliseconds(1));
+
+    fixture.handler->Prepare();
+    fixture.io->RunUntilTimeout([&]() { return fixture.factory.Connecting().size() == endpoints.size(); });
+
+    fixture.factory.clients[1]->Succeed();
+
+    REQUIRE(fixture.Statistics().numOpen._value == 1);
+    REQUIRE(fixture.Statistics().numOpenFail._value == 0);
+    REQUIRE(fixture.factory.Connecting().empty());
+    REQUIRE(fixture.factory.clients[0]->numCancel > 0);
+    REQUIRE(fixture.factory.clients[2]->numCancel > 0);
+
+    // the race is over, no attempts are started later on
+    fixture.io->RunUntilOutOfWork();
+    REQUIRE(fixture.factory.clients.size() == endpoints.size());
+    REQUIRE(fixture.Statistics().numOpen._value == 1);
+}
+
+TEST_CASE(SUITE("Retries with a new race once every attempt fails"))
+{
+    RaceFixture fixture(std::chrono::seconds(10), TimeDuration::Milliseconds(20));
+
+    fixture.handler->Prepare();
+    for (size_t i = 0; i < endpoints.size(); ++i)
+    {
+        fixture.factory.clients[i]->Fail();
+    }
+
+    REQUIRE(fixture.Statistics().numOpenFail._value == endpoints.size());
+    REQUIRE(fixture.factory.Connecting().empty());
+
+    const auto start = std::chrono::steady_clock::now();
+    fixture.io->RunUntilTimeout([&]() { return fixture.factory.clients.size() == 2 * endpoints.size(); });
+    REQUIRE(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+
+    // the new race starts from the first endpoint again with fresh clients
+    const auto connecting = fixture.factory.Connecting();
+    REQUIRE(connecting.size() == 1);
+    REQUIRE(connecting[0] == fixture.factory.clients[endpoints.size()]);
+    REQUIRE(connecting[0]->remote == endpoints[0]);
+}
+
+TEST_CASE(SUITE("The next race starts with the previous winner"))
+{
+    RaceFixture fixture(std::chrono::milliseconds(1));
+
+    fixture.handler->Prepare();
+    fixture.io->RunUntilTimeout([&]() { return fixture.factory.Connecting().size() == endpoints.size(); });
+
+    fixture.factory.clients[1]->Succeed();
+    REQUIRE(fixture.Statistics().numOpen._value == 1);
+
+    // the remote closes the connection, the handler reconnects with a new race
+    fixture.factory.clients[1]->peer->close();
+    fixture.io->RunUntilTimeout([&]() { return fixture.factory.clients.size() == 2 * endpoints.size(); });
+
+    const auto connecting = fixture.factory.Connecting();
+    REQUIRE(connecting.size() == 1);
+    REQUIRE(connecting[0]->remote == endpoints[1]);
+
+    // the others follow in list order, wrapping around
+    fixture.io->RunUntilTimeout([&]() { return fixture.factory.Connecting().size() == endpoints.size(); });
+    REQUIRE(fixture.factory.clients[endpoints.size() + 1]->remote == endpoints[2]);
+    REQUIRE(fixture.factory.clients[endpoints.size() + 2]->remote == endpoints[0]);
+}
+
+TEST_CASE(SUITE("With finite tries every endpoint starts one race before giving up"))
+{
+    RaceFixture fixture(std::chrono::seconds(10), TimeDuration::Milliseconds(1), false);
+
+    fixture.handler->Prepare();
+
+    for (size_t race = 0; race < endpoints.size(); ++race)
+    {
+        fixture.io->RunUntilTimeout([&]() { return fixture.factory.clients.size() == (race + 1) * endpoints.size(); });
+
+        const auto connecting = fixture.factory.Connecting();
+        REQUIRE(connecting.size() == 1);
+        REQUIRE(connecting[0]->remote == endpoints[race]);
+        REQUIRE(fixture.numConnectionFailures == 0);
+
+        for (size_t i = 0; i < endpoints.size(); ++i)
+        {
+            fixture.factory.clients[race * endpoints.size() + i]->Fail();
+        }
+    }
+
+    fixture.io->RunUntilTimeout([&]() { return fixture.numConnectionFailures > 0; });
+    REQUIRE(fixture.numConnectionFailures == 1);
+    REQUIRE(fixture.factory.clients.size() == endpoints.size() * endpoints.size());
+    REQUIRE(fixture.Statistics().numOpenFail._value == endpoints.size() * endpoints.size());
+}
+
+TEST_CASE(SUITE("Shutdown during a race cancels every attempt"))
+{
+    RaceFixture fixture(std::chrono::milliseconds(1));
+
+    fixture.handler->Prepare();
+    fixture.io->RunUntilTimeout([&]() { return fixture.factory.Connecting().size() == 2; });
+
+    fixture.handler->Shutdown();
+
+    REQUIRE(fixture.factory.Connecting().empty());
+    for (const auto& client : fixture.factory.clients)
+    {
+        REQUIRE(client->numCancel > 0);
+    }
+
+    // the stagger timer was canceled, so the last endpoint is never tried
+    fixture.io->RunUntilOutOfWork();
+    REQUIRE(fixture.factory.clients.size() == endpoints.size());
+    REQUIRE(fixture.factory.clients[2]->numConnect == 0);
+    REQUIRE(fixture.Statistics().numOpen._value == 0);
+}
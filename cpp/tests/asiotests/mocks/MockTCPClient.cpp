@@ -0,0 +1,104 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "mocks/MockTCPClient.h"
+
+#include <stdexcept>
+
+using namespace opendnp3;
+
+bool MockTCPClient::Cancel()
+{
+    ++this->numCancel;
+
+    if (this->canceled || !this->callback)
+    {
+        return false;
+    }
+
+    // like TCPClient, a canceled attempt never invokes its callback
+    this->canceled = true;
+    this->callback = nullptr;
+    return true;
+}
+
+bool MockTCPClient::BeginConnect(const IPEndpoint& remote, const connect_callback_t& callback)
+{
+    if (this->callback || this->canceled)
+    {
+        return false;
+    }
+
+    ++this->numConnect;
+    this->remote = remote;
+    this->callback = callback;
+    return true;
+}
+
+void MockTCPClient::Succeed()
+{
+    // connect a real socket pair over loopback so the handler gets a working channel
+    auto& io = *this->executor->get_context();
+    asio::ip::tcp::acceptor acceptor(io, asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+    asio::ip::tcp::socket socket(io);
+    socket.connect(acceptor.local_endpoint());
+    this->peer = std::make_shared<asio::ip::tcp::socket>(io);
+    acceptor.accept(*this->peer);
+
+    this->Complete(std::move(socket), std::error_code());
+}
+
+void MockTCPClient::Fail(const std::error_code& ec)
+{
+    this->Complete(asio::ip::tcp::socket(*this->executor->get_context()), ec);
+}
+
+void MockTCPClient::Complete(asio::ip::tcp::socket socket, const std::error_code& ec)
+{
+    if (!this->callback)
+    {
+        throw std::logic_error("no connection attempt in progress");
+    }
+
+    const auto cb = this->callback;
+    this->callback = nullptr;
+    cb(this->executor, std::move(socket), ec);
+}
+
+std::function<std::shared_ptr<ITCPClient>()> MockTCPClientFactory::Get()
+{
+    return [this]() -> std::shared_ptr<ITCPClient> {
+        auto client = std::make_shared<MockTCPClient>(this->executor);
+        this->clients.push_back(client);
+        return client;
+    };
+}
+
+std::vector<std::shared_ptr<MockTCPClient>> MockTCPClientFactory::Connecting() const
+{
+    std::vector<std::shared_ptr<MockTCPClient>> connecting;
+    for (const auto& client : this->clients)
+    {
+        if (client->IsConnecting())
+        {
+            connecting.push_back(client);
+        }
+    }
+    return connecting;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_ASIOTESTS_MOCKTCPCLIENT_H
+#define OPENDNP3_ASIOTESTS_MOCKTCPCLIENT_H
+
+#include "channel/ITCPClient.h"
+
+#include <memory>
+#include <vector>
+
+/**
+ * Records connection attempts so that tests decide when and how they complete
+ */
+class MockTCPClient final : public opendnp3::ITCPClient
+{
+
+public:
+    explicit MockTCPClient(std::shared_ptr<exe4cpp::StrandExecutor> executor) : executor(std::move(executor)) {}
+
+    bool Cancel() override;
+
+    bool BeginConnect(const opendnp3::IPEndpoint& remote, const connect_callback_t& callback) override;
+
+    // complete the pending attempt with a socket that can be read and written
+    void Succeed();
+
+    void Fail(const std::error_code& ec = std::make_error_code(std::errc::connection_refused));
+
+    bool IsConnecting() const
+    {
+        return this->callback != nullptr;
+    }
+
+    size_t numConnect = 0;
+    size_t numCancel = 0;
+    opendnp3::IPEndpoint remote;
+
+    // the server side of the last successful connection
+    std::shared_ptr<asio::ip::tcp::socket> peer;
+
+private:
+    void Complete(asio::ip::tcp::socket socket, const std::error_code& ec);
+
+    const std::shared_ptr<exe4cpp::StrandExecutor> executor;
+    connect_callback_t callback;
+    bool canceled = false;
+};
+
+/**
+ * Hands out a new MockTCPClient for every client the IO handler creates
+ */
+class MockTCPClientFactory final
+{
+
+public:
+    explicit MockTCPClientFactory(std::shared_ptr<exe4cpp::StrandExecutor> executor) : executor(std::move(executor)) {}
+
+    std::function<std::shared_ptr<opendnp3::ITCPClient>()> Get();
+
+    // the clients connecting right now, in the order they were created
+    std::vector<std::shared_ptr<MockTCPClient>> Connecting() const;
+
+    std::vector<std::shared_ptr<MockTCPClient>> clients;
+
+private:
+    const std::shared_ptr<exe4cpp::StrandExecutor> executor;
+};
+
+#endif
@@ -0,0 +1,202 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/tls/SSLContextCache.h"
+
+#include <dnp3mocks/MockLogHandler.h>
+
+#include <catch.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+using namespace opendnp3;
+
+#define SUITE(name) "SSLContextCacheSuite - " name
+
+namespace
+{
+const auto key1 = "certs/self_signed/entity1_key.pem";
+const auto key2 = "certs/self_signed/entity2_key.pem";
+const auto cert1 = "certs/self_signed/entity1_cert.pem";
+const auto cert2 = "certs/self_signed/entity2_cert.pem";
+
+// local certificate and key that the tests rotate on disk
+const auto rotatedCert = "ssl_context_cache_cert.pem";
+const auto rotatedKey = "ssl_context_cache_key.pem";
+
+void Copy(const std::string& from, const std::string& to)
+{
+    std::ifstream in(from, std::ios::binary);
+    std::ofstream out(to, std::ios::binary | std::ios::trunc);
+    out << in.rdbuf();
+}
+
+class RotatedFiles
+{
+public:
+    RotatedFiles()
+    {
+        this->Rotate(cert1, key1);
+    }
+
+    ~RotatedFiles()
+    {
+        std::remove(rotatedCert);
+        std::remove(rotatedKey);
+    }
+
+    void Rotate(const std::string& cert, const std::string& key)
+    {
+        Copy(cert, rotatedCert);
+        Copy(key, rotatedKey);
+    }
+};
+
+bool UsesCertificate(const std::shared_ptr<SSLContext>& context, const std::string& file)
+{
+    auto ctx = SSL_CTX_new(TLS_method());
+    SSL_CTX_use_certificate_chain_file(ctx, file.c_str());
+    const auto equal = X509_cmp(SSL_CTX_get0_certificate(context->value.native_handle()), SSL_CTX_get0_certificate(ctx)) == 0;
+    SSL_CTX_free(ctx);
+    return equal;
+}
+} // namespace
+
+TEST_CASE(SUITE("returns the same context for the same role and configuration"))
+{
+    MockLogHandler log;
+    SSLContextCache cache;
+    std::error_code ec;
+
+    const auto first = cache.Get(log.logger, false, TLSConfig(cert2, cert1, key1), ec);
+    REQUIRE_FALSE(ec);
+    const auto second = cache.Get(log.logger, false, TLSConfig(cert2, cert1, key1), ec);
+    REQUIRE_FALSE(ec);
+
+    REQUIRE(first);
+    REQUIRE(first == second);
+    REQUIRE(cache.Size() == 1);
+}
+
+TEST_CASE(SUITE("loads a separate context for a different role or configuration"))
+{
+    MockLogHandler log;
+    SSLContextCache cache;
+    std::error_code ec;
+
+    const auto client = cache.Get(log.logger, false, TLSConfig(cert2, cert1, key1), ec);
+    const auto server = cache.Get(log.logger, true, TLSConfig(cert2, cert1, key1), ec);
+    const auto other = cache.Get(log.logger, false, TLSConfig(cert1, cert2, key2), ec);
+    REQUIRE_FALSE(ec);
+
+    REQUIRE(client != server);
+    REQUIRE(client != other);
+    REQUIRE(server != other);
+    REQUIRE(cache.Size() == 3);
+}
+
+TEST_CASE(SUITE("does not cache a configuration that fails to load"))
+{
+    MockLogHandler log;
+    SSLContextCache cache;
+    std::error_code ec;
+
+    REQUIRE_FALSE(cache.Get(log.logger, false, TLSConfig(cert2, "missing_cert.pem", key1), ec));
+    REQUIRE(ec);
+    REQUIRE(cache.Size() == 0);
+}
+
+TEST_CASE(SUITE("reload replaces the context with the files currently on disk"))
+{
+    MockLogHandler log;
+    RotatedFiles files;
+    SSLContextCache cache;
+    std::error_code ec;
+
+    const TLSConfig config(cert2, rotatedCert, rotatedKey);
+    const auto before = cache.Get(log.logger, false, config, ec);
+    REQUIRE(UsesCertificate(before, cert1));
+
+    files.Rotate(cert2, key2);
+    REQUIRE(cache.Reload() == 0);
+
+    const auto after = cache.Get(log.logger, false, config, ec);
+    REQUIRE(after != before);
+    REQUIRE(UsesCertificate(after, cert2));
+
+    // the connections established before the reload keep their context
+    REQUIRE(UsesCertificate(before, cert1));
+}
+
+TEST_CASE(SUITE("a configuration that fails to reload keeps the previous context"))
+{
+    MockLogHandler log;
+    RotatedFiles files;
+    SSLContextCache cache;
+    std::error_code ec;
+
+    const TLSConfig config(cert2, rotatedCert, rotatedKey);
+    const auto before = cache.Get(log.logger, false, config, ec);
+
+    // a certificate that doesn't match the private key
+    Copy(cert2, rotatedCert);
+    REQUIRE(cache.Reload() == 1);
+
+    REQUIRE(cache.Get(log.logger, false, config, ec) == before);
+}
+
+TEST_CASE(SUITE("evicts configurations that are no longer used"))
+{
+    MockLogHandler log;
+    SSLContextCache cache;
+    std::error_code ec;
+
+    auto unused = cache.Get(log.logger, false, TLSConfig(cert2, cert1, key1), ec);
+    const auto used = cache.Get(log.logger, false, TLSConfig(cert1, cert2, key2), ec);
+    REQUIRE(cache.Size() == 2);
+
+    unused.reset();
+
+    // eviction happens when another configuration is loaded
+    cache.Get(log.logger, true, TLSConfig(cert1, cert2, key2), ec);
+    REQUIRE(cache.Size() == 2);
+    REQUIRE(cache.Get(log.logger, false, TLSConfig(cert1, cert2, key2), ec) == used);
+}
+
+TEST_CASE(SUITE("keeps a reloaded configuration while connections hold the replaced context"))
+{
+    MockLogHandler log;
+    RotatedFiles files;
+    SSLContextCache cache;
+    std::error_code ec;
+
+    const TLSConfig config(cert2, rotatedCert, rotatedKey);
+    auto established = cache.Get(log.logger, false, config, ec);
+
+    REQUIRE(cache.Reload() == 0);
+
+    // only the cache holds the reloaded context, but the established connection still uses the configuration
+    REQUIRE(cache.Reload() == 0);
+    REQUIRE(cache.Size() == 1);
+
+    established.reset();
+    REQUIRE(cache.Reload() == 0);
+    REQUIRE(cache.Size() == 0);
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/ConnectionAdmission.h"
+#include "channel/SharedChannelData.h"
+#include "channel/tls/TLSClientIOHandler.h"
+#include "mocks/MockIO.h"
+#include "tls/mocks/MockTLSServer.h"
+
+#include <dnp3mocks/MockLogHandler.h>
+
+#include <catch.hpp>
+
+using namespace opendnp3;
+
+#define SUITE(name) "TLSClientIOHandlerSuite - " name
+
+namespace
+{
+const auto key1 = "certs/self_signed/entity1_key.pem";
+const auto key2 = "certs/self_signed/entity2_key.pem";
+const auto cert1 = "certs/self_signed/entity1_cert.pem";
+const auto cert2 = "certs/self_signed/entity2_cert.pem";
+
+const uint16_t port = 20005;
+
+class AdmissionFixture
+{
+
+public:
+    AdmissionFixture()
+        : io(MockIO::Create()),
+          executor(io->GetExecutor()),
+          admission(std::make_shared<ConnectionAdmission>(1)),
+          server(MockTLSServer::Create(log.logger, executor, IPEndpoint::Localhost(port), TLSConfig(cert1, cert2, key2), ec)),
+          handler(TLSClientIOHandler::Create(log.logger,
+                                             nullptr,
+                                             executor,
+                                             TLSConfig(cert2, cert1, key1),
+                                             ChannelRetry::Default(),
+                                             IPEndpointsList({IPEndpoint::Localhost(port)}),
+                                             "127.0.0.1",
+                                             std::make_shared<SharedChannelData>(log.logger),
+                                             nullptr,
+                                             nullptr,
+                                             nullptr,
+                                             admission))
+    {
+    }
+
+    ~AdmissionFixture()
+    {
+        this->handler->Shutdown();
+        if (this->server)
+        {
+            this->server->Shutdown();
+        }
+        this->io->RunUntilOutOfWork();
+    }
+
+    MockLogHandler log;
+    std::error_code ec;
+    const std::shared_ptr<MockIO> io;
+    const std::shared_ptr<exe4cpp::StrandExecutor> executor;
+    const std::shared_ptr<ConnectionAdmission> admission;
+    const std::shared_ptr<MockTLSServer> server;
+    const std::shared_ptr<TLSClientIOHandler> handler;
+};
+} // namespace
+
+TEST_CASE(SUITE("Connection attempts wait for admission and release it once connected"))
+{
+    AdmissionFixture fixture;
+    REQUIRE(fixture.server);
+
+    // another channel holds the only slot
+    const auto blocker = fixture.admission->Request(fixture.executor, 0, [] {});
+    REQUIRE(fixture.admission->NumInFlight() == 1);
+
+    fixture.handler->Prepare();
+    fixture.io->RunUntilOutOfWork();
+
+    REQUIRE(fixture.admission->NumQueued() == 1);
+    REQUIRE(fixture.server->channels.empty());
+    REQUIRE(fixture.handler->Statistics().channel.numOpen._value == 0);
+
+    fixture.admission->Release(blocker);
+    fixture.io->RunUntilTimeout([&]() {
+        return fixture.handler->Statistics().channel.numOpen._value == 1 && fixture.server->channels.size() == 1;
+    });
+
+    REQUIRE(fixture.admission->NumQueued() == 0);
+    REQUIRE(fixture.admission->NumInFlight() == 0);
+}
+
+TEST_CASE(SUITE("Shutdown withdraws a queued connection attempt"))
+{
+    AdmissionFixture fixture;
+    REQUIRE(fixture.server);
+
+    const auto blocker = fixture.admission->Request(fixture.executor, 0, [] {});
+
+    fixture.handler->Prepare();
+    fixture.io->RunUntilOutOfWork();
+    REQUIRE(fixture.admission->NumQueued() == 1);
+
+    fixture.handler->Shutdown();
+    fixture.io->RunUntilOutOfWork();
+    REQUIRE(fixture.admission->NumQueued() == 0);
+
+    // freeing the slot doesn't start the abandoned attempt
+    fixture.admission->Release(blocker);
+    fixture.io->RunUntilOutOfWork();
+    REQUIRE(fixture.server->channels.empty());
+    REQUIRE(fixture.admission->NumInFlight() == 0);
+}
@@ -17,6 +17,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "channel/tls/SSLContextCache.h"
 #include "mocks/MockTLSPair.h"
 
 #include <catch.hpp>
@@ -101,3 +102,38 @@ TEST_CASE(SUITE("client and server can connect using certificates signed by comm
         iteration();
     }
 }
+
+TEST_CASE(SUITE("client and server connections share the contexts of a cache across reloads"))
+{
+    const auto key1 = "certs/self_signed/entity1_key.pem";
+    const auto key2 = "certs/self_signed/entity2_key.pem";
+    const auto cert1 = "certs/self_signed/entity1_cert.pem";
+    const auto cert2 = "certs/self_signed/entity2_cert.pem";
+
+    const auto all_certs_found = exists(key1) && exists(key2) && exists(cert1) && exists(cert2);
+    REQUIRE(all_certs_found);
+
+    auto test = [=](const std::shared_ptr<MockIO>& io) {
+        TLSConfig cfg1(cert2, cert1, key1);
+        TLSConfig cfg2(cert1, cert2, key2);
+
+        const auto contexts = std::make_shared<SSLContextCache>();
+
+        MockTLSPair pair1(io, 20001, cfg1, cfg2, std::error_code(), contexts);
+        pair1.Connect(1);
+
+        // one context per role
+        REQUIRE(contexts->Size() == 2);
+
+        REQUIRE(contexts->Reload() == 0);
+
+        // new connections use the reloaded contexts while the first pair stays connected
+        MockTLSPair pair2(io, 20002, cfg1, cfg2, std::error_code(), contexts);
+        pair2.Connect(1);
+
+        REQUIRE(contexts->Size() == 2);
+        REQUIRE(pair1.NumConnectionsEqual(1));
+    };
+
+    WithIO(test);
+}
@@ -0,0 +1,246 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/tls/SSLContext.h"
+#include "channel/tls/TLSSessionCache.h"
+
+#include <dnp3mocks/MockLogHandler.h>
+
+#include <catch.hpp>
+
+#include <set>
+#include <stdexcept>
+
+using namespace opendnp3;
+
+#define SUITE(name) "TLSSessionCacheSuite - " name
+
+namespace
+{
+const auto key1 = "certs/self_signed/entity1_key.pem";
+const auto key2 = "certs/self_signed/entity2_key.pem";
+const auto cert1 = "certs/self_signed/entity1_cert.pem";
+const auto cert2 = "certs/self_signed/entity2_cert.pem";
+
+TLSConfig ClientConfig()
+{
+    TLSConfig config(cert2, cert1, key1);
+    config.enableSessionResumption = true;
+    return config;
+}
+
+TLSConfig ServerConfig()
+{
+    TLSConfig config(cert1, cert2, key2);
+    config.enableSessionResumption = true;
+    return config;
+}
+
+/**
+ * A client and a server context that handshake in memory over a BIO pair
+ */
+class Contexts
+{
+public:
+    Contexts()
+    {
+        std::error_code ec;
+        this->client = std::make_shared<SSLContext>(log.logger, false, ClientConfig(), ec);
+        if (!ec)
+        {
+            this->server = std::make_shared<SSLContext>(log.logger, true, ServerConfig(), ec);
+        }
+        if (ec)
+        {
+            throw std::logic_error(ec.message());
+        }
+    }
+
+    // run a full handshake, attaching the client to the cache under the key first
+    // returns true if the client resumed a session
+    bool Handshake(TLSSessionCache& cache, const std::string& key, bool* offered = nullptr)
+    {
+        const auto c = SSL_new(this->client->value.native_handle());
+        const auto s = SSL_new(this->server->value.native_handle());
+
+        BIO* cbio = nullptr;
+        BIO* sbio = nullptr;
+        BIO_new_bio_pair(&cbio, 0, &sbio, 0);
+        SSL_set_bio(c, cbio, cbio);
+        SSL_set_bio(s, sbio, sbio);
+        SSL_set_connect_state(c);
+        SSL_set_accept_state(s);
+
+        const auto wasOffered = cache.Attach(c, key);
+        if (offered)
+        {
+            *offered = wasOffered;
+        }
+
+        bool cdone = false;
+        bool sdone = false;
+        for (int i = 0; i < 20 && !(cdone && sdone); ++i)
+        {
+            cdone = cdone || SSL_do_handshake(c) == 1;
+            sdone = sdone || SSL_do_handshake(s) == 1;
+        }
+
+        if (!(cdone && sdone))
+        {
+            SSL_free(c);
+            SSL_free(s);
+            throw std::logic_error("handshake did not complete");
+        }
+
+        // TLS 1.3 tickets arrive after the handshake, reading processes them
+        unsigned char buffer[16];
+        SSL_read(c, buffer, sizeof(buffer));
+
+        const auto reused = SSL_session_reused(c) == 1;
+
+        // without a clean shutdown OpenSSL marks the session as not resumable
+        SSL_shutdown(c);
+        SSL_shutdown(s);
+
+        SSL_free(c);
+        SSL_free(s);
+
+        return reused;
+    }
+
+    MockLogHandler log;
+    std::shared_ptr<SSLContext> client;
+    std::shared_ptr<SSLContext> server;
+};
+} // namespace
+
+TEST_CASE(SUITE("keys differ by endpoint and every trust setting"))
+{
+    const auto remote = IPEndpoint::Localhost(20000);
+    const auto base = ClientConfig();
+
+    std::set<std::string> keys;
+    keys.insert(TLSSessionCache::GetKey(remote, base));
+    keys.insert(TLSSessionCache::GetKey(IPEndpoint::Localhost(20001), base));
+    keys.insert(TLSSessionCache::GetKey(IPEndpoint("127.0.0.2", 20000), base));
+
+    auto config = base;
+    config.peerCertFilePath = "ca.pem";
+    keys.insert(TLSSessionCache::GetKey(remote, config));
+
+    config = base;
+    config.localCertFilePath = "other_cert.pem";
+    keys.insert(TLSSessionCache::GetKey(remote, config));
+
+    config = base;
+    config.privateKeyFilePath = "other_key.pem";
+    keys.insert(TLSSessionCache::GetKey(remote, config));
+
+    config = base;
+    config.allowTLSv13 = false;
+    keys.insert(TLSSessionCache::GetKey(remote, config));
+
+    config = base;
+    config.cipherList = "ECDHE-RSA-AES128-GCM-SHA256";
+    keys.insert(TLSSessionCache::GetKey(remote, config));
+
+    REQUIRE(keys.size() == 8);
+
+    // identical configurations share sessions
+    REQUIRE(TLSSessionCache::GetKey(remote, ClientConfig()) == TLSSessionCache::GetKey(remote, base));
+}
+
+TEST_CASE(SUITE("stores the session of a full handshake and resumes it under the same key"))
+{
+    Contexts contexts;
+    const auto cache = std::make_shared<TLSSessionCache>();
+    const auto key = TLSSessionCache::GetKey(IPEndpoint::Localhost(20000), ClientConfig());
+
+    bool offered = true;
+    REQUIRE_FALSE(contexts.Handshake(*cache, key, &offered));
+    REQUIRE_FALSE(offered);
+    REQUIRE(cache->Size() == 1);
+
+    REQUIRE(contexts.Handshake(*cache, key, &offered));
+    REQUIRE(offered);
+    REQUIRE(cache->Size() == 1);
+}
+
+TEST_CASE(SUITE("does not offer a session to a channel with different trust settings"))
+{
+    Contexts contexts;
+    const auto cache = std::make_shared<TLSSessionCache>();
+    const auto remote = IPEndpoint::Localhost(20000);
+
+    auto other = ClientConfig();
+    other.peerCertFilePath = "certs/ca_chain/ca_cert.pem";
+
+    contexts.Handshake(*cache, TLSSessionCache::GetKey(remote, ClientConfig()));
+
+    bool offered = true;
+    REQUIRE_FALSE(contexts.Handshake(*cache, TLSSessionCache::GetKey(remote, other), &offered));
+    REQUIRE_FALSE(offered);
+    REQUIRE(cache->Size() == 2);
+}
+
+TEST_CASE(SUITE("removed and cleared sessions are not offered"))
+{
+    Contexts contexts;
+    const auto cache = std::make_shared<TLSSessionCache>();
+    const auto key1 = TLSSessionCache::GetKey(IPEndpoint::Localhost(20000), ClientConfig());
+    const auto key2 = TLSSessionCache::GetKey(IPEndpoint::Localhost(20001), ClientConfig());
+
+    contexts.Handshake(*cache, key1);
+    contexts.Handshake(*cache, key2);
+    REQUIRE(cache->Size() == 2);
+
+    cache->Remove(key1);
+    REQUIRE(cache->Size() == 1);
+
+    bool offered = true;
+    contexts.Handshake(*cache, key1, &offered);
+    REQUIRE_FALSE(offered);
+
+    cache->Clear();
+    REQUIRE(cache->Size() == 0);
+
+    contexts.Handshake(*cache, key2, &offered);
+    REQUIRE_FALSE(offered);
+}
+
+TEST_CASE(SUITE("evicts the oldest session beyond the limit"))
+{
+    Contexts contexts;
+    const auto cache = std::make_shared<TLSSessionCache>(2);
+    const auto key1 = TLSSessionCache::GetKey(IPEndpoint::Localhost(20000), ClientConfig());
+    const auto key2 = TLSSessionCache::GetKey(IPEndpoint::Localhost(20001), ClientConfig());
+    const auto key3 = TLSSessionCache::GetKey(IPEndpoint::Localhost(20002), ClientConfig());
+
+    contexts.Handshake(*cache, key1);
+    contexts.Handshake(*cache, key2);
+    contexts.Handshake(*cache, key3);
+    REQUIRE(cache->Size() == 2);
+
+    bool offered = true;
+    contexts.Handshake(*cache, key1, &offered);
+    REQUIRE_FALSE(offered);
+
+    REQUIRE(contexts.Handshake(*cache, key3, &offered));
+    REQUIRE(offered);
+}
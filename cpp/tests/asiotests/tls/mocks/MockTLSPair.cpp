@@ -26,14 +26,15 @@ MockTLSPair::MockTLSPair(const std::shared_ptr<MockIO>& io,
                          uint16_t port,
                          const TLSConfig& client,
                          const TLSConfig& server,
-                         std::error_code ec)
+                         std::error_code ec,
+                         const std::shared_ptr<SSLContextCache>& contexts)
     : log(),
       io(io),
       port(port),
       chandler(std::make_shared<MockTLSClientHandler>()),
-      client(TLSClient::Create(log.logger, io->GetExecutor(), "127.0.0.1", client, ec)),
+      client(TLSClient::Create(log.logger, io->GetExecutor(), "127.0.0.1", client, ec, contexts)),
       server(ec ? nullptr
-                : MockTLSServer::Create(log.logger, io->GetExecutor(), IPEndpoint::Localhost(port), server, ec))
+                : MockTLSServer::Create(log.logger, io->GetExecutor(), IPEndpoint::Localhost(port), server, ec, contexts))
 {
     if (ec)
     {
@@ -60,7 +61,8 @@ void MockTLSPair::Connect(size_t num)
 
     auto connected = [this, num]() -> bool { return this->NumConnectionsEqual(num); };
 
-    io->CompleteInMaxXIterations(10, connected);
+    // other pairs on the same io may have post-handshake traffic in flight
+    io->CompleteInMaxXIterations(20, connected);
 }
 
 bool MockTLSPair::NumConnectionsEqual(size_t num) const
@@ -36,7 +36,8 @@ public:
                 uint16_t port,
                 const opendnp3::TLSConfig& client,
                 const opendnp3::TLSConfig& server,
-                std::error_code ec = std::error_code());
+                std::error_code ec = std::error_code(),
+                const std::shared_ptr<opendnp3::SSLContextCache>& contexts = nullptr);
 
     ~MockTLSPair();
 
@@ -35,8 +35,9 @@ public:
                   std::shared_ptr<exe4cpp::StrandExecutor> executor,
                   opendnp3::IPEndpoint endpoint,
                   const opendnp3::TLSConfig& config,
-                  std::error_code& ec)
-        : TLSServer(logger, executor, endpoint, config, ec)
+                  std::error_code& ec,
+                  std::shared_ptr<opendnp3::SSLContextCache> contexts = nullptr)
+        : TLSServer(logger, executor, endpoint, config, ec, std::move(contexts))
     {
     }
 
@@ -44,9 +45,10 @@ public:
                                                  std::shared_ptr<exe4cpp::StrandExecutor> executor,
                                                  opendnp3::IPEndpoint endpoint,
                                                  const opendnp3::TLSConfig& config,
-                                                 std::error_code& ec)
+                                                 std::error_code& ec,
+                                                 const std::shared_ptr<opendnp3::SSLContextCache>& contexts = nullptr)
     {
-        auto server = std::make_shared<MockTLSServer>(logger, executor, endpoint, config, ec);
+        auto server = std::make_shared<MockTLSServer>(logger, executor, endpoint, config, ec, contexts);
 
         if (ec)
             return nullptr;
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/BenchmarkFixtures.h"
+
+#include <opendnp3/master/ISOEHandler.h>
+
+#include <app/GroupVariationRecord.h>
+#include <app/parsing/APDUHeaderParser.h>
+#include <benchmark/benchmark.h>
+#include <master/MeasurementHandler.h>
+
+using namespace opendnp3;
+
+/**
+ * Visits every value so that the lazily decoded collections are fully deserialized
+ */
+class VisitingSOEHandler final : public ISOEHandler
+{
+public:
+    void BeginFragment(const ResponseInfo& info) override {}
+    void EndFragment(const ResponseInfo& info) override {}
+
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values) override
+    {
+        Visit(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values) override
+    {
+        Visit(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values) override
+    {
+        Visit(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values) override
+    {
+        Visit(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values) override
+    {
+        Visit(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values) override
+    {
+        Visit(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values) override
+    {
+        Visit(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values) override
+    {
+        Visit(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values) override
+    {
+        Visit(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values) override
+    {
+        Visit(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values) override
+    {
+        Visit(values);
+    }
+    void Process(const HeaderInfo& info, const ICollection<DNPTime>& values) override
+    {
+        Visit(values);
+    }
+
+    size_t numValues = 0;
+
+private:
+    template<class T> void Visit(const ICollection<T>& values)
+    {
+        values.ForeachItem([this](const T& value) {
+            benchmark::DoNotOptimize(value);
+            ++this->numValues;
+        });
+    }
+};
+
+// parse the object headers of a max-size g30v1 response and deliver every value to an ISOEHandler
+static void APDUParser_Parse(benchmark::State& state)
+{
+    const auto fragment = BenchmarkFixtures::AnalogResponseFragment();
+    auto logger = Logger::empty();
+    VisitingSOEHandler handler;
+
+    const auto result = APDUHeaderParser::ParseResponse(BenchmarkFixtures::ToRSeq(fragment));
+    if (!result.success)
+    {
+        state.SkipWithError("unable to parse response header");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        if (MeasurementHandler::ProcessMeasurements(result.header.as_response_info(), result.objects, logger, &handler)
+            != ParseResult::OK)
+        {
+            state.SkipWithError("unable to parse response objects");
+            return;
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * fragment.size()));
+    state.counters["values"] = benchmark::Counter(static_cast<double>(handler.numValues), benchmark::Counter::kIsRate);
+}
+BENCHMARK(APDUParser_Parse);
+
+// resolve the group/variation of object headers typical of polls, events and commands
+static void APDUParser_GetRecord(benchmark::State& state)
+{
+    const uint8_t headers[][2] = {{60, 1}, {60, 2}, {1, 2}, {2, 2}, {30, 1}, {32, 7}, {20, 1}, {22, 1},
+                                  {12, 1}, {41, 2}, {50, 1}, {110, 8}, {111, 16}, {80, 1}, {3, 2}, {200, 1}};
+
+    for (auto _ : state)
+    {
+        for (const auto& header : headers)
+        {
+            benchmark::DoNotOptimize(GroupVariationRecord::GetRecord(header[0], header[1]));
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (sizeof(headers) / sizeof(headers[0]))));
+}
+BENCHMARK(APDUParser_GetRecord);
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <link/CRC.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace opendnp3;
+
+// 16 bytes is a full link layer data block, 250 bytes is the maximum user data of a frame
+static void CRC_CalcCrc(benchmark::State& state)
+{
+    const auto length = static_cast<size_t>(state.range(0));
+
+    std::vector<uint8_t> data(length);
+    for (size_t i = 0; i < length; ++i)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(CRC::CalcCrc(data.data(), data.size()));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * length));
+}
+BENCHMARK(CRC_CalcCrc)->Arg(16)->Arg(250)->Arg(2048);
+
+// the body blocks of a maximum size frame, checked one at a time and two at a time
+static void CRC_IsCorrectCRC_Blocks(benchmark::State& state)
+{
+    const size_t count = 15;
+    std::vector<uint8_t> blocks(count * 18);
+    for (size_t i = 0; i < count; ++i)
+    {
+        CRC::AddCrc(blocks.data() + i * 18, 16);
+    }
+
+    for (auto _ : state)
+    {
+        bool valid = true;
+        for (size_t i = 0; i < count; ++i)
+        {
+            valid &= CRC::IsCorrectCRC(blocks.data() + i * 18, 16);
+        }
+        benchmark::DoNotOptimize(valid);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * count * 16));
+}
+BENCHMARK(CRC_IsCorrectCRC_Blocks);
+
+static void CRC_AreCorrectCRCs(benchmark::State& state)
+{
+    const size_t count = 15;
+    std::vector<uint8_t> blocks(count * 18);
+    for (size_t i = 0; i < count; ++i)
+    {
+        CRC::AddCrc(blocks.data() + i * 18, 16);
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(CRC::AreCorrectCRCs(blocks.data(), count, 16));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * count * 16));
+}
+BENCHMARK(CRC_AreCorrectCRCs);
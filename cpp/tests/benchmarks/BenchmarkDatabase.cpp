@@ -0,0 +1,81 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/DatabaseFixture.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace opendnp3;
+
+// update every analog once per iteration, arg 0 repeats the stored value and arg 1 changes it to produce an event
+static void Database_UpdateAnalog(benchmark::State& state)
+{
+    const bool produceEvents = state.range(0) != 0;
+    DatabaseFixture fixture;
+
+    double value = 0;
+    for (auto _ : state)
+    {
+        if (produceEvents)
+        {
+            // start every pass with an empty event buffer so the events are recorded rather than discarded
+            state.PauseTiming();
+            fixture.ClearEvents();
+            state.ResumeTiming();
+
+            value += 1;
+        }
+
+        for (uint16_t i = 0; i < DatabaseFixture::NUM_POINTS; ++i)
+        {
+            fixture.database.Update(Analog(value, Flags(0x01)), i, EventMode::Detect);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * DatabaseFixture::NUM_POINTS));
+}
+BENCHMARK(Database_UpdateAnalog)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+static void Database_UpdateBinary(benchmark::State& state)
+{
+    const bool produceEvents = state.range(0) != 0;
+    DatabaseFixture fixture;
+
+    bool value = false;
+    for (auto _ : state)
+    {
+        if (produceEvents)
+        {
+            // start every pass with an empty event buffer so the events are recorded rather than discarded
+            state.PauseTiming();
+            fixture.ClearEvents();
+            state.ResumeTiming();
+
+            value = !value;
+        }
+
+        for (uint16_t i = 0; i < DatabaseFixture::NUM_POINTS; ++i)
+        {
+            fixture.database.Update(Binary(value, Flags(0x01)), i, EventMode::Detect);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * DatabaseFixture::NUM_POINTS));
+}
+BENCHMARK(Database_UpdateBinary)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
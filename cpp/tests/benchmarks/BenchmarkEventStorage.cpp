@@ -0,0 +1,67 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <outstation/event/EventStorage.h>
+
+using namespace opendnp3;
+
+static const uint16_t NUM_EVENTS = 10000;
+
+// fill the storage with a mix of event types spread across the three classes
+static void Fill(EventStorage& storage)
+{
+    for (uint16_t i = 0; i < NUM_EVENTS; ++i)
+    {
+        switch (i % 3)
+        {
+        case (0):
+            storage.Update(Event<BinarySpec>(Binary(i % 2 == 0), i, EventClass::EC1, EventBinaryVariation::Group2Var2));
+            break;
+        case (1):
+            storage.Update(Event<AnalogSpec>(Analog(i), i, EventClass::EC2, EventAnalogVariation::Group32Var1));
+            break;
+        default:
+            storage.Update(Event<CounterSpec>(Counter(i), i, EventClass::EC3, EventCounterVariation::Group22Var1));
+            break;
+        }
+    }
+}
+
+// arg 0 selects a single class, arg 1 selects all event classes
+static void EventStorage_SelectByClass(benchmark::State& state)
+{
+    const auto classes = state.range(0) == 0 ? ClassField(PointClass::Class1) : ClassField::AllEventClasses();
+
+    EventStorage storage(EventBufferConfig::AllTypes(NUM_EVENTS));
+    Fill(storage);
+
+    uint32_t numSelected = 0;
+    for (auto _ : state)
+    {
+        numSelected = storage.SelectByClass(classes);
+
+        state.PauseTiming();
+        storage.Unselect();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numSelected));
+}
+BENCHMARK(EventStorage_SelectByClass)->Arg(0)->Arg(1);
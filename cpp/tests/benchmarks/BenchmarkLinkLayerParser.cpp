@@ -0,0 +1,84 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/BenchmarkFixtures.h"
+
+#include <benchmark/benchmark.h>
+#include <link/IFrameSink.h>
+#include <link/LinkLayerParser.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace opendnp3;
+
+class CountingFrameSink final : public IFrameSink
+{
+public:
+    bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) final
+    {
+        ++this->numFrames;
+        this->numBytes += userdata.length();
+        return true;
+    }
+
+    size_t numFrames = 0;
+    size_t numBytes = 0;
+};
+
+// feed the frames of a max-size fragment to the parser in reads of the specified size
+static void ParseFrames(benchmark::State& state, bool reliableTransport)
+{
+    const auto readSize = static_cast<size_t>(state.range(0));
+    const auto frames = BenchmarkFixtures::LinkFrames(
+        BenchmarkFixtures::TransportSegments(BenchmarkFixtures::AnalogResponseFragment()));
+
+    LinkLayerParser parser(Logger::empty());
+    parser.SetReliableTransport(reliableTransport);
+    CountingFrameSink sink;
+
+    for (auto _ : state)
+    {
+        size_t position = 0;
+        while (position < frames.size())
+        {
+            auto dest = parser.WriteBuff();
+            const auto count = std::min(std::min(readSize, dest.length()), frames.size() - position);
+            memcpy(dest, frames.data() + position, count);
+            parser.OnRead(count, sink);
+            position += count;
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * frames.size()));
+    state.counters["frames"] = benchmark::Counter(static_cast<double>(sink.numFrames), benchmark::Counter::kIsRate);
+}
+
+static void LinkLayerParser_OnRead(benchmark::State& state)
+{
+    ParseFrames(state, false);
+}
+BENCHMARK(LinkLayerParser_OnRead)->Arg(1)->Arg(64)->Arg(4096);
+
+// same as above, but with the single pass parsing used for TCP and TLS
+static void LinkLayerParser_OnReadReliable(benchmark::State& state)
+{
+    ParseFrames(state, true);
+}
+BENCHMARK(LinkLayerParser_OnReadReliable)->Arg(1)->Arg(64)->Arg(4096);
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/DatabaseFixture.h"
+
+#include <opendnp3/app/AppConstants.h>
+#include <opendnp3/gen/GroupVariation.h>
+#include <opendnp3/outstation/StaticPacking.h>
+
+#include <app/APDUHeader.h>
+#include <app/APDUResponse.h>
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace opendnp3;
+
+static const GroupVariation variations[] = {
+    GroupVariation::Group1Var2, GroupVariation::Group30Var1, GroupVariation::Group30Var5,
+    GroupVariation::Group20Var1, GroupVariation::Group60Var1,
+};
+
+// select a whole type (or class 0) and write it out as a series of max-size response fragments
+static void StaticWriters_Load(benchmark::State& state)
+{
+    const auto variation = variations[state.range(0)];
+    state.SetLabel(GroupVariationSpec::to_string(variation));
+
+    DatabaseFixture fixture;
+    std::vector<uint8_t> buffer(DEFAULT_MAX_APDU_SIZE);
+
+    size_t numFragments = 0;
+    size_t numBytes = 0;
+    for (auto _ : state)
+    {
+        fixture.database.SelectAll(variation);
+
+        while (fixture.database.HasAnySelection())
+        {
+            APDUResponse response(ser4cpp::wseq_t(buffer.data(), buffer.size()));
+            auto writer = response.GetWriter();
+            fixture.database.Load(writer);
+
+            if (response.Size() <= APDUHeader::RESPONSE_SIZE)
+            {
+                state.SkipWithError("no values were written to the fragment");
+                return;
+            }
+
+            ++numFragments;
+            numBytes += response.Size();
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(numBytes));
+    state.counters["fragments"] = benchmark::Counter(static_cast<double>(numFragments), benchmark::Counter::kIsRate);
+}
+BENCHMARK(StaticWriters_Load)->DenseRange(0, 4)->Unit(benchmark::kMillisecond);
+
+// counters at every n-th index (range(1)) written with each packing mode (range(0))
+static void StaticWriters_BytesPerPoint(benchmark::State& state)
+{
+    const auto packing = static_cast<StaticPacking>(state.range(0));
+    const auto stride = static_cast<uint16_t>(state.range(1));
+    const uint16_t numPoints = 10000;
+
+    DatabaseConfig config;
+    for (uint16_t i = 0; i < numPoints; ++i)
+    {
+        config.counter[i * stride] = {};
+    }
+
+    IDnpTimeSource timeSource;
+    EventBuffer eventBuffer(EventBufferConfig::AllTypes(0));
+    Database database(config, eventBuffer, timeSource, StaticTypeBitField::AllTypes(), packing);
+    std::vector<uint8_t> buffer(DEFAULT_MAX_APDU_SIZE);
+
+    size_t numBytes = 0;
+    size_t numLoads = 0;
+    for (auto _ : state)
+    {
+        database.SelectAll(GroupVariation::Group20Var1);
+
+        while (database.HasAnySelection())
+        {
+            APDUResponse response(ser4cpp::wseq_t(buffer.data(), buffer.size()));
+            auto writer = response.GetWriter();
+            database.Load(writer);
+            numBytes += response.Size() - APDUHeader::RESPONSE_SIZE;
+        }
+
+        ++numLoads;
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(numBytes));
+    state.counters["bytes_per_point"]
+        = static_cast<double>(numBytes) / static_cast<double>(numLoads * static_cast<size_t>(numPoints));
+}
+BENCHMARK(StaticWriters_BytesPerPoint)
+    ->Apply([](benchmark::internal::Benchmark* b) {
+        for (int packing = 0; packing < 3; ++packing)
+        {
+            for (int stride : {1, 2, 5})
+            {
+                b->Args({packing, stride});
+            }
+        }
+    })
+    ->Unit(benchmark::kMillisecond);
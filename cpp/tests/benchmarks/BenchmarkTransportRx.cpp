@@ -0,0 +1,56 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/BenchmarkFixtures.h"
+
+#include <benchmark/benchmark.h>
+#include <transport/TransportRx.h>
+
+using namespace opendnp3;
+
+// reassemble a max-size fragment from its transport segments
+static void TransportRx_ProcessReceive(benchmark::State& state)
+{
+    const auto fragment = BenchmarkFixtures::AnalogResponseFragment();
+    const auto segments = BenchmarkFixtures::TransportSegments(fragment);
+
+    TransportRx rx(Logger::empty(), DEFAULT_MAX_APDU_SIZE);
+
+    size_t numFragments = 0;
+    for (auto _ : state)
+    {
+        for (const auto& segment : segments)
+        {
+            const auto message
+                = rx.ProcessReceive(Message(BenchmarkFixtures::addresses, BenchmarkFixtures::ToRSeq(segment)));
+            if (message.payload.is_not_empty())
+            {
+                ++numFragments;
+            }
+        }
+    }
+
+    if (numFragments != static_cast<size_t>(state.iterations()))
+    {
+        state.SkipWithError("fragment was not reassembled");
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * fragment.size()));
+}
+BENCHMARK(TransportRx_ProcessReceive);
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/BenchmarkFixtures.h"
+
+#include <ser4cpp/container/StaticBuffer.h>
+
+#include <app/APDUResponse.h>
+#include <gen/objects/Group30.h>
+#include <link/LinkFrame.h>
+#include <link/LinkLayerConstants.h>
+#include <transport/TransportTx.h>
+
+using namespace opendnp3;
+using namespace ser4cpp;
+
+const Addresses BenchmarkFixtures::addresses(1024, 1);
+
+bytes_t BenchmarkFixtures::AnalogResponseFragment(uint32_t maxSize)
+{
+    bytes_t buffer(maxSize);
+
+    APDUResponse response(wseq_t(buffer.data(), buffer.size()));
+    response.SetFunction(FunctionCode::RESPONSE);
+    response.SetControl(AppControlField(true, true, false, false, 0));
+    response.SetIIN(IINField::Empty());
+
+    auto writer = response.GetWriter();
+
+    {
+        auto iterator = writer.IterateOverRange<UInt16, Analog>(QualifierCode::UINT16_START_STOP, Group30Var1::Inst(), 0);
+
+        uint16_t index = 0;
+        while (iterator.Write(Analog(index, Flags(0x01))))
+        {
+            ++index;
+        }
+    }
+
+    buffer.resize(response.Size());
+    return buffer;
+}
+
+std::vector<bytes_t> BenchmarkFixtures::TransportSegments(const bytes_t& apdu)
+{
+    TransportTx tx(Logger::empty());
+    tx.Configure(Message(addresses, ToRSeq(apdu)));
+
+    std::vector<bytes_t> segments;
+    while (tx.HasValue())
+    {
+        const auto segment = tx.GetSegment();
+        const uint8_t* data = segment;
+        segments.emplace_back(data, data + segment.length());
+        tx.Advance();
+    }
+
+    return segments;
+}
+
+bytes_t BenchmarkFixtures::LinkFrames(const std::vector<bytes_t>& segments)
+{
+    bytes_t frames;
+
+    for (const auto& segment : segments)
+    {
+        StaticBuffer<LPDU_MAX_FRAME_SIZE> buffer;
+        auto dest = buffer.as_wseq();
+        const auto frame = LinkFrame::FormatUnconfirmedUserData(dest, false, addresses.destination, addresses.source,
+                                                                ToRSeq(segment), nullptr);
+        const uint8_t* data = frame;
+        frames.insert(frames.end(), data, data + frame.length());
+    }
+
+    return frames;
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_BENCHMARKS_BENCHMARK_FIXTURES_H
+#define OPENDNP3_BENCHMARKS_BENCHMARK_FIXTURES_H
+
+#include <opendnp3/app/AppConstants.h>
+#include <opendnp3/link/Addresses.h>
+
+#include <ser4cpp/container/SequenceTypes.h>
+
+#include <cstdint>
+#include <vector>
+
+using bytes_t = std::vector<uint8_t>;
+
+/**
+ * Builds realistic wire data shared by the benchmarks
+ */
+struct BenchmarkFixtures
+{
+    static const opendnp3::Addresses addresses;
+
+    /// a FIR/FIN response fragment filled with a single g30v1 range header up to the specified size
+    static bytes_t AnalogResponseFragment(uint32_t maxSize = opendnp3::DEFAULT_MAX_APDU_SIZE);
+
+    /// split an APDU into transport segments using the transmit side of the transport layer
+    static std::vector<bytes_t> TransportSegments(const bytes_t& apdu);
+
+    /// wrap every segment in an unconfirmed user data link frame and concatenate the result
+    static bytes_t LinkFrames(const std::vector<bytes_t>& segments);
+
+    static ser4cpp::rseq_t ToRSeq(const bytes_t& bytes)
+    {
+        return ser4cpp::rseq_t(bytes.data(), bytes.size());
+    }
+};
+
+#endif
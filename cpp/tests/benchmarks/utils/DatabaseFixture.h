@@ -0,0 +1,85 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_BENCHMARKS_DATABASE_FIXTURE_H
+#define OPENDNP3_BENCHMARKS_DATABASE_FIXTURE_H
+
+#include <opendnp3/outstation/DatabaseConfig.h>
+#include <opendnp3/outstation/IDnpTimeSource.h>
+
+#include <app/APDUResponse.h>
+#include <outstation/Database.h>
+#include <outstation/event/EventBuffer.h>
+
+#include <vector>
+
+/**
+ * An outstation database with a full 16-bit index space of binaries, analogs and counters
+ * backed by an event buffer, wired the same way as in OContext
+ */
+class DatabaseFixture
+{
+public:
+    static const uint16_t NUM_POINTS = 65535;
+    // room for one event per point, so a single pass over the points never overflows
+    static const uint16_t NUM_EVENTS = NUM_POINTS;
+
+    DatabaseFixture()
+        : buffer(opendnp3::EventBufferConfig::AllTypes(NUM_EVENTS)),
+          database(Config(), buffer, timeSource, opendnp3::StaticTypeBitField::AllTypes())
+    {
+    }
+
+    // removes every event the same way confirmed responses would
+    void ClearEvents()
+    {
+        // large enough to take all of the events in one pass
+        std::vector<uint8_t> fragment(NUM_EVENTS * 32);
+
+        this->buffer.SelectAllByClass(opendnp3::ClassField::AllEventClasses());
+
+        bool complete = false;
+        while (!complete)
+        {
+            opendnp3::APDUResponse response(ser4cpp::wseq_t(fragment.data(), fragment.size()));
+            auto writer = response.GetWriter();
+            complete = this->buffer.Load(writer);
+            this->buffer.ClearWritten();
+        }
+    }
+
+    opendnp3::IDnpTimeSource timeSource;
+    opendnp3::EventBuffer buffer;
+    opendnp3::Database database;
+
+private:
+    static opendnp3::DatabaseConfig Config()
+    {
+        opendnp3::DatabaseConfig config;
+        for (uint16_t i = 0; i < NUM_POINTS; ++i)
+        {
+            config.binary_input[i] = {};
+            config.analog_input[i] = {};
+            config.counter[i] = {};
+        }
+        return config;
+    }
+};
+
+#endif
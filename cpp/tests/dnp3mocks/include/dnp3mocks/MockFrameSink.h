@@ -41,6 +41,7 @@ public:
     bool OnTxReady() override;
 
     bool OnFrame(const opendnp3::LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) final;
+    ser4cpp::wseq_t GetUserDataBuffer(const opendnp3::LinkHeaderFields& header, size_t length) final;
 
     void Reset();
 
@@ -55,6 +56,11 @@ public:
 
     bool mLowerOnline;
 
+    // storage offered to the parser for user data, empty by default
+    ser4cpp::wseq_t userDataBuffer;
+    // where the user data of the last frame was located
+    const uint8_t* m_last_userdata;
+
     // Add a function to execute the next time a frame is received
     // This allows us to test re-entrant behaviors
     void AddAction(const std::function<void()>& fun);
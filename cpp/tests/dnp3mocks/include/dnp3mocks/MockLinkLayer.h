@@ -61,6 +61,23 @@ public:
         return false;
     }
 
+    // writes the segment into the storage the upper layer provides, the way the link parser does, before passing it up
+    bool SendUpInPlace(const std::string& hex, const opendnp3::Addresses& addresses = opendnp3::Addresses())
+    {
+        if (pUpperLayer)
+        {
+            HexSequence hs(hex);
+            auto dest = pUpperLayer->GetReceiveBuffer(hs.Size());
+            if (dest.length() != hs.Size())
+            {
+                return false;
+            }
+            const auto staged = dest.copy_from(hs.ToRSeq());
+            return pUpperLayer->OnReceive(opendnp3::Message(addresses, staged));
+        }
+        return false;
+    }
+
     std::vector<std::string> sends;
 };
 
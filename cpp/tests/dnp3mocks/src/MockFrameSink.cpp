@@ -22,7 +22,7 @@
 using namespace opendnp3;
 using namespace ser4cpp;
 
-MockFrameSink::MockFrameSink() : m_num_frames(0), mLowerOnline(false) {}
+MockFrameSink::MockFrameSink() : m_num_frames(0), mLowerOnline(false), m_last_userdata(nullptr) {}
 
 bool MockFrameSink::OnLowerLayerUp()
 {
@@ -68,6 +68,7 @@ bool MockFrameSink::OnFrame(const LinkHeaderFields& header, const rseq_t& userda
     ++m_num_frames;
 
     this->m_last_header = header;
+    this->m_last_userdata = userdata;
 
     if (userdata.is_not_empty())
     {
@@ -77,6 +78,11 @@ bool MockFrameSink::OnFrame(const LinkHeaderFields& header, const rseq_t& userda
     return true;
 }
 
+ser4cpp::wseq_t MockFrameSink::GetUserDataBuffer(const LinkHeaderFields& /*header*/, size_t /*length*/)
+{
+    return this->userDataBuffer;
+}
+
 void MockFrameSink::AddAction(const std::function<void()>& fun)
 {
     m_actions.push_back(fun);
@@ -33,14 +33,14 @@ using namespace opendnp3;
 
 #define SUITE(name) "PerformanceTestSuite - " name
 
-TEST_CASE(SUITE("PointsPerSecond"))
+void RunPerformanceTest(PerformanceStackPair::Transport transport,
+                        uint16_t numStackPairs,
+                        uint16_t eventsPerIteration,
+                        int numIterations)
 {
     const uint16_t START_PORT = 20000;
-    const uint16_t NUM_STACK_PAIRS = 10;
 
     const uint16_t NUM_POINTS_PER_TYPE = 50;
-    const uint16_t EVENTS_PER_ITERATION = 50;
-    const int NUM_ITERATIONS = 100;
 
     const auto LEVELS = levels::NOTHING | flags::ERR | flags::WARN;
 
@@ -56,10 +56,10 @@ TEST_CASE(SUITE("PointsPerSecond"))
 
     std::vector<std::unique_ptr<PerformanceStackPair>> pairs;
 
-    for (uint16_t i = 0; i < NUM_STACK_PAIRS; ++i)
+    for (uint16_t i = 0; i < numStackPairs; ++i)
     {
         auto pair = std::make_unique<PerformanceStackPair>(LEVELS, STACK_TIMEOUT, manager, START_PORT + i,
-                                                           NUM_POINTS_PER_TYPE, EVENTS_PER_ITERATION);
+                                                           NUM_POINTS_PER_TYPE, eventsPerIteration, transport);
         pairs.push_back(std::move(pair));
     }
 
@@ -70,7 +70,7 @@ TEST_CASE(SUITE("PointsPerSecond"))
 
     const auto start = std::chrono::steady_clock::now();
 
-    for (int i = 0; i < NUM_ITERATIONS; ++i)
+    for (int i = 0; i < numIterations; ++i)
     {
 
         for (auto& pair : pairs)
@@ -89,11 +89,22 @@ TEST_CASE(SUITE("PointsPerSecond"))
     const auto milliseconds
         = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
 
-    const auto total_events_transferred = static_cast<uint64_t>(NUM_STACK_PAIRS)
-        * static_cast<uint64_t>(EVENTS_PER_ITERATION) * static_cast<uint64_t>(NUM_ITERATIONS);
+    const auto total_events_transferred = static_cast<uint64_t>(numStackPairs)
+        * static_cast<uint64_t>(eventsPerIteration) * static_cast<uint64_t>(numIterations);
 
-    const auto rate = (total_events_transferred * 1000) / milliseconds.count();
+    const auto rate = (total_events_transferred * 1000) / std::max<int64_t>(milliseconds.count(), 1);
 
     std::cout << total_events_transferred << " in " << milliseconds.count() << " ms == " << rate << " events per/sec"
               << std::endl;
 }
+
+TEST_CASE(SUITE("PointsPerSecond"))
+{
+    RunPerformanceTest(PerformanceStackPair::Transport::TCP, 10, 50, 100);
+}
+
+TEST_CASE(SUITE("PointsPerSecondLoopback"))
+{
+    // no sockets involved, so a lot more pairs can run within the same process
+    RunPerformanceTest(PerformanceStackPair::Transport::LOOPBACK, 1000, 50, 10);
+}
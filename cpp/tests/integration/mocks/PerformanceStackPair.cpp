@@ -38,15 +38,16 @@ PerformanceStackPair::PerformanceStackPair(LogLevels levels,
                                            DNP3Manager& manager,
                                            uint16_t port,
                                            uint16_t numPointsPerType,
-                                           uint32_t eventsPerIteration)
+                                           uint32_t eventsPerIteration,
+                                           Transport transport)
     : NUM_POINTS_PER_TYPE(numPointsPerType),
       EVENTS_PER_ITERATION(eventsPerIteration),
       soeHandler(std::make_shared<CountingSOEHandler>()),
       clientListener(std::make_shared<QueuedChannelListener>()),
       serverListener(std::make_shared<QueuedChannelListener>()),
-      master(CreateMaster(levels, timeout, manager, port, this->soeHandler, this->clientListener)),
-      outstation(CreateOutstation(
-          levels, timeout, manager, port, numPointsPerType, 3 * eventsPerIteration, this->serverListener))
+      channels(CreateChannels(transport, levels, manager, port, this->clientListener, this->serverListener)),
+      master(CreateMaster(timeout, this->channels.first, port, this->soeHandler)),
+      outstation(CreateOutstation(timeout, this->channels.second, port, numPointsPerType, 3 * eventsPerIteration))
 {
     this->outstation->Enable();
     this->master->Enable();
@@ -134,31 +135,43 @@ MasterStackConfig PerformanceStackPair::GetMasterStackConfig(TimeDuration timeou
     return config;
 }
 
-std::shared_ptr<IMaster> PerformanceStackPair::CreateMaster(LogLevels levels,
-                                                            TimeDuration timeout,
-                                                            DNP3Manager& manager,
-                                                            uint16_t port,
-                                                            std::shared_ptr<ISOEHandler> soehandler,
-                                                            std::shared_ptr<IChannelListener> listener)
+PerformanceStackPair::ChannelPair PerformanceStackPair::CreateChannels(Transport transport,
+                                                                   LogLevels levels,
+                                                                   DNP3Manager& manager,
+                                                                   uint16_t port,
+                                                                   std::shared_ptr<IChannelListener> clientListener,
+                                                                   std::shared_ptr<IChannelListener> serverListener)
 {
-    auto channel = manager.AddTCPClient(GetId("client", port), levels, ChannelRetry::Default(),
-                                        {IPEndpoint("127.0.0.1", port)}, "127.0.0.1", std::move(listener));
+    if (transport == Transport::LOOPBACK)
+    {
+        return manager.AddLoopbackPair(GetId("loopback", port), levels, std::move(clientListener),
+                                       std::move(serverListener));
+    }
+
+    auto client = manager.AddTCPClient(GetId("client", port), levels, ChannelRetry::Default(),
+                                       {IPEndpoint("127.0.0.1", port)}, "127.0.0.1", std::move(clientListener));
+
+    auto server = manager.AddTCPServer(GetId("server", port), levels, ServerAcceptMode::CloseExisting,
+                                       IPEndpoint("127.0.0.1", port), std::move(serverListener));
 
+    return std::make_pair(client, server);
+}
+
+std::shared_ptr<IMaster> PerformanceStackPair::CreateMaster(TimeDuration timeout,
+                                                            const std::shared_ptr<IChannel>& channel,
+                                                            uint16_t port,
+                                                            std::shared_ptr<ISOEHandler> soehandler)
+{
     return channel->AddMaster(GetId("master", port), std::move(soehandler), DefaultMasterApplication::Create(),
                               GetMasterStackConfig(timeout));
 }
 
-std::shared_ptr<IOutstation> PerformanceStackPair::CreateOutstation(LogLevels levels,
-                                                                    TimeDuration timeout,
-                                                                    DNP3Manager& manager,
+std::shared_ptr<IOutstation> PerformanceStackPair::CreateOutstation(TimeDuration timeout,
+                                                                    const std::shared_ptr<IChannel>& channel,
                                                                     uint16_t port,
                                                                     uint16_t numPointsPerType,
-                                                                    uint16_t eventBufferSize,
-                                                                    std::shared_ptr<IChannelListener> listener)
+                                                                    uint16_t eventBufferSize)
 {
-    auto channel = manager.AddTCPServer(GetId("server", port), levels, ServerAcceptMode::CloseExisting,
-                                        IPEndpoint("127.0.0.1", port), std::move(listener));
-
     return channel->AddOutstation(GetId("outstation", port), SuccessCommandHandler::Create(),
                                   DefaultOutstationApplication::Create(),
                                   GetOutstationStackConfig(numPointsPerType, eventBufferSize, timeout));
@@ -31,9 +31,20 @@
 #include <deque>
 #include <memory>
 #include <random>
+#include <utility>
 
 class PerformanceStackPair final : opendnp3::Uncopyable
 {
+public:
+    enum class Transport
+    {
+        TCP,
+        LOOPBACK
+    };
+
+private:
+    using ChannelPair = std::pair<std::shared_ptr<opendnp3::IChannel>, std::shared_ptr<opendnp3::IChannel>>;
+
     const uint16_t NUM_POINTS_PER_TYPE;
     const uint32_t EVENTS_PER_ITERATION;
 
@@ -42,6 +53,8 @@ class PerformanceStackPair final : opendnp3::Uncopyable
     std::shared_ptr<QueuedChannelListener> clientListener;
     std::shared_ptr<QueuedChannelListener> serverListener;
 
+    const ChannelPair channels;
+
     const std::shared_ptr<opendnp3::IMaster> master;
     const std::shared_ptr<opendnp3::IOutstation> outstation;
 
@@ -50,20 +63,22 @@ class PerformanceStackPair final : opendnp3::Uncopyable
                                                                     opendnp3::TimeDuration timeout);
     static opendnp3::MasterStackConfig GetMasterStackConfig(opendnp3::TimeDuration timeout);
 
-    static std::shared_ptr<opendnp3::IMaster> CreateMaster(opendnp3::LogLevels levels,
-                                                           opendnp3::TimeDuration timeout,
-                                                           opendnp3::DNP3Manager& manager,
+    // first is the master channel, second is the outstation channel
+    static ChannelPair CreateChannels(Transport transport,
+                                      opendnp3::LogLevels levels,
+                                      opendnp3::DNP3Manager& manager,
+                                      uint16_t port,
+                                      std::shared_ptr<opendnp3::IChannelListener> clientListener,
+                                      std::shared_ptr<opendnp3::IChannelListener> serverListener);
+    static std::shared_ptr<opendnp3::IMaster> CreateMaster(opendnp3::TimeDuration timeout,
+                                                           const std::shared_ptr<opendnp3::IChannel>& channel,
                                                            uint16_t port,
-                                                           std::shared_ptr<opendnp3::ISOEHandler>,
-                                                           std::shared_ptr<opendnp3::IChannelListener> listener);
-    static std::shared_ptr<opendnp3::IOutstation> CreateOutstation(
-        opendnp3::LogLevels levels,
-        opendnp3::TimeDuration timeout,
-        opendnp3::DNP3Manager& manager,
-        uint16_t port,
-        uint16_t numPointsPerType,
-        uint16_t eventBufferSize,
-        std::shared_ptr<opendnp3::IChannelListener> listener);
+                                                           std::shared_ptr<opendnp3::ISOEHandler>);
+    static std::shared_ptr<opendnp3::IOutstation> CreateOutstation(opendnp3::TimeDuration timeout,
+                                                                   const std::shared_ptr<opendnp3::IChannel>& channel,
+                                                                   uint16_t port,
+                                                                   uint16_t numPointsPerType,
+                                                                   uint16_t eventBufferSize);
 
     static std::string GetId(const char* name, uint16_t port);
     void AddValue(uint32_t i, opendnp3::UpdateBuilder& builder);
@@ -74,7 +89,8 @@ public:
                          opendnp3::DNP3Manager& manager,
                          uint16_t port,
                          uint16_t numPointsPerType,
-                         uint32_t eventsPerIteration);
+                         uint32_t eventsPerIteration,
+                         Transport transport = Transport::TCP);
 
     void WaitForChannelsOnline(std::chrono::steady_clock::duration timeout);
 
@@ -254,10 +254,23 @@ TEST_CASE(SUITE("ParserDoesNotAllowEmptyOctetStrings"))
     REQUIRE(mock.records.empty());
 }
 
-TEST_CASE(SUITE("Group1Var2CountWithIndexUInt8"))
+TEST_CASE(SUITE("Group1Var2CountWithAllIndexSizes"))
 {
+    auto validator = [](MockApduHeaderHandler& mock) {
+        REQUIRE(1 == mock.eventBinaries.size());
+        Indexed<Binary> value(Binary(true), 9);
+        REQUIRE((value == mock.eventBinaries[0]));
+    };
+
     // 1 byte count, 1 byte index, index == 09, value = 0x81
-    TestSimple("01 02 17 01 09 81", ParseResult::INVALID_OBJECT_QUALIFIER, 0);
+    TestComplex("01 02 17 01 09 81", ParseResult::OK, 1, validator);
+    TestComplex("01 02 28 01 00 09 00 81", ParseResult::OK, 1, validator);
+}
+
+TEST_CASE(SUITE("Group1Var1CountWithIndexUInt8"))
+{
+    // packed static bitfields can't be index prefixed
+    TestSimple("01 01 17 01 09 81", ParseResult::INVALID_OBJECT_QUALIFIER, 0);
 }
 
 TEST_CASE(SUITE("Group2Var1CountWithAllIndexSizes"))
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "master/AdaptiveScanPolicy.h"
+
+#include <catch.hpp>
+
+using namespace opendnp3;
+
+#define SUITE(name) "AdaptiveScanPolicyTestSuite - " name
+
+namespace
+{
+AdaptiveScanConfig Config()
+{
+    return AdaptiveScanConfig(TimeDuration::Seconds(1), TimeDuration::Seconds(60));
+}
+
+AdaptiveScanPolicy::Outcome WithValues(uint32_t numValues)
+{
+    AdaptiveScanPolicy::Outcome outcome;
+    outcome.numValues = numValues;
+    return outcome;
+}
+} // namespace
+
+TEST_CASE(SUITE("stretches the period of a quiet scan"))
+{
+    const auto next = AdaptiveScanPolicy::NextPeriod(Config(), TimeDuration::Seconds(10), WithValues(0));
+    REQUIRE(next == TimeDuration::Seconds(20));
+}
+
+TEST_CASE(SUITE("shrinks the period when the scan returns values"))
+{
+    const auto next = AdaptiveScanPolicy::NextPeriod(Config(), TimeDuration::Seconds(10), WithValues(3));
+    REQUIRE(next == TimeDuration::Seconds(5));
+}
+
+TEST_CASE(SUITE("shrinks the period when events are still pending"))
+{
+    auto outcome = WithValues(0);
+    outcome.eventsPending = true;
+    const auto next = AdaptiveScanPolicy::NextPeriod(Config(), TimeDuration::Seconds(10), outcome);
+    REQUIRE(next == TimeDuration::Seconds(5));
+}
+
+TEST_CASE(SUITE("clamps the period to the configured bounds"))
+{
+    REQUIRE(AdaptiveScanPolicy::NextPeriod(Config(), TimeDuration::Seconds(50), WithValues(0))
+            == TimeDuration::Seconds(60));
+    REQUIRE(AdaptiveScanPolicy::NextPeriod(Config(), TimeDuration::Milliseconds(1500), WithValues(1))
+            == TimeDuration::Seconds(1));
+}
+
+TEST_CASE(SUITE("stretches on a slow response even if values were returned"))
+{
+    auto config = Config();
+    config.slowResponse = TimeDuration::Seconds(2);
+
+    auto outcome = WithValues(10);
+    outcome.responseTime = TimeDuration::Seconds(3);
+
+    REQUIRE(AdaptiveScanPolicy::IsCongested(config, outcome));
+    REQUIRE(AdaptiveScanPolicy::NextPeriod(config, TimeDuration::Seconds(10), outcome) == TimeDuration::Seconds(20));
+}
+
+TEST_CASE(SUITE("stretches when the scan waited for the channel"))
+{
+    auto config = Config();
+    config.congestedQueueWait = TimeDuration::Seconds(1);
+
+    auto outcome = WithValues(10);
+    outcome.queueWait = TimeDuration::Milliseconds(500);
+    REQUIRE_FALSE(AdaptiveScanPolicy::IsCongested(config, outcome));
+
+    outcome.queueWait = TimeDuration::Seconds(1);
+    REQUIRE(AdaptiveScanPolicy::IsCongested(config, outcome));
+}
+
+TEST_CASE(SUITE("congestion checks are disabled by default"))
+{
+    auto outcome = WithValues(10);
+    outcome.responseTime = TimeDuration::Minutes(1);
+    outcome.queueWait = TimeDuration::Minutes(1);
+    REQUIRE_FALSE(AdaptiveScanPolicy::IsCongested(Config(), outcome));
+}
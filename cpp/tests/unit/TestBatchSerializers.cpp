@@ -0,0 +1,165 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <opendnp3/app/MeasurementTypes.h>
+
+#include <app/RangeWriteIterator.h>
+#include <gen/objects/Group1.h>
+#include <gen/objects/Group20.h>
+#include <gen/objects/Group30.h>
+#include <gen/objects/Group32.h>
+
+#include <ser4cpp/serialization/LittleEndian.h>
+#include <ser4cpp/util/HexConversions.h>
+
+#include <catch.hpp>
+
+#include <vector>
+
+using namespace opendnp3;
+using namespace ser4cpp;
+
+#define SUITE(name) "BatchSerializers - " name
+
+namespace
+{
+template<class GV> std::string WriteOneAtATime(const std::vector<typename GV::Target>& values)
+{
+    std::vector<uint8_t> buffer(values.size() * GV::Size());
+    wseq_t dest(buffer.data(), buffer.size());
+    for (const auto& value : values)
+    {
+        REQUIRE(GV::WriteTarget(value, dest));
+    }
+    REQUIRE(dest.is_empty());
+    return HexConversions::to_hex(rseq_t(buffer.data(), buffer.size()));
+}
+
+template<class GV> std::string WriteAsArray(const std::vector<typename GV::Target>& values)
+{
+    std::vector<uint8_t> buffer(values.size() * GV::Size());
+    wseq_t dest(buffer.data(), buffer.size());
+    REQUIRE(GV::WriteArray(values.data(), values.size(), dest));
+    REQUIRE(dest.is_empty());
+    return HexConversions::to_hex(rseq_t(buffer.data(), buffer.size()));
+}
+
+// write the values, read them back with ReadArray and check that they re-encode to the same bytes
+template<class GV> void CheckEquivalent(const std::vector<typename GV::Target>& values)
+{
+    const auto expected = WriteOneAtATime<GV>(values);
+    REQUIRE(WriteAsArray<GV>(values) == expected);
+
+    std::vector<uint8_t> buffer(values.size() * GV::Size());
+    wseq_t dest(buffer.data(), buffer.size());
+    REQUIRE(GV::WriteArray(values.data(), values.size(), dest));
+
+    std::vector<typename GV::Target> output(values.size());
+    rseq_t input(buffer.data(), buffer.size());
+    REQUIRE(GV::ReadArray(input, output.data(), output.size()));
+    REQUIRE(input.is_empty());
+
+    std::vector<typename GV::Target> single(values.size());
+    rseq_t single_input(buffer.data(), buffer.size());
+    for (auto& value : single)
+    {
+        REQUIRE(GV::ReadTarget(single_input, value));
+    }
+
+    REQUIRE(WriteAsArray<GV>(output) == WriteOneAtATime<GV>(single));
+    REQUIRE(WriteAsArray<GV>(output) == expected);
+}
+} // namespace
+
+TEST_CASE(SUITE("Group1Var2 matches the single value serializer"))
+{
+    CheckEquivalent<Group1Var2>({Binary(true), Binary(false, Flags(0x02)), Binary(true, Flags(0x81))});
+}
+
+TEST_CASE(SUITE("Group20Var1 matches the single value serializer"))
+{
+    CheckEquivalent<Group20Var1>({Counter(0), Counter(1), Counter(0xFFFFFFFF), Counter(0x12345678, Flags(0x03))});
+}
+
+TEST_CASE(SUITE("Group30Var2 applies the same range conversions"))
+{
+    CheckEquivalent<Group30Var2>({Analog(12), Analog(32768), Analog(-32769), Analog(-7.6)});
+}
+
+TEST_CASE(SUITE("Group30Var5 matches the single value serializer"))
+{
+    std::vector<Analog> values;
+    for (int i = 0; i < 100; ++i)
+    {
+        values.push_back(Analog(i * 1.25 - 40.0, Flags(static_cast<uint8_t>(i))));
+    }
+    CheckEquivalent<Group30Var5>(values);
+}
+
+TEST_CASE(SUITE("Group32Var7 encodes the 48-bit timestamp"))
+{
+    CheckEquivalent<Group32Var7>({Analog(1.5, Flags(0x01), DNPTime(0x0000123456789ABC)),
+                                  Analog(-3.0, Flags(0x21), DNPTime(0x0000FFFFFFFFFFFF)), Analog(0.0)});
+
+    const std::vector<Analog> values = {Analog(0.0, Flags(0x01), DNPTime(0x0000060504030201))};
+    REQUIRE(WriteAsArray<Group32Var7>(values) == "01 00 00 00 00 01 02 03 04 05 06");
+}
+
+TEST_CASE(SUITE("array functions don't touch a buffer that is too short"))
+{
+    const std::vector<Counter> values = {Counter(1), Counter(2)};
+    std::vector<uint8_t> buffer(2 * Group20Var1::Size() - 1);
+
+    wseq_t dest(buffer.data(), buffer.size());
+    REQUIRE_FALSE(Group20Var1::WriteArray(values.data(), values.size(), dest));
+    REQUIRE(dest.length() == buffer.size());
+
+    std::vector<Counter> output(2);
+    rseq_t input(buffer.data(), buffer.size());
+    REQUIRE_FALSE(Group20Var1::ReadArray(input, output.data(), output.size()));
+    REQUIRE(input.length() == buffer.size());
+}
+
+TEST_CASE(SUITE("serializer without array functions falls back to single values"))
+{
+    const Serializer<Counter> serializer(Group20Var1::Size(), &Group20Var1::ReadTarget, &Group20Var1::WriteTarget);
+    const std::vector<Counter> values = {Counter(7), Counter(8)};
+
+    std::vector<uint8_t> buffer(values.size() * Group20Var1::Size());
+    wseq_t dest(buffer.data(), buffer.size());
+    REQUIRE(serializer.write_array(values.data(), values.size(), dest));
+    REQUIRE(HexConversions::to_hex(rseq_t(buffer.data(), buffer.size())) == WriteOneAtATime<Group20Var1>(values));
+}
+
+TEST_CASE(SUITE("range iterator batches are limited by the index range"))
+{
+    std::vector<uint8_t> buffer(2048);
+    wseq_t position(buffer.data(), buffer.size());
+    RangeWriteIterator<UInt8, Counter> iter(0, Group20Var1::Inst(), position);
+
+    REQUIRE(iter.Remaining() == 256);
+
+    const std::vector<Counter> values(200, Counter(1));
+    REQUIRE(iter.WriteArray(values.data(), 200));
+    REQUIRE(iter.Remaining() == 56);
+    REQUIRE_FALSE(iter.WriteArray(values.data(), 57));
+    REQUIRE(iter.WriteArray(values.data(), 56));
+    REQUIRE(iter.Remaining() == 0);
+    REQUIRE_FALSE(iter.WriteArray(values.data(), 1));
+}
@@ -0,0 +1,241 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <app/BitfieldKernels.h>
+#include <app/BitfieldRangeWriteIterator.h>
+#include <app/parsing/BitReader.h>
+
+#include <ser4cpp/container/SequenceTypes.h>
+#include <ser4cpp/util/HexConversions.h>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "BitfieldKernels - " name
+
+namespace
+{
+// enough values to cover several full AVX2 blocks plus every tail length
+const size_t MAX_COUNT = 4 * 32 + 31;
+
+// byte patterns used as bitfield input: every byte value in every position, then a pseudo-random sequence
+std::vector<std::vector<uint8_t>> Patterns()
+{
+    const size_t num_bytes = MAX_COUNT / 4 + 1;
+    std::vector<std::vector<uint8_t>> patterns;
+
+    for (int value = 0; value < 256; ++value)
+    {
+        patterns.emplace_back(num_bytes, static_cast<uint8_t>(value));
+
+        std::vector<uint8_t> shifted(num_bytes);
+        for (size_t i = 0; i < num_bytes; ++i)
+        {
+            shifted[i] = static_cast<uint8_t>(value + i);
+        }
+        patterns.push_back(shifted);
+    }
+
+    uint32_t state = 0x12345678;
+    std::vector<uint8_t> random(num_bytes);
+    for (auto& byte : random)
+    {
+        state = state * 1664525 + 1013904223;
+        byte = static_cast<uint8_t>(state >> 24);
+    }
+    patterns.push_back(random);
+
+    return patterns;
+}
+
+template<class Kernels> void CheckSingleBits()
+{
+    for (const auto& pattern : Patterns())
+    {
+        const ser4cpp::rseq_t buffer(pattern.data(), pattern.size());
+
+        for (size_t count = 0; count <= MAX_COUNT; ++count)
+        {
+            // unpack against the bit reader the parser used to use
+            std::vector<uint8_t> expected(count + 1, 0xAA);
+            for (size_t i = 0; i < count; ++i)
+            {
+                expected[i] = GetBit(buffer, i) ? 1 : 0;
+            }
+
+            std::vector<uint8_t> unpacked(count + 1, 0xAA);
+            Kernels::UnpackBits(pattern.data(), count, reinterpret_cast<bool*>(unpacked.data()));
+            REQUIRE(unpacked == expected);
+
+            // pack the values back and compare against the original bits, trailing bits must be zero
+            const auto num_bytes = NumBytesInBits(count);
+            std::vector<uint8_t> expected_packed(num_bytes + 1, 0xAA);
+            for (size_t i = 0; i < num_bytes; ++i)
+            {
+                const auto num_bits = (count - 8 * i) < 8 ? (count - 8 * i) : 8;
+                expected_packed[i] = pattern[i] & static_cast<uint8_t>((1u << num_bits) - 1);
+            }
+
+            std::vector<uint8_t> packed(num_bytes + 1, 0xAA);
+            Kernels::PackBits(reinterpret_cast<const bool*>(unpacked.data()), count, packed.data());
+            REQUIRE(packed == expected_packed);
+        }
+    }
+}
+
+template<class Kernels> void CheckDoubleBits()
+{
+    for (const auto& pattern : Patterns())
+    {
+        const ser4cpp::rseq_t buffer(pattern.data(), pattern.size());
+
+        for (size_t count = 0; count <= MAX_COUNT; ++count)
+        {
+            std::vector<uint8_t> expected(count + 1, 0xAA);
+            for (size_t i = 0; i < count; ++i)
+            {
+                expected[i] = DoubleBitSpec::to_type(GetDoubleBit(buffer, i));
+            }
+
+            std::vector<uint8_t> unpacked(count + 1, 0xAA);
+            Kernels::UnpackDoubleBits(pattern.data(), count, unpacked.data());
+            REQUIRE(unpacked == expected);
+
+            const auto num_bytes = NumBytesInDoubleBits(count);
+            std::vector<uint8_t> expected_packed(num_bytes + 1, 0xAA);
+            for (size_t i = 0; i < num_bytes; ++i)
+            {
+                const auto num_values = (count - 4 * i) < 4 ? (count - 4 * i) : 4;
+                expected_packed[i] = pattern[i] & static_cast<uint8_t>((1u << (2 * num_values)) - 1);
+            }
+
+            std::vector<uint8_t> packed(num_bytes + 1, 0xAA);
+            Kernels::PackDoubleBits(unpacked.data(), count, packed.data());
+            REQUIRE(packed == expected_packed);
+        }
+    }
+}
+
+template<class Kernels> void CheckDoubleBitsIgnoreHighBits()
+{
+    // only the low 2 bits of each value are packed
+    const std::vector<uint8_t> values(64, 0xFE);
+    std::vector<uint8_t> packed(16);
+    Kernels::PackDoubleBits(values.data(), values.size(), packed.data());
+    REQUIRE(packed == std::vector<uint8_t>(16, 0xAA));
+}
+} // namespace
+
+TEST_CASE(SUITE("scalar kernels match the bit reader"))
+{
+    CheckSingleBits<ScalarBitfieldKernels>();
+    CheckDoubleBits<ScalarBitfieldKernels>();
+    CheckDoubleBitsIgnoreHighBits<ScalarBitfieldKernels>();
+}
+
+TEST_CASE(SUITE("SSE2 kernels match the bit reader"))
+{
+    INFO("SSE2 available: " << SSE2BitfieldKernels::Available());
+    CheckSingleBits<SSE2BitfieldKernels>();
+    CheckDoubleBits<SSE2BitfieldKernels>();
+    CheckDoubleBitsIgnoreHighBits<SSE2BitfieldKernels>();
+}
+
+TEST_CASE(SUITE("AVX2 kernels match the bit reader"))
+{
+    INFO("AVX2 available: " << AVX2BitfieldKernels::Available());
+    CheckSingleBits<AVX2BitfieldKernels>();
+    CheckDoubleBits<AVX2BitfieldKernels>();
+    CheckDoubleBitsIgnoreHighBits<AVX2BitfieldKernels>();
+}
+
+TEST_CASE(SUITE("dispatch matches the bit reader"))
+{
+    INFO("kernel: " << BitfieldKernels::Name());
+    CheckSingleBits<BitfieldKernels>();
+    CheckDoubleBits<BitfieldKernels>();
+    CheckDoubleBitsIgnoreHighBits<BitfieldKernels>();
+}
+
+namespace
+{
+template<class IndexType> std::string WriteBits(const std::vector<bool>& values, size_t num_single)
+{
+    std::vector<uint8_t> buffer(64, 0xAA);
+    ser4cpp::wseq_t position(buffer.data(), buffer.size());
+    {
+        BitfieldRangeWriteIterator<IndexType> iter(0, position);
+
+        // the first values one at a time so the array starts part way through a byte
+        for (size_t i = 0; i < num_single; ++i)
+        {
+            REQUIRE(iter.Write(values[i]));
+        }
+
+        std::unique_ptr<bool[]> rest(new bool[values.size() - num_single]);
+        std::copy(values.begin() + num_single, values.end(), rest.get());
+        REQUIRE(iter.WriteArray(rest.get(), static_cast<uint32_t>(values.size() - num_single)));
+    }
+
+    const auto num_written = buffer.size() - position.length();
+    return ser4cpp::HexConversions::to_hex(ser4cpp::rseq_t(buffer.data(), num_written));
+}
+} // namespace
+
+TEST_CASE(SUITE("iterator packs arrays that start part way through a byte"))
+{
+    std::vector<bool> values;
+    for (size_t i = 0; i < 300; ++i)
+    {
+        values.push_back((i % 3) == 0);
+    }
+
+    const auto expected = WriteBits<ser4cpp::UInt16>(values, values.size());
+    for (size_t num_single = 0; num_single < 17; ++num_single)
+    {
+        REQUIRE(WriteBits<ser4cpp::UInt16>(values, num_single) == expected);
+    }
+}
+
+TEST_CASE(SUITE("iterator writes a full 1-byte index range"))
+{
+    const std::vector<bool> values(256, true);
+    const auto hex = WriteBits<ser4cpp::UInt8>(values, 0);
+    REQUIRE(hex.substr(0, 5) == "00 FF");
+    REQUIRE(hex.size() == (2 + 32) * 3 - 1);
+}
+
+TEST_CASE(SUITE("iterator rejects arrays that don't fit"))
+{
+    std::vector<uint8_t> buffer(2 * ser4cpp::UInt16::size + 2);
+    ser4cpp::wseq_t position(buffer.data(), buffer.size());
+    BitfieldRangeWriteIterator<ser4cpp::UInt16> iter(0, position);
+
+    const bool values[17] = {};
+    REQUIRE(iter.Remaining() == 16);
+    REQUIRE_FALSE(iter.WriteArray(values, 17));
+    REQUIRE(iter.WriteArray(values, 16));
+    REQUIRE(iter.Remaining() == 0);
+}
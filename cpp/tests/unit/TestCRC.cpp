@@ -37,3 +37,32 @@ TEST_CASE(SUITE("CrcTest"))
     REQUIRE(hs.Size() == 10);
     REQUIRE(CRC::CalcCrc(hs, 8) == 0x21E9);
 }
+
+TEST_CASE(SUITE("AreCorrectCRCsChecksEveryBlock"))
+{
+    const size_t blockSize = 16;
+    const size_t stride = blockSize + 2;
+
+    for (size_t count = 0; count <= 5; ++count)
+    {
+        std::vector<uint8_t> blocks(count * stride);
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (size_t j = 0; j < blockSize; ++j)
+            {
+                blocks[i * stride + j] = static_cast<uint8_t>(i * 31 + j);
+            }
+            CRC::AddCrc(blocks.data() + i * stride, blockSize);
+        }
+
+        REQUIRE(CRC::AreCorrectCRCs(blocks.data(), count, blockSize));
+
+        // corrupting any single block, including its CRC, is detected
+        for (size_t i = 0; i < blocks.size(); ++i)
+        {
+            blocks[i] ^= 0x01;
+            REQUIRE_FALSE(CRC::AreCorrectCRCs(blocks.data(), count, blockSize));
+            blocks[i] ^= 0x01;
+        }
+    }
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/BufferHelpers.h"
+
+#include <ser4cpp/util/HexConversions.h>
+
+#include <opendnp3/decoder/CaptureReplay.h>
+#include <opendnp3/logging/LogLevels.h>
+
+#include <catch.hpp>
+#include <channel/CaptureReader.h>
+#include <channel/CaptureWriter.h>
+#include <dnp3mocks/MockLogHandler.h>
+#include <dnp3mocks/MockSOEHandler.h>
+#include <link/LinkFrame.h>
+
+#include <cstdio>
+
+using namespace opendnp3;
+using namespace ser4cpp;
+
+#define SUITE(name) "CaptureTestSuite - " name
+
+namespace
+{
+// single unconfirmed user data frame from outstation 1024 to master 1 carrying a
+// response with one binary (g1v2, index 0, ONLINE | STATE)
+std::string ResponseFrame()
+{
+    HexSequence hs("C0 C0 81 00 00 01 02 00 00 00 81");
+
+    uint8_t buffer[292];
+    wseq_t wrapper(buffer, 292);
+
+    return HexConversions::to_hex(LinkFrame::FormatUnconfirmedUserData(wrapper, false, 1, 1024, hs, nullptr));
+}
+
+void WriteCapture(const std::string& path, CaptureFormat format)
+{
+    std::error_code ec;
+    auto writer = CaptureWriter::Create(Logger::empty(), path, format, ec);
+    REQUIRE(writer);
+    REQUIRE_FALSE(ec);
+
+    HexSequence tx("05 64 05 C0 01 00 00 04 E9 21");
+    HexSequence rx(ResponseFrame());
+
+    writer->Write(CaptureDirection::Tx, tx.ToRSeq());
+    writer->Write(CaptureDirection::Rx, rx.ToRSeq());
+}
+} // namespace
+
+TEST_CASE(SUITE("pcapng round trip preserves data and direction"))
+{
+    const std::string path = "capture-test.pcapng";
+    WriteCapture(path, CaptureFormat::PCAPNG);
+
+    CaptureReader reader(Logger::empty());
+    REQUIRE(reader.Load(path));
+    REQUIRE(reader.Records().size() == 2);
+
+    REQUIRE(reader.Records()[0].direction == CaptureDirection::Tx);
+    REQUIRE(HexConversions::to_hex(reader.Records()[0].data) == "05 64 05 C0 01 00 00 04 E9 21");
+
+    REQUIRE(reader.Records()[1].direction == CaptureDirection::Rx);
+    REQUIRE(HexConversions::to_hex(reader.Records()[1].data) == ResponseFrame());
+    REQUIRE(reader.Records()[1].micros >= reader.Records()[0].micros);
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE(SUITE("pcap only records received data"))
+{
+    const std::string path = "capture-test.pcap";
+    WriteCapture(path, CaptureFormat::PCAP);
+
+    CaptureReader reader(Logger::empty());
+    REQUIRE(reader.Load(path));
+    REQUIRE(reader.Records().size() == 1);
+    REQUIRE(reader.Records()[0].direction == CaptureDirection::Rx);
+    REQUIRE(HexConversions::to_hex(reader.Records()[0].data) == ResponseFrame());
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE(SUITE("write failure logs once and disables capture"))
+{
+    FILE* file = std::fopen("/dev/full", "wb");
+    if (!file)
+    {
+        return; // platform without /dev/full
+    }
+
+    MockLogHandler log;
+    HexSequence rx(ResponseFrame());
+
+    {
+        CaptureWriter writer(log.logger, file, CaptureFormat::PCAPNG);
+
+        for (int i = 0; i < 10; ++i)
+        {
+            writer.Write(CaptureDirection::Rx, rx.ToRSeq());
+        }
+    }
+
+    size_t numErrors = 0;
+    LogRecord record;
+    while (log.GetNextEntry(record))
+    {
+        if (record.level == flags::ERR)
+        {
+            ++numErrors;
+        }
+    }
+    REQUIRE(numErrors == 1);
+}
+
+TEST_CASE(SUITE("reader rejects unknown files"))
+{
+    const std::string path = "capture-test.bin";
+    {
+        FILE* file = std::fopen(path.c_str(), "wb");
+        REQUIRE(file);
+        const uint8_t garbage[] = {0x05, 0x64, 0x05, 0xC0, 0x01, 0x00};
+        std::fwrite(garbage, 1, sizeof(garbage), file);
+        std::fclose(file);
+    }
+
+    CaptureReader reader(Logger::empty());
+    REQUIRE_FALSE(reader.Load(path));
+    REQUIRE_FALSE(reader.Load("capture-test-missing.pcap"));
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE(SUITE("replay delivers measurements to the SOE handler"))
+{
+    const std::string path = "capture-test-replay.pcapng";
+    WriteCapture(path, CaptureFormat::PCAPNG);
+
+    MockSOEHandler handler;
+    CaptureReplay replay(handler, Logger::empty());
+    REQUIRE(replay.Load(path));
+
+    const auto stats = replay.Run(3);
+    REQUIRE(stats.numRecords == 3);
+    REQUIRE(stats.numLinkFrames == 3);
+    REQUIRE(stats.numFragments == 3);
+    REQUIRE(stats.numResponses == 3);
+    REQUIRE(stats.numParseErrors == 0);
+
+    REQUIRE(handler.TotalReceived() == 3);
+    REQUIRE(handler.binarySOE[0].meas.value);
+
+    std::remove(path.c_str());
+}
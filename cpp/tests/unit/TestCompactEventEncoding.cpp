@@ -0,0 +1,175 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/APDUHelpers.h"
+
+#include "dnp3mocks/MockLogHandler.h"
+#include "dnp3mocks/MockSOEHandler.h"
+
+#include <app/APDUHeader.h>
+#include <master/MeasurementHandler.h>
+#include <outstation/event/EventBuffer.h>
+
+#include <ser4cpp/util/HexConversions.h>
+
+#include <catch.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace opendnp3;
+using namespace ser4cpp;
+
+#define SUITE(name) "CompactEventEncoding - " name
+
+namespace
+{
+const DNPTime BASE_TIME(1000, TimestampQuality::SYNCHRONIZED);
+
+Event<BinarySpec> BinaryEvent(uint16_t index, uint64_t time, TimestampQuality quality = TimestampQuality::SYNCHRONIZED)
+{
+    return Event<BinarySpec>(Binary(true, Flags(0x01), DNPTime(time, quality)), index, EventClass::EC1,
+                             EventBinaryVariation::Group2Var2);
+}
+
+Event<DoubleBitBinarySpec> DoubleBitEvent(uint16_t index, uint64_t time)
+{
+    return Event<DoubleBitBinarySpec>(
+        DoubleBitBinary(DoubleBit::DETERMINED_ON, Flags(0x01), DNPTime(time, TimestampQuality::SYNCHRONIZED)), index,
+        EventClass::EC1, EventDoubleBinaryVariation::Group4Var2);
+}
+
+// objects written by a single Load(..), without the response header
+std::string LoadClassData(EventBuffer& buffer)
+{
+    buffer.SelectAllByClass(ClassField::AllEventClasses());
+    auto response = APDUHelpers::Response();
+    auto writer = response.GetWriter();
+    REQUIRE(buffer.Load(writer));
+    return HexConversions::to_hex(response.ToRSeq().skip(APDUHeader::RESPONSE_SIZE));
+}
+
+void ParseClassData(EventBuffer& buffer, MockSOEHandler& soe)
+{
+    buffer.SelectAllByClass(ClassField::AllEventClasses());
+    auto response = APDUHelpers::Response();
+    auto writer = response.GetWriter();
+    REQUIRE(buffer.Load(writer));
+
+    MockLogHandler log;
+    const auto objects = response.ToRSeq().skip(APDUHeader::RESPONSE_SIZE);
+    REQUIRE(MeasurementHandler::ProcessMeasurements(ResponseInfo(false, true, true), objects, log.logger, &soe)
+            == ParseResult::OK);
+}
+} // namespace
+
+TEST_CASE(SUITE("default encoding uses 2-byte prefixes and absolute time"))
+{
+    EventBuffer buffer(EventBufferConfig::AllTypes(10));
+    buffer.Update(BinaryEvent(3, 1000));
+
+    REQUIRE(LoadClassData(buffer) == "02 02 28 01 00 03 00 81 E8 03 00 00 00 00");
+}
+
+TEST_CASE(SUITE("binary events are written relative to a CTO with 1-byte prefixes"))
+{
+    EventBuffer buffer(EventBufferConfig::AllTypes(10), true);
+    buffer.Update(BinaryEvent(3, 1000));
+    buffer.Update(BinaryEvent(7, 1005));
+
+    REQUIRE(LoadClassData(buffer) == "33 01 07 01 E8 03 00 00 00 00 02 03 17 02 03 81 00 00 07 81 05 00");
+}
+
+TEST_CASE(SUITE("indices above 255 keep 2-byte prefixes"))
+{
+    EventBuffer buffer(EventBufferConfig::AllTypes(10), true);
+    buffer.Update(Event<CounterSpec>(Counter(5), 3, EventClass::EC1, EventCounterVariation::Group22Var1));
+    buffer.Update(Event<CounterSpec>(Counter(6), 300, EventClass::EC1, EventCounterVariation::Group22Var1));
+
+    REQUIRE(LoadClassData(buffer) == "16 01 28 02 00 03 00 01 05 00 00 00 2C 01 01 06 00 00 00");
+}
+
+TEST_CASE(SUITE("explicit requests for absolute time are honored"))
+{
+    EventBuffer buffer(EventBufferConfig::AllTypes(10), true);
+    buffer.Update(BinaryEvent(3, 1000));
+
+    REQUIRE_FALSE(buffer.SelectAll(GroupVariation::Group2Var2).Any());
+    auto response = APDUHelpers::Response();
+    auto writer = response.GetWriter();
+    REQUIRE(buffer.Load(writer));
+
+    REQUIRE(HexConversions::to_hex(response.ToRSeq().skip(APDUHeader::RESPONSE_SIZE))
+            == "02 02 17 01 03 81 E8 03 00 00 00 00");
+}
+
+TEST_CASE(SUITE("round trips binary and double-bit events through the master"))
+{
+    EventBuffer buffer(EventBufferConfig::AllTypes(10), true);
+    buffer.Update(BinaryEvent(1, 1000));
+    buffer.Update(BinaryEvent(2, 1250));
+    buffer.Update(BinaryEvent(3, 1000 + 70000));                          // too far from the CTO, new header
+    buffer.Update(BinaryEvent(4, 500));                                    // goes backwards, new header
+    buffer.Update(BinaryEvent(5, 600, TimestampQuality::UNSYNCHRONIZED)); // different quality, new header
+    buffer.Update(DoubleBitEvent(6, 2000));
+    buffer.Update(DoubleBitEvent(7, 2001));
+
+    MockSOEHandler soe;
+    ParseClassData(buffer, soe);
+
+    REQUIRE(soe.TotalReceived() == 7);
+
+    const std::vector<std::pair<uint16_t, uint64_t>> binaries = {{1, 1000}, {2, 1250}, {3, 71000}, {4, 500}, {5, 600}};
+    for (const auto& expected : binaries)
+    {
+        const auto record = soe.binarySOE.find(expected.first);
+        REQUIRE(record != soe.binarySOE.end());
+        REQUIRE(record->second.meas.value);
+        REQUIRE(record->second.meas.time.value == expected.second);
+        REQUIRE(record->second.info.gv == GroupVariation::Group2Var3);
+        REQUIRE(record->second.info.qualifier == QualifierCode::UINT8_CNT_UINT8_INDEX);
+    }
+    REQUIRE(soe.binarySOE[4].meas.time.quality == TimestampQuality::SYNCHRONIZED);
+    REQUIRE(soe.binarySOE[5].meas.time.quality == TimestampQuality::UNSYNCHRONIZED);
+
+    for (uint16_t index = 6; index <= 7; ++index)
+    {
+        const auto record = soe.doubleBinarySOE.find(index);
+        REQUIRE(record != soe.doubleBinarySOE.end());
+        REQUIRE(record->second.meas.value == DoubleBit::DETERMINED_ON);
+        REQUIRE(record->second.meas.time.value == 2000u + index - 6);
+        REQUIRE(record->second.info.gv == GroupVariation::Group4Var3);
+    }
+}
+
+TEST_CASE(SUITE("headers with 1-byte prefixes are limited to 255 objects"))
+{
+    EventBuffer buffer(EventBufferConfig::AllTypes(300), true);
+    for (uint16_t i = 0; i < 300; ++i)
+    {
+        buffer.Update(BinaryEvent(i % 200, 1000 + i));
+    }
+
+    MockSOEHandler soe;
+    ParseClassData(buffer, soe);
+
+    REQUIRE(soe.TotalReceived() == 300);
+    REQUIRE(soe.binarySOE[99].meas.time.value == 1000 + 299);
+    REQUIRE(soe.binarySOE[99].info.qualifier == QualifierCode::UINT8_CNT_UINT8_INDEX);
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/ConnectionAdmission.h"
+
+#include <exe4cpp/MockExecutor.h>
+
+#include <catch.hpp>
+
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "ConnectionAdmissionTestSuite - " name
+
+TEST_CASE(SUITE("admits every request without a limit"))
+{
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    ConnectionAdmission admission;
+
+    int count = 0;
+    for (int i = 0; i < 10; ++i)
+    {
+        admission.Request(executor, 0, [&]() { ++count; });
+    }
+
+    // callbacks are never invoked synchronously
+    REQUIRE(count == 0);
+    REQUIRE(executor->run_many() == 10);
+    REQUIRE(count == 10);
+    REQUIRE(admission.NumInFlight() == 10);
+    REQUIRE(admission.NumQueued() == 0);
+}
+
+TEST_CASE(SUITE("queues requests beyond the limit until a slot is released"))
+{
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    ConnectionAdmission admission(2);
+
+    std::vector<int> admitted;
+    const auto t1 = admission.Request(executor, 0, [&]() { admitted.push_back(1); });
+    admission.Request(executor, 0, [&]() { admitted.push_back(2); });
+    admission.Request(executor, 0, [&]() { admitted.push_back(3); });
+
+    executor->run_many();
+    REQUIRE(admitted == std::vector<int>{1, 2});
+    REQUIRE(admission.NumQueued() == 1);
+
+    admission.Release(t1);
+    executor->run_many();
+    REQUIRE(admitted == std::vector<int>{1, 2, 3});
+    REQUIRE(admission.NumInFlight() == 2);
+}
+
+TEST_CASE(SUITE("admits higher priority requests first"))
+{
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    ConnectionAdmission admission(1);
+
+    std::vector<int> admitted;
+    const auto first = admission.Request(executor, 0, [&]() { admitted.push_back(1); });
+    admission.Request(executor, 0, [&]() { admitted.push_back(2); });
+    admission.Request(executor, 5, [&]() { admitted.push_back(3); });
+    admission.Request(executor, 5, [&]() { admitted.push_back(4); });
+
+    executor->run_many();
+    admission.Release(first);
+    executor->run_many();
+
+    REQUIRE(admitted == std::vector<int>{1, 3});
+}
+
+TEST_CASE(SUITE("releasing a queued request withdraws it"))
+{
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    ConnectionAdmission admission(1);
+
+    std::vector<int> admitted;
+    const auto first = admission.Request(executor, 0, [&]() { admitted.push_back(1); });
+    const auto second = admission.Request(executor, 0, [&]() { admitted.push_back(2); });
+    admission.Request(executor, 0, [&]() { admitted.push_back(3); });
+
+    admission.Release(second);
+    REQUIRE(admission.NumQueued() == 1);
+
+    admission.Release(first);
+    executor->run_many();
+
+    REQUIRE(admitted == std::vector<int>{1, 3});
+}
+
+TEST_CASE(SUITE("raising the limit admits queued requests"))
+{
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    ConnectionAdmission admission(1);
+
+    int count = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+        admission.Request(executor, 0, [&]() { ++count; });
+    }
+
+    executor->run_many();
+    REQUIRE(count == 1);
+
+    admission.SetMaxInFlight(0);
+    executor->run_many();
+    REQUIRE(count == 3);
+}
@@ -153,3 +153,24 @@ TEST_CASE(SUITE("selected events discarded on overflow"))
     MockEventWriteHandler handler;
     REQUIRE(storage.Write(handler) == 0);
 }
+
+TEST_CASE(SUITE("records the selection latency of each event once when tracing"))
+{
+    EventStorage storage(EventBufferConfig::AllTypes(10));
+    LatencyHistogram histogram;
+    storage.SetLatencyTracing(&histogram);
+
+    REQUIRE_FALSE(
+        storage.Update(Event<BinarySpec>(Binary(true), 0, EventClass::EC1, EventBinaryVariation::Group2Var1)));
+    REQUIRE_FALSE(
+        storage.Update(Event<AnalogSpec>(Analog(1.0), 0, EventClass::EC2, EventAnalogVariation::Group32Var1)));
+
+    REQUIRE(storage.SelectByClass(EventClass::EC1) == 1);
+    REQUIRE(histogram.count == 1);
+
+    // re-selecting an event does not record it again
+    storage.Unselect();
+    REQUIRE(storage.SelectByType(EventType::Binary, 10) == 1);
+    REQUIRE(storage.SelectByType(EventType::Analog, 10) == 1);
+    REQUIRE(histogram.count == 2);
+}
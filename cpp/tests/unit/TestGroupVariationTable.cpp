@@ -0,0 +1,152 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <app/GroupVariationRecord.h>
+#include <gen/GroupVariationTable.h>
+#include <gen/objects/Group1.h>
+#include <gen/objects/Group12.h>
+#include <gen/objects/Group30.h>
+#include <gen/objects/Group50.h>
+
+#include <catch.hpp>
+
+#include <cstdint>
+
+using namespace opendnp3;
+
+#define SUITE(name) "GroupVariationTable - " name
+
+namespace
+{
+// the group/variation classification the table must reproduce
+GroupVariationType ExpectedType(uint8_t group, uint8_t variation)
+{
+    switch (group)
+    {
+    case (1):
+    case (3):
+    case (10):
+    case (20):
+    case (21):
+    case (30):
+    case (40):
+    case (110):
+    case (121):
+        return GroupVariationType::STATIC;
+    case (2):
+    case (4):
+    case (11):
+    case (13):
+    case (22):
+    case (23):
+    case (32):
+    case (41):
+    case (42):
+    case (43):
+    case (111):
+    case (122):
+        return GroupVariationType::EVENT;
+    case (50):
+        return (variation == 4) ? GroupVariationType::STATIC : GroupVariationType::OTHER;
+    case (60):
+        return (variation == 1) ? GroupVariationType::STATIC : GroupVariationType::EVENT;
+    default:
+        return GroupVariationType::OTHER;
+    }
+}
+
+GroupVariation ExpectedEnum(uint8_t group, uint8_t variation)
+{
+    const auto enumeration = GroupVariationSpec::from_type(GroupVariationRecord::GetGroupVar(group, variation));
+    if (enumeration != GroupVariation::UNKNOWN)
+    {
+        return enumeration;
+    }
+
+    switch (group)
+    {
+    case (110):
+        return GroupVariation::Group110Var0;
+    case (111):
+        return GroupVariation::Group111Var0;
+    case (112):
+        return GroupVariation::Group112Var0;
+    case (113):
+        return GroupVariation::Group113Var0;
+    default:
+        return GroupVariation::UNKNOWN;
+    }
+}
+} // namespace
+
+TEST_CASE(SUITE("Every group and variation resolves to the same enumeration as the conversion functions"))
+{
+    for (int group = 0; group < 256; ++group)
+    {
+        for (int variation = 0; variation < 256; ++variation)
+        {
+            const auto info = GroupVariationTable::Lookup(static_cast<uint8_t>(group), static_cast<uint8_t>(variation));
+            if (info.enumeration != ExpectedEnum(static_cast<uint8_t>(group), static_cast<uint8_t>(variation)))
+            {
+                FAIL("enumeration mismatch for g" << group << "v" << variation);
+            }
+        }
+    }
+}
+
+TEST_CASE(SUITE("Every group and variation resolves to the expected type"))
+{
+    for (int group = 0; group < 256; ++group)
+    {
+        for (int variation = 0; variation < 256; ++variation)
+        {
+            const auto type = GroupVariationRecord::GetType(static_cast<uint8_t>(group), static_cast<uint8_t>(variation));
+            if (type != ExpectedType(static_cast<uint8_t>(group), static_cast<uint8_t>(variation)))
+            {
+                FAIL("type mismatch for g" << group << "v" << variation);
+            }
+        }
+    }
+}
+
+TEST_CASE(SUITE("Fixed size objects report their serialized size"))
+{
+    REQUIRE(GroupVariationTable::Lookup(1, 2).size == Group1Var2::Size());
+    REQUIRE(GroupVariationTable::Lookup(12, 1).size == Group12Var1::Size());
+    REQUIRE(GroupVariationTable::Lookup(30, 5).size == Group30Var5::Size());
+    REQUIRE(GroupVariationTable::Lookup(50, 4).size == Group50Var4::Size());
+}
+
+TEST_CASE(SUITE("Objects without a fixed size report zero"))
+{
+    REQUIRE(GroupVariationTable::Lookup(1, 0).size == 0);
+    REQUIRE(GroupVariationTable::Lookup(1, 1).size == 0);
+    REQUIRE(GroupVariationTable::Lookup(60, 2).size == 0);
+    REQUIRE(GroupVariationTable::Lookup(110, 10).size == 0);
+    REQUIRE(GroupVariationTable::Lookup(200, 1).size == 0);
+}
+
+TEST_CASE(SUITE("Records keep the raw group and variation"))
+{
+    const auto record = GroupVariationRecord::GetRecord(111, 7);
+    REQUIRE(record.group == 111);
+    REQUIRE(record.variation == 7);
+    REQUIRE(record.enumeration == GroupVariation::Group111Var0);
+    REQUIRE(record.type == GroupVariationType::EVENT);
+}
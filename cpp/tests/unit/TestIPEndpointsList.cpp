@@ -18,7 +18,7 @@
  * limitations under the License.
  */
 
-#include "channel/IPEndpointsList.h"
+#include "opendnp3/channel/IPEndpointsList.h"
 
 #include <catch.hpp>
 
@@ -79,4 +79,33 @@ TEST_CASE("TestIPEndpointsList")
         REQUIRE(list.GetCurrentEndpoint().address == ADDRESS);
         REQUIRE(list.GetCurrentEndpoint().port == PORT);
     }
+
+    SECTION("all endpoints are available regardless of the current one")
+    {
+        IPEndpointsList list({IPEndpoint(ADDRESS, PORT), IPEndpoint(OTHER_ADDRESS, OTHER_PORT)});
+
+        list.Next();
+
+        REQUIRE(list.GetEndpoints().size() == 2);
+        REQUIRE(list.GetEndpoints()[0].address == ADDRESS);
+        REQUIRE(list.GetEndpoints()[1].address == OTHER_ADDRESS);
+        REQUIRE(list.GetCurrentEndpoint().address == OTHER_ADDRESS);
+    }
+
+    SECTION("current endpoint can be selected by index")
+    {
+        IPEndpointsList list({IPEndpoint(ADDRESS, PORT), IPEndpoint(OTHER_ADDRESS, OTHER_PORT)});
+
+        REQUIRE(list.GetCurrentIndex() == 0);
+
+        list.SetCurrentIndex(1);
+        REQUIRE(list.GetCurrentIndex() == 1);
+        REQUIRE(list.GetCurrentEndpoint().address == OTHER_ADDRESS);
+
+        list.SetCurrentIndex(2);
+        REQUIRE(list.GetCurrentIndex() == 1);
+
+        REQUIRE_FALSE(list.Next());
+        REQUIRE(list.GetCurrentIndex() == 0);
+    }
 }
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <opendnp3/util/LatencyHistogram.h>
+
+#include <catch.hpp>
+
+using namespace opendnp3;
+
+#define SUITE(name) "LatencyHistogramTestSuite - " name
+
+TEST_CASE(SUITE("empty histogram reports zero"))
+{
+    LatencyHistogram histogram;
+
+    REQUIRE(histogram.count == 0);
+    REQUIRE(histogram.MeanMicros() == 0);
+    REQUIRE(histogram.PercentileMicros(99) == 0);
+}
+
+TEST_CASE(SUITE("samples are placed in power of two buckets"))
+{
+    LatencyHistogram histogram;
+
+    histogram.Record(std::chrono::nanoseconds(500));
+    histogram.Record(std::chrono::microseconds(1));
+    histogram.Record(std::chrono::microseconds(3));
+    histogram.Record(std::chrono::microseconds(4));
+    histogram.Record(std::chrono::microseconds(1000));
+
+    REQUIRE(histogram.buckets[0] == 1);
+    REQUIRE(histogram.buckets[1] == 1);
+    REQUIRE(histogram.buckets[2] == 1);
+    REQUIRE(histogram.buckets[3] == 1);
+    REQUIRE(histogram.buckets[10] == 1);
+
+    REQUIRE(histogram.count == 5);
+    REQUIRE(histogram.minMicros == 0);
+    REQUIRE(histogram.maxMicros == 1000);
+    REQUIRE(histogram.sumMicros == 1008);
+}
+
+TEST_CASE(SUITE("large and negative samples are clamped to the outer buckets"))
+{
+    LatencyHistogram histogram;
+
+    histogram.Record(std::chrono::hours(24));
+    histogram.Record(-std::chrono::microseconds(5));
+
+    REQUIRE(histogram.buckets[LatencyHistogram::NUM_BUCKETS - 1] == 1);
+    REQUIRE(histogram.buckets[0] == 1);
+    REQUIRE(LatencyHistogram::UpperBoundMicros(LatencyHistogram::NUM_BUCKETS - 1)
+            == std::numeric_limits<uint64_t>::max());
+}
+
+TEST_CASE(SUITE("percentiles report the bucket bound limited by the maximum"))
+{
+    LatencyHistogram histogram;
+
+    for (int i = 0; i < 99; ++i)
+    {
+        histogram.Record(std::chrono::microseconds(10));
+    }
+    histogram.Record(std::chrono::microseconds(100));
+
+    REQUIRE(histogram.PercentileMicros(50) == 16);
+    REQUIRE(histogram.PercentileMicros(98) == 16);
+    REQUIRE(histogram.PercentileMicros(100) == 100);
+    REQUIRE(histogram.MeanMicros() == 10);
+}
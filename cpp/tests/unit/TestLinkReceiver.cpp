@@ -253,6 +253,42 @@ TEST_CASE(SUITE("ConfirmedUserData"))
     REQUIRE(t.sink.received.Equals(data.ToRSeq()));
 }
 
+TEST_CASE(SUITE("UserDataIsWrittenIntoSinkBuffer"))
+{
+    ByteStr data(250, 0);
+
+    Buffer buffer(292);
+    auto writeTo = buffer.as_wslice();
+    auto frame = LinkFrame::FormatUnconfirmedUserData(writeTo, true, 1, 2, data.ToRSeq(), nullptr);
+
+    Buffer dest(250);
+
+    LinkParserTest t;
+    t.sink.userDataBuffer = dest.as_wslice();
+    t.WriteData(frame);
+    REQUIRE(t.sink.m_num_frames == 1);
+    REQUIRE(t.sink.m_last_userdata == dest.as_rslice());
+    REQUIRE(t.sink.received.Equals(data.ToRSeq()));
+}
+
+TEST_CASE(SUITE("SinkBufferThatIsTooSmallIsIgnored"))
+{
+    ByteStr data(250, 0);
+
+    Buffer buffer(292);
+    auto writeTo = buffer.as_wslice();
+    auto frame = LinkFrame::FormatUnconfirmedUserData(writeTo, true, 1, 2, data.ToRSeq(), nullptr);
+
+    Buffer dest(249);
+
+    LinkParserTest t;
+    t.sink.userDataBuffer = dest.as_wslice();
+    t.WriteData(frame);
+    REQUIRE(t.sink.m_num_frames == 1);
+    REQUIRE(t.sink.m_last_userdata != dest.as_rslice());
+    REQUIRE(t.sink.received.Equals(data.ToRSeq()));
+}
+
 //////////////////////////////////////////
 // multi packets
 //////////////////////////////////////////
@@ -302,3 +338,50 @@ TEST_CASE(SUITE("ManyReceives"))
         REQUIRE(t.sink.CheckLastWithDFC(LinkFunction::SEC_ACK, true, false, 1, 2));
     }
 }
+
+//////////////////////////////////////////
+// reliable transport fast path
+//////////////////////////////////////////
+
+TEST_CASE(SUITE("ReliableTransportParsesBackToBackFrames"))
+{
+    ByteStr data(250, 0);
+
+    Buffer buffer(292);
+    auto writeTo = buffer.as_wslice();
+    auto frame = LinkFrame::FormatUnconfirmedUserData(writeTo, true, 1, 2, data.ToRSeq(), nullptr);
+
+    LinkParserTest t;
+    t.parser.SetReliableTransport(true);
+    t.WriteData("05 64 05 C0 01 00 00 04 E9 21");
+    t.WriteData(frame);
+    REQUIRE(t.sink.m_num_frames == 2);
+    REQUIRE(t.sink.CheckLast(LinkFunction::PRI_UNCONFIRMED_USER_DATA, true, 1, 2));
+    REQUIRE(t.sink.received.Equals(data.ToRSeq()));
+    REQUIRE(t.parser.Statistics().numLinkFrameRx == 2);
+}
+
+TEST_CASE(SUITE("ReliableTransportFallsBackForPartialFrames"))
+{
+    LinkParserTest t;
+    t.parser.SetReliableTransport(true);
+    t.WriteData("05 64 05 C0 01");
+    REQUIRE(t.sink.m_num_frames == 0);
+    t.WriteData("00 00 04 E9 21 05 64 05 C0 01 00 00 04 E9 21");
+    REQUIRE(t.sink.m_num_frames == 2);
+    REQUIRE(t.sink.CheckLast(LinkFunction::PRI_RESET_LINK_STATES, true, 1, 1024));
+}
+
+TEST_CASE(SUITE("ReliableTransportCountsErrorsOnce"))
+{
+    LinkParserTest t;
+    t.parser.SetReliableTransport(true);
+    t.WriteData("05 64 14 F3 01 00 00 04 0A 3B C0 C3 01 3C 02 06 3C 03 06 3C 04 06 3C 01 06 9A 11");
+    t.WriteData("05 64 05 64 05 C0 01 00 00 04 E9 21");
+    t.WriteData(RepairCRC("05 64 08 C0 01 00 00 04 E9 21"));
+    REQUIRE(t.parser.Statistics().numBodyCrcError == 1);
+    REQUIRE(t.parser.Statistics().numHeaderCrcError == 1);
+    REQUIRE(t.parser.Statistics().numBadLength == 1);
+    REQUIRE(t.sink.m_num_frames == 1);
+    REQUIRE(t.sink.CheckLast(LinkFunction::PRI_RESET_LINK_STATES, true, 1, 1024));
+}
@@ -779,3 +779,30 @@ TEST_CASE(SUITE("IntegrityPollOnBufferOverflowIIN"))
     REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(1));
     t.context->OnTxReady();
 }
+
+TEST_CASE(SUITE("records task statistics for a solicited poll"))
+{
+    MasterParams params;
+    params.disableUnsolOnStartup = false;
+    params.unsolClassMask = ClassField::None();
+    MasterTestFixture t(params);
+    t.context->OnLowerLayerUp();
+
+    t.exe->run_many();
+
+    REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+    t.context->OnTxReady();
+    t.SendToMaster("C0 81 00 00 01 02 00 02 03 81 81"); // group 1 var 2, index = 2-3
+
+    const auto statistics = t.context->tasks.context->GetStatistics();
+    const auto& integrity = statistics.at(MasterTaskType::STARTUP_INTEGRITY_POLL);
+    REQUIRE(integrity.numStarted == 1);
+    REQUIRE(integrity.numSucceeded == 1);
+    REQUIRE(integrity.numFailed == 0);
+    REQUIRE(integrity.numResponses == 1);
+    REQUIRE(integrity.numBytesRx == 11);
+    REQUIRE(integrity.numObjects == 2);
+    REQUIRE(integrity.queueWait.count == 1);
+    REQUIRE(integrity.requestToFirstResponse.count == 1);
+    REQUIRE(integrity.duration.count == 1);
+}
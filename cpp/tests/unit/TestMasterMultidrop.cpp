@@ -172,6 +172,332 @@ TEST_CASE(SUITE("Scheduler still does integrity polls if exception scan set to h
     ExpectRequestAndRespond(t1, hex::IntegrityPoll(2), hex::EmptyResponse(2));
 }
 
+MasterSchedulerConfig ConcurrentSchedulerConfig(uint16_t maxConcurrentTasks)
+{
+    MasterSchedulerConfig config;
+    config.concurrentTasksPerMaster = true;
+    config.maxConcurrentTasks = maxConcurrentTasks;
+    return config;
+}
+
+TEST_CASE(SUITE("Concurrent scheduling runs a task per master on a full-duplex channel"))
+{
+    MasterParams params;
+    params.disableUnsolOnStartup = false;
+
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    const auto log = std::make_shared<MockLogHandlerImpl>();
+
+    scheduler->Configure(ConcurrentSchedulerConfig(0));
+    scheduler->SetFullDuplex(true);
+
+    MasterTestFixture t1(params, Addresses(1, 10), "s1", log, executor, scheduler);
+    MasterTestFixture t2(params, Addresses(1, 11), "s2", log, executor, scheduler);
+
+    t1.context->OnLowerLayerUp();
+    t2.context->OnLowerLayerUp();
+
+    REQUIRE(executor->run_many() > 0);
+
+    // both masters have their integrity poll in flight at the same time
+    REQUIRE(t1.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+    REQUIRE(t2.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+
+    // each master still only runs a single task at a time
+    t1.context->OnTxReady();
+    t2.context->OnTxReady();
+    t2.SendToMaster(hex::EmptyResponse(0, IINField(IINBit::DEVICE_RESTART)));
+
+    REQUIRE(executor->run_many() > 0);
+
+    REQUIRE(t1.lower->PopWriteAsHex().empty());
+    REQUIRE(t2.lower->PopWriteAsHex() == hex::ClearRestartIIN(1));
+}
+
+TEST_CASE(SUITE("Concurrent scheduling is serialized on a half-duplex channel"))
+{
+    MasterParams params;
+    params.disableUnsolOnStartup = false;
+
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    const auto log = std::make_shared<MockLogHandlerImpl>();
+
+    scheduler->Configure(ConcurrentSchedulerConfig(0));
+    scheduler->SetFullDuplex(false);
+
+    MasterTestFixture t1(params, Addresses(1, 10), "s1", log, executor, scheduler);
+    MasterTestFixture t2(params, Addresses(1, 11), "s2", log, executor, scheduler);
+
+    t1.context->OnLowerLayerUp();
+    t2.context->OnLowerLayerUp();
+
+    REQUIRE(executor->run_many() > 0);
+
+    REQUIRE(t1.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+    REQUIRE(t2.lower->PopWriteAsHex().empty());
+
+    t1.context->OnTxReady();
+    t1.SendToMaster(hex::EmptyResponse(0));
+
+    REQUIRE(executor->run_many() > 0);
+
+    REQUIRE(t2.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+}
+
+TEST_CASE(SUITE("Switching to full-duplex starts waiting tasks"))
+{
+    MasterParams params;
+    params.disableUnsolOnStartup = false;
+
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    const auto log = std::make_shared<MockLogHandlerImpl>();
+
+    scheduler->Configure(ConcurrentSchedulerConfig(0));
+    scheduler->SetFullDuplex(false);
+
+    MasterTestFixture t1(params, Addresses(1, 10), "s1", log, executor, scheduler);
+    MasterTestFixture t2(params, Addresses(1, 11), "s2", log, executor, scheduler);
+
+    t1.context->OnLowerLayerUp();
+    t2.context->OnLowerLayerUp();
+
+    REQUIRE(executor->run_many() > 0);
+
+    REQUIRE(t1.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+    REQUIRE(t2.lower->PopWriteAsHex().empty());
+
+    // nothing else happens on the channel, the mode change alone starts the second master
+    scheduler->SetFullDuplex(true);
+
+    REQUIRE(executor->run_many() > 0);
+
+    REQUIRE(t1.lower->PopWriteAsHex().empty());
+    REQUIRE(t2.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+}
+
+TEST_CASE(SUITE("Concurrent scheduling respects the channel-wide limit"))
+{
+    MasterParams params;
+    params.disableUnsolOnStartup = false;
+
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    const auto log = std::make_shared<MockLogHandlerImpl>();
+
+    scheduler->Configure(ConcurrentSchedulerConfig(2));
+    scheduler->SetFullDuplex(true);
+
+    MasterTestFixture t1(params, Addresses(1, 10), "s1", log, executor, scheduler);
+    MasterTestFixture t2(params, Addresses(1, 11), "s2", log, executor, scheduler);
+    MasterTestFixture t3(params, Addresses(1, 12), "s3", log, executor, scheduler);
+
+    t1.context->OnLowerLayerUp();
+    t2.context->OnLowerLayerUp();
+    t3.context->OnLowerLayerUp();
+
+    REQUIRE(executor->run_many() > 0);
+
+    REQUIRE(t1.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+    REQUIRE(t2.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+    REQUIRE(t3.lower->PopWriteAsHex().empty());
+
+    // completing a task on the first master frees a slot for the third
+    t1.context->OnTxReady();
+    t1.SendToMaster(hex::EmptyResponse(0));
+
+    REQUIRE(executor->run_many() > 0);
+
+    REQUIRE(t3.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+}
+
+MasterSchedulerConfig MergingSchedulerConfig(TimeDuration window)
+{
+    MasterSchedulerConfig config;
+    config.pollMergeWindow = window;
+    return config;
+}
+
+TEST_CASE(SUITE("Polls with different handlers are not merged"))
+{
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    scheduler->Configure(MergingSchedulerConfig(TimeDuration::Milliseconds(5)));
+
+    MasterTestFixture t(NoStartupTasks(), Addresses(1, 1024), "test", nullptr, executor, scheduler);
+    const auto other = std::make_shared<MockSOEHandler>();
+
+    t.context->AddClassScan(ClassField(ClassField::CLASS_1 | ClassField::CLASS_2), TimeDuration::Milliseconds(10),
+                            t.meas);
+    t.context->AddClassScan(ClassField(ClassField::CLASS_3), TimeDuration::Milliseconds(20), other);
+
+    t.context->OnLowerLayerUp();
+
+    REQUIRE(executor->run_many() > 0);
+
+    REQUIRE(t.lower->PopWriteAsHex() == "C0 01 3C 02 06 3C 03 06");
+    t.context->OnTxReady();
+    t.SendToMaster("C0 81 00 00 02 01 17 01 02 81");
+
+    // each handler only receives the response to its own scan
+    REQUIRE(t.meas->TotalReceived() == 1);
+    REQUIRE(other->TotalReceived() == 0);
+
+    REQUIRE(executor->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == "C1 01 3C 04 06");
+    t.context->OnTxReady();
+    t.SendToMaster("C1 81 00 00 02 01 17 01 03 81");
+
+    REQUIRE(t.meas->TotalReceived() == 1);
+    REQUIRE(other->TotalReceived() == 1);
+}
+
+TEST_CASE(SUITE("Merged polls that share a handler deliver the response to it once"))
+{
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    scheduler->Configure(MergingSchedulerConfig(TimeDuration::Milliseconds(5)));
+
+    MasterTestFixture t(NoStartupTasks(), Addresses(1, 1024), "test", nullptr, executor, scheduler);
+
+    t.context->AddClassScan(ClassField(ClassField::CLASS_1), TimeDuration::Milliseconds(10), t.meas);
+    t.context->AddClassScan(ClassField(ClassField::CLASS_2), TimeDuration::Milliseconds(10), t.meas);
+
+    t.context->OnLowerLayerUp();
+
+    REQUIRE(executor->run_many() > 0);
+
+    REQUIRE(t.lower->PopWriteAsHex() == "C0 01 3C 02 06 3C 03 06");
+    t.context->OnTxReady();
+    t.SendToMaster("C0 81 00 00 02 01 17 01 02 81");
+
+    REQUIRE(t.meas->TotalReceived() == 1);
+
+    // both polls complete, but the single response is only counted once
+    const auto statistics = t.context->tasks.context->GetStatistics();
+    const auto& polls = statistics.at(MasterTaskType::USER_POLL);
+    REQUIRE(polls.numStarted == 2);
+    REQUIRE(polls.numSucceeded == 2);
+    REQUIRE(polls.numResponses == 1);
+    REQUIRE(polls.numBytesRx == 10);
+    REQUIRE(polls.requestToFirstResponse.count == 1);
+}
+
+TEST_CASE(SUITE("Merged adaptive polls count the values delivered through the shared handler"))
+{
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    scheduler->Configure(MergingSchedulerConfig(TimeDuration::Milliseconds(5)));
+
+    MasterTestFixture t(NoStartupTasks(), Addresses(1, 1024), "test", nullptr, executor, scheduler);
+
+    auto adaptive = TaskConfig::Default();
+    adaptive.adaptiveScan = AdaptiveScanConfig(TimeDuration::Seconds(1), TimeDuration::Minutes(1));
+
+    t.context->AddClassScan(ClassField(ClassField::CLASS_1), TimeDuration::Seconds(10), t.meas);
+    t.context->AddClassScan(ClassField(ClassField::CLASS_2), TimeDuration::Seconds(10), t.meas, adaptive);
+
+    t.context->OnLowerLayerUp();
+
+    REQUIRE(executor->run_many() > 0);
+
+    REQUIRE(t.lower->PopWriteAsHex() == "C0 01 3C 02 06 3C 03 06");
+    t.context->OnTxReady();
+    const auto completed = executor->get_time();
+    t.SendToMaster("C0 81 00 00 02 01 17 01 02 81");
+
+    REQUIRE(t.meas->TotalReceived() == 1);
+
+    // the value was delivered by the class 1 poll, but it still shrinks the period of the merged class 2 poll
+    executor->run_many();
+    REQUIRE(executor->advance_to_next_timer());
+    REQUIRE(executor->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == "C1 01 3C 03 06");
+    REQUIRE(executor->get_time() - completed == std::chrono::seconds(5));
+}
+
+TEST_CASE(SUITE("Merged polls still expecting fragments fail when the active poll ends"))
+{
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    scheduler->Configure(MergingSchedulerConfig(TimeDuration::Milliseconds(5)));
+
+    MasterTestFixture t(NoStartupTasks(), Addresses(1, 1024), "test", nullptr, executor, scheduler);
+
+    t.context->AddClassScan(ClassField(ClassField::CLASS_1), TimeDuration::Milliseconds(10), t.meas);
+    t.context->AddClassScan(ClassField(ClassField::CLASS_2), TimeDuration::Milliseconds(10), t.meas);
+
+    t.context->OnLowerLayerUp();
+
+    REQUIRE(executor->run_many() > 0);
+
+    REQUIRE(t.lower->PopWriteAsHex() == "C0 01 3C 02 06 3C 03 06");
+    t.context->OnTxReady();
+
+    // first fragment of a multi-fragment response, the object header can't be parsed by the active poll
+    t.SendToMaster("80 81 00 00 FF FF 00");
+
+    const auto statistics = t.context->tasks.context->GetStatistics();
+    const auto& polls = statistics.at(MasterTaskType::USER_POLL);
+    REQUIRE(polls.numStarted == 2);
+    REQUIRE(polls.numFailed == 2);
+    REQUIRE(polls.duration.count == 2);
+}
+
+TEST_CASE(SUITE("Polls are only merged while the request fits in maxTxFragSize"))
+{
+    auto params = NoStartupTasks();
+    params.maxTxFragSize = 8;
+
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    scheduler->Configure(MergingSchedulerConfig(TimeDuration::Milliseconds(5)));
+
+    MasterTestFixture t(params, Addresses(1, 1024), "test", nullptr, executor, scheduler);
+
+    t.context->AddClassScan(ClassField(ClassField::CLASS_1), TimeDuration::Milliseconds(10), t.meas);
+    t.context->AddClassScan(ClassField(ClassField::CLASS_2), TimeDuration::Milliseconds(10), t.meas);
+    t.context->AddClassScan(ClassField(ClassField::CLASS_3), TimeDuration::Milliseconds(10), t.meas);
+
+    t.context->OnLowerLayerUp();
+
+    REQUIRE(executor->run_many() > 0);
+
+    REQUIRE(t.lower->PopWriteAsHex() == "C0 01 3C 02 06 3C 03 06");
+    t.context->OnTxReady();
+    t.SendToMaster("C0 81 00 00");
+
+    REQUIRE(executor->run_many() > 0);
+
+    REQUIRE(t.lower->PopWriteAsHex() == "C1 01 3C 04 06");
+}
+
+TEST_CASE(SUITE("Polls outside the merge window are not merged"))
+{
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    scheduler->Configure(MergingSchedulerConfig(TimeDuration::Milliseconds(5)));
+
+    MasterTestFixture t(NoStartupTasks(), Addresses(1, 1024), "test", nullptr, executor, scheduler);
+
+    t.context->AddClassScan(ClassField(ClassField::CLASS_1), TimeDuration::Milliseconds(10), t.meas);
+    t.context->OnLowerLayerUp();
+
+    REQUIRE(executor->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == "C0 01 3C 02 06");
+    t.context->OnTxReady();
+    t.SendToMaster("C0 81 00 00");
+    REQUIRE(executor->run_many() > 0);
+
+    // the new scan is due now, the first one isn't due for another 10ms
+    t.context->AddClassScan(ClassField(ClassField::CLASS_2), TimeDuration::Milliseconds(10), t.meas);
+
+    REQUIRE(executor->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == "C1 01 3C 03 06");
+}
+
 void ExpectRequestAndCauseResponseTimeout(MasterTestFixture& session, const std::string& expected)
 {
     REQUIRE(session.lower->PopWriteAsHex() == expected);
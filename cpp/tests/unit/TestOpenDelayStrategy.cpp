@@ -0,0 +1,79 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "opendnp3/channel/IOpenDelayStrategy.h"
+
+#include <catch.hpp>
+
+#include <set>
+
+using namespace opendnp3;
+
+#define SUITE(name) "OpenDelayStrategyTestSuite - " name
+
+TEST_CASE(SUITE("exponential backoff doubles up to the maximum"))
+{
+    auto& strategy = ExponentialBackoffStrategy::Instance();
+
+    REQUIRE(strategy.GetNextDelay(TimeDuration::Seconds(1), TimeDuration::Minutes(1)) == TimeDuration::Seconds(2));
+    REQUIRE(strategy.GetNextDelay(TimeDuration::Seconds(40), TimeDuration::Minutes(1)) == TimeDuration::Minutes(1));
+}
+
+TEST_CASE(SUITE("decorrelated jitter stays between the base and 3x the current delay"))
+{
+    const auto base = TimeDuration::Seconds(1);
+    const auto max = TimeDuration::Minutes(1);
+    DecorrelatedJitterStrategy strategy(base, 42);
+
+    auto current = base;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto next = strategy.GetNextDelay(current, max);
+        REQUIRE(next >= base);
+        REQUIRE(next <= max);
+        REQUIRE(next.value <= 3 * current.value);
+        current = next;
+    }
+}
+
+TEST_CASE(SUITE("decorrelated jitter spreads out channels that fail together"))
+{
+    const auto base = TimeDuration::Seconds(1);
+    const auto max = TimeDuration::Minutes(1);
+
+    std::set<int64_t> delays;
+    for (uint32_t seed = 0; seed < 100; ++seed)
+    {
+        DecorrelatedJitterStrategy strategy(base, seed);
+        const auto delay = strategy.GetNextDelay(TimeDuration::Seconds(10), max);
+        delays.insert(std::chrono::duration_cast<std::chrono::milliseconds>(delay.value).count());
+    }
+
+    REQUIRE(delays.size() > 50);
+}
+
+TEST_CASE(SUITE("decorrelated jitter never exceeds the maximum"))
+{
+    DecorrelatedJitterStrategy strategy(TimeDuration::Seconds(1), 7);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        REQUIRE(strategy.GetNextDelay(TimeDuration::Max(), TimeDuration::Seconds(5)) <= TimeDuration::Seconds(5));
+    }
+}
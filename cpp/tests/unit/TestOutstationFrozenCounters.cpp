@@ -221,3 +221,35 @@ TEST_CASE(SUITE("Range freeze"))
                "01 00 00 00 00 01 00 00 00 00 01 00 00 00 00"); // Frozen values are updated
     t.OnTxReady();
 }
+
+TEST_CASE(SUITE("Freeze and clear queues the frozen counter events before the counter events"))
+{
+    OutstationConfig config;
+    config.eventBufferConfig = EventBufferConfig::AllTypes(10);
+    auto database = configure::by_count_of::counter(2, true);
+    OutstationTestObject t(config, database);
+    t.Transaction([](IUpdateHandler& db) {
+        db.Update(Counter(counterValue, Flags(0x01)), 0);
+        db.Update(Counter(counterValue, Flags(0x01)), 1);
+        db.Modify(FlagsType::FrozenCounter, 0, 1, 0x01);
+    });
+    t.LowerLayerUp();
+
+    // Discard the events of the initial updates
+    t.SendToOutstation(hex::ClassPoll(0, PointClass::Class1));
+    t.lower->PopWriteAsHex();
+    t.OnTxReady();
+    t.SendToOutstation(hex::SolicitedConfirm(0));
+
+    // Freeze and clear all counters
+    t.SendToOutstation("C1 09 14 00 06");
+    REQUIRE(t.lower->PopWriteAsHex() == "C1 81 82 00");
+    t.OnTxReady();
+
+    // Both frozen counter events come first, followed by both counter events
+    t.SendToOutstation(hex::ClassPoll(2, PointClass::Class1));
+    REQUIRE(t.lower->PopWriteAsHex()
+            == "E2 81 80 00 "
+               "17 01 28 02 00 00 00 01 29 00 00 00 01 00 01 29 00 00 00 "
+               "16 01 28 02 00 00 00 01 00 00 00 00 01 00 01 00 00 00 00");
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "app/parsing/Collections.h"
+
+#include <opendnp3/ErrorCodes.h>
+#include <opendnp3/master/PointCache.h>
+
+#include <catch.hpp>
+
+#include <cstdio>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "PointCacheTestSuite - " name
+
+namespace
+{
+PointCacheConfig Config()
+{
+    PointCacheConfig config;
+    config.numBinary = 2;
+    config.numAnalog = 3;
+    config.numCounter = 1;
+    return config;
+}
+
+template<class T> void Load(ISOEHandler& handler, const std::vector<Indexed<T>>& values)
+{
+    ArrayCollection<Indexed<T>> collection(values.data(), values.size());
+    handler.Process(HeaderInfo(), collection);
+}
+
+class CountingHandler final : public ISOEHandler
+{
+public:
+    void BeginFragment(const ResponseInfo&) override {}
+    void EndFragment(const ResponseInfo&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<Binary>>& values) override
+    {
+        count += values.Count();
+    }
+    void Process(const HeaderInfo&, const ICollection<Indexed<DoubleBitBinary>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<Analog>>& values) override
+    {
+        count += values.Count();
+    }
+    void Process(const HeaderInfo&, const ICollection<Indexed<Counter>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<FrozenCounter>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<BinaryOutputStatus>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<AnalogOutputStatus>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<OctetString>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<TimeAndInterval>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<BinaryCommandEvent>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<AnalogCommandEvent>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<DNPTime>&) override {}
+
+    size_t count = 0;
+};
+} // namespace
+
+TEST_CASE(SUITE("caches the latest value, flags and time of each point"))
+{
+    auto cache = PointCache::Create(Config());
+
+    Load(*cache, std::vector<Indexed<Analog>>{WithIndex(Analog(3.5, Flags(0x01), DNPTime(1000)), 2)});
+
+    CachedPoint point;
+    REQUIRE(cache->Get(PointCacheType::Analog, 2, point));
+    REQUIRE(point.value == 3.5);
+    REQUIRE(point.flags == 0x01);
+    REQUIRE(point.time == 1000);
+    REQUIRE(point.changeSequence == 1);
+
+    REQUIRE(cache->Get(PointCacheType::Analog, 0, point));
+    REQUIRE(point.changeSequence == 0);
+}
+
+TEST_CASE(SUITE("ignores indices beyond the configured count"))
+{
+    auto cache = PointCache::Create(Config());
+
+    Load(*cache, std::vector<Indexed<Counter>>{WithIndex(Counter(7), 1)});
+
+    CachedPoint point;
+    REQUIRE_FALSE(cache->Get(PointCacheType::Counter, 1, point));
+    REQUIRE(cache->GetLastChange() == 0);
+}
+
+TEST_CASE(SUITE("only records a change when the value or flags differ"))
+{
+    auto cache = PointCache::Create(Config());
+
+    Load(*cache, std::vector<Indexed<Binary>>{WithIndex(Binary(true), 0)});
+    Load(*cache, std::vector<Indexed<Binary>>{WithIndex(Binary(true), 0)});
+    REQUIRE(cache->GetLastChange() == 1);
+
+    Load(*cache, std::vector<Indexed<Binary>>{WithIndex(Binary(false), 0)});
+    REQUIRE(cache->GetLastChange() == 2);
+}
+
+TEST_CASE(SUITE("change cursor only visits points changed since the last call"))
+{
+    auto cache = PointCache::Create(Config());
+
+    Load(*cache, std::vector<Indexed<Analog>>{WithIndex(Analog(1.0), 0), WithIndex(Analog(2.0), 1)});
+    Load(*cache, std::vector<Indexed<Binary>>{WithIndex(Binary(true), 1)});
+
+    std::vector<CachedPoint> changes;
+    auto collect = [&](const CachedPoint& point) { changes.push_back(point); };
+
+    auto cursor = cache->ForEachChange(0, collect);
+    REQUIRE(cursor == 3);
+    REQUIRE(changes.size() == 3);
+
+    changes.clear();
+    REQUIRE(cache->ForEachChange(cursor, collect) == 3);
+    REQUIRE(changes.empty());
+
+    Load(*cache, std::vector<Indexed<Analog>>{WithIndex(Analog(1.0), 0), WithIndex(Analog(5.0), 1)});
+    REQUIRE(cache->ForEachChange(cursor, collect) == 4);
+    REQUIRE(changes.size() == 1);
+    REQUIRE(changes[0].type == PointCacheType::Analog);
+    REQUIRE(changes[0].index == 1);
+    REQUIRE(changes[0].value == 5.0);
+}
+
+TEST_CASE(SUITE("forwards every callback to the next handler"))
+{
+    auto next = std::make_shared<CountingHandler>();
+    auto cache = PointCache::Create(Config(), next);
+
+    Load(*cache, std::vector<Indexed<Binary>>{WithIndex(Binary(true), 0), WithIndex(Binary(true), 9)});
+    Load(*cache, std::vector<Indexed<Analog>>{WithIndex(Analog(1.0), 0)});
+
+    REQUIRE(next->count == 3);
+}
+
+TEST_CASE(SUITE("columns can be read through the layout"))
+{
+    auto cache = PointCache::Create(Config());
+
+    Load(*cache, std::vector<Indexed<Counter>>{WithIndex(Counter(42), 0)});
+
+    const auto& layout = cache->GetLayout();
+    const auto base = reinterpret_cast<const uint8_t*>(&layout);
+    const auto& table = layout.tables[static_cast<uint8_t>(PointCacheType::Counter)];
+
+    REQUIRE(layout.magic == static_cast<uint32_t>(PointCacheLayout::MAGIC));
+    REQUIRE(layout.writeCount.load() % 2 == 0);
+    REQUIRE(table.count == 1);
+    REQUIRE(table.valueSize == sizeof(uint32_t));
+    REQUIRE(reinterpret_cast<const uint32_t*>(base + table.valuesOffset)[0] == 42);
+    REQUIRE(reinterpret_cast<const uint64_t*>(base + table.changesOffset)[0] == 1);
+}
+
+TEST_CASE(SUITE("columns can be backed by a mapped file"))
+{
+    const auto path = "pointcache.test.map";
+
+    auto config = Config();
+    config.mappedFilePath = path;
+
+    {
+        auto cache = PointCache::Create(config);
+        Load(*cache, std::vector<Indexed<Analog>>{WithIndex(Analog(9.0), 2)});
+
+        const auto file = std::fopen(path, "rb");
+        REQUIRE(file != nullptr);
+        uint32_t magic = 0;
+        REQUIRE(std::fread(&magic, sizeof(magic), 1, file) == 1);
+        std::fclose(file);
+        REQUIRE(magic == static_cast<uint32_t>(PointCacheLayout::MAGIC));
+
+        CachedPoint point;
+        REQUIRE(cache->Get(PointCacheType::Analog, 2, point));
+        REQUIRE(point.value == 9.0);
+    }
+
+    std::remove(path);
+}
+
+TEST_CASE(SUITE("throws if the file cannot be mapped"))
+{
+    auto config = Config();
+    config.mappedFilePath = "no/such/directory/pointcache.map";
+
+    REQUIRE_THROWS_AS(PointCache::Create(config), DNP3Error);
+}
@@ -21,11 +21,14 @@
 #include <catch.hpp>
 #include <outstation/StaticDataMap.h>
 
+#include <vector>
+
 using namespace opendnp3;
 
 struct EventReceiver : public IEventReceiver
 {
     size_t count = 0;
+    size_t batches = 0;
     Event<BinarySpec> latestBinaryEvent;
 
     void Update(const Event<BinarySpec>& evt)
@@ -68,6 +71,15 @@ struct EventReceiver : public IEventReceiver
     {
         ++count;
     }
+
+    void Update(const Event<BinarySpec>* events, size_t num) override
+    {
+        ++batches;
+        for (size_t i = 0; i < num; ++i)
+        {
+            this->Update(events[i]);
+        }
+    }
 };
 
 #define SUITE(name) "StaticDataMap - " name
@@ -392,3 +404,68 @@ TEST_CASE(SUITE("can select disjoint ranges and iterate over them"))
     REQUIRE(items[1].first == 2);
     REQUIRE(items[2].first == 9);
 }
+
+TEST_CASE(SUITE("points added out of order are kept sorted by index"))
+{
+    StaticDataMap<BinarySpec> map;
+    REQUIRE(map.add(Binary(), 5, BinaryConfig()));
+    REQUIRE(map.add(Binary(), 1, BinaryConfig()));
+    REQUIRE(map.add(Binary(), 3, BinaryConfig()));
+
+    REQUIRE(map.select_all() == 3);
+
+    std::vector<uint16_t> indices;
+    for (const auto& elem : map)
+    {
+        indices.push_back(elem.first);
+    }
+    REQUIRE(indices == std::vector<uint16_t>{1, 3, 5});
+}
+
+TEST_CASE(SUITE("modifying the flags of a range delivers the events as one batch"))
+{
+    StaticDataMap<BinarySpec> map{{{0, {}}, {1, {}}, {2, {}}, {3, {}}, {7, {}}}};
+
+    EventReceiver receiver;
+    REQUIRE(map.modify(1, 5, 0x01, receiver));
+    REQUIRE(receiver.batches == 1);
+    REQUIRE(receiver.count == 3);
+    REQUIRE(receiver.latestBinaryEvent.index == 3);
+    REQUIRE(receiver.latestBinaryEvent.value.flags.value == 0x01);
+
+    // points outside the range keep their flags
+    map.select_all();
+    for (const auto& elem : map)
+    {
+        const auto expected = (elem.first >= 1 && elem.first <= 5) ? 0x01 : Binary().flags.value;
+        REQUIRE(elem.second.value.flags.value == expected);
+    }
+
+    // no events when the flags don't change
+    REQUIRE(map.modify(1, 5, 0x01, receiver));
+    REQUIRE(receiver.batches == 1);
+}
+
+TEST_CASE(SUITE("modifying a range without any points returns false"))
+{
+    StaticDataMap<BinarySpec> map{{{0, {}}, {10, {}}}};
+
+    EventReceiver receiver;
+    REQUIRE_FALSE(map.modify(2, 8, 0x01, receiver));
+    REQUIRE_FALSE(map.modify(8, 2, 0x01, receiver));
+    REQUIRE(receiver.count == 0);
+}
+
+TEST_CASE(SUITE("can update sorted values in a single batch"))
+{
+    StaticDataMap<BinarySpec> map{{{0, {}}, {2, {}}, {4, {}}}};
+
+    const std::vector<Indexed<Binary>> values{WithIndex(Binary(true), 0), WithIndex(Binary(true), 1),
+                                              WithIndex(Binary(true), 4), WithIndex(Binary(true), 9)};
+
+    EventReceiver receiver;
+    REQUIRE(map.update(values, EventMode::Detect, receiver) == 2);
+    REQUIRE(receiver.batches == 1);
+    REQUIRE(receiver.count == 2);
+    REQUIRE(receiver.latestBinaryEvent.index == 4);
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/APDUHelpers.h"
+
+#include "dnp3mocks/MockLogHandler.h"
+#include "dnp3mocks/MockSOEHandler.h"
+
+#include <opendnp3/app/AppConstants.h>
+#include <opendnp3/outstation/IDnpTimeSource.h>
+
+#include <app/APDUHeader.h>
+#include <master/MeasurementHandler.h>
+#include <outstation/Database.h>
+#include <outstation/event/EventBuffer.h>
+
+#include <ser4cpp/util/HexConversions.h>
+
+#include <catch.hpp>
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+using namespace opendnp3;
+using namespace ser4cpp;
+
+#define SUITE(name) "StaticPacking - " name
+
+namespace
+{
+class PackingTestObject
+{
+public:
+    PackingTestObject(const DatabaseConfig& config, StaticPacking packing)
+        : buffer(EventBufferConfig::AllTypes(10)),
+          database(config, buffer, timeSource, StaticTypeBitField::AllTypes(), packing)
+    {
+    }
+
+    // objects written by a single Load(..), without the response header
+    std::string Load()
+    {
+        auto response = APDUHelpers::Response();
+        auto writer = response.GetWriter();
+        REQUIRE(database.Load(writer));
+        return HexConversions::to_hex(response.ToRSeq().skip(APDUHeader::RESPONSE_SIZE));
+    }
+
+    IDnpTimeSource timeSource;
+    EventBuffer buffer;
+    Database database;
+};
+
+DatabaseConfig Counters(std::initializer_list<uint16_t> indices)
+{
+    DatabaseConfig config;
+    for (auto index : indices)
+    {
+        config.counter[index] = {};
+    }
+    return config;
+}
+
+DatabaseConfig Binaries(std::initializer_list<uint16_t> indices)
+{
+    DatabaseConfig config;
+    for (auto index : indices)
+    {
+        config.binary_input[index] = {};
+    }
+    return config;
+}
+
+void SetCounters(Database& database, std::initializer_list<uint16_t> indices)
+{
+    for (auto index : indices)
+    {
+        database.Update(Counter(static_cast<uint32_t>(index)), index, EventMode::Suppress);
+    }
+}
+
+void SetBinaries(Database& database, std::initializer_list<uint16_t> indices)
+{
+    for (auto index : indices)
+    {
+        database.Update(Binary(true), index, EventMode::Suppress);
+    }
+}
+} // namespace
+
+TEST_CASE(SUITE("ranges packing writes one header per contiguous run"))
+{
+    PackingTestObject test(Counters({0, 100, 200}), StaticPacking::Ranges);
+    SetCounters(test.database, {0, 100, 200});
+    test.database.SelectAll(GroupVariation::Group20Var1);
+
+    REQUIRE(test.Load()
+            == "14 01 00 00 00 01 00 00 00 00 14 01 00 64 64 01 64 00 00 00 14 01 00 C8 C8 01 C8 00 00 00");
+}
+
+TEST_CASE(SUITE("optimized packing writes sparse points with index prefixes"))
+{
+    PackingTestObject test(Counters({0, 100, 200}), StaticPacking::Optimized);
+    SetCounters(test.database, {0, 100, 200});
+    test.database.SelectAll(GroupVariation::Group20Var1);
+
+    REQUIRE(test.Load() == "14 01 17 03 00 01 00 00 00 00 64 01 64 00 00 00 C8 01 C8 00 00 00");
+}
+
+TEST_CASE(SUITE("optimized packing keeps ranges for contiguous points"))
+{
+    PackingTestObject test(Counters({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 100, 200}), StaticPacking::Optimized);
+    SetCounters(test.database, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 100, 200});
+    test.database.SelectAll(GroupVariation::Group20Var1);
+
+    REQUIRE(test.Load()
+            == "14 01 00 00 09 01 00 00 00 00 01 01 00 00 00 01 02 00 00 00 01 03 00 00 00 01 04 00 00 00 "
+               "01 05 00 00 00 01 06 00 00 00 01 07 00 00 00 01 08 00 00 00 01 09 00 00 00 "
+               "14 01 17 02 64 01 64 00 00 00 C8 01 C8 00 00 00");
+}
+
+TEST_CASE(SUITE("optimized packing uses 2-byte prefixes above index 255"))
+{
+    PackingTestObject test(Counters({256, 1000}), StaticPacking::Optimized);
+    SetCounters(test.database, {256, 1000});
+    test.database.SelectAll(GroupVariation::Group20Var1);
+
+    REQUIRE(test.Load() == "14 01 28 02 00 00 01 01 00 01 00 00 E8 03 01 E8 03 00 00");
+}
+
+TEST_CASE(SUITE("padding bridges gaps that don't exist in the database"))
+{
+    PackingTestObject test(Binaries({0, 1, 3}), StaticPacking::OptimizedWithPadding);
+    SetBinaries(test.database, {0, 1, 3});
+    test.database.SelectAll(GroupVariation::Group1Var2);
+
+    // index 2 is reported as a padding point with the RESTART flag
+    REQUIRE(test.Load() == "01 02 00 00 03 81 81 02 81");
+}
+
+TEST_CASE(SUITE("padding never covers points that exist but are not selected"))
+{
+    PackingTestObject test(Binaries({0, 1, 2, 3}), StaticPacking::OptimizedWithPadding);
+    SetBinaries(test.database, {0, 1, 2, 3});
+    test.database.SelectRange(GroupVariation::Group1Var2, Range::From(0, 1));
+    test.database.SelectRange(GroupVariation::Group1Var2, Range::From(3, 3));
+
+    // index 2 can't be used as padding, so the prefixed header is cheapest
+    REQUIRE(test.Load() == "01 02 17 03 00 81 01 81 03 81");
+}
+
+TEST_CASE(SUITE("padding bridges gaps in packed bitfields"))
+{
+    PackingTestObject test(Binaries({0, 1, 2, 3, 4, 5, 6, 7, 10, 11, 12, 13, 14, 15, 16, 17}),
+                           StaticPacking::OptimizedWithPadding);
+    SetBinaries(test.database, {0, 1, 2, 3, 4, 5, 6, 7, 10, 11, 12, 13, 14, 15, 16, 17});
+    test.database.SelectAll(GroupVariation::Group1Var1);
+
+    REQUIRE(test.Load() == "01 01 00 00 11 FF FC 03");
+}
+
+TEST_CASE(SUITE("optimized packing round trips through the master across fragments"))
+{
+    DatabaseConfig config;
+    for (uint16_t i = 0; i < 300; ++i)
+    {
+        config.analog_input[i * 7] = {};
+    }
+
+    PackingTestObject test(config, StaticPacking::Optimized);
+    for (uint16_t i = 0; i < 300; ++i)
+    {
+        test.database.Update(Analog(i * 2.0), i * 7, EventMode::Suppress);
+    }
+    test.database.SelectAll(GroupVariation::Group30Var1);
+
+    MockSOEHandler soe;
+    MockLogHandler log;
+    size_t num_fragments = 0;
+    while (test.database.HasAnySelection())
+    {
+        auto response = APDUHelpers::Response(249);
+        auto writer = response.GetWriter();
+        test.database.Load(writer);
+        ++num_fragments;
+
+        const auto objects = response.ToRSeq().skip(APDUHeader::RESPONSE_SIZE);
+        REQUIRE(MeasurementHandler::ProcessMeasurements(ResponseInfo(false, true, true), objects, log.logger, &soe)
+                == ParseResult::OK);
+    }
+
+    REQUIRE(num_fragments > 1);
+    REQUIRE(soe.analogSOE.size() == 300);
+    for (uint16_t i = 0; i < 300; ++i)
+    {
+        const auto record = soe.analogSOE.find(i * 7);
+        REQUIRE(record != soe.analogSOE.end());
+        REQUIRE(record->second.meas.value == i * 2.0);
+    }
+}
@@ -169,6 +169,50 @@ TEST_CASE(SUITE("ReceiveNewFir"))
     REQUIRE(test.transport.GetStatistics().rx.numTransportDiscard == 1);
 }
 
+TEST_CASE(SUITE("ReceiveInPlace"))
+{
+    TransportTestObject test(true);
+
+    REQUIRE(test.link.SendUpInPlace("40 0A 0B 0C")); // FIR/_/0
+    REQUIRE(test.link.SendUpInPlace("01 0D 0E")); // _/_/1
+    REQUIRE(test.link.SendUpInPlace("82 0F")); // _/FIN/2
+    REQUIRE(test.upper.received.AsHex() == "0A 0B 0C 0D 0E 0F");
+}
+
+TEST_CASE(SUITE("ReceiveInPlaceRestoresFragmentAfterUndeliveredSegment"))
+{
+    TransportTestObject test(true);
+
+    REQUIRE(test.link.SendUpInPlace("40 0A 0B 0C")); // FIR/_/0
+
+    // staged over the last byte, but never delivered, e.g. a frame rejected by the link layer
+    auto dest = test.transport.GetReceiveBuffer(2);
+    REQUIRE(dest.length() == 2);
+    dest.set_all_to(0xFF);
+
+    REQUIRE(test.link.SendUp("81 0D")); // _/FIN/1, not staged
+    REQUIRE(test.upper.received.AsHex() == "0A 0B 0C 0D");
+}
+
+TEST_CASE(SUITE("ReceiveInPlaceNewFir"))
+{
+    TransportTestObject test(true);
+
+    REQUIRE(test.link.SendUpInPlace("40 0A 0B")); // FIR/_/0
+    REQUIRE(test.link.SendUpInPlace("C0 AB CD")); // FIR/FIN/0
+    REQUIRE(test.upper.received.AsHex() == "AB CD");
+    REQUIRE(test.transport.GetStatistics().rx.numTransportDiscard == 1);
+}
+
+TEST_CASE(SUITE("NoReceiveBufferOnOverflow"))
+{
+    TransportTestObject test(true, 4); // maximum ASDU size of 4
+
+    REQUIRE(test.link.SendUpInPlace("40 11 22 33")); // FIR/_/0
+    REQUIRE(test.transport.GetReceiveBuffer(2).length() == 2);
+    REQUIRE(test.transport.GetReceiveBuffer(3).is_empty());
+}
+
 TEST_CASE(SUITE("StateSending"))
 {
     TransportTestObject test(true);
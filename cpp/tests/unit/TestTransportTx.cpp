@@ -0,0 +1,125 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <link/CRC.h>
+#include <link/LinkFrame.h>
+#include <link/LinkLayerConstants.h>
+#include <transport/TransportTx.h>
+
+#include <catch.hpp>
+
+#include <cstring>
+#include <vector>
+
+using namespace opendnp3;
+using namespace ser4cpp;
+
+#define SUITE(name) "TransportTx - " name
+
+namespace
+{
+std::vector<uint8_t> MakeFragment(size_t length)
+{
+    std::vector<uint8_t> fragment(length);
+    for (size_t i = 0; i < length; ++i)
+    {
+        fragment[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    return fragment;
+}
+
+// encode the fragment a tpdu at a time, the way the link layer does for segments without EncodeFrames
+std::vector<uint8_t> EncodePerSegment(const std::vector<uint8_t>& fragment)
+{
+    TransportTx tx(Logger::empty());
+    tx.Configure(Message(Addresses(1, 1024), rseq_t(fragment.data(), fragment.size())));
+
+    std::vector<uint8_t> output;
+    uint8_t frame[LPDU_MAX_FRAME_SIZE];
+    while (tx.HasValue())
+    {
+        wseq_t dest(frame, sizeof(frame));
+        const auto written = LinkFrame::FormatUnconfirmedUserData(dest, true, 1024, 1, tx.GetSegment(), nullptr);
+        output.insert(output.end(), static_cast<const uint8_t*>(written), static_cast<const uint8_t*>(written) + written.length());
+        tx.Advance();
+    }
+    return output;
+}
+
+void TestEquivalence(size_t length)
+{
+    const auto fragment = MakeFragment(length);
+    const auto expected = EncodePerSegment(fragment);
+
+    TransportTx tx(Logger::empty());
+    tx.Configure(Message(Addresses(1, 1024), rseq_t(fragment.data(), fragment.size())));
+    REQUIRE(tx.GetFramesSize() == expected.size());
+
+    std::vector<uint8_t> buffer(tx.GetFramesSize());
+    wseq_t dest(buffer.data(), buffer.size());
+    const auto written = tx.EncodeFrames(dest, true, nullptr);
+
+    REQUIRE(written.length() == expected.size());
+    REQUIRE(std::memcmp(written, expected.data(), expected.size()) == 0);
+    REQUIRE(dest.is_empty());
+    REQUIRE(tx.GetNumEncodedFrames() == (length + 248) / 249);
+
+    // encoding doesn't consume, the transmit completion does
+    REQUIRE(tx.HasValue());
+    REQUIRE_FALSE(tx.Advance());
+    REQUIRE_FALSE(tx.HasValue());
+    REQUIRE(tx.Statistics().numTransportTx == (length + 248) / 249);
+}
+} // namespace
+
+TEST_CASE(SUITE("CopyWithCrc matches AddCrc"))
+{
+    uint8_t block[18] = {0xC0};
+    const auto data = MakeFragment(15);
+    CRC::CopyWithCrc(block, 1, data.data(), data.size());
+
+    uint8_t expected[18] = {0xC0};
+    std::memcpy(expected + 1, data.data(), data.size());
+    CRC::AddCrc(expected, 16);
+
+    REQUIRE(std::memcmp(block, expected, sizeof(block)) == 0);
+}
+
+TEST_CASE(SUITE("Single byte fragment encodes like the per-segment path"))
+{
+    TestEquivalence(1);
+}
+
+TEST_CASE(SUITE("Fragment filling exactly one tpdu encodes like the per-segment path"))
+{
+    TestEquivalence(249);
+}
+
+TEST_CASE(SUITE("Fragment spilling into a second tpdu encodes like the per-segment path"))
+{
+    TestEquivalence(250);
+}
+
+TEST_CASE(SUITE("Multi-tpdu fragments encode like the per-segment path"))
+{
+    for (size_t length : {15, 16, 31, 498, 600, 2048})
+    {
+        TestEquivalence(length);
+    }
+}
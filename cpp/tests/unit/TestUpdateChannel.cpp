@@ -0,0 +1,340 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "outstation/UpdateChannel.h"
+
+#include <opendnp3/app/Indexed.h>
+
+#include <catch.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "UpdateChannelTestSuite - " name
+
+namespace
+{
+class RecordingHandler final : public IUpdateHandler
+{
+public:
+    bool Update(const Binary& meas, uint16_t index, EventMode) override
+    {
+        binaries.push_back(WithIndex(meas, index));
+        return true;
+    }
+    bool Update(const DoubleBitBinary&, uint16_t, EventMode) override
+    {
+        return true;
+    }
+    bool Update(const Analog& meas, uint16_t index, EventMode) override
+    {
+        analogs.push_back(WithIndex(meas, index));
+        return true;
+    }
+    bool Update(const Counter&, uint16_t, EventMode) override
+    {
+        return true;
+    }
+    bool FreezeCounter(uint16_t index, bool clear, EventMode) override
+    {
+        frozen.push_back(index);
+        lastClear = clear;
+        return true;
+    }
+    bool Update(const BinaryOutputStatus&, uint16_t, EventMode) override
+    {
+        return true;
+    }
+    bool Update(const AnalogOutputStatus&, uint16_t, EventMode) override
+    {
+        return true;
+    }
+    bool Update(const OctetString&, uint16_t, EventMode) override
+    {
+        return true;
+    }
+    bool Update(const TimeAndInterval&, uint16_t) override
+    {
+        return true;
+    }
+    bool Modify(FlagsType type, uint16_t start, uint16_t stop, uint8_t flags) override
+    {
+        modifiedType = type;
+        modifiedRange = stop - start + 1;
+        modifiedFlags = flags;
+        return true;
+    }
+    bool Modify(uint16_t, DoubleBitBinary, EventMode) override
+    {
+        return true;
+    }
+
+    std::vector<Indexed<Binary>> binaries;
+    std::vector<Indexed<Analog>> analogs;
+    std::vector<uint16_t> frozen;
+    bool lastClear = false;
+    FlagsType modifiedType = FlagsType::BinaryInput;
+    int modifiedRange = 0;
+    uint8_t modifiedFlags = 0;
+};
+} // namespace
+
+TEST_CASE(SUITE("applies updates in the order they were written"))
+{
+    int notifications = 0;
+    UpdateChannel channel(8, [&]() { ++notifications; });
+
+    REQUIRE(channel.Update(Analog(1.5, Flags(0x01), DNPTime(100)), 3));
+    REQUIRE(channel.Update(Binary(true), 1));
+    REQUIRE(channel.Update(Analog(2.5), 4));
+    REQUIRE(channel.FreezeCounter(7, true));
+    REQUIRE(channel.Modify(FlagsType::Counter, 2, 5, 0x02));
+
+    REQUIRE(notifications == 1);
+
+    RecordingHandler handler;
+    REQUIRE(channel.Drain(handler) == 5);
+
+    REQUIRE(handler.analogs.size() == 2);
+    REQUIRE(handler.analogs[0].index == 3);
+    REQUIRE(handler.analogs[0].value.value == 1.5);
+    REQUIRE(handler.analogs[0].value.flags.value == 0x01);
+    REQUIRE(handler.analogs[0].value.time.value == 100);
+    REQUIRE(handler.analogs[1].index == 4);
+    REQUIRE(handler.binaries.size() == 1);
+    REQUIRE(handler.binaries[0].value.value);
+    REQUIRE(handler.frozen == std::vector<uint16_t>{7});
+    REQUIRE(handler.lastClear);
+    REQUIRE(handler.modifiedType == FlagsType::Counter);
+    REQUIRE(handler.modifiedRange == 4);
+    REQUIRE(handler.modifiedFlags == 0x02);
+
+    REQUIRE(channel.Drain(handler) == 0);
+}
+
+TEST_CASE(SUITE("notifies again once the backlog is drained"))
+{
+    int notifications = 0;
+    UpdateChannel channel(8, [&]() { ++notifications; });
+    RecordingHandler handler;
+
+    channel.Update(Binary(true), 0);
+    channel.Update(Binary(false), 0);
+    REQUIRE(notifications == 1);
+
+    channel.Drain(handler);
+    channel.Update(Binary(true), 0);
+    REQUIRE(notifications == 2);
+}
+
+TEST_CASE(SUITE("rejects updates when the ring is full"))
+{
+    UpdateChannel channel(4, []() {});
+
+    for (uint16_t i = 0; i < 4; ++i)
+    {
+        REQUIRE(channel.Update(Analog(i), i));
+    }
+    REQUIRE_FALSE(channel.Update(Analog(4), 4));
+
+    RecordingHandler handler;
+    REQUIRE(channel.Drain(handler) == 4);
+    REQUIRE(channel.Update(Analog(4), 4));
+}
+
+TEST_CASE(SUITE("rejects octet strings"))
+{
+    UpdateChannel channel(4, []() {});
+    REQUIRE_FALSE(channel.Update(OctetString(), 0));
+}
+
+TEST_CASE(SUITE("delivers every update from concurrent producers"))
+{
+    const uint16_t NUM_PRODUCERS = 4;
+    const uint16_t NUM_UPDATES = 1000;
+
+    UpdateChannel channel(NUM_PRODUCERS * NUM_UPDATES, []() {});
+
+    std::vector<std::thread> producers;
+    for (uint16_t p = 0; p < NUM_PRODUCERS; ++p)
+    {
+        producers.emplace_back([&channel, p]() {
+            for (uint16_t i = 0; i < NUM_UPDATES; ++i)
+            {
+                channel.Update(Analog(i), p);
+            }
+        });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    RecordingHandler handler;
+    REQUIRE(channel.Drain(handler) == NUM_PRODUCERS * NUM_UPDATES);
+
+    // updates from each producer keep their relative order
+    std::vector<double> last(NUM_PRODUCERS, -1);
+    for (const auto& update : handler.analogs)
+    {
+        REQUIRE(update.value.value > last[update.index]);
+        last[update.index] = update.value.value;
+    }
+}
+
+TEST_CASE(SUITE("writes a batch as one run in order"))
+{
+    UpdateChannel channel(8, []() {});
+
+    REQUIRE(channel.Update(Analog(0), 0));
+    REQUIRE(channel.UpdateBatch(3, [](IUpdateHandler& handler) {
+        for (uint16_t i = 1; i <= 3; ++i)
+        {
+            handler.Update(Analog(i), i);
+        }
+    }));
+    REQUIRE(channel.Update(Analog(4), 4));
+
+    RecordingHandler handler;
+    REQUIRE(channel.Drain(handler) == 5);
+    REQUIRE(handler.analogs.size() == 5);
+    for (uint16_t i = 0; i < 5; ++i)
+    {
+        REQUIRE(handler.analogs[i].index == i);
+    }
+}
+
+TEST_CASE(SUITE("rejects a batch that doesn't fit without writing any of it"))
+{
+    UpdateChannel channel(4, []() {});
+
+    REQUIRE(channel.Update(Analog(0), 0));
+    REQUIRE(channel.Update(Analog(1), 1));
+
+    bool invoked = false;
+    REQUIRE_FALSE(channel.UpdateBatch(3, [&](IUpdateHandler&) { invoked = true; }));
+    REQUIRE_FALSE(invoked);
+
+    RecordingHandler handler;
+    REQUIRE(channel.Drain(handler) == 2);
+    REQUIRE(handler.analogs.size() == 2);
+
+    REQUIRE(channel.UpdateBatch(3, [&](IUpdateHandler&) { invoked = true; }));
+    REQUIRE(invoked);
+}
+
+TEST_CASE(SUITE("releases the unused part of a batch and rejects writes past it"))
+{
+    UpdateChannel channel(4, []() {});
+
+    REQUIRE(channel.UpdateBatch(3, [](IUpdateHandler& handler) {
+        REQUIRE(handler.Update(Binary(true), 0));
+        REQUIRE_FALSE(handler.Update(OctetString(), 1));
+    }));
+    REQUIRE(channel.UpdateBatch(1, [](IUpdateHandler& handler) {
+        REQUIRE(handler.Update(Binary(false), 2));
+        REQUIRE_FALSE(handler.Update(Binary(false), 3));
+    }));
+
+    RecordingHandler handler;
+    REQUIRE(channel.Drain(handler) == 4);
+    REQUIRE(handler.binaries.size() == 2);
+    REQUIRE(handler.binaries[0].index == 0);
+    REQUIRE(handler.binaries[1].index == 2);
+
+    REQUIRE(channel.Update(Binary(true), 4));
+    REQUIRE(channel.Drain(handler) == 1);
+}
+
+TEST_CASE(SUITE("keeps later writes behind a batch that overflowed"))
+{
+    UpdateChannel channel(4, []() {});
+    RecordingHandler handler;
+
+    REQUIRE(channel.Update(Analog(0), 0));
+
+    // what the outstation does with a batch that doesn't fit: block, then drain and apply it on the strand
+    REQUIRE_FALSE(channel.UpdateBatch(4, [](IUpdateHandler&) {}));
+    channel.Block();
+
+    REQUIRE_FALSE(channel.Update(Analog(5), 5));
+    REQUIRE_FALSE(channel.UpdateBatch(1, [](IUpdateHandler&) {}));
+
+    REQUIRE(channel.Drain(handler) == 1);
+    for (uint16_t i = 1; i <= 4; ++i)
+    {
+        handler.Update(Analog(i), i, EventMode::Detect);
+    }
+    channel.Unblock();
+
+    REQUIRE(channel.Update(Analog(5), 5));
+    REQUIRE(channel.Drain(handler) == 1);
+
+    REQUIRE(handler.analogs.size() == 6);
+    for (uint16_t i = 0; i < 6; ++i)
+    {
+        REQUIRE(handler.analogs[i].index == i);
+    }
+}
+
+TEST_CASE(SUITE("batches from concurrent producers are not interleaved"))
+{
+    const uint16_t NUM_PRODUCERS = 4;
+    const uint16_t NUM_BATCHES = 100;
+    const uint16_t BATCH_SIZE = 5;
+
+    UpdateChannel channel(NUM_PRODUCERS * NUM_BATCHES * BATCH_SIZE, []() {});
+
+    std::vector<std::thread> producers;
+    for (uint16_t p = 0; p < NUM_PRODUCERS; ++p)
+    {
+        producers.emplace_back([&channel, p]() {
+            for (uint16_t b = 0; b < NUM_BATCHES; ++b)
+            {
+                channel.UpdateBatch(BATCH_SIZE, [p, b](IUpdateHandler& handler) {
+                    for (uint16_t i = 0; i < BATCH_SIZE; ++i)
+                    {
+                        handler.Update(Analog(b * BATCH_SIZE + i), p);
+                    }
+                });
+            }
+        });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    RecordingHandler handler;
+    REQUIRE(channel.Drain(handler) == NUM_PRODUCERS * NUM_BATCHES * BATCH_SIZE);
+
+    for (size_t i = 0; i < handler.analogs.size(); i += BATCH_SIZE)
+    {
+        const auto& first = handler.analogs[i];
+        for (uint16_t j = 1; j < BATCH_SIZE; ++j)
+        {
+            REQUIRE(handler.analogs[i + j].index == first.index);
+            REQUIRE(handler.analogs[i + j].value.value == first.value.value + j);
+        }
+    }
+}
@@ -71,7 +71,7 @@ uint32_t LinkLayerTest::NumTotalWrites()
     return numTotalWrites;
 }
 
-void LinkLayerTest::BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& /*context*/)
+void LinkLayerTest::BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& /*context*/, uint32_t /*numFrames*/)
 {
     ++numTotalWrites;
     this->writeQueue.push_back(HexConversions::to_hex(buffer));
@@ -49,7 +49,7 @@ public:
                  const ser4cpp::rseq_t& userdata = ser4cpp::rseq_t::empty());
 
     // ILinkTx interface
-    void BeginTransmit(const ser4cpp::rseq_t& buffer, opendnp3::ILinkSession& context) final;
+    void BeginTransmit(const ser4cpp::rseq_t& buffer, opendnp3::ILinkSession& context, uint32_t numFrames) final;
 
     static opendnp3::LinkLayerConfig DefaultConfig();
 
@@ -0,0 +1,22 @@
+include(FetchContent)
+
+# prefer an installed copy of Google Benchmark and fall back to fetching a pinned release
+find_package(benchmark QUIET)
+
+if(NOT benchmark_FOUND)
+    FetchContent_Declare(
+        benchmark
+        URL      https://github.com/google/benchmark/archive/v1.5.2.tar.gz
+        URL_HASH SHA256=DCCBDAB796BAA1043F04982147E67BB6E118FE610DA2C65F88912D73987E700C
+    )
+
+    FetchContent_GetProperties(benchmark)
+    if(NOT benchmark_POPULATED)
+        FetchContent_Populate(benchmark)
+
+        set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+        set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+        set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+        add_subdirectory(${benchmark_SOURCE_DIR} ${benchmark_BINARY_DIR} EXCLUDE_FROM_ALL)
+    endif()
+endif()
@@ -23,7 +23,7 @@ import java.nio.file.FileSystems
 
 import com.automatak.render.dnp3.enums.generators.{CSharpEnumGenerator, CppEnumGenerator, JavaEnumGenerator}
 import com.automatak.render.dnp3.enums.groups.{CSharpEnumGroup, DNPCppEnumGroup}
-import com.automatak.render.dnp3.objects.generators.{AttributeGenerator, GroupVariationFileGenerator}
+import com.automatak.render.dnp3.objects.generators.{AttributeGenerator, GroupVariationFileGenerator, GroupVariationTableGenerator}
 
 object Generate {
 
@@ -41,6 +41,9 @@ object Generate {
     // generate the C++ variation attribute lookups
     AttributeGenerator.writeAttributes("opendnp3", dnp3GenHeaderPath, dnp3GenImplPath)
 
+    // generate the flat group/variation lookup tables used to dispatch object headers
+    GroupVariationTableGenerator("opendnp3", dnp3GenImplPath)
+
     // generate the C# enums
     CSharpEnumGenerator(CSharpEnumGroup.enums, "Step Function I/O.DNP3.Interface", csharpGenPath)
 
@@ -66,13 +66,15 @@ trait Conversion extends FixedSize {
     Iterator(
       "static bool ReadTarget(ser4cpp::rseq_t&, %s&);".format(target),
       "static bool WriteTarget(const %s&, ser4cpp::wseq_t&);".format(target),
+      "static bool ReadArray(ser4cpp::rseq_t&, %s*, size_t);".format(target),
+      "static bool WriteArray(const %s*, size_t, ser4cpp::wseq_t&);".format(target),
       serializerInstance
     )
   }
 
   def serializerInstance : String  = {
       val serializerType = "DNP3Serializer<%s>".format(target)
-      "static %s Inst() { return %s(ID(), Size(), &ReadTarget, &WriteTarget); }".format(serializerType, serializerType)
+      "static %s Inst() { return %s(ID(), Size(), &ReadTarget, &WriteTarget, &ReadArray, &WriteArray); }".format(serializerType, serializerType)
   }
 
 
@@ -100,7 +102,46 @@ trait Conversion extends FixedSize {
       }
     }
 
-    readFunc ++ space ++ writeFunc
+    // byte offset of each field within a single object
+    def offsets : List[(FixedSizeField, Int)] = fs.fields.zip(fs.fields.scanLeft(0)((sum, f) => sum + f.typ.numBytes))
+
+    def pointer(offset: Int) : String = if(offset == 0) "data" else "data + %d".format(offset)
+
+    // batch conversions check the length once and then run without bounds checks so the loops can be vectorised
+    def readArrayFunc = {
+      val args = offsets.map { case (f, offset) => FixedSizeHelpers.pointerRead(f, pointer(offset)) }.mkString(", ")
+      Iterator("bool %s::ReadArray(rseq_t& buff, %s* output, size_t count)".format(fs.name, target)) ++ bracket {
+        Iterator("const auto size = count * Size();") ++
+        Iterator("if(buff.length() < size)") ++ bracket {
+          Iterator("return false;")
+        } ++ space ++
+        Iterator("const uint8_t* data = buff;") ++
+        Iterator("for(size_t i = 0; i < count; ++i, data += %d)".format(fs.size)) ++ bracket {
+          Iterator("output[i] = %sFactory::From(%s);".format(target, args))
+        } ++ space ++
+        Iterator("buff.advance(size);") ++
+        Iterator("return true;")
+      }
+    }
+
+    def writeArrayFunc = {
+      val writes = offsets.map { case (f, offset) => FixedSizeHelpers.pointerWrite(f, pointer(offset), "gv.") }
+      Iterator("bool %s::WriteArray(const %s* values, size_t count, ser4cpp::wseq_t& buff)".format(fs.name, target)) ++ bracket {
+        Iterator("const auto size = count * Size();") ++
+        Iterator("if(buff.length() < size)") ++ bracket {
+          Iterator("return false;")
+        } ++ space ++
+        Iterator("uint8_t* data = buff;") ++
+        Iterator("for(size_t i = 0; i < count; ++i, data += %d)".format(fs.size)) ++ bracket {
+          Iterator("const auto gv = Convert%s::Apply(values[i]);".format(fs.name)) ++
+          writes.iterator
+        } ++ space ++
+        Iterator("buff.advance(size);") ++
+        Iterator("return true;")
+      }
+    }
+
+    readFunc ++ space ++ writeFunc ++ space ++ readArrayFunc ++ space ++ writeArrayFunc
   }
 
 }
@@ -38,6 +38,20 @@ object FixedSizeHelpers {
     case EnumFieldType(model: EnumModel) => model.name
   }
 
+  // expression that reads a field directly from a pointer without bounds checking
+  def pointerRead(f: FixedSizeField, pointer: String): String = f.typ match {
+    case UInt48Field => "DNPTime(UInt48::read(%s).Get())".format(pointer)
+    case EnumFieldType(model: EnumModel) => "%sSpec::from_type(UInt8::read(%s))".format(model.name, pointer)
+    case x => "%s::read(%s)".format(getCppFieldTypeParser(x), pointer)
+  }
+
+  // statement that writes a field directly to a pointer without bounds checking
+  def pointerWrite(f: FixedSizeField, pointer: String, inputLocation: String): String = f.typ match {
+    case UInt48Field => "UInt48::write(%s, UInt48Type(%s%s.value));".format(pointer, inputLocation, f.name)
+    case EnumFieldType(model: EnumModel) => "UInt8::write(%s, %sSpec::to_type(%s%s));".format(pointer, model.name, inputLocation, f.name)
+    case x => "%s::write(%s, %s%s);".format(getCppFieldTypeParser(x), pointer, inputLocation, f.name)
+  }
+
   // Any special headers required for fixed-size fields
   def fieldHeaders(fields: List[FixedSizeField]): List[String] = fields.map { f =>
      f.typ match {
@@ -0,0 +1,188 @@
+/**
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package com.automatak.render.dnp3.objects.generators
+
+import java.nio.file.Path
+
+import com.automatak.render._
+import com.automatak.render.cpp._
+import com.automatak.render.LicenseHeader
+import com.automatak.render.cpp.CppIndentation
+import com.automatak.render.dnp3.objects.{FixedSize, GroupVariation, ObjectGroup, SizedByVariation}
+
+/**
+ * Emits flat lookup tables that resolve a group/variation pair to its enumeration, type and fixed size.
+ *
+ * The tables are a two-level perfect hash: the group indexes a 256 entry table that holds an offset
+ * into a dense variation table, so a header is resolved with two loads and no branches on the group.
+ */
+object GroupVariationTableGenerator {
+  implicit val indent = CppIndentation()
+
+  private val name = "GroupVariationTable"
+
+  private val staticGroups = Set(1, 3, 10, 20, 21, 30, 40, 110, 121)
+  private val eventGroups = Set(2, 4, 11, 13, 22, 23, 32, 41, 42, 43, 60, 111, 122)
+
+  private def groupType(group: Int): String = {
+    if(staticGroups.contains(group)) "STATIC"
+    else if(eventGroups.contains(group)) "EVENT"
+    else "OTHER"
+  }
+
+  private def variationType(group: Int, variation: Int): String = (group, variation) match {
+    case (50, 4) => "STATIC"
+    case (60, 1) => "STATIC"
+    case _ => groupType(group)
+  }
+
+  // groups whose "any variation" object is used for every variation that isn't explicitly defined
+  private def fallback(og: ObjectGroup): String = og.objects.find(gv => gv.variation == 0 && gv.isInstanceOf[SizedByVariation]) match {
+    case Some(gv) => gv.name
+    case None => "UNKNOWN"
+  }
+
+  private def size(gv: GroupVariation): Int = gv match {
+    case fs: FixedSize => fs.size
+    case _ => 0
+  }
+
+  private case class GroupRow(offset: Int, count: Int, typ: String, fallback: String)
+  private case class VariationRow(enumeration: String, typ: String, size: Int, comment: String)
+
+  private def groupsByNumber : Map[Int, ObjectGroup] = ObjectGroup.all.map(og => (og.group.toInt, og)).toMap
+
+  private def variationRows(og: ObjectGroup) : List[VariationRow] = {
+    val group = og.group.toInt
+    val max = og.objects.map(_.variation.toInt).max
+    val byVariation = og.objects.map(gv => (gv.variation.toInt, gv)).toMap
+    (0 to max).toList.map { v =>
+      byVariation.get(v) match {
+        case Some(gv) => VariationRow(gv.name, variationType(group, v), size(gv), "g%dv%d".format(group, v))
+        case None => VariationRow(fallback(og), variationType(group, v), 0, "g%dv%d - undefined".format(group, v))
+      }
+    }
+  }
+
+  private def tables : (List[GroupRow], List[VariationRow]) = {
+    val groups = groupsByNumber
+    val (rows, variations) = (0 to 255).foldLeft((List.empty[GroupRow], List.empty[VariationRow])) { case ((gr, vr), g) =>
+      groups.get(g) match {
+        case Some(og) =>
+          val rows = variationRows(og)
+          (GroupRow(vr.length, rows.length, groupType(g), fallback(og)) :: gr, vr ++ rows)
+        case None =>
+          (GroupRow(0, 0, groupType(g), "UNKNOWN") :: gr, vr)
+      }
+    }
+    (rows.reverse, variations)
+  }
+
+  def apply(cppNamespace: String, impl: Path): Unit = {
+
+    val headerPath = impl.resolve(String.format("%s.h", name))
+    val implPath = impl.resolve(String.format("%s.cpp", name))
+
+    val (groups, variations) = tables
+
+    def license = commented(LicenseHeader())
+
+    def writeHeader() : Unit = {
+
+      def includes : Iterator[String] = Iterator(
+        include(quoted("opendnp3/gen/GroupVariation.h")),
+        "",
+        include("<cstdint>")
+      )
+
+      def declarations : Iterator[String] = {
+        Iterator("enum class GroupVariationType : int") ++ bracketSemiColon {
+          commaDelimited(Iterator("STATIC", "EVENT", "OTHER"))
+        } ++ space ++
+        struct("GroupVariationInfo") {
+          Iterator(
+            "GroupVariation enumeration;",
+            "GroupVariationType type;",
+            "// number of bytes per object for fixed size types, 0 otherwise",
+            "uint8_t size;"
+          )
+        } ++ space ++
+        struct("GroupInfo") {
+          Iterator(
+            "// offset of variation 0 in the variation table",
+            "uint16_t offset;",
+            "// number of consecutive variations starting at 0 in the variation table",
+            "uint8_t count;",
+            "// type and enumeration of variations beyond count",
+            "GroupVariationType type;",
+            "GroupVariation fallback;"
+          )
+        } ++ space ++
+        struct(name) {
+          Iterator(
+            "static GroupVariationInfo Lookup(uint8_t group, uint8_t variation)",
+            "{",
+            "  const auto& g = groups[group];",
+            "  return (variation < g.count) ? variations[g.offset + variation] : GroupVariationInfo{g.fallback, g.type, 0};",
+            "}",
+            "",
+            "static const GroupInfo groups[256];",
+            "static const GroupVariationInfo variations[%d];".format(variations.length)
+          )
+        }
+      }
+
+      def lines = license ++ space ++ includeGuards(name)(includes ++ space ++ namespace(cppNamespace)(declarations))
+
+      writeTo(headerPath)(lines)
+      println("Wrote: " + headerPath)
+    }
+
+    def writeImpl(): Unit = {
+
+      def rows(entries: List[(String, String)]) : Iterator[String] = entries.zipWithIndex.iterator.map { case ((entry, comment), i) =>
+        val delim = if(i == entries.length - 1) "" else ","
+        "%s%s // %s".format(entry, delim, comment)
+      }
+
+      def groupLines : Iterator[String] = rows(groups.zipWithIndex.map { case (g, i) =>
+        ("{%d, %d, GroupVariationType::%s, GroupVariation::%s}".format(g.offset, g.count, g.typ, g.fallback), "g%d".format(i))
+      })
+
+      def variationLines : Iterator[String] = rows(variations.map { v =>
+        ("{GroupVariation::%s, GroupVariationType::%s, %d}".format(v.enumeration, v.typ, v.size), v.comment)
+      })
+
+      def tableLines : Iterator[String] = {
+        Iterator("const GroupInfo %s::groups[256] =".format(name)) ++ bracketSemiColon(groupLines) ++ space ++
+        Iterator("const GroupVariationInfo %s::variations[%d] =".format(name, variations.length)) ++ bracketSemiColon(variationLines)
+      }
+
+      def lines = license ++ space ++ Iterator(include(quoted("gen/GroupVariationTable.h"))) ++ space ++ namespace(cppNamespace)(tableLines)
+
+      writeTo(implPath)(lines)
+      println("Wrote: " + implPath)
+    }
+
+    writeHeader()
+    writeImpl()
+  }
+
+}
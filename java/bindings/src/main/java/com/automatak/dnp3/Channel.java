@@ -54,6 +54,18 @@ public interface Channel {
      */
     Master addMaster(String loggerId, SOEHandler handler, MasterApplication application, MasterStackConfig config) throws DNP3Exception;
 
+    /**
+     * Adds a master to the channel that delivers measurements as packed records in a reusable direct buffer
+     *
+     * @param loggerId name of the logger that will be assigned to this stack
+     * @param handler where measurements will be sent as they are received from the outstation
+     * @param application  master application instance
+     * @param config configuration information for the master stack
+     * @return reference to the created master
+     * @throws DNP3Exception if any error occurs while creating the master
+     */
+    Master addMaster(String loggerId, PackedSOEHandler handler, MasterApplication application, MasterStackConfig config) throws DNP3Exception;
+
     /**
      * Adds an outstation to the channel
      *
@@ -19,6 +19,9 @@
  */
 package com.automatak.dnp3;
 
+import com.automatak.dnp3.enums.DoubleBit;
+import com.automatak.dnp3.enums.EventMode;
+
 /**
  * Interface representing an outstation
  */
@@ -30,4 +33,138 @@ public interface Outstation extends Stack {
      */
     void apply(ChangeSet changes);
 
+    /**
+     * Update a batch of binary inputs in a single native call without allocating per point
+     *
+     * The default implementation applies the batch as a ChangeSet.
+     *
+     * Timestamps are treated as synchronized, like DNPTime(long).
+     *
+     * @param indices point indices
+     * @param values point values
+     * @param flags quality flags of each point
+     * @param timestamps milliseconds since epoch of each point
+     * @param count number of points to read from the arrays
+     * @param mode how events are generated for the batch
+     */
+    default void updateBinaries(int[] indices, boolean[] values, byte[] flags, long[] timestamps, int count, EventMode mode)
+    {
+        final OutstationChangeSet set = new OutstationChangeSet();
+        for(int i = 0; i < count; ++i)
+        {
+            set.update(new BinaryInput(values[i], new Flags(flags[i]), new DNPTime(timestamps[i])), indices[i], mode);
+        }
+        this.apply(set);
+    }
+
+    /**
+     * Update a batch of double-bit binary inputs, using DoubleBit.toType() values in a single native call without allocating per point
+     *
+     * Timestamps are treated as synchronized, like DNPTime(long).
+     *
+     * @param indices point indices
+     * @param values point values
+     * @param flags quality flags of each point
+     * @param timestamps milliseconds since epoch of each point
+     * @param count number of points to read from the arrays
+     * @param mode how events are generated for the batch
+     */
+    default void updateDoubleBinaries(int[] indices, byte[] values, byte[] flags, long[] timestamps, int count, EventMode mode)
+    {
+        final OutstationChangeSet set = new OutstationChangeSet();
+        for(int i = 0; i < count; ++i)
+        {
+            set.update(new DoubleBitBinaryInput(DoubleBit.fromType(values[i]), new Flags(flags[i]), new DNPTime(timestamps[i])), indices[i], mode);
+        }
+        this.apply(set);
+    }
+
+    /**
+     * Update a batch of analog inputs in a single native call without allocating per point
+     *
+     * Timestamps are treated as synchronized, like DNPTime(long).
+     *
+     * @param indices point indices
+     * @param values point values
+     * @param flags quality flags of each point
+     * @param timestamps milliseconds since epoch of each point
+     * @param count number of points to read from the arrays
+     * @param mode how events are generated for the batch
+     */
+    default void updateAnalogs(int[] indices, double[] values, byte[] flags, long[] timestamps, int count, EventMode mode)
+    {
+        final OutstationChangeSet set = new OutstationChangeSet();
+        for(int i = 0; i < count; ++i)
+        {
+            set.update(new AnalogInput(values[i], new Flags(flags[i]), new DNPTime(timestamps[i])), indices[i], mode);
+        }
+        this.apply(set);
+    }
+
+    /**
+     * Update a batch of counters in a single native call without allocating per point
+     *
+     * Timestamps are treated as synchronized, like DNPTime(long).
+     *
+     * @param indices point indices
+     * @param values point values
+     * @param flags quality flags of each point
+     * @param timestamps milliseconds since epoch of each point
+     * @param count number of points to read from the arrays
+     * @param mode how events are generated for the batch
+     */
+    default void updateCounters(int[] indices, long[] values, byte[] flags, long[] timestamps, int count, EventMode mode)
+    {
+        final OutstationChangeSet set = new OutstationChangeSet();
+        for(int i = 0; i < count; ++i)
+        {
+            set.update(new Counter(values[i], new Flags(flags[i]), new DNPTime(timestamps[i])), indices[i], mode);
+        }
+        this.apply(set);
+    }
+
+    /**
+     * Update a batch of binary output statuses in a single native call without allocating per point
+     *
+     * Timestamps are treated as synchronized, like DNPTime(long).
+     *
+     * @param indices point indices
+     * @param values point values
+     * @param flags quality flags of each point
+     * @param timestamps milliseconds since epoch of each point
+     * @param count number of points to read from the arrays
+     * @param mode how events are generated for the batch
+     */
+    default void updateBinaryOutputStatuses(int[] indices, boolean[] values, byte[] flags, long[] timestamps, int count, EventMode mode)
+    {
+        final OutstationChangeSet set = new OutstationChangeSet();
+        for(int i = 0; i < count; ++i)
+        {
+            set.update(new BinaryOutputStatus(values[i], new Flags(flags[i]), new DNPTime(timestamps[i])), indices[i], mode);
+        }
+        this.apply(set);
+    }
+
+    /**
+     * Update a batch of analog output statuses in a single native call without allocating per point
+     *
+     * Timestamps are treated as synchronized, like DNPTime(long).
+     *
+     * @param indices point indices
+     * @param values point values
+     * @param flags quality flags of each point
+     * @param timestamps milliseconds since epoch of each point
+     * @param count number of points to read from the arrays
+     * @param mode how events are generated for the batch
+     */
+    default void updateAnalogOutputStatuses(int[] indices, double[] values, byte[] flags, long[] timestamps, int count, EventMode mode)
+    {
+        final OutstationChangeSet set = new OutstationChangeSet();
+        for(int i = 0; i < count; ++i)
+        {
+            set.update(new AnalogOutputStatus(values[i], new Flags(flags[i]), new DNPTime(timestamps[i])), indices[i], mode);
+        }
+        this.apply(set);
+    }
+
 }
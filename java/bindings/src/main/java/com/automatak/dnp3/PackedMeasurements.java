@@ -0,0 +1,116 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package com.automatak.dnp3;
+
+import com.automatak.dnp3.enums.DoubleBit;
+import com.automatak.dnp3.enums.TimestampQuality;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+/**
+ * Flyweight over the packed records delivered to a PackedSOEHandler
+ *
+ * Each record is RECORD_SIZE bytes in native byte order:
+ *
+ * offset 0  - int32 point index
+ * offset 4  - uint8 quality flags
+ * offset 5  - uint8 timestamp quality
+ * offset 8  - float64 value (0/1 for binaries, the DoubleBit type for double-bit binaries)
+ * offset 16 - int64 timestamp in milliseconds since epoch
+ *
+ * A single instance can be reused for every callback by calling wrap() with the new buffer.
+ */
+public final class PackedMeasurements {
+
+    public static final int RECORD_SIZE = 24;
+
+    public static final int INDEX_OFFSET = 0;
+    public static final int FLAGS_OFFSET = 4;
+    public static final int TIME_QUALITY_OFFSET = 5;
+    public static final int VALUE_OFFSET = 8;
+    public static final int TIME_OFFSET = 16;
+
+    private ByteBuffer buffer;
+    private int count;
+
+    /**
+     * Point the flyweight at a new buffer
+     * @param buffer the buffer passed to the PackedSOEHandler
+     * @param count the number of records passed to the PackedSOEHandler
+     * @return this instance
+     */
+    public PackedMeasurements wrap(ByteBuffer buffer, int count)
+    {
+        this.buffer = buffer.order(ByteOrder.nativeOrder());
+        this.count = count;
+        return this;
+    }
+
+    public int count()
+    {
+        return count;
+    }
+
+    public int getIndex(int i)
+    {
+        return buffer.getInt(offset(i) + INDEX_OFFSET);
+    }
+
+    public byte getFlags(int i)
+    {
+        return buffer.get(offset(i) + FLAGS_OFFSET);
+    }
+
+    public double getValue(int i)
+    {
+        return buffer.getDouble(offset(i) + VALUE_OFFSET);
+    }
+
+    public boolean getBooleanValue(int i)
+    {
+        return getValue(i) != 0;
+    }
+
+    public long getLongValue(int i)
+    {
+        return (long) getValue(i);
+    }
+
+    public DoubleBit getDoubleBitValue(int i)
+    {
+        return DoubleBit.fromType((int) getValue(i));
+    }
+
+    public long getTimestamp(int i)
+    {
+        return buffer.getLong(offset(i) + TIME_OFFSET);
+    }
+
+    public TimestampQuality getTimestampQuality(int i)
+    {
+        return TimestampQuality.fromType(buffer.get(offset(i) + TIME_QUALITY_OFFSET));
+    }
+
+    private static int offset(int i)
+    {
+        return i * RECORD_SIZE;
+    }
+}
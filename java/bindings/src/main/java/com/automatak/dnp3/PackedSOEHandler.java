@@ -0,0 +1,110 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package com.automatak.dnp3;
+
+import java.nio.ByteBuffer;
+
+/**
+ * Alternative to SOEHandler that receives each header as packed records in a direct ByteBuffer
+ *
+ * The buffer is owned by the native stack and reused for every header, so it is only valid for the duration of the
+ * callback. Use a PackedMeasurements flyweight to read the records without allocating.
+ *
+ * Only the types below are delivered. Like SOEHandler, headers of octet strings, time and interval,
+ * binary command events and analog command events are not passed to Java and are discarded.
+ */
+public interface PackedSOEHandler {
+
+    /**
+     * Start a processing an ASDU
+     * @param info Information about the incoming ASDU
+     */
+    void beginFragment(ResponseInfo info);
+
+    /**
+     * End a processing an ASDU
+     * @param info Information about the incoming ASDU
+     */
+    void endFragment(ResponseInfo info);
+
+    /**
+     * Process a header of binary inputs
+     * @param info information about the header from which the values came
+     * @param values packed records, see PackedMeasurements for the layout
+     * @param count the number of records in the buffer
+     */
+    void processBI(HeaderInfo info, ByteBuffer values, int count);
+
+    /**
+     * Process a header of double-bit binary inputs
+     * @param info information about the header from which the values came
+     * @param values packed records, see PackedMeasurements for the layout
+     * @param count the number of records in the buffer
+     */
+    void processDBI(HeaderInfo info, ByteBuffer values, int count);
+
+    /**
+     * Process a header of analog inputs
+     * @param info information about the header from which the values came
+     * @param values packed records, see PackedMeasurements for the layout
+     * @param count the number of records in the buffer
+     */
+    void processAI(HeaderInfo info, ByteBuffer values, int count);
+
+    /**
+     * Process a header of counters
+     * @param info information about the header from which the values came
+     * @param values packed records, see PackedMeasurements for the layout
+     * @param count the number of records in the buffer
+     */
+    void processC(HeaderInfo info, ByteBuffer values, int count);
+
+    /**
+     * Process a header of frozen counters
+     * @param info information about the header from which the values came
+     * @param values packed records, see PackedMeasurements for the layout
+     * @param count the number of records in the buffer
+     */
+    void processFC(HeaderInfo info, ByteBuffer values, int count);
+
+    /**
+     * Process a header of binary output status values
+     * @param info information about the header from which the values came
+     * @param values packed records, see PackedMeasurements for the layout
+     * @param count the number of records in the buffer
+     */
+    void processBOS(HeaderInfo info, ByteBuffer values, int count);
+
+    /**
+     * Process a header of analog output status values
+     * @param info information about the header from which the values came
+     * @param values packed records, see PackedMeasurements for the layout
+     * @param count the number of records in the buffer
+     */
+    void processAOS(HeaderInfo info, ByteBuffer values, int count);
+
+    /**
+     * Process a header of absolute times. Only the timestamp fields of the records are used.
+     * @param info information about the header from which the values came
+     * @param values packed records, see PackedMeasurements for the layout
+     * @param count the number of records in the buffer
+     */
+    void processDNPTime(HeaderInfo info, ByteBuffer values, int count);
+}
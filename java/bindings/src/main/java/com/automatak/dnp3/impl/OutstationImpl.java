@@ -22,6 +22,7 @@ package com.automatak.dnp3.impl;
 import com.automatak.dnp3.ChangeSet;
 import com.automatak.dnp3.Outstation;
 import com.automatak.dnp3.StackStatistics;
+import com.automatak.dnp3.enums.EventMode;
 
 class OutstationImpl implements Outstation {
 
@@ -80,6 +81,57 @@ class OutstationImpl implements Outstation {
 
     }
 
+    @Override
+    public void updateBinaries(int[] indices, boolean[] values, byte[] flags, long[] timestamps, int count, EventMode mode)
+    {
+        checkBatch(indices.length, values.length, flags.length, timestamps.length, count);
+        this.update_binaries_native(this.nativePointer, indices, values, flags, timestamps, count, mode.toType());
+    }
+
+    @Override
+    public void updateDoubleBinaries(int[] indices, byte[] values, byte[] flags, long[] timestamps, int count, EventMode mode)
+    {
+        checkBatch(indices.length, values.length, flags.length, timestamps.length, count);
+        this.update_double_binaries_native(this.nativePointer, indices, values, flags, timestamps, count, mode.toType());
+    }
+
+    @Override
+    public void updateAnalogs(int[] indices, double[] values, byte[] flags, long[] timestamps, int count, EventMode mode)
+    {
+        checkBatch(indices.length, values.length, flags.length, timestamps.length, count);
+        this.update_analogs_native(this.nativePointer, indices, values, flags, timestamps, count, mode.toType());
+    }
+
+    @Override
+    public void updateCounters(int[] indices, long[] values, byte[] flags, long[] timestamps, int count, EventMode mode)
+    {
+        checkBatch(indices.length, values.length, flags.length, timestamps.length, count);
+        this.update_counters_native(this.nativePointer, indices, values, flags, timestamps, count, mode.toType());
+    }
+
+    @Override
+    public void updateBinaryOutputStatuses(int[] indices, boolean[] values, byte[] flags, long[] timestamps, int count, EventMode mode)
+    {
+        checkBatch(indices.length, values.length, flags.length, timestamps.length, count);
+        this.update_bo_statuses_native(this.nativePointer, indices, values, flags, timestamps, count, mode.toType());
+    }
+
+    @Override
+    public void updateAnalogOutputStatuses(int[] indices, double[] values, byte[] flags, long[] timestamps, int count, EventMode mode)
+    {
+        checkBatch(indices.length, values.length, flags.length, timestamps.length, count);
+        this.update_ao_statuses_native(this.nativePointer, indices, values, flags, timestamps, count, mode.toType());
+    }
+
+    // the native side reads count elements from every array without further checks
+    private static void checkBatch(int numIndices, int numValues, int numFlags, int numTimestamps, int count)
+    {
+        if(count < 0 || numIndices < count || numValues < count || numFlags < count || numTimestamps < count)
+        {
+            throw new IllegalArgumentException(String.format("all arrays must hold at least %d elements", count));
+        }
+    }
+
     private native void set_log_level_native(long nativePointer, int levels);
     private native StackStatistics get_statistics_native(long nativePointer);
     private native void enable_native(long nativePointer);
@@ -87,4 +139,10 @@ class OutstationImpl implements Outstation {
     private native void shutdown_native(long nativePointer);
     private native void destroy_native(long nativePointer);
     private native void apply_native(long nativePointer, long nativeChangeSet);
+    private native void update_binaries_native(long nativePointer, int[] indices, boolean[] values, byte[] flags, long[] timestamps, int count, int mode);
+    private native void update_double_binaries_native(long nativePointer, int[] indices, byte[] values, byte[] flags, long[] timestamps, int count, int mode);
+    private native void update_analogs_native(long nativePointer, int[] indices, double[] values, byte[] flags, long[] timestamps, int count, int mode);
+    private native void update_counters_native(long nativePointer, int[] indices, long[] values, byte[] flags, long[] timestamps, int count, int mode);
+    private native void update_bo_statuses_native(long nativePointer, int[] indices, boolean[] values, byte[] flags, long[] timestamps, int count, int mode);
+    private native void update_ao_statuses_native(long nativePointer, int[] indices, double[] values, byte[] flags, long[] timestamps, int count, int mode);
 }
@@ -0,0 +1,179 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package com.automatak.dnp3.impl;
+
+import com.automatak.dnp3.*;
+import com.automatak.dnp3.enums.*;
+import com.automatak.dnp3.impl.mocks.BlockingChannelListener;
+import com.automatak.dnp3.impl.mocks.NullLogHandler;
+import com.automatak.dnp3.mock.DefaultMasterApplication;
+import com.automatak.dnp3.mock.DefaultOutstationApplication;
+import com.automatak.dnp3.mock.SuccessCommandHandler;
+import junit.framework.Assert;
+import org.junit.Test;
+
+import java.time.Duration;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.TimeUnit;
+
+public class OutstationBatchUpdateTest {
+
+    static final int START_PORT = 20030;
+    static final Duration TIMEOUT = Duration.ofSeconds(10);
+
+    // larger than the default update channel of the outstation, so the batch can't be written to it
+    static final int NUM_FALLBACK_POINTS = 1500;
+
+    static class CounterSOEHandler implements SOEHandler {
+
+        final LinkedBlockingQueue<IndexedValue<Counter>> counters = new LinkedBlockingQueue<>();
+
+        List<IndexedValue<Counter>> waitFor(int count, Duration duration) {
+            final List<IndexedValue<Counter>> result = new ArrayList<>();
+            final long deadline = System.currentTimeMillis() + duration.toMillis();
+            try {
+                while(result.size() < count) {
+                    IndexedValue<Counter> value = counters.poll(deadline - System.currentTimeMillis(), TimeUnit.MILLISECONDS);
+                    if(value == null) throw new RuntimeException(String.format("Received %d of %d counters", result.size(), count));
+                    result.add(value);
+                }
+            }
+            catch(InterruptedException ex) {
+                throw new RuntimeException(ex);
+            }
+            return result;
+        }
+
+        @Override
+        public void processC(HeaderInfo info, Iterable<IndexedValue<Counter>> values) {
+            values.forEach(counters::add);
+        }
+
+        @Override
+        public void beginFragment(ResponseInfo info) {}
+        @Override
+        public void endFragment(ResponseInfo info) {}
+        @Override
+        public void processBI(HeaderInfo info, Iterable<IndexedValue<BinaryInput>> values) {}
+        @Override
+        public void processDBI(HeaderInfo info, Iterable<IndexedValue<DoubleBitBinaryInput>> values) {}
+        @Override
+        public void processAI(HeaderInfo info, Iterable<IndexedValue<AnalogInput>> values) {}
+        @Override
+        public void processFC(HeaderInfo info, Iterable<IndexedValue<FrozenCounter>> values) {}
+        @Override
+        public void processBOS(HeaderInfo info, Iterable<IndexedValue<BinaryOutputStatus>> values) {}
+        @Override
+        public void processAOS(HeaderInfo info, Iterable<IndexedValue<AnalogOutputStatus>> values) {}
+        @Override
+        public void processDNPTime(HeaderInfo info, Iterable<DNPTime> values) {}
+    }
+
+    static OutstationStackConfig getOutstationConfig(int numCounters)
+    {
+        OutstationStackConfig config = new OutstationStackConfig(
+                new DatabaseConfig(0, 0, 0, numCounters, 0, 0, 0), EventBufferConfig.allTypes(numCounters)
+        );
+
+        // report the time of each counter event so that the timestamps can be checked
+        config.databaseConfig.counter.values().forEach(c -> c.eventVariation = EventCounterVariation.Group22Var5);
+
+        config.outstationConfig.allowUnsolicited = true;
+
+        return config;
+    }
+
+    static MasterStackConfig getMasterStackConfig()
+    {
+        MasterStackConfig config = new MasterStackConfig();
+
+        config.master.disableUnsolOnStartup = false;
+        config.master.startupIntegrityClassMask = ClassField.none();
+        config.master.unsolClassMask = ClassField.allEventClasses();
+
+        return config;
+    }
+
+    static void sendAndVerify(int port, int count) throws DNP3Exception
+    {
+        final DNP3Manager manager = DNP3ManagerFactory.createManager(1, new NullLogHandler());
+
+        try {
+            final BlockingChannelListener clientListener = new BlockingChannelListener();
+            final BlockingChannelListener serverListener = new BlockingChannelListener();
+            final CounterSOEHandler soeHandler = new CounterSOEHandler();
+
+            Channel client = manager.addTCPClient("client", LogLevels.INFO, ChannelRetry.getDefault(),
+                    Arrays.asList(new IPEndpoint("127.0.0.1", port)), "127.0.0.1", clientListener);
+            Channel server = manager.addTCPServer("server", LogLevels.INFO, ServerAcceptMode.CloseExisting,
+                    new IPEndpoint("127.0.0.1", port), serverListener);
+
+            Master master = client.addMaster("master", soeHandler, DefaultMasterApplication.getInstance(), getMasterStackConfig());
+            Outstation outstation = server.addOutstation("outstation", SuccessCommandHandler.getInstance(),
+                    DefaultOutstationApplication.getInstance(), getOutstationConfig(count));
+
+            outstation.enable();
+            master.enable();
+
+            clientListener.waitFor(ChannelState.OPEN, TIMEOUT);
+            serverListener.waitFor(ChannelState.OPEN, TIMEOUT);
+
+            final int[] indices = new int[count];
+            final long[] values = new long[count];
+            final byte[] flags = new byte[count];
+            final long[] timestamps = new long[count];
+
+            for(int i = 0; i < count; ++i) {
+                indices[i] = count - 1 - i;
+                values[i] = 4294967295L - i;
+                flags[i] = (byte)(i % 2 == 0 ? 0x01 : 0x41);
+                timestamps[i] = 1234567890123L + i;
+            }
+
+            outstation.updateCounters(indices, values, flags, timestamps, count, EventMode.Force);
+
+            final List<IndexedValue<Counter>> received = soeHandler.waitFor(count, TIMEOUT);
+
+            for(int i = 0; i < count; ++i) {
+                final IndexedValue<Counter> value = received.get(i);
+                Assert.assertEquals(indices[i], value.index);
+                Assert.assertEquals(values[i], value.value.value);
+                Assert.assertEquals(flags[i], value.value.quality.getValue());
+                Assert.assertEquals(timestamps[i], value.value.timestamp.msSinceEpoch);
+            }
+        }
+        finally {
+            manager.shutdown();
+        }
+    }
+
+    @Test
+    public void roundTripsIndexValueFlagsAndTime() throws DNP3Exception {
+        sendAndVerify(START_PORT, 10);
+    }
+
+    @Test
+    public void appliesBatchesThatDoNotFitTheUpdateChannelInOrder() throws DNP3Exception {
+        sendAndVerify(START_PORT + 1, NUM_FALLBACK_POINTS);
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package com.automatak.dnp3.impl;
+
+import com.automatak.dnp3.PackedMeasurements;
+import com.automatak.dnp3.enums.DoubleBit;
+import com.automatak.dnp3.enums.TimestampQuality;
+import junit.framework.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+public class PackedMeasurementsTest {
+
+    private static void put(ByteBuffer buffer, int i, int index, byte flags, TimestampQuality quality, double value, long time) {
+        final int offset = i * PackedMeasurements.RECORD_SIZE;
+        buffer.putInt(offset + PackedMeasurements.INDEX_OFFSET, index);
+        buffer.put(offset + PackedMeasurements.FLAGS_OFFSET, flags);
+        buffer.put(offset + PackedMeasurements.TIME_QUALITY_OFFSET, (byte)quality.toType());
+        buffer.putDouble(offset + PackedMeasurements.VALUE_OFFSET, value);
+        buffer.putLong(offset + PackedMeasurements.TIME_OFFSET, time);
+    }
+
+    @Test
+    public void readsRecordsInNativeOrder() {
+        ByteBuffer buffer = ByteBuffer.allocateDirect(3 * PackedMeasurements.RECORD_SIZE).order(ByteOrder.nativeOrder());
+        put(buffer, 0, 7, (byte)0x81, TimestampQuality.SYNCHRONIZED, 1.0, 1234567890123L);
+        put(buffer, 1, 65535, (byte)0x01, TimestampQuality.UNSYNCHRONIZED, 4294967295.0, 42L);
+        put(buffer, 2, 3, (byte)0x02, TimestampQuality.INVALID, DoubleBit.DETERMINED_ON.toType(), 0L);
+
+        // the flyweight must not depend on the order the buffer was created with
+        buffer.order(ByteOrder.BIG_ENDIAN == ByteOrder.nativeOrder() ? ByteOrder.LITTLE_ENDIAN : ByteOrder.BIG_ENDIAN);
+
+        PackedMeasurements values = new PackedMeasurements().wrap(buffer, 3);
+
+        Assert.assertEquals(3, values.count());
+
+        Assert.assertEquals(7, values.getIndex(0));
+        Assert.assertEquals((byte)0x81, values.getFlags(0));
+        Assert.assertTrue(values.getBooleanValue(0));
+        Assert.assertEquals(1234567890123L, values.getTimestamp(0));
+        Assert.assertEquals(TimestampQuality.SYNCHRONIZED, values.getTimestampQuality(0));
+
+        Assert.assertEquals(65535, values.getIndex(1));
+        Assert.assertEquals(4294967295L, values.getLongValue(1));
+        Assert.assertEquals(TimestampQuality.UNSYNCHRONIZED, values.getTimestampQuality(1));
+
+        Assert.assertEquals(DoubleBit.DETERMINED_ON, values.getDoubleBitValue(2));
+        Assert.assertEquals(TimestampQuality.INVALID, values.getTimestampQuality(2));
+    }
+
+    @Test
+    public void canBeReusedForAnotherBuffer() {
+        ByteBuffer first = ByteBuffer.allocateDirect(PackedMeasurements.RECORD_SIZE).order(ByteOrder.nativeOrder());
+        ByteBuffer second = ByteBuffer.allocateDirect(PackedMeasurements.RECORD_SIZE).order(ByteOrder.nativeOrder());
+        put(first, 0, 1, (byte)0x01, TimestampQuality.SYNCHRONIZED, 3.5, 10L);
+        put(second, 0, 2, (byte)0x01, TimestampQuality.SYNCHRONIZED, -3.5, 20L);
+
+        PackedMeasurements values = new PackedMeasurements();
+
+        values.wrap(first, 1);
+        Assert.assertEquals(3.5, values.getValue(0), 0.0);
+
+        values.wrap(second, 1);
+        Assert.assertEquals(2, values.getIndex(0));
+        Assert.assertEquals(-3.5, values.getValue(0), 0.0);
+        Assert.assertEquals(20L, values.getTimestamp(0));
+    }
+}
@@ -78,6 +78,7 @@ object Classes {
   private def interfaces : List[ClassConfig] = List(
     classOf[LogHandler],
     classOf[SOEHandler],
+    classOf[PackedSOEHandler],
     classOf[LinkStatusListener],
     classOf[MasterApplication],
     classOf[OutstationApplication],
@@ -97,6 +98,7 @@ object Classes {
     ClassConfig(classOf[java.util.Map[_, _]], Set(Features.Methods), MethodFilter.equalsAny("entrySet")),
     ClassConfig(classOf[java.util.Map.Entry[_, _]], Set(Features.Methods), MethodFilter.equalsAny("getKey", "getValue")),
     ClassConfig(classOf[java.util.Set[_]], Set.empty),
+    ClassConfig(classOf[java.nio.ByteBuffer], Set.empty),
     ClassConfig(classOf[Object], Set.empty),
     ClassConfig(classOf[Integer], Set(Features.Methods), MethodFilter.equalsAny("intValue"))
   )
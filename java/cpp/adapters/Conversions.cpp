@@ -32,3 +32,15 @@ LocalRef<jni::JStackStatistics> Conversions::ConvertStackStatistics(JNIEnv* env,
 
     return jni::JCache::StackStatistics.construct(env, link, transport);
 }
+
+LocalRef<jni::JHeaderInfo> Conversions::ConvertHeaderInfo(JNIEnv* env, const opendnp3::HeaderInfo& info)
+{
+    auto gv = jni::JCache::GroupVariation.fromType(env, opendnp3::GroupVariationSpec::to_type(info.gv));
+    auto qc = jni::JCache::QualifierCode.fromType(env, opendnp3::QualifierCodeSpec::to_type(info.qualifier));
+    auto tsquality = jni::JCache::TimestampQuality.fromType(env, static_cast<jint>(info.tsquality));
+    jboolean isEvent = static_cast<jboolean>(info.isEventVariation);
+    jboolean flagsValid = static_cast<jboolean>(info.flagsValid);
+    jint headerIndex = info.headerIndex;
+
+    return jni::JCache::HeaderInfo.construct(env, gv, qc, tsquality, isEvent, flagsValid, headerIndex);
+}
@@ -23,11 +23,14 @@
 #include "../jni/JCache.h"
 
 #include "opendnp3/StackStatistics.h"
+#include "opendnp3/master/HeaderInfo.h"
 
 class Conversions
 {
 public:
     static LocalRef<jni::JStackStatistics> ConvertStackStatistics(JNIEnv* env, const opendnp3::StackStatistics& stats);
+
+    static LocalRef<jni::JHeaderInfo> ConvertHeaderInfo(JNIEnv* env, const opendnp3::HeaderInfo& info);
 };
 
 #endif
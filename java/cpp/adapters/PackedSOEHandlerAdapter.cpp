@@ -0,0 +1,178 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "PackedSOEHandlerAdapter.h"
+
+#include "Conversions.h"
+
+#include "../jni/JCache.h"
+
+#include <algorithm>
+
+using namespace opendnp3;
+
+namespace
+{
+// start with enough room for a typical event response to avoid growing the buffer on the first few headers
+const size_t INITIAL_RECORDS = 256;
+} // namespace
+
+void PackedSOEHandlerAdapter::BeginFragment(const ResponseInfo& info)
+{
+    const auto env = JNI::GetEnv();
+    jni::JCache::PackedSOEHandler.beginFragment(env, proxy, jni::JCache::ResponseInfo.construct(env, info.unsolicited, info.fir, info.fin));
+}
+
+void PackedSOEHandlerAdapter::EndFragment(const ResponseInfo& info)
+{
+    const auto env = JNI::GetEnv();
+    jni::JCache::PackedSOEHandler.endFragment(env, proxy, jni::JCache::ResponseInfo.construct(env, info.unsolicited, info.fir, info.fin));
+}
+
+jni::JByteBuffer PackedSOEHandlerAdapter::Reserve(JNIEnv* env, size_t count)
+{
+    if (!buffer || records.size() < count)
+    {
+        records.resize(std::max(count, std::max(INITIAL_RECORDS, 2 * records.size())));
+
+        // the direct buffer only wraps the vector's storage, so it must be replaced whenever the vector reallocates
+        LocalRef<jni::JByteBuffer> local(
+            env, jni::JByteBuffer(env->NewDirectByteBuffer(records.data(), static_cast<jlong>(records.size() * sizeof(Record)))));
+        buffer = std::make_unique<GlobalRef<jni::JByteBuffer>>(local.get());
+    }
+
+    return buffer->get();
+}
+
+template<class T, class GetValue, class CallProxy>
+void PackedSOEHandlerAdapter::Process(const opendnp3::HeaderInfo& info,
+                                      const opendnp3::ICollection<opendnp3::Indexed<T>>& values,
+                                      const GetValue& get_value,
+                                      const CallProxy& call_proxy)
+{
+    const auto env = JNI::GetEnv();
+
+    auto jinfo = Conversions::ConvertHeaderInfo(env, info);
+    auto jbuffer = this->Reserve(env, values.Count());
+
+    auto dest = records.data();
+    auto pack = [&](const Indexed<T>& meas) {
+        dest->index = meas.index;
+        dest->flags = meas.value.flags.value;
+        dest->tsquality = TimestampQualitySpec::to_type(meas.value.time.quality);
+        dest->reserved = 0;
+        dest->value = get_value(meas.value);
+        dest->time = static_cast<int64_t>(meas.value.time.value);
+        ++dest;
+    };
+
+    values.ForeachItem(pack);
+
+    call_proxy(env, proxy, jinfo, jbuffer, static_cast<jint>(dest - records.data()));
+}
+
+void PackedSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values)
+{
+    auto get = [](const Binary& value) -> double { return value.value ? 1.0 : 0.0; };
+    auto call = [](JNIEnv* env, jni::JPackedSOEHandler proxy, jni::JHeaderInfo hinfo, jni::JByteBuffer buffer, jint count) {
+        jni::JCache::PackedSOEHandler.processBI(env, proxy, hinfo, buffer, count);
+    };
+
+    this->Process(info, values, get, call);
+}
+
+void PackedSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values)
+{
+    auto get = [](const DoubleBitBinary& value) -> double { return DoubleBitSpec::to_type(value.value); };
+    auto call = [](JNIEnv* env, jni::JPackedSOEHandler proxy, jni::JHeaderInfo hinfo, jni::JByteBuffer buffer, jint count) {
+        jni::JCache::PackedSOEHandler.processDBI(env, proxy, hinfo, buffer, count);
+    };
+
+    this->Process(info, values, get, call);
+}
+
+void PackedSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values)
+{
+    auto get = [](const Analog& value) -> double { return value.value; };
+    auto call = [](JNIEnv* env, jni::JPackedSOEHandler proxy, jni::JHeaderInfo hinfo, jni::JByteBuffer buffer, jint count) {
+        jni::JCache::PackedSOEHandler.processAI(env, proxy, hinfo, buffer, count);
+    };
+
+    this->Process(info, values, get, call);
+}
+
+void PackedSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values)
+{
+    auto get = [](const Counter& value) -> double { return value.value; };
+    auto call = [](JNIEnv* env, jni::JPackedSOEHandler proxy, jni::JHeaderInfo hinfo, jni::JByteBuffer buffer, jint count) {
+        jni::JCache::PackedSOEHandler.processC(env, proxy, hinfo, buffer, count);
+    };
+
+    this->Process(info, values, get, call);
+}
+
+void PackedSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values)
+{
+    auto get = [](const FrozenCounter& value) -> double { return value.value; };
+    auto call = [](JNIEnv* env, jni::JPackedSOEHandler proxy, jni::JHeaderInfo hinfo, jni::JByteBuffer buffer, jint count) {
+        jni::JCache::PackedSOEHandler.processFC(env, proxy, hinfo, buffer, count);
+    };
+
+    this->Process(info, values, get, call);
+}
+
+void PackedSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values)
+{
+    auto get = [](const BinaryOutputStatus& value) -> double { return value.value ? 1.0 : 0.0; };
+    auto call = [](JNIEnv* env, jni::JPackedSOEHandler proxy, jni::JHeaderInfo hinfo, jni::JByteBuffer buffer, jint count) {
+        jni::JCache::PackedSOEHandler.processBOS(env, proxy, hinfo, buffer, count);
+    };
+
+    this->Process(info, values, get, call);
+}
+
+void PackedSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values)
+{
+    auto get = [](const AnalogOutputStatus& value) -> double { return value.value; };
+    auto call = [](JNIEnv* env, jni::JPackedSOEHandler proxy, jni::JHeaderInfo hinfo, jni::JByteBuffer buffer, jint count) {
+        jni::JCache::PackedSOEHandler.processAOS(env, proxy, hinfo, buffer, count);
+    };
+
+    this->Process(info, values, get, call);
+}
+
+void PackedSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<DNPTime>& values)
+{
+    const auto env = JNI::GetEnv();
+
+    auto jinfo = Conversions::ConvertHeaderInfo(env, info);
+    auto jbuffer = this->Reserve(env, values.Count());
+
+    auto dest = records.data();
+    auto pack = [&](const DNPTime& value) {
+        *dest = Record{};
+        dest->tsquality = TimestampQualitySpec::to_type(value.quality);
+        dest->time = static_cast<int64_t>(value.value);
+        ++dest;
+    };
+
+    values.ForeachItem(pack);
+
+    jni::JCache::PackedSOEHandler.processDNPTime(env, proxy, jinfo, jbuffer, static_cast<jint>(dest - records.data()));
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_PACKEDSOEHANDLERADAPTER_H
+#define OPENDNP3_PACKEDSOEHANDLERADAPTER_H
+
+#include <opendnp3/master/ISOEHandler.h>
+
+#include "GlobalRef.h"
+#include "LocalRef.h"
+
+#include "../jni/JNIWrappers.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * Delivers each header to a Java PackedSOEHandler as packed records in a reusable direct ByteBuffer.
+ *
+ * Unlike SOEHandlerAdapter, no Java objects are allocated per point. The buffer is only grown when a
+ * header holds more points than any previous header.
+ */
+class PackedSOEHandlerAdapter final : public opendnp3::ISOEHandler
+{
+public:
+    PackedSOEHandlerAdapter(jni::JPackedSOEHandler proxy) : proxy(proxy) {}
+
+    void BeginFragment(const opendnp3::ResponseInfo& info) override;
+
+    void EndFragment(const opendnp3::ResponseInfo& info) override;
+
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Binary>>& values) override;
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::DoubleBitBinary>>& values) override;
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Analog>>& values) override;
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Counter>>& values) override;
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::FrozenCounter>>& values) override;
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::BinaryOutputStatus>>& values) override;
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::AnalogOutputStatus>>& values) override;
+
+    // these types have no packed representation and are discarded, same as SOEHandlerAdapter
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::OctetString>>& values) override
+    {
+    }
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::TimeAndInterval>>& values) override
+    {
+    }
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::BinaryCommandEvent>>& values) override
+    {
+    }
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::AnalogCommandEvent>>& values) override
+    {
+    }
+
+    void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::DNPTime>& values) override;
+
+private:
+    // the layout read by com.automatak.dnp3.PackedMeasurements
+    struct Record
+    {
+        int32_t index;
+        uint8_t flags;
+        uint8_t tsquality;
+        uint16_t reserved;
+        double value;
+        int64_t time;
+    };
+
+    static_assert(sizeof(Record) == 24, "Record layout must match PackedMeasurements.RECORD_SIZE");
+
+    template<class T, class GetValue, class CallProxy>
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<T>>& values,
+                 const GetValue& get_value,
+                 const CallProxy& call_proxy);
+
+    // make sure the direct buffer can hold at least count records
+    jni::JByteBuffer Reserve(JNIEnv* env, size_t count);
+
+    GlobalRef<jni::JPackedSOEHandler> proxy;
+
+    std::vector<Record> records;
+    std::unique_ptr<GlobalRef<jni::JByteBuffer>> buffer;
+};
+
+#endif
@@ -20,6 +20,8 @@
 
 #include "SOEHandlerAdapter.h"
 
+#include "Conversions.h"
+
 #include "../jni/JCache.h"
 #include "../jni/JNIWrappers.h"
 
@@ -45,7 +47,7 @@ void SOEHandlerAdapter::Process(const opendnp3::HeaderInfo& info,
 {
     const auto env = JNI::GetEnv();
 
-    auto jinfo = Convert(env, info);
+    auto jinfo = Conversions::ConvertHeaderInfo(env, info);
 
     auto jlist = jni::JCache::ArrayList.construct(env, static_cast<jint>(values.Count()));
 
@@ -151,7 +153,7 @@ void SOEHandlerAdapter::Process(const opendnp3::HeaderInfo& info,
 {
     const auto env = JNI::GetEnv();
 
-    auto jinfo = Convert(env, info);
+    auto jinfo = Conversions::ConvertHeaderInfo(env, info);
 
     auto jlist = jni::JCache::ArrayList.construct(env, static_cast<jint>(values.Count()));
 
@@ -165,18 +167,6 @@ void SOEHandlerAdapter::Process(const opendnp3::HeaderInfo& info,
     jni::JCache::SOEHandler.processDNPTime(env, proxy, jinfo, jlist.as<jni::JIterable>());
 }
 
-LocalRef<jni::JHeaderInfo> SOEHandlerAdapter::Convert(JNIEnv* env, const opendnp3::HeaderInfo& info)
-{
-    auto gv = jni::JCache::GroupVariation.fromType(env, GroupVariationSpec::to_type(info.gv));
-    auto qc = jni::JCache::QualifierCode.fromType(env, QualifierCodeSpec::to_type(info.qualifier));
-    auto tsquality = jni::JCache::TimestampQuality.fromType(env, static_cast<jint>(info.tsquality));
-    jboolean isEvent = static_cast<jboolean>(info.isEventVariation);
-    jboolean flagsValid = static_cast<jboolean>(info.flagsValid);
-    jint headerIndex = info.headerIndex;
-
-    return jni::JCache::HeaderInfo.construct(env, gv, qc, tsquality, isEvent, flagsValid, headerIndex);
-}
-
 LocalRef<jni::JDNPTime> SOEHandlerAdapter::Convert(JNIEnv* env, const opendnp3::DNPTime& time)
 {
     const auto jquality = jni::JCache::TimestampQuality.fromType(env, TimestampQualitySpec::to_type(time.quality));
@@ -78,7 +78,6 @@ private:
                  const CreateMeas& createMeas,
                  const CallProxy& callProxy);
 
-    static LocalRef<jni::JHeaderInfo> Convert(JNIEnv* env, const opendnp3::HeaderInfo& info);
     static LocalRef<jni::JDNPTime> Convert(JNIEnv* env, const opendnp3::DNPTime& time);
 
     GlobalRef<jni::JSOEHandler> proxy;
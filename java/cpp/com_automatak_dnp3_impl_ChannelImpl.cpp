@@ -24,6 +24,7 @@
 #include "adapters/ConfigReader.h"
 #include "adapters/MasterApplicationAdapter.h"
 #include "adapters/OutstationApplicationAdapter.h"
+#include "adapters/PackedSOEHandlerAdapter.h"
 #include "adapters/SOEHandlerAdapter.h"
 #include "jni/JCache.h"
 
@@ -92,6 +93,22 @@ JNIEXPORT jlong JNICALL Java_com_automatak_dnp3_impl_ChannelImpl_get_1native_1ma
     return stack ? (jlong) new std::shared_ptr<IMaster>(stack) : 0;
 }
 
+JNIEXPORT jlong JNICALL Java_com_automatak_dnp3_impl_ChannelImpl_get_1native_1packed_1master(
+    JNIEnv* env, jobject /*unused*/, jlong native, jstring jid, jobject handler, jobject application, jobject jconfig)
+{
+    const auto channel = (std::shared_ptr<IChannel>*)native;
+
+    auto config = ConfigReader::Convert(env, jni::JMasterStackConfig(jconfig));
+    auto soeAdapter = std::make_shared<PackedSOEHandlerAdapter>(handler);
+    auto appAdapter = std::make_shared<MasterApplicationAdapter>(application);
+
+    CString id(env, jid);
+
+    auto stack = (*channel)->AddMaster(id.str(), soeAdapter, appAdapter, config);
+
+    return stack ? (jlong) new std::shared_ptr<IMaster>(stack) : 0;
+}
+
 JNIEXPORT jlong JNICALL Java_com_automatak_dnp3_impl_ChannelImpl_get_1native_1outstation(JNIEnv* env,
                                                                                          jobject /*unused*/,
                                                                                          jlong native,
@@ -47,6 +47,14 @@ JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChannelImpl_destroy_1native
 JNIEXPORT jlong JNICALL Java_com_automatak_dnp3_impl_ChannelImpl_get_1native_1master
   (JNIEnv *, jobject, jlong, jstring, jobject, jobject, jobject);
 
+/*
+ * Class:     com_automatak_dnp3_impl_ChannelImpl
+ * Method:    get_native_packed_master
+ * Signature: (JLjava/lang/String;Lcom/automatak/dnp3/PackedSOEHandler;Lcom/automatak/dnp3/MasterApplication;Lcom/automatak/dnp3/MasterStackConfig;)J
+ */
+JNIEXPORT jlong JNICALL Java_com_automatak_dnp3_impl_ChannelImpl_get_1native_1packed_1master
+  (JNIEnv *, jobject, jlong, jstring, jobject, jobject, jobject);
+
 /*
  * Class:     com_automatak_dnp3_impl_ChannelImpl
  * Method:    get_native_outstation
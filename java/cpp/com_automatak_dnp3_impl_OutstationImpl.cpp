@@ -24,6 +24,97 @@
 #include <opendnp3/outstation/IOutstation.h>
 #include <opendnp3/outstation/UpdateBuilder.h>
 
+#include <functional>
+#include <vector>
+
+namespace
+{
+// copies of the Java arrays of a batch, reused by later batches on the same thread
+template<class V> struct BatchBuffers
+{
+    std::vector<jint> indices;
+    std::vector<V> values;
+    std::vector<jbyte> flags;
+    std::vector<jlong> timestamps;
+};
+
+void CopyRegion(JNIEnv* env, jintArray array, jint count, jint* dest)
+{
+    env->GetIntArrayRegion(array, 0, count, dest);
+}
+
+void CopyRegion(JNIEnv* env, jbooleanArray array, jint count, jboolean* dest)
+{
+    env->GetBooleanArrayRegion(array, 0, count, dest);
+}
+
+void CopyRegion(JNIEnv* env, jbyteArray array, jint count, jbyte* dest)
+{
+    env->GetByteArrayRegion(array, 0, count, dest);
+}
+
+void CopyRegion(JNIEnv* env, jdoubleArray array, jint count, jdouble* dest)
+{
+    env->GetDoubleArrayRegion(array, 0, count, dest);
+}
+
+void CopyRegion(JNIEnv* env, jlongArray array, jint count, jlong* dest)
+{
+    env->GetLongArrayRegion(array, 0, count, dest);
+}
+
+template<class T, class A> void CopyArray(JNIEnv* env, A array, jint count, std::vector<T>& dest)
+{
+    dest.resize(static_cast<size_t>(count));
+    CopyRegion(env, array, count, dest.data());
+}
+
+/**
+ * Writes a batch with IOutstation::UpdateBatch, which puts it in the update channel without allocating if the whole
+ * batch fits and otherwise applies all of it in order behind the channel.
+ *
+ * The arrays are copied out first so that no Java array stays pinned while the batch is written.
+ */
+template<class V, class A, class CreateMeas>
+void UpdateBatch(JNIEnv* env,
+                 jlong native,
+                 jintArray jindices,
+                 A jvalues,
+                 jbyteArray jflags,
+                 jlongArray jtimestamps,
+                 jint count,
+                 jint mode,
+                 const CreateMeas& create)
+{
+    auto outstation = (std::shared_ptr<opendnp3::IOutstation>*)native;
+    const auto emode = static_cast<opendnp3::EventMode>(mode);
+
+    thread_local BatchBuffers<V> buffers;
+    CopyArray(env, jindices, count, buffers.indices);
+    CopyArray(env, jvalues, count, buffers.values);
+    CopyArray(env, jflags, count, buffers.flags);
+    CopyArray(env, jtimestamps, count, buffers.timestamps);
+
+    // an array shorter than count leaves a pending ArrayIndexOutOfBoundsException for the caller
+    if (env->ExceptionCheck())
+    {
+        return;
+    }
+
+    auto write = [&](opendnp3::IUpdateHandler& handler) {
+        for (jint i = 0; i < count; ++i)
+        {
+            handler.Update(create(buffers.values[i], opendnp3::Flags(static_cast<uint8_t>(buffers.flags[i])),
+                                  opendnp3::DNPTime(static_cast<uint64_t>(buffers.timestamps[i]))),
+                           static_cast<uint16_t>(buffers.indices[i]), emode);
+        }
+    };
+
+    // a reference_wrapper is stored inline, so wrapping it in a std::function doesn't allocate
+    (*outstation)->UpdateBatch(static_cast<size_t>(count), std::cref(write));
+}
+} // namespace
+
 JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_set_1log_1level_1native(JNIEnv* /*env*/,
                                                                                            jobject /*unused*/,
                                                                                            jlong native,
@@ -83,3 +174,100 @@ JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_apply_1native
     auto builder = (opendnp3::UpdateBuilder*)nativeChangeSet;
     (*outstation)->Apply(builder->Build());
 }
+
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_update_1binaries_1native(JNIEnv* env,
+                                                                                          jobject /*unused*/,
+                                                                                          jlong native,
+                                                                                          jintArray indices,
+                                                                                          jbooleanArray values,
+                                                                                          jbyteArray flags,
+                                                                                          jlongArray timestamps,
+                                                                                          jint count,
+                                                                                          jint mode)
+{
+    UpdateBatch<jboolean>(env, native, indices, values, flags, timestamps, count, mode,
+                          [](jboolean value, opendnp3::Flags flags, opendnp3::DNPTime time) {
+                              return opendnp3::Binary(value != 0, flags, time);
+                          });
+}
+
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_update_1double_1binaries_1native(JNIEnv* env,
+                                                                                                  jobject /*unused*/,
+                                                                                                  jlong native,
+                                                                                                  jintArray indices,
+                                                                                                  jbyteArray values,
+                                                                                                  jbyteArray flags,
+                                                                                                  jlongArray timestamps,
+                                                                                                  jint count,
+                                                                                                  jint mode)
+{
+    UpdateBatch<jbyte>(env, native, indices, values, flags, timestamps, count, mode,
+                       [](jbyte value, opendnp3::Flags flags, opendnp3::DNPTime time) {
+                           return opendnp3::DoubleBitBinary(opendnp3::DoubleBitSpec::from_type(static_cast<uint8_t>(value)),
+                                                            flags, time);
+                       });
+}
+
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_update_1analogs_1native(JNIEnv* env,
+                                                                                         jobject /*unused*/,
+                                                                                         jlong native,
+                                                                                         jintArray indices,
+                                                                                         jdoubleArray values,
+                                                                                         jbyteArray flags,
+                                                                                         jlongArray timestamps,
+                                                                                         jint count,
+                                                                                         jint mode)
+{
+    UpdateBatch<jdouble>(env, native, indices, values, flags, timestamps, count, mode,
+                         [](jdouble value, opendnp3::Flags flags, opendnp3::DNPTime time) {
+                             return opendnp3::Analog(value, flags, time);
+                         });
+}
+
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_update_1counters_1native(JNIEnv* env,
+                                                                                          jobject /*unused*/,
+                                                                                          jlong native,
+                                                                                          jintArray indices,
+                                                                                          jlongArray values,
+                                                                                          jbyteArray flags,
+                                                                                          jlongArray timestamps,
+                                                                                          jint count,
+                                                                                          jint mode)
+{
+    UpdateBatch<jlong>(env, native, indices, values, flags, timestamps, count, mode,
+                       [](jlong value, opendnp3::Flags flags, opendnp3::DNPTime time) {
+                           return opendnp3::Counter(static_cast<uint32_t>(value), flags, time);
+                       });
+}
+
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_update_1bo_1statuses_1native(JNIEnv* env,
+                                                                                              jobject /*unused*/,
+                                                                                              jlong native,
+                                                                                              jintArray indices,
+                                                                                              jbooleanArray values,
+                                                                                              jbyteArray flags,
+                                                                                              jlongArray timestamps,
+                                                                                              jint count,
+                                                                                              jint mode)
+{
+    UpdateBatch<jboolean>(env, native, indices, values, flags, timestamps, count, mode,
+                          [](jboolean value, opendnp3::Flags flags, opendnp3::DNPTime time) {
+                              return opendnp3::BinaryOutputStatus(value != 0, flags, time);
+                          });
+}
+
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_update_1ao_1statuses_1native(JNIEnv* env,
+                                                                                              jobject /*unused*/,
+                                                                                              jlong native,
+                                                                                              jintArray indices,
+                                                                                              jdoubleArray values,
+                                                                                              jbyteArray flags,
+                                                                                              jlongArray timestamps,
+                                                                                              jint count,
+                                                                                              jint mode)
+{
+    UpdateBatch<jdouble>(env, native, indices, values, flags, timestamps, count, mode,
+                         [](jdouble value, opendnp3::Flags flags, opendnp3::DNPTime time) {
+                             return opendnp3::AnalogOutputStatus(value, flags, time);
+                         });
+}
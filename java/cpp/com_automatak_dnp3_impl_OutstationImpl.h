@@ -63,6 +63,54 @@ JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_destroy_1nati
 JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_apply_1native
   (JNIEnv *, jobject, jlong, jlong);
 
+/*
+ * Class:     com_automatak_dnp3_impl_OutstationImpl
+ * Method:    update_binaries_native
+ * Signature: (J[I[Z[B[JII)V
+ */
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_update_1binaries_1native
+  (JNIEnv *, jobject, jlong, jintArray, jbooleanArray, jbyteArray, jlongArray, jint, jint);
+
+/*
+ * Class:     com_automatak_dnp3_impl_OutstationImpl
+ * Method:    update_double_binaries_native
+ * Signature: (J[I[B[B[JII)V
+ */
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_update_1double_1binaries_1native
+  (JNIEnv *, jobject, jlong, jintArray, jbyteArray, jbyteArray, jlongArray, jint, jint);
+
+/*
+ * Class:     com_automatak_dnp3_impl_OutstationImpl
+ * Method:    update_analogs_native
+ * Signature: (J[I[D[B[JII)V
+ */
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_update_1analogs_1native
+  (JNIEnv *, jobject, jlong, jintArray, jdoubleArray, jbyteArray, jlongArray, jint, jint);
+
+/*
+ * Class:     com_automatak_dnp3_impl_OutstationImpl
+ * Method:    update_counters_native
+ * Signature: (J[I[J[B[JII)V
+ */
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_update_1counters_1native
+  (JNIEnv *, jobject, jlong, jintArray, jlongArray, jbyteArray, jlongArray, jint, jint);
+
+/*
+ * Class:     com_automatak_dnp3_impl_OutstationImpl
+ * Method:    update_bo_statuses_native
+ * Signature: (J[I[Z[B[JII)V
+ */
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_update_1bo_1statuses_1native
+  (JNIEnv *, jobject, jlong, jintArray, jbooleanArray, jbyteArray, jlongArray, jint, jint);
+
+/*
+ * Class:     com_automatak_dnp3_impl_OutstationImpl
+ * Method:    update_ao_statuses_native
+ * Signature: (J[I[D[B[JII)V
+ */
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_OutstationImpl_update_1ao_1statuses_1native
+  (JNIEnv *, jobject, jlong, jintArray, jdoubleArray, jbyteArray, jlongArray, jint, jint);
+
 #ifdef __cplusplus
 }
 #endif
@@ -48,6 +48,7 @@ namespace jni
     cache::BinaryInput JCache::BinaryInput;
     cache::BinaryOutputStatus JCache::BinaryOutputStatus;
     cache::BinaryOutputStatusConfig JCache::BinaryOutputStatusConfig;
+    cache::ByteBuffer JCache::ByteBuffer;
     cache::ChannelListener JCache::ChannelListener;
     cache::ChannelState JCache::ChannelState;
     cache::ChannelStatistics JCache::ChannelStatistics;
@@ -117,6 +118,7 @@ namespace jni
     cache::OutstationApplication JCache::OutstationApplication;
     cache::OutstationConfig JCache::OutstationConfig;
     cache::OutstationStackConfig JCache::OutstationStackConfig;
+    cache::PackedSOEHandler JCache::PackedSOEHandler;
     cache::ParserStatistics JCache::ParserStatistics;
     cache::PointClass JCache::PointClass;
     cache::QualifierCode JCache::QualifierCode;
@@ -161,6 +163,7 @@ namespace jni
         && BinaryInput.init(env)
         && BinaryOutputStatus.init(env)
         && BinaryOutputStatusConfig.init(env)
+        && ByteBuffer.init(env)
         && ChannelListener.init(env)
         && ChannelState.init(env)
         && ChannelStatistics.init(env)
@@ -230,6 +233,7 @@ namespace jni
         && OutstationApplication.init(env)
         && OutstationConfig.init(env)
         && OutstationStackConfig.init(env)
+        && PackedSOEHandler.init(env)
         && ParserStatistics.init(env)
         && PointClass.init(env)
         && QualifierCode.init(env)
@@ -276,6 +280,7 @@ namespace jni
         BinaryInput.cleanup(env);
         BinaryOutputStatus.cleanup(env);
         BinaryOutputStatusConfig.cleanup(env);
+        ByteBuffer.cleanup(env);
         ChannelListener.cleanup(env);
         ChannelState.cleanup(env);
         ChannelStatistics.cleanup(env);
@@ -345,6 +350,7 @@ namespace jni
         OutstationApplication.cleanup(env);
         OutstationConfig.cleanup(env);
         OutstationStackConfig.cleanup(env);
+        PackedSOEHandler.cleanup(env);
         ParserStatistics.cleanup(env);
         PointClass.cleanup(env);
         QualifierCode.cleanup(env);
@@ -49,6 +49,7 @@
 #include "JNIBinaryInput.h"
 #include "JNIBinaryOutputStatus.h"
 #include "JNIBinaryOutputStatusConfig.h"
+#include "JNIByteBuffer.h"
 #include "JNIChannelListener.h"
 #include "JNIChannelState.h"
 #include "JNIChannelStatistics.h"
@@ -118,6 +119,7 @@
 #include "JNIOutstationApplication.h"
 #include "JNIOutstationConfig.h"
 #include "JNIOutstationStackConfig.h"
+#include "JNIPackedSOEHandler.h"
 #include "JNIParserStatistics.h"
 #include "JNIPointClass.h"
 #include "JNIQualifierCode.h"
@@ -167,6 +169,7 @@ namespace jni
         static cache::BinaryInput BinaryInput;
         static cache::BinaryOutputStatus BinaryOutputStatus;
         static cache::BinaryOutputStatusConfig BinaryOutputStatusConfig;
+        static cache::ByteBuffer ByteBuffer;
         static cache::ChannelListener ChannelListener;
         static cache::ChannelState ChannelState;
         static cache::ChannelStatistics ChannelStatistics;
@@ -236,6 +239,7 @@ namespace jni
         static cache::OutstationApplication OutstationApplication;
         static cache::OutstationConfig OutstationConfig;
         static cache::OutstationStackConfig OutstationStackConfig;
+        static cache::PackedSOEHandler PackedSOEHandler;
         static cache::ParserStatistics ParserStatistics;
         static cache::PointClass PointClass;
         static cache::QualifierCode QualifierCode;
@@ -0,0 +1,133 @@
+//
+//  _   _         ______    _ _ _   _             _ _ _
+// | \ | |       |  ____|  | (_) | (_)           | | | |
+// |  \| | ___   | |__   __| |_| |_ _ _ __   __ _| | | |
+// | . ` |/ _ \  |  __| / _` | | __| | '_ \ / _` | | | |
+// | |\  | (_) | | |___| (_| | | |_| | | | | (_| |_|_|_|
+// |_| \_|\___/  |______\__,_|_|\__|_|_| |_|\__, (_|_|_)
+//                                           __/ |
+//                                          |___/
+// 
+// This file is auto-generated. Do not edit manually
+// 
+// Copyright 2013-2022 Step Function I/O, LLC
+// 
+// Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+// LLC (https://stepfunc.io) under one or more contributor license agreements.
+// See the NOTICE file distributed with this work for additional information
+// regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+// this file to you under the Apache License, Version 2.0 (the "License"); you
+// may not use this file except in compliance with the License. You may obtain
+// a copy of the License at:
+// 
+//   http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "JNIPackedSOEHandler.h"
+
+namespace jni
+{
+    namespace cache
+    {
+        bool PackedSOEHandler::init(JNIEnv* env)
+        {
+            auto clazzTemp = env->FindClass("Lcom/automatak/dnp3/PackedSOEHandler;");
+            if(!clazzTemp) return false;
+            this->clazz = (jclass) env->NewGlobalRef(clazzTemp);
+            env->DeleteLocalRef(clazzTemp);
+
+            this->method0 = env->GetMethodID(this->clazz, "beginFragment", "(Lcom/automatak/dnp3/ResponseInfo;)V");
+            if(!this->method0) return false;
+
+            this->method1 = env->GetMethodID(this->clazz, "endFragment", "(Lcom/automatak/dnp3/ResponseInfo;)V");
+            if(!this->method1) return false;
+
+            this->method2 = env->GetMethodID(this->clazz, "processAI", "(Lcom/automatak/dnp3/HeaderInfo;Ljava/nio/ByteBuffer;I)V");
+            if(!this->method2) return false;
+
+            this->method3 = env->GetMethodID(this->clazz, "processAOS", "(Lcom/automatak/dnp3/HeaderInfo;Ljava/nio/ByteBuffer;I)V");
+            if(!this->method3) return false;
+
+            this->method4 = env->GetMethodID(this->clazz, "processBI", "(Lcom/automatak/dnp3/HeaderInfo;Ljava/nio/ByteBuffer;I)V");
+            if(!this->method4) return false;
+
+            this->method5 = env->GetMethodID(this->clazz, "processBOS", "(Lcom/automatak/dnp3/HeaderInfo;Ljava/nio/ByteBuffer;I)V");
+            if(!this->method5) return false;
+
+            this->method6 = env->GetMethodID(this->clazz, "processC", "(Lcom/automatak/dnp3/HeaderInfo;Ljava/nio/ByteBuffer;I)V");
+            if(!this->method6) return false;
+
+            this->method7 = env->GetMethodID(this->clazz, "processDBI", "(Lcom/automatak/dnp3/HeaderInfo;Ljava/nio/ByteBuffer;I)V");
+            if(!this->method7) return false;
+
+            this->method8 = env->GetMethodID(this->clazz, "processDNPTime", "(Lcom/automatak/dnp3/HeaderInfo;Ljava/nio/ByteBuffer;I)V");
+            if(!this->method8) return false;
+
+            this->method9 = env->GetMethodID(this->clazz, "processFC", "(Lcom/automatak/dnp3/HeaderInfo;Ljava/nio/ByteBuffer;I)V");
+            if(!this->method9) return false;
+
+            return true;
+        }
+
+        void PackedSOEHandler::cleanup(JNIEnv* env)
+        {
+            env->DeleteGlobalRef(this->clazz);
+        }
+
+        void PackedSOEHandler::beginFragment(JNIEnv* env, JPackedSOEHandler instance, JResponseInfo arg0)
+        {
+            env->CallVoidMethod(instance, this->method0, arg0);
+        }
+
+        void PackedSOEHandler::endFragment(JNIEnv* env, JPackedSOEHandler instance, JResponseInfo arg0)
+        {
+            env->CallVoidMethod(instance, this->method1, arg0);
+        }
+
+        void PackedSOEHandler::processAI(JNIEnv* env, JPackedSOEHandler instance, JHeaderInfo arg0, JByteBuffer arg1, jint arg2)
+        {
+            env->CallVoidMethod(instance, this->method2, arg0, arg1, arg2);
+        }
+
+        void PackedSOEHandler::processAOS(JNIEnv* env, JPackedSOEHandler instance, JHeaderInfo arg0, JByteBuffer arg1, jint arg2)
+        {
+            env->CallVoidMethod(instance, this->method3, arg0, arg1, arg2);
+        }
+
+        void PackedSOEHandler::processBI(JNIEnv* env, JPackedSOEHandler instance, JHeaderInfo arg0, JByteBuffer arg1, jint arg2)
+        {
+            env->CallVoidMethod(instance, this->method4, arg0, arg1, arg2);
+        }
+
+        void PackedSOEHandler::processBOS(JNIEnv* env, JPackedSOEHandler instance, JHeaderInfo arg0, JByteBuffer arg1, jint arg2)
+        {
+            env->CallVoidMethod(instance, this->method5, arg0, arg1, arg2);
+        }
+
+        void PackedSOEHandler::processC(JNIEnv* env, JPackedSOEHandler instance, JHeaderInfo arg0, JByteBuffer arg1, jint arg2)
+        {
+            env->CallVoidMethod(instance, this->method6, arg0, arg1, arg2);
+        }
+
+        void PackedSOEHandler::processDBI(JNIEnv* env, JPackedSOEHandler instance, JHeaderInfo arg0, JByteBuffer arg1, jint arg2)
+        {
+            env->CallVoidMethod(instance, this->method7, arg0, arg1, arg2);
+        }
+
+        void PackedSOEHandler::processDNPTime(JNIEnv* env, JPackedSOEHandler instance, JHeaderInfo arg0, JByteBuffer arg1, jint arg2)
+        {
+            env->CallVoidMethod(instance, this->method8, arg0, arg1, arg2);
+        }
+
+        void PackedSOEHandler::processFC(JNIEnv* env, JPackedSOEHandler instance, JHeaderInfo arg0, JByteBuffer arg1, jint arg2)
+        {
+            env->CallVoidMethod(instance, this->method9, arg0, arg1, arg2);
+        }
+    }
+}
@@ -171,6 +171,15 @@ namespace jni
         jobject value;
     };
 
+    struct JByteBuffer
+    {
+        JByteBuffer(jobject value) : value(value) {}
+
+        operator jobject() const { return value; }
+
+        jobject value;
+    };
+
     struct JChannelListener
     {
         JChannelListener(jobject value) : value(value) {}
@@ -792,6 +801,15 @@ namespace jni
         jobject value;
     };
 
+    struct JPackedSOEHandler
+    {
+        JPackedSOEHandler(jobject value) : value(value) {}
+
+        operator jobject() const { return value; }
+
+        jobject value;
+    };
+
     struct JParserStatistics
     {
         JParserStatistics(jobject value) : value(value) {}